@@ -67,7 +67,7 @@ ro="-bench -rt -mpibind -save ${save}"
 
 RAJA_DIR=/usr/workspace/hypre/ext-libs/RAJA/nvcc10.1.243-sm_70-xl2021.03.11/
 co="--with-cuda --enable-debug --with-raja --with-raja-include=${RAJA_DIR}/include --with-raja-lib-dirs=${RAJA_DIR}/lib --with-raja-libs=RAJA --with-gpu-arch=70 --with-extra-CFLAGS=\\'-qmaxmem=-1 -qsuppress=1500-029\\' --with-extra-CXXFLAGS=\\'-qmaxmem=-1 -qsuppress=1500-029\\'"
-ro="-struct -rt -mpibind -save ${save}"
+ro="-struct-nohost -rt -mpibind -save ${save}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-cuda-nonum-raja
 
@@ -82,7 +82,7 @@ module load gcc/8.3.1
 module load cmake/3.16
 KOKKOS_DIR=/usr/workspace/hypre/ext-libs/Kokkos/nvcc10.1.243-sm_70-gcc8.3.1/
 co="--with-cuda --enable-debug --with-kokkos --with-kokkos-include=${KOKKOS_DIR}/include --with-kokkos-lib-dirs=${KOKKOS_DIR}/lib64 --with-kokkos-libs=kokkoscore --with-cxxstandard=14 --with-gpu-arch=70 CC=mpicc CXX=mpicxx"
-ro="-struct -rt -mpibind -save ${save}"
+ro="-struct-nohost -rt -mpibind -save ${save}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-cuda-nonum-kokkos
 
@@ -55,7 +55,7 @@ module -q load xl
 
 # CUDA with UM in debug mode [ij, ams, struct, sstruct]
 co="--with-cuda --enable-unified-memory --enable-persistent --enable-debug --with-gpu-arch=70 --with-memory-tracker --with-extra-CFLAGS=\\'-qsuppress=1500-029\\' --with-extra-CXXFLAGS=\\'-qsuppress=1500-029\\'"
-ro="-ij-gpu -ams -struct -sstruct -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
+ro="-ij-gpu -ams -struct-nohost -sstruct-nohost -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
 eo="-gpu -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro -eo: $eo
 ./renametest.sh basic $output_dir/basic-cuda-um
@@ -68,7 +68,7 @@ ro="-error -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
 
 # CUDA with UM and mixed-int
 co="--with-cuda --enable-unified-memory --enable-mixedint --enable-debug --with-gpu-arch=70 --with-extra-CFLAGS=\\'-qsuppress=1500-029\\' --with-extra-CXXFLAGS=\\'-qsuppress=1500-029\\'"
-ro="-ij-mixed -ams -struct -sstruct-mixed -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
+ro="-ij-mixed -ams -struct-nohost -sstruct-mixed -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-cuda-um-mixedint
 
@@ -91,7 +91,7 @@ ro="-single -rt -mpibind -save ${save}"
 
 # CUDA without UM with device memory pool [struct]
 co="--with-cuda --enable-device-memory-pool --with-gpu-arch=70 --with-extra-CFLAGS=\\'-qsuppress=1500-029\\' --with-extra-CXXFLAGS=\\'-qsuppress=1500-029\\'"
-ro="-struct -rt -mpibind -save ${save}"
+ro="-struct-nohost -rt -mpibind -save ${save}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-cuda-nonum
 
@@ -104,7 +104,7 @@ ro="-bench -rt -mpibind -save ${save}"
 
 # run on CPU
 co="--with-cuda --with-test-using-host --with-memory-tracker --enable-debug --with-gpu-arch=70"
-ro="-ij-noilu -ams -struct -sstruct -rt -mpibind -save lassen_cpu"
+ro="-ij-noilu -ams -struct-nohost -sstruct-nohost -rt -mpibind -save lassen_cpu"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-cuda-cpu
 
@@ -119,7 +119,7 @@ ro="-ij-noilu -ams -struct -sstruct -rt -mpibind -save lassen_cpu"
 
 # OMP 4.5 without UM in debug mode [struct]
 co="--with-device-openmp --enable-debug --with-gpu-arch=70 --with-extra-CFLAGS=\\'-qsuppress=1500-029\\' --with-extra-CXXFLAGS=\\'-qsuppress=1500-029\\'"
-ro="-struct -rt -mpibind -save ${save}"
+ro="-struct-nohost -rt -mpibind -save ${save}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-deviceomp-nonum-debug-struct
 
@@ -160,7 +160,7 @@ module -q load gcc/8.3.1
 module -q load cuda/12.0
 module list cuda/12.0 |& grep "None found"
 co="--with-cuda --enable-unified-memory --enable-thrust-nosync --enable-debug --with-gpu-arch=70 CC=mpicc CXX=mpicxx"
-ro="-ij-gpu -ams -struct -sstruct -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
+ro="-ij-gpu -ams -struct-nohost -sstruct-nohost -rt -mpibind -save ${save} -rtol ${rtol} -atol ${atol}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-cuda12_0
 
@@ -63,7 +63,7 @@ save="sunspot"
 # SYCL with UM in debug mode [ij, struct]
 # WM: I suppress all warnings for sycl files for now
 co="--enable-debug --with-sycl --enable-unified-memory CC=mpicc CXX=mpicxx --disable-fortran --with-extra-CFLAGS=\\'-Wno-unused-but-set-variable -Wno-unused-variable -Wno-builtin-macro-redefined -Rno-debug-disables-optimization\\' --with-extra-CUFLAGS=\\'-w\\' --with-MPI-include=${MPI_ROOT}/include --with-MPI-libs=mpi --with-MPI-lib-dirs=${MPI_ROOT}/lib"
-ro="-ij-gpu -struct -rt -save ${save} -script gpu_tile_compact.sh -rtol ${rtol} -atol ${atol}"
+ro="-ij-gpu -struct-nohost -rt -save ${save} -script gpu_tile_compact.sh -rtol ${rtol} -atol ${atol}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-sycl-um
 
@@ -81,7 +81,7 @@ co="--enable-bigint --with-sycl --enable-unified-memory CC=mpicc CXX=mpicxx --di
 # WM: todo
 # OMP 4.5 without UM in debug mode [struct]
 # co="--with-device-openmp --enable-debug --enable-fortran=no --with-extra-CXXFLAGS=\\'-Wno-missing-prototype-for-cc\\' --with-extra-CFLAGS=\\'-Wno-missing-prototype-for-cc\\' CC= CXX= --with-MPI-include=${MPI_ROOT}/include --with-MPI-libs=mpi --with-MPI-lib-dirs=${MPI_ROOT}/lib"
-# ro="-struct -rt -save ${save} -script gpu_tile_compact.sh"
+# ro="-struct-nohost -rt -save ${save} -script gpu_tile_compact.sh"
 # ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 # ./renametest.sh basic $output_dir/basic-deviceomp-nonum-debug-struct
 
@@ -92,7 +92,7 @@ co="--enable-bigint --with-sycl --enable-unified-memory CC=mpicc CXX=mpicxx --di
 # WM: todo
 # Kokkos without UM in debug mode [struct]
 # co="--with-device-openmp --with-kokkos --enable-debug --with-kokkos-include=$KOKKOS_HOME/include --with-kokkos-lib=$KOKKOS_HOME/lib64/libkokkoscore.a --with-cxxstandard=17 --with-extra-CXXFLAGS=\\'-fno-exceptions -D__STRICT_ANSI__\\' --enable-fortran=no CC= CXX= --with-MPI-include=${MPI_ROOT}/include --with-MPI-libs=mpi --with-MPI-lib-dirs=${MPI_ROOT}/lib"
-# ro="-struct -rt -save ${save} -script gpu_tile_compact.sh"
+# ro="-struct-nohost -rt -save ${save} -script gpu_tile_compact.sh"
 # ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 # ./renametest.sh basic $output_dir/basic-kokkos-nonum-debug-struct
 
@@ -53,7 +53,7 @@ module -q load rocm/5.2.0
 
 # HIP without UM [benchmark, struct, ams]
 co="--with-hip --with-MPI-include=${MPICH_DIR}/include --with-MPI-lib-dirs=${MPICH_DIR}/lib --with-MPI-libs=mpi --with-gpu-arch='gfx90a' CC=cc CXX=CC"
-ro="-ams -bench -struct -rt -save ${save}"
+ro="-ams -bench -struct-nohost -rt -save ${save}"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-hip-nonum
 
@@ -64,7 +64,7 @@ co="--with-hip --enable-unified-memory --enable-single --enable-debug --with-MPI
 
 # run on CPU
 co="--with-hip --with-test-using-host --with-memory-tracker --enable-debug --with-MPI-include=${MPICH_DIR}/include --with-MPI-lib-dirs=${MPICH_DIR}/lib --with-MPI-libs=mpi --with-gpu-arch='gfx90a' CC=cc CXX=CC"
-ro="-ij-noilu -ams -struct -sstruct -rt -D HYPRE_NO_SAVED"
+ro="-ij-noilu -ams -struct-nohost -sstruct-nohost -rt -D HYPRE_NO_SAVED"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh basic $output_dir/basic-hip-cpu
 
@@ -45,6 +45,9 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixAssemblyMode(ijmatrix)   = 0;
+   hypre_IJMatrixPattern(ijmatrix)        = NULL;
+   hypre_IJMatrixExchangeGraph(ijmatrix)  = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -156,6 +159,9 @@ HYPRE_IJMatrixPartialClone( HYPRE_IJMatrix  matrix_in,
    hypre_IJMatrixAssembleFlag(ijmatrix_out)       = 0;
    hypre_IJMatrixPrintLevel(ijmatrix_out)         = hypre_IJMatrixPrintLevel(ijmatrix_in);
    hypre_IJMatrixOMPFlag(ijmatrix_out)            = hypre_IJMatrixOMPFlag(ijmatrix_in);
+   hypre_IJMatrixAssemblyMode(ijmatrix_out)       = hypre_IJMatrixAssemblyMode(ijmatrix_in);
+   hypre_IJMatrixPattern(ijmatrix_out)            = NULL;
+   hypre_IJMatrixExchangeGraph(ijmatrix_out)      = NULL;
    hypre_IJMatrixGlobalFirstRow(ijmatrix_out)     = hypre_IJMatrixGlobalFirstRow(ijmatrix_in);
    hypre_IJMatrixGlobalFirstCol(ijmatrix_out)     = hypre_IJMatrixGlobalFirstCol(ijmatrix_in);
    hypre_IJMatrixGlobalNumRows(ijmatrix_out)      = hypre_IJMatrixGlobalNumRows(ijmatrix_in);
@@ -190,6 +196,7 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
       {
          hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJMatrixAssumedPart(ijmatrix));
       }
+      hypre_DataExchangeGraphDestroy(hypre_IJMatrixExchangeGraph(ijmatrix));
       if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
       {
          hypre_IJMatrixDestroyParCSR( ijmatrix );
@@ -475,6 +482,13 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
    }
    else
 #endif
+   if (hypre_IJMatrixAssemblyMode(ijmatrix) > 0)
+   {
+      /* may be called concurrently from several threads, so return right away */
+      return hypre_IJMatrixSetAddValuesParCSRStash(ijmatrix, nrows, ncols, rows, row_indexes, cols,
+                                                   values, "set");
+   }
+   else
    {
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
@@ -685,6 +699,13 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    }
    else
 #endif
+   if (hypre_IJMatrixAssemblyMode(ijmatrix) > 0)
+   {
+      /* may be called concurrently from several threads, so return right away */
+      return hypre_IJMatrixSetAddValuesParCSRStash(ijmatrix, nrows, ncols, rows, row_indexes, cols,
+                                                   values, "add");
+   }
+   else
    {
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
@@ -755,6 +776,11 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
       }
       else
 #endif
+      if (hypre_IJMatrixAssemblyMode(ijmatrix) > 0)
+      {
+         hypre_IJMatrixAssembleParCSRStash(ijmatrix);
+      }
+      else
       {
          hypre_IJMatrixAssembleParCSR(ijmatrix);
       }
@@ -1296,7 +1322,8 @@ HYPRE_IJMatrixReadBinary( const char     *filename,
  * HYPRE_IJMatrixReadMM
  *
  * Reads matrix-market data from file in ASCII format and creates an
- * IJMatrix on host memory.
+ * IJMatrix on host memory. ParCSR matrices are read in parallel, with the
+ * rows distributed uniformly among the processes.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -1305,7 +1332,14 @@ HYPRE_IJMatrixReadMM( const char     *filename,
                       HYPRE_Int       type,
                       HYPRE_IJMatrix *matrix_ptr )
 {
-   hypre_IJMatrixRead(filename, comm, type, matrix_ptr, 1);
+   if (type == HYPRE_PARCSR)
+   {
+      hypre_IJMatrixReadMMParCSR(filename, comm, matrix_ptr);
+   }
+   else
+   {
+      hypre_IJMatrixRead(filename, comm, type, matrix_ptr, 1);
+   }
 
    return hypre_error_flag;
 }
@@ -1387,6 +1421,33 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetAssemblyMode
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetAssemblyMode( HYPRE_IJMatrix matrix,
+                               HYPRE_Int      mode )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (mode < 0 || mode > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixAssemblyMode(ijmatrix) = mode;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixTranspose
  *--------------------------------------------------------------------------*/
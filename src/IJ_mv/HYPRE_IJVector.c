@@ -77,6 +77,7 @@ HYPRE_IJVectorCreate( MPI_Comm        comm,
    hypre_IJVectorObject(vec)          = NULL;
    hypre_IJVectorTranslator(vec)      = NULL;
    hypre_IJVectorAssumedPart(vec)     = NULL;
+   hypre_IJVectorExchangeGraph(vec)   = NULL;
    hypre_IJVectorPrintLevel(vec)      = 0;
    hypre_IJVectorPartitioning(vec)[0] = jlower;
    hypre_IJVectorPartitioning(vec)[1] = jupper + 1;
@@ -161,6 +162,7 @@ HYPRE_IJVectorDestroy( HYPRE_IJVector vector )
    {
       hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJVectorAssumedPart(vec));
    }
+   hypre_DataExchangeGraphDestroy(hypre_IJVectorExchangeGraph(vec));
 
    if ( hypre_IJVectorObjectType(vec) == HYPRE_PARCSR )
    {
@@ -150,6 +150,10 @@ HYPRE_Int HYPRE_IJMatrixSetConstantValues(HYPRE_IJMatrix matrix,
  * and is only efficient if a large number of rows is added in one call
  * to HYPRE_IJMatrixAddToValues.
  *
+ * If the assembly mode is 1 or 2 (see \ref HYPRE_IJMatrixSetAssemblyMode),
+ * this function can be called concurrently by the threads of an OpenMP
+ * parallel region.
+ *
  * Not collective.
  *
  **/
@@ -370,6 +374,49 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) Selects the algorithm used to assemble a matrix on the host.
+ * Options for \e mode are:
+ *
+ *    - 0 : insert values into per-row auxiliary arrays (default)
+ *    - 1 : append values to a coordinate (COO) stash and build the matrix
+ *          with a parallel sort and reduction in HYPRE_IJMatrixAssemble
+ *    - 2 : as 1, but reuse the assembly pattern when the same sequence of
+ *          entries is assembled again
+ *
+ * Mode 1 makes HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues
+ * constant cost per entry and moves all the work to the assembly phase,
+ * where it is threaded. The semantics of repeated Set and AddTo calls are
+ * the same as for the device assembly: the last set value of an entry wins
+ * and later additions accumulate on top of it. Setting values on other
+ * processors follows the rules described in HYPRE_IJMatrixSetValues.
+ * Entries that are set or added after the matrix has been assembled must
+ * be part of its sparsity pattern. This option has no effect when the
+ * matrix lives in device memory.
+ *
+ * With mode 2, the first assembly records where each stashed entry goes in
+ * the ParCSR matrix and which values are exchanged with other processors.
+ * A later assembly in which every processor passed the same rows and
+ * columns, in the same order and from the same threads, only reduces the
+ * values into the matrix and exchanges them with persistent point-to-point
+ * messages; otherwise, the full assembly is done and a new pattern is
+ * recorded. The pattern is kept until the matrix is destroyed and takes
+ * memory proportional to the number of stashed entries.
+ *
+ * With modes 1 and 2, HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues are
+ * thread safe: they may be called concurrently by the threads of an OpenMP
+ * parallel region (e.g., inside a threaded finite element loop). Each
+ * thread collects its values in a private stash; the stashes are merged in
+ * HYPRE_IJMatrixAssemble, which must be called outside of the parallel
+ * region. The parallel region must not use more threads than were available
+ * when the matrix was initialized, and the order in which different threads
+ * set the same entry is not defined.
+ *
+ * Must be called before HYPRE_IJMatrixInitialize. Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetAssemblyMode(HYPRE_IJMatrix matrix,
+                                        HYPRE_Int      mode);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
@@ -379,7 +426,11 @@ HYPRE_Int HYPRE_IJMatrixRead(const char     *filename,
                              HYPRE_IJMatrix *matrix);
 
 /**
- * Read the matrix from MM file.  This is mainly for debugging purposes.
+ * Read the matrix from a Matrix Market file.  For \c HYPRE_PARCSR, every
+ * process parses a part of the file and the rows and columns are distributed
+ * uniformly among the processes.  Real, integer and pattern coordinate files
+ * with general, symmetric or skew-symmetric storage are supported, and
+ * duplicate entries are summed.
  **/
 HYPRE_Int HYPRE_IJMatrixReadMM(const char     *filename,
                                MPI_Comm        comm,
@@ -285,12 +285,19 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
 
+      /* COO stash assembly: one stash per thread replaces the row arrays */
+      if (hypre_IJMatrixAssemblyMode(matrix) > 0 && memory_location_aux == HYPRE_MEMORY_HOST)
+      {
+         hypre_AuxParCSRMatrixNumStashes(aux_matrix) = hypre_NumThreads();
+      }
+
       hypre_ParCSRMatrixInitialize_v2(par_matrix, memory_location);
       hypre_AuxParCSRMatrixInitialize_v2(aux_matrix, memory_location_aux);
 
 #if defined(HYPRE_USING_GPU)
       if (hypre_GetExecPolicy1(memory_location_aux) == HYPRE_EXEC_HOST)
 #endif
+      if (!hypre_AuxParCSRMatrixNumStashes(aux_matrix))
       {
          if (hypre_AuxParCSRMatrixDiagSizes(aux_matrix))
          {
@@ -315,7 +322,7 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          }
       }
 
-      if (!hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      if (!hypre_AuxParCSRMatrixNeedAux(aux_matrix) && !hypre_AuxParCSRMatrixNumStashes(aux_matrix))
       {
 #ifdef HYPRE_USING_OPENMP
          #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
@@ -338,6 +345,11 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
                                      hypre_ParCSRMatrixNumCols(par_matrix), NULL);
          hypre_AuxParCSRMatrixMemoryLocation(aux_matrix) = HYPRE_MEMORY_HOST;
          hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
+         if (hypre_IJMatrixAssemblyMode(matrix) > 0)
+         {
+            hypre_AuxParCSRMatrixNumStashes(aux_matrix) = hypre_NumThreads();
+            hypre_AuxParCSRMatrixInitializeStashes(aux_matrix);
+         }
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
    }
@@ -1645,10 +1657,12 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
 {
    hypre_ParCSRMatrixDestroy((hypre_ParCSRMatrix *)hypre_IJMatrixObject(matrix));
    hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix*)hypre_IJMatrixTranslator(matrix));
+   hypre_AuxParCSRPatternDestroy((hypre_AuxParCSRPattern*)hypre_IJMatrixPattern(matrix));
 
    /* Reset pointers to NULL */
    hypre_IJMatrixObject(matrix)     = NULL;
    hypre_IJMatrixTranslator(matrix) = NULL;
+   hypre_IJMatrixPattern(matrix)    = NULL;
 
    return hypre_error_flag;
 }
@@ -1675,6 +1689,8 @@ hypre_IJMatrixTransposeParCSR( hypre_IJMatrix  *matrix_A,
       hypre_ParCSRMatrixDestroy(par_AT);
       hypre_IJMatrixObject(matrix_AT) = NULL;
    }
+   hypre_AuxParCSRPatternDestroy((hypre_AuxParCSRPattern*) hypre_IJMatrixPattern(matrix_AT));
+   hypre_IJMatrixPattern(matrix_AT) = NULL;
 
    hypre_ParCSRMatrixTranspose(par_A, &par_AT, 1);
    hypre_ParCSRMatrixSetNumNonzeros(par_AT);
@@ -1734,6 +1750,8 @@ hypre_IJMatrixAddParCSR( HYPRE_Complex    alpha,
       hypre_ParCSRMatrixDestroy(par_C);
       hypre_IJMatrixObject(matrix_C) = NULL;
    }
+   hypre_AuxParCSRPatternDestroy((hypre_AuxParCSRPattern*) hypre_IJMatrixPattern(matrix_C));
+   hypre_IJMatrixPattern(matrix_C) = NULL;
 
    hypre_ParCSRMatrixAdd(alpha, par_A, beta, par_B, &par_C);
    hypre_ParCSRMatrixSetNumNonzeros(par_C);
@@ -1805,6 +1823,9 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int *num_rows_per_proc = NULL, *num_elements_total = NULL;
    HYPRE_Int *argsort_contact_procs = NULL;
 
+   /* the stash assembly with pattern reuse records the exchange */
+   hypre_AuxParCSRPattern *pattern = NULL;
+
    HYPRE_Int  obj_size_bytes, complex_size;
    HYPRE_BigInt big_int_size;
    HYPRE_Int  tmp_int;
@@ -2185,6 +2206,18 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
    hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
 
+   if (memory_location == HYPRE_MEMORY_HOST && hypre_IJMatrixAssemblyMode(matrix) == 2)
+   {
+      pattern = (hypre_AuxParCSRPattern *) hypre_IJMatrixPattern(matrix);
+   }
+   if (pattern)
+   {
+      /* keep the owner of each row */
+      pattern -> num_off_rows  = num_rows;
+      pattern -> off_row_procs = us_real_proc_id;
+      us_real_proc_id = NULL;
+   }
+
    hypre_TFree(us_real_proc_id, HYPRE_MEMORY_HOST);
    hypre_TFree(orig_order, HYPRE_MEMORY_HOST);
    hypre_TFree(row_list, HYPRE_MEMORY_HOST);
@@ -2210,29 +2243,42 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
    /*build the response object*/
 
-   /* use the send_proc_obj for the info kept from contacts */
-   /*estimate inital storage allocation */
-   send_proc_obj.length = 0;
-   send_proc_obj.storage_length = num_real_procs + 5;
-   send_proc_obj.id =
-      hypre_CTAlloc(HYPRE_Int,  send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
-   send_proc_obj.vec_starts =
-      hypre_CTAlloc(HYPRE_Int,  send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
-   send_proc_obj.vec_starts[0] = 0;
-   send_proc_obj.element_storage_length = storage + 20;
-   send_proc_obj.v_elements =
-      hypre_TAlloc(char, obj_size_bytes * send_proc_obj.element_storage_length, HYPRE_MEMORY_HOST);
-
-   response_obj2.fill_response = hypre_FillResponseIJOffProcVals;
-   response_obj2.data1 = NULL;
-   response_obj2.data2 = &send_proc_obj;
-
-   max_response_size = 0;
-
-   hypre_DataExchangeList(num_real_procs, ex_contact_procs,
-                          void_contact_buf, ex_contact_vec_starts, obj_size_bytes,
-                          0, &response_obj2, max_response_size, 2,
-                          comm,  (void **) &response_buf, &response_buf_starts);
+   if (hypre_HandleUseNeighborColl(hypre_handle()))
+   {
+      /* the destinations are known now, so the sizes and the data can be
+         exchanged with neighborhood collectives */
+      hypre_DataExchangeNeighborList(num_real_procs, ex_contact_procs,
+                                     void_contact_buf, ex_contact_vec_starts, obj_size_bytes,
+                                     comm, &hypre_IJMatrixExchangeGraph(matrix),
+                                     &send_proc_obj.length, &send_proc_obj.id,
+                                     &send_proc_obj.vec_starts, &send_proc_obj.v_elements);
+   }
+   else
+   {
+      /* use the send_proc_obj for the info kept from contacts */
+      /*estimate inital storage allocation */
+      send_proc_obj.length = 0;
+      send_proc_obj.storage_length = num_real_procs + 5;
+      send_proc_obj.id =
+         hypre_CTAlloc(HYPRE_Int,  send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
+      send_proc_obj.vec_starts =
+         hypre_CTAlloc(HYPRE_Int,  send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
+      send_proc_obj.vec_starts[0] = 0;
+      send_proc_obj.element_storage_length = storage + 20;
+      send_proc_obj.v_elements =
+         hypre_TAlloc(char, obj_size_bytes * send_proc_obj.element_storage_length, HYPRE_MEMORY_HOST);
+
+      response_obj2.fill_response = hypre_FillResponseIJOffProcVals;
+      response_obj2.data1 = NULL;
+      response_obj2.data2 = &send_proc_obj;
+
+      max_response_size = 0;
+
+      hypre_DataExchangeList(num_real_procs, ex_contact_procs,
+                             void_contact_buf, ex_contact_vec_starts, obj_size_bytes,
+                             0, &response_obj2, max_response_size, 2,
+                             comm,  (void **) &response_buf, &response_buf_starts);
+   }
 
    hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
    hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
@@ -2259,6 +2305,15 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    recv_data_ptr = send_proc_obj.v_elements;
    recv_starts = send_proc_obj.vec_starts;
 
+   if (pattern)
+   {
+      pattern -> num_recvs   = num_recvs;
+      pattern -> recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      pattern -> recv_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(pattern -> recv_procs, send_proc_obj.id, HYPRE_Int, num_recvs,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
    for (i = 0; i < num_recvs; i++)
    {
 
@@ -2330,7 +2385,19 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
          }
 
-         if (memory_location == HYPRE_MEMORY_HOST)
+         if (memory_location == HYPRE_MEMORY_HOST && hypre_IJMatrixAssemblyMode(matrix) > 0)
+         {
+            hypre_AuxParCSRMatrix *aux_matrix =
+               (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+
+            hypre_AuxParCSRStashAppend(hypre_AuxParCSRMatrixRecvStash(aux_matrix), 1, &num_elements,
+                                       &row, &row_index, col_ptr, col_data_ptr, 0);
+            if (pattern)
+            {
+               pattern -> recv_starts[i + 1] += num_elements;
+            }
+         }
+         else if (memory_location == HYPRE_MEMORY_HOST)
          {
             hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
          }
@@ -0,0 +1,861 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Parallel Matrix Market reader for IJMatrix_ParCSR
+ *
+ * Every process parses a contiguous byte range of the file, routes the
+ * resulting triplets to the processes that own their rows in the assumed
+ * (uniform) partitioning, and builds its local ParCSR blocks directly,
+ * without going through the IJ auxiliary matrix.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "../HYPRE.h"
+
+#include <locale.h>
+
+/* 64-bit file offsets, so that byte ranges past 2 GB can be addressed */
+#if defined(_WIN32)
+#define hypre_mm_fseek _fseeki64
+#define hypre_mm_ftell _ftelli64
+typedef __int64 hypre_mm_off_t;
+#else
+#define hypre_mm_fseek fseeko
+#define hypre_mm_ftell ftello
+typedef off_t hypre_mm_off_t;
+#endif
+
+/* Exact powers of ten used by the fast path of the number parser */
+static const HYPRE_Real hypre_mm_pow10[] =
+{
+   1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* Longest number handed to strtod by the slow path of the number parser */
+#define HYPRE_MM_MAX_NUMBER_LENGTH 128
+
+/* A number must be followed by a blank, the end of the line or the end of
+ * the buffer */
+#define hypre_MMIsDelimiter(c) \
+   ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\n' || (c) == '\0')
+
+/*--------------------------------------------------------------------------
+ * hypre_MMParseBigInt
+ *
+ * Parses a non-negative decimal integer starting at p (after blanks).
+ * Returns the position following the number, or NULL on error, including
+ * when the number is not followed by a blank or the end of the line.
+ *--------------------------------------------------------------------------*/
+
+static const char *
+hypre_MMParseBigInt( const char   *p,
+                     HYPRE_BigInt *value )
+{
+   HYPRE_BigInt v = 0;
+
+   while (*p == ' ' || *p == '\t')
+   {
+      p++;
+   }
+
+   if (*p < '0' || *p > '9')
+   {
+      return NULL;
+   }
+
+   while (*p >= '0' && *p <= '9')
+   {
+      v = 10 * v + (HYPRE_BigInt) (*p - '0');
+      p++;
+   }
+   if (!hypre_MMIsDelimiter(*p))
+   {
+      return NULL;
+   }
+   *value = v;
+
+   return p;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MMParseReal
+ *
+ * Locale-independent floating point parser. Numbers with at most 15
+ * significant digits and a decimal exponent of at most 22 in magnitude
+ * (which covers virtually all Matrix Market files) are converted exactly
+ * with a single multiplication or division. Other numbers are converted by
+ * strtod, after the decimal point has been replaced by the one of the
+ * current locale and the Fortran exponent marker by 'e', so that the result
+ * does not depend on the locale either. Only decimal numbers are accepted
+ * (no inf, nan or hexadecimal), and they must be followed by a blank or the
+ * end of the line. Returns the position following the number, or NULL on
+ * error.
+ *--------------------------------------------------------------------------*/
+
+static const char *
+hypre_MMParseReal( const char *p,
+                   HYPRE_Real *value )
+{
+   const char   *start;
+   char          buf[HYPRE_MM_MAX_NUMBER_LENGTH];
+   char         *end;
+   char          point;
+   size_t        k, len;
+   hypre_uint64  mantissa = 0;
+   HYPRE_Int     ndigits = 0, exp10 = 0, e = 0;
+   HYPRE_Int     neg = 0, eneg = 0, has_digits = 0;
+   double        v;
+
+   while (*p == ' ' || *p == '\t')
+   {
+      p++;
+   }
+   start = p;
+
+   if (*p == '-' || *p == '+')
+   {
+      neg = (*p == '-');
+      p++;
+   }
+
+   /* Integer part */
+   for (; *p >= '0' && *p <= '9'; p++)
+   {
+      has_digits = 1;
+      if (ndigits < 19)
+      {
+         mantissa = 10 * mantissa + (hypre_uint64) (*p - '0');
+         ndigits += (mantissa > 0);
+      }
+      else
+      {
+         ndigits++;
+         exp10++;
+      }
+   }
+
+   /* Fractional part */
+   if (*p == '.')
+   {
+      for (p++; *p >= '0' && *p <= '9'; p++)
+      {
+         has_digits = 1;
+         if (ndigits < 19)
+         {
+            mantissa = 10 * mantissa + (hypre_uint64) (*p - '0');
+            ndigits += (mantissa > 0);
+            exp10--;
+         }
+         else
+         {
+            ndigits++;
+         }
+      }
+   }
+
+   if (!has_digits)
+   {
+      return NULL;
+   }
+
+   /* Exponent, including the Fortran 'd' notation */
+   if (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D')
+   {
+      const char *q = p + 1;
+
+      if (*q == '-' || *q == '+')
+      {
+         eneg = (*q == '-');
+         q++;
+      }
+      if (*q < '0' || *q > '9')
+      {
+         return NULL;
+      }
+      for (; *q >= '0' && *q <= '9'; q++)
+      {
+         if (e < 100000)
+         {
+            e = 10 * e + (*q - '0');
+         }
+      }
+      exp10 += eneg ? -e : e;
+      p = q;
+   }
+
+   if (!hypre_MMIsDelimiter(*p))
+   {
+      return NULL;
+   }
+
+   if (ndigits <= 15 && exp10 >= -22 && exp10 <= 22)
+   {
+      v = (double) mantissa;
+      v = (exp10 < 0) ? v / hypre_mm_pow10[-exp10] : v * hypre_mm_pow10[exp10];
+      *value = (HYPRE_Real) (neg ? -v : v);
+   }
+   else
+   {
+      len = (size_t) (p - start);
+      if (len >= HYPRE_MM_MAX_NUMBER_LENGTH)
+      {
+         return NULL;
+      }
+
+      point = localeconv()->decimal_point[0];
+      for (k = 0; k < len; k++)
+      {
+         switch (start[k])
+         {
+            case '.':
+               buf[k] = point;
+               break;
+
+            case 'd':
+            case 'D':
+               buf[k] = 'e';
+               break;
+
+            default:
+               buf[k] = start[k];
+         }
+      }
+      buf[len] = '\0';
+
+      v = strtod(buf, &end);
+      if (end != buf + len)
+      {
+         return NULL;
+      }
+      *value = (HYPRE_Real) v;
+   }
+
+   return p;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMMHeader
+ *
+ * Reads the banner and the size line on the calling process. Returns a
+ * nonzero error code if the file cannot be read or is not supported.
+ * info = {num_rows, num_cols, num_entries, data offset, file size}.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixReadMMHeader( const char   *filename,
+                            MM_typecode  *matcode,
+                            HYPRE_BigInt *info )
+{
+   FILE      *file;
+   HYPRE_Int  nrow, ncol, nnz;
+
+   if ((file = fopen(filename, "r")) == NULL)
+   {
+      return MM_COULD_NOT_READ_FILE;
+   }
+
+   if (hypre_mm_read_banner(file, matcode) != 0 ||
+       !hypre_mm_is_valid(*matcode) ||
+       !hypre_mm_is_coordinate(*matcode) ||
+       hypre_mm_is_complex(*matcode) ||
+       hypre_mm_is_hermitian(*matcode))
+   {
+      fclose(file);
+      return MM_UNSUPPORTED_TYPE;
+   }
+
+   if (hypre_mm_read_mtx_crd_size(file, &nrow, &ncol, &nnz) != 0)
+   {
+      fclose(file);
+      return MM_PREMATURE_EOF;
+   }
+
+   info[0] = (HYPRE_BigInt) nrow;
+   info[1] = (HYPRE_BigInt) ncol;
+   info[2] = (HYPRE_BigInt) nnz;
+   info[3] = (HYPRE_BigInt) hypre_mm_ftell(file);
+   hypre_mm_fseek(file, 0, SEEK_END);
+   info[4] = (HYPRE_BigInt) hypre_mm_ftell(file);
+
+   fclose(file);
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMMRange
+ *
+ * Reads the bytes [begin, end) of the file, preceded by the byte at
+ * begin - 1 (when begin > data_start) and followed by the remainder of the
+ * last line. The lines that start inside [begin, end) are parsed into
+ * triplets with zero-based indices; for symmetric and skew-symmetric
+ * matrices, the transposed entries are generated as well.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixReadMMRange( const char      *filename,
+                           MM_typecode      matcode,
+                           HYPRE_BigInt     data_start,
+                           HYPRE_BigInt     begin,
+                           HYPRE_BigInt     end,
+                           HYPRE_Int       *num_entries_ptr,
+                           HYPRE_BigInt   **rows_ptr,
+                           HYPRE_BigInt   **cols_ptr,
+                           HYPRE_Complex  **vals_ptr )
+{
+   HYPRE_Int       is_pattern = hypre_mm_is_pattern(matcode);
+   HYPRE_Int       mirror     = hypre_mm_is_symmetric(matcode) || hypre_mm_is_skew(matcode);
+   HYPRE_Real      sign       = hypre_mm_is_skew(matcode) ? -1.0 : 1.0;
+
+   FILE           *file;
+   char           *buf;
+   const char     *p, *limit, *buf_end;
+   size_t          lookbehind, nbytes, capacity, n;
+   HYPRE_Int       c, ierr = 0;
+
+   HYPRE_Int       num_entries = 0, max_entries;
+   HYPRE_BigInt   *rows, *cols;
+   HYPRE_Complex  *vals;
+   HYPRE_BigInt    I, J;
+   HYPRE_Real      value;
+
+   *num_entries_ptr = 0;
+   *rows_ptr = NULL;
+   *cols_ptr = NULL;
+   *vals_ptr = NULL;
+
+   if (end <= begin)
+   {
+      return 0;
+   }
+
+   if ((file = fopen(filename, "r")) == NULL)
+   {
+      return MM_COULD_NOT_READ_FILE;
+   }
+
+   lookbehind = (begin > data_start) ? 1 : 0;
+   nbytes     = (size_t) (end - begin) + lookbehind;
+   capacity   = nbytes + MM_MAX_LINE_LENGTH;
+   buf        = hypre_TAlloc(char, capacity + 1, HYPRE_MEMORY_HOST);
+
+   hypre_mm_fseek(file, (hypre_mm_off_t) (begin - (HYPRE_BigInt) lookbehind), SEEK_SET);
+   n = fread(buf, 1, nbytes, file);
+
+   /* Complete the last line, which may extend into the next range */
+   while (n > 0 && buf[n - 1] != '\n' && (c = fgetc(file)) != EOF)
+   {
+      if (n == capacity)
+      {
+         capacity *= 2;
+         buf = hypre_TReAlloc(buf, char, capacity + 1, HYPRE_MEMORY_HOST);
+      }
+      buf[n++] = (char) c;
+   }
+   buf[n] = '\0';
+   fclose(file);
+
+   buf_end = buf + n;
+   limit   = buf + hypre_min(n, nbytes);
+   p       = buf + lookbehind;
+
+   /* A line that straddles begin belongs to the previous range */
+   if (lookbehind && buf[0] != '\n')
+   {
+      while (p < buf_end && *p != '\n')
+      {
+         p++;
+      }
+      p++;
+   }
+
+   /* Estimate the number of entries from the number of bytes */
+   max_entries = (HYPRE_Int) ((end - begin) / 16) + 16;
+   max_entries *= mirror ? 2 : 1;
+   rows = hypre_TAlloc(HYPRE_BigInt,  max_entries, HYPRE_MEMORY_HOST);
+   cols = hypre_TAlloc(HYPRE_BigInt,  max_entries, HYPRE_MEMORY_HOST);
+   vals = hypre_TAlloc(HYPRE_Complex, max_entries, HYPRE_MEMORY_HOST);
+
+   while (p < limit)
+   {
+      const char *q = p;
+
+      while (*q == ' ' || *q == '\t')
+      {
+         q++;
+      }
+
+      /* Skip blank and comment lines */
+      if (*q != '\n' && *q != '\r' && *q != '%' && *q != '\0')
+      {
+         q = hypre_MMParseBigInt(q, &I);
+         if (q)
+         {
+            q = hypre_MMParseBigInt(q, &J);
+         }
+         if (q && !is_pattern)
+         {
+            q = hypre_MMParseReal(q, &value);
+         }
+         else
+         {
+            value = 1.0;
+         }
+         if (!q || I < 1 || J < 1)
+         {
+            ierr = MM_PREMATURE_EOF;
+            break;
+         }
+
+         if (num_entries + 2 > max_entries)
+         {
+            max_entries = 2 * max_entries;
+            rows = hypre_TReAlloc(rows, HYPRE_BigInt,  max_entries, HYPRE_MEMORY_HOST);
+            cols = hypre_TReAlloc(cols, HYPRE_BigInt,  max_entries, HYPRE_MEMORY_HOST);
+            vals = hypre_TReAlloc(vals, HYPRE_Complex, max_entries, HYPRE_MEMORY_HOST);
+         }
+
+         rows[num_entries] = I - 1;
+         cols[num_entries] = J - 1;
+         vals[num_entries] = (HYPRE_Complex) value;
+         num_entries++;
+
+         if (mirror && I != J)
+         {
+            rows[num_entries] = J - 1;
+            cols[num_entries] = I - 1;
+            vals[num_entries] = (HYPRE_Complex) (sign * value);
+            num_entries++;
+         }
+      }
+
+      /* Advance to the next line */
+      while (p < buf_end && *p != '\n')
+      {
+         p++;
+      }
+      p++;
+   }
+
+   hypre_TFree(buf, HYPRE_MEMORY_HOST);
+
+   *num_entries_ptr = num_entries;
+   *rows_ptr = rows;
+   *cols_ptr = cols;
+   *vals_ptr = vals;
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMMParCSR
+ *
+ * Reads a matrix from a Matrix Market file in parallel and returns an
+ * assembled IJMatrix stored on host memory. The rows and columns are
+ * distributed uniformly among the processes. Real, integer and pattern
+ * coordinate files with general, symmetric or skew-symmetric storage are
+ * supported. Duplicate entries are summed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixReadMMParCSR( const char     *filename,
+                            MPI_Comm        comm,
+                            HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix               matrix;
+   hypre_ParCSRMatrix          *par_matrix;
+   hypre_CSRMatrix             *diag, *offd;
+   MM_typecode                  matcode;
+   HYPRE_BigInt                 info[5];
+   HYPRE_Int                    myid, num_procs, ierr, global_ierr;
+
+   HYPRE_BigInt                 global_num_rows, global_num_cols;
+   HYPRE_BigInt                 row_starts[2], col_starts[2], range[2];
+   HYPRE_Int                    num_rows;
+
+   HYPRE_Int                    num_entries;
+   HYPRE_BigInt                *rows, *cols;
+   HYPRE_Complex               *vals;
+
+   /* Routing of the triplets */
+   HYPRE_Int                   *proc_counts, *proc_starts, *owner;
+   HYPRE_Int                    num_contacts, num_local, num_recvs;
+   HYPRE_Int                   *contact_procs, *contact_starts;
+   void                        *contact_buf, *index_ptr;
+   HYPRE_Int                    obj_size_bytes;
+   hypre_DataExchangeResponse   response_obj;
+   hypre_ProcListElements       send_proc_obj;
+   HYPRE_Int                   *response_buf_starts = NULL;
+   void                        *response_buf = NULL;
+
+   /* Local assembly */
+   HYPRE_Int                    total, pos;
+   HYPRE_BigInt                *l_cols, *big_offd_j, *col_map_offd;
+   HYPRE_Complex               *l_vals;
+   HYPRE_Int                   *row_ptr, *perm;
+   HYPRE_Int                   *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex               *diag_data, *offd_data;
+   HYPRE_Int                    diag_nnz, offd_nnz, num_cols_offd;
+   HYPRE_BigInt                 col;
+   HYPRE_Complex                val;
+   HYPRE_Int                    i, j, k, p, lr, proc;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /*-----------------------------------------------------------------
+    * Read the header on the first process and broadcast it
+    *-----------------------------------------------------------------*/
+
+   ierr = 0;
+   if (myid == 0)
+   {
+      ierr = hypre_IJMatrixReadMMHeader(filename, &matcode, info);
+   }
+   hypre_MPI_Bcast(&ierr, 1, HYPRE_MPI_INT, 0, comm);
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Could not read a supported Matrix Market coordinate file!");
+      return hypre_error_flag;
+   }
+   hypre_MPI_Bcast(info, 5, HYPRE_MPI_BIG_INT, 0, comm);
+   hypre_MPI_Bcast(matcode, 4, hypre_MPI_CHAR, 0, comm);
+
+   global_num_rows = info[0];
+   global_num_cols = info[1];
+   hypre_GenerateLocalPartitioning(global_num_rows, num_procs, myid, row_starts);
+   hypre_GenerateLocalPartitioning(global_num_cols, num_procs, myid, col_starts);
+   num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+
+   /*-----------------------------------------------------------------
+    * Parse the local byte range of the data section
+    *-----------------------------------------------------------------*/
+
+   hypre_GenerateLocalPartitioning(info[4] - info[3], num_procs, myid, range);
+   ierr = hypre_IJMatrixReadMMRange(filename, matcode, info[3],
+                                    info[3] + range[0], info[3] + range[1],
+                                    &num_entries, &rows, &cols, &vals);
+   for (i = 0; i < num_entries && !ierr; i++)
+   {
+      if (rows[i] >= global_num_rows || cols[i] >= global_num_cols)
+      {
+         ierr = MM_UNSUPPORTED_TYPE;
+      }
+   }
+
+   hypre_MPI_Allreduce(&ierr, &global_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (global_ierr)
+   {
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(vals, HYPRE_MEMORY_HOST);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in Matrix Market input file!");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------
+    * Bucket the triplets by owner in the assumed partition, which
+    * coincides with the uniform row partitioning used here
+    *-----------------------------------------------------------------*/
+
+   proc_counts = hypre_CTAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   owner       = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_entries; i++)
+   {
+      hypre_GetAssumedPartitionProcFromRow(comm, rows[i], 0, global_num_rows, &owner[i]);
+      proc_counts[owner[i]]++;
+   }
+
+   num_local    = proc_counts[myid];
+   num_contacts = 0;
+   for (proc = 0; proc < num_procs; proc++)
+   {
+      if (proc != myid && proc_counts[proc])
+      {
+         num_contacts++;
+      }
+   }
+
+   contact_procs  = hypre_TAlloc(HYPRE_Int, num_contacts, HYPRE_MEMORY_HOST);
+   contact_starts = hypre_TAlloc(HYPRE_Int, num_contacts + 1, HYPRE_MEMORY_HOST);
+   proc_starts    = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+
+   /* Offsets of each destination in the contact buffer, in triplets */
+   contact_starts[0] = 0;
+   for (proc = 0, k = 0; proc < num_procs; proc++)
+   {
+      if (proc != myid && proc_counts[proc])
+      {
+         contact_procs[k] = proc;
+         proc_starts[proc] = contact_starts[k];
+         contact_starts[k + 1] = contact_starts[k] + proc_counts[proc];
+         k++;
+      }
+   }
+
+   /* Each triplet occupies three objects: row, column and value */
+   obj_size_bytes = (HYPRE_Int) hypre_max(sizeof(HYPRE_BigInt), sizeof(HYPRE_Complex));
+   contact_buf = hypre_TAlloc(char, 3 * contact_starts[num_contacts] * obj_size_bytes,
+                              HYPRE_MEMORY_HOST);
+
+   /* Locally owned triplets are kept aside, in the local arrays */
+   l_cols = hypre_TAlloc(HYPRE_BigInt,  num_local, HYPRE_MEMORY_HOST);
+   l_vals = hypre_TAlloc(HYPRE_Complex, num_local, HYPRE_MEMORY_HOST);
+   for (i = 0, k = 0; i < num_entries; i++)
+   {
+      if (owner[i] == myid)
+      {
+         /* Compact in place: k <= i */
+         rows[k]   = rows[i];
+         l_cols[k] = cols[i];
+         l_vals[k] = vals[i];
+         k++;
+      }
+      else
+      {
+         pos = 3 * (proc_starts[owner[i]]++);
+         index_ptr = (void *) ((char *) contact_buf + pos * obj_size_bytes);
+         hypre_TMemcpy(index_ptr, &rows[i], HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+         hypre_TMemcpy(index_ptr, &cols[i], HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+         hypre_TMemcpy(index_ptr, &vals[i], HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals, HYPRE_MEMORY_HOST);
+   hypre_TFree(owner, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_counts, HYPRE_MEMORY_HOST);
+
+   /* The exchange counts objects, not triplets */
+   for (k = 0; k <= num_contacts; k++)
+   {
+      contact_starts[k] *= 3;
+   }
+
+   /*-----------------------------------------------------------------
+    * Exchange the triplets
+    *-----------------------------------------------------------------*/
+
+   if (hypre_HandleUseNeighborColl(hypre_handle()))
+   {
+      hypre_DataExchangeNeighborList(num_contacts, contact_procs,
+                                     contact_buf, contact_starts, obj_size_bytes,
+                                     comm, NULL, &send_proc_obj.length, &send_proc_obj.id,
+                                     &send_proc_obj.vec_starts, &send_proc_obj.v_elements);
+   }
+   else
+   {
+      send_proc_obj.length = 0;
+      send_proc_obj.storage_length = num_contacts + 5;
+      send_proc_obj.id =
+         hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
+      send_proc_obj.vec_starts =
+         hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
+      send_proc_obj.vec_starts[0] = 0;
+      send_proc_obj.element_storage_length = contact_starts[num_contacts] + 20;
+      send_proc_obj.v_elements =
+         hypre_TAlloc(char, obj_size_bytes * send_proc_obj.element_storage_length, HYPRE_MEMORY_HOST);
+
+      response_obj.fill_response = hypre_FillResponseIJOffProcVals;
+      response_obj.data1 = NULL;
+      response_obj.data2 = &send_proc_obj;
+
+      hypre_DataExchangeList(num_contacts, contact_procs,
+                             contact_buf, contact_starts, obj_size_bytes,
+                             0, &response_obj, 0, 3,
+                             comm, (void **) &response_buf, &response_buf_starts);
+   }
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_buf, HYPRE_MEMORY_HOST);
+
+   /* Append the received triplets to the local ones */
+   num_recvs = send_proc_obj.vec_starts[send_proc_obj.length] / 3;
+   total     = num_local + num_recvs;
+   rows   = hypre_TReAlloc(rows,   HYPRE_BigInt,  hypre_max(total, 1), HYPRE_MEMORY_HOST);
+   l_cols = hypre_TReAlloc(l_cols, HYPRE_BigInt,  hypre_max(total, 1), HYPRE_MEMORY_HOST);
+   l_vals = hypre_TReAlloc(l_vals, HYPRE_Complex, hypre_max(total, 1), HYPRE_MEMORY_HOST);
+
+   index_ptr = send_proc_obj.v_elements;
+   for (i = num_local; i < total; i++)
+   {
+      hypre_TMemcpy(&rows[i], index_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+      hypre_TMemcpy(&l_cols[i], index_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+      hypre_TMemcpy(&l_vals[i], index_ptr, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
+   }
+
+   hypre_TFree(send_proc_obj.v_elements, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Sort the triplets by row (counting sort) and by column within
+    * each row, summing duplicates
+    *-----------------------------------------------------------------*/
+
+   row_ptr = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   perm    = hypre_TAlloc(HYPRE_Int, hypre_max(total, 1), HYPRE_MEMORY_HOST);
+   for (i = 0; i < total; i++)
+   {
+      row_ptr[rows[i] - row_starts[0] + 1]++;
+   }
+   for (lr = 0; lr < num_rows; lr++)
+   {
+      row_ptr[lr + 1] += row_ptr[lr];
+   }
+   for (i = 0; i < total; i++)
+   {
+      perm[row_ptr[rows[i] - row_starts[0]]++] = i;
+   }
+   for (lr = num_rows; lr > 0; lr--)
+   {
+      row_ptr[lr] = row_ptr[lr - 1];
+   }
+   row_ptr[0] = 0;
+
+   /* Reuse rows[] for the columns in row order */
+   for (i = 0; i < total; i++)
+   {
+      rows[i] = l_cols[perm[i]];
+   }
+   hypre_TFree(l_cols, HYPRE_MEMORY_HOST);
+   l_cols = rows;
+
+   diag_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   diag_j     = hypre_TAlloc(HYPRE_Int,     total, HYPRE_MEMORY_HOST);
+   diag_data  = hypre_TAlloc(HYPRE_Complex, total, HYPRE_MEMORY_HOST);
+   big_offd_j = hypre_TAlloc(HYPRE_BigInt,  total, HYPRE_MEMORY_HOST);
+   offd_data  = hypre_TAlloc(HYPRE_Complex, total, HYPRE_MEMORY_HOST);
+   diag_nnz = offd_nnz = 0;
+
+   for (lr = 0; lr < num_rows; lr++)
+   {
+      /* perm[j] still holds the source index of the value; sort it along */
+      hypre_BigQsortbi(l_cols, perm, row_ptr[lr], row_ptr[lr + 1] - 1);
+
+      for (j = row_ptr[lr]; j < row_ptr[lr + 1]; j = k)
+      {
+         col = l_cols[j];
+         val = l_vals[perm[j]];
+         for (k = j + 1; k < row_ptr[lr + 1] && l_cols[k] == col; k++)
+         {
+            val += l_vals[perm[k]];
+         }
+
+         if (col >= col_starts[0] && col < col_starts[1])
+         {
+            diag_j[diag_nnz]    = (HYPRE_Int) (col - col_starts[0]);
+            diag_data[diag_nnz] = val;
+            diag_nnz++;
+         }
+         else
+         {
+            big_offd_j[offd_nnz] = col;
+            offd_data[offd_nnz]  = val;
+            offd_nnz++;
+         }
+      }
+      diag_i[lr + 1] = diag_nnz;
+      offd_i[lr + 1] = offd_nnz;
+   }
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(l_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(l_vals, HYPRE_MEMORY_HOST);
+
+   /* Generate col_map_offd */
+   col_map_offd  = hypre_TAlloc(HYPRE_BigInt, offd_nnz, HYPRE_MEMORY_HOST);
+   offd_j        = hypre_TAlloc(HYPRE_Int, offd_nnz, HYPRE_MEMORY_HOST);
+   num_cols_offd = 0;
+   if (offd_nnz)
+   {
+      hypre_TMemcpy(col_map_offd, big_offd_j, HYPRE_BigInt, offd_nnz,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_BigQsort0(col_map_offd, 0, offd_nnz - 1);
+      for (i = 1; i < offd_nnz; i++)
+      {
+         if (col_map_offd[i] > col_map_offd[num_cols_offd])
+         {
+            col_map_offd[++num_cols_offd] = col_map_offd[i];
+         }
+      }
+      num_cols_offd++;
+   }
+   for (i = 0; i < offd_nnz; i++)
+   {
+      offd_j[i] = hypre_BigBinarySearch(col_map_offd, big_offd_j[i], num_cols_offd);
+   }
+   hypre_TFree(big_offd_j, HYPRE_MEMORY_HOST);
+
+   /* Move diagonal element in first position in each row */
+   if (row_starts[0] == col_starts[0] && row_starts[1] == col_starts[1])
+   {
+      for (lr = 0; lr < num_rows; lr++)
+      {
+         for (j = diag_i[lr]; j < diag_i[lr + 1]; j++)
+         {
+            if (diag_j[j] == lr)
+            {
+               val = diag_data[j];
+               for (p = j; p > diag_i[lr]; p--)
+               {
+                  diag_j[p]    = diag_j[p - 1];
+                  diag_data[p] = diag_data[p - 1];
+               }
+               diag_j[diag_i[lr]]    = lr;
+               diag_data[diag_i[lr]] = val;
+               break;
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Create the ParCSR matrix and wrap it in an assembled IJMatrix
+    *-----------------------------------------------------------------*/
+
+   par_matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                         row_starts, col_starts, num_cols_offd,
+                                         diag_nnz, offd_nnz);
+   diag = hypre_ParCSRMatrixDiag(par_matrix);
+   offd = hypre_ParCSRMatrixOffd(par_matrix);
+
+   hypre_CSRMatrixI(diag)    = diag_i;
+   hypre_CSRMatrixJ(diag)    = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixMemoryLocation(diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(offd)    = offd_i;
+   hypre_CSRMatrixJ(offd)    = offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixMemoryLocation(offd) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+   hypre_ParCSRMatrixSetNumNonzeros(par_matrix);
+
+   HYPRE_IJMatrixCreate(comm, row_starts[0], row_starts[1] - 1,
+                        col_starts[0], col_starts[1] - 1, &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, HYPRE_PARCSR);
+   hypre_IJMatrixObject(matrix)       = par_matrix;
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,1369 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR host assembly through per-thread COO stashes
+ *
+ * SetValues and AddToValues only append (row, col, value, set/add) entries to
+ * the stash of the calling thread, so they can be called concurrently by the
+ * threads of an OpenMP parallel region. Assemble exchanges the off-processor
+ * entries, sorts the local entries by row with a two pass parallel radix
+ * (bucket) sort, sorts each row by column with a stable merge sort, and reduces
+ * duplicate entries with the same rules as the device assembly: the last Set
+ * wins and the following Adds accumulate on top of it.
+ *
+ * With assembly mode 2, the assembly also records a pattern mapping each
+ * stashed entry to its slot in the ParCSR matrix, together with persistent
+ * requests for the off-processor exchange. Re-assembling the same sequence
+ * of entries then only moves values.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+
+/* Tag of the persistent off-processor exchange. It is kept apart from tag 0
+   of the ParCSR communication packages and from the tags used by
+   hypre_DataExchangeList, so that a stray message on the matrix communicator
+   cannot match one of the persistent receives. */
+#define HYPRE_IJ_STASH_PATTERN_TAG 1993
+
+/*--------------------------------------------------------------------------
+ * hypre_IJStashLess
+ *
+ * Lexicographic comparison of the entries a and b by (key1, key2).
+ * key1 may be NULL.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_IJStashLess( const HYPRE_BigInt *key1,
+                   const HYPRE_BigInt *key2,
+                   HYPRE_Int           a,
+                   HYPRE_Int           b )
+{
+   if (key1 && key1[a] != key1[b])
+   {
+      return (key1[a] < key1[b]);
+   }
+
+   return (key2[a] < key2[b]);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJStashStableSort
+ *
+ * Stable bottom-up merge sort of the index array perm (length n) by the keys
+ * (key1[perm[i]], key2[perm[i]]). Short runs are sorted by insertion first.
+ * work must have length n.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_IJStashStableSort( HYPRE_Int           n,
+                         const HYPRE_BigInt *key1,
+                         const HYPRE_BigInt *key2,
+                         HYPRE_Int          *perm,
+                         HYPRE_Int          *work )
+{
+   HYPRE_Int  run = 16;
+   HYPRE_Int *src = perm;
+   HYPRE_Int *dst = work;
+   HYPRE_Int *tmp;
+   HYPRE_Int  width, lo, mid, hi;
+   HYPRE_Int  i, j, k, v;
+
+   for (lo = 0; lo < n; lo += run)
+   {
+      hi = hypre_min(lo + run, n);
+      for (i = lo + 1; i < hi; i++)
+      {
+         v = perm[i];
+         for (j = i; j > lo && hypre_IJStashLess(key1, key2, v, perm[j - 1]); j--)
+         {
+            perm[j] = perm[j - 1];
+         }
+         perm[j] = v;
+      }
+   }
+
+   for (width = run; width < n; width *= 2)
+   {
+      for (lo = 0; lo < n; lo += 2 * width)
+      {
+         mid = hypre_min(lo + width, n);
+         hi  = hypre_min(lo + 2 * width, n);
+         i = lo;
+         j = mid;
+         k = lo;
+         while (i < mid && j < hi)
+         {
+            /* take from the left run on ties to keep the sort stable */
+            dst[k++] = hypre_IJStashLess(key1, key2, src[j], src[i]) ? src[j++] : src[i++];
+         }
+         while (i < mid)
+         {
+            dst[k++] = src[i++];
+         }
+         while (j < hi)
+         {
+            dst[k++] = src[j++];
+         }
+      }
+      tmp = src;
+      src = dst;
+      dst = tmp;
+   }
+
+   if (src != perm)
+   {
+      for (i = 0; i < n; i++)
+      {
+         perm[i] = src[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJStashRowBlock
+ *
+ * Returns the block containing local row r when num_rows rows are split into
+ * num_blocks blocks with hypre_partition1D.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_IJStashRowBlock( HYPRE_Int r,
+                       HYPRE_Int num_rows,
+                       HYPRE_Int num_blocks )
+{
+   HYPRE_Int size = num_rows / num_blocks;
+   HYPRE_Int rest = num_rows - size * num_blocks;
+
+   if (r < rest * (size + 1))
+   {
+      return r / (size + 1);
+   }
+
+   return rest + (r - rest * (size + 1)) / size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetAddValuesParCSRStash
+ *
+ * Appends values to the COO stash of the calling thread. The row and column
+ * indices are global, and may refer to rows owned by other processors.
+ *
+ * Thread safe: the threads of a (non-nested) parallel region write to
+ * different stashes, and only the creation of the stashes is serialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetAddValuesParCSRStash( hypre_IJMatrix       *matrix,
+                                       HYPRE_Int             nrows,
+                                       HYPRE_Int            *ncols,
+                                       const HYPRE_BigInt   *rows,
+                                       const HYPRE_Int      *row_indexes,
+                                       const HYPRE_BigInt   *cols,
+                                       const HYPRE_Complex  *values,
+                                       const char           *action )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *)    hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   char                   sora = (action[0] == 's') ? 1 : 0;
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* the aux matrix is destroyed by the assembly, recreate it if necessary.
+      The translator and the stash array are only published once they are
+      complete, so a non-NULL array can be used without the lock. */
+   if (!aux_matrix || !hypre_AuxParCSRMatrixStashes(aux_matrix))
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp critical (hypre_IJMatrixStash)
+#endif
+      {
+         aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+         if (!aux_matrix)
+         {
+            hypre_AuxParCSRMatrixCreate(&aux_matrix, hypre_ParCSRMatrixNumRows(par_matrix),
+                                        hypre_ParCSRMatrixNumCols(par_matrix), NULL);
+            hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
+         }
+         hypre_AuxParCSRMatrixInitializeStashes(aux_matrix);
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp flush
+#endif
+         hypre_IJMatrixTranslator(matrix) = aux_matrix;
+      }
+   }
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp flush
+#endif
+
+   if (my_thread_num >= hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "More threads than stashes! Initialize the matrix with the same number of threads.");
+      return hypre_error_flag;
+   }
+
+   return hypre_AuxParCSRStashAppend(hypre_AuxParCSRMatrixStashes(aux_matrix)[my_thread_num],
+                                     nrows, ncols, rows, row_indexes, cols, values, sora);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleOffProcValsParCSRStash
+ *
+ * Collects the stashed entries of rows owned by other processors, reduces
+ * them and sends them to their owners as additions. As for the device
+ * assembly, a Set on an off-processor entry discards all the previous
+ * contributions to that entry from this processor and counts as zero.
+ * Received entries are appended to the receive stash of the owner.
+ *
+ * If pattern is not NULL, the reduction and the exchange are recorded in it.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixAssembleOffProcValsParCSRStash( hypre_IJMatrix         *matrix,
+                                              hypre_AuxParCSRPattern *pattern )
+{
+   MPI_Comm               comm             = hypre_IJMatrixComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix       = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt           row_0            = row_partitioning[0];
+   HYPRE_BigInt           row_n            = row_partitioning[1] - 1;
+   HYPRE_Int              num_stashes      = hypre_AuxParCSRMatrixNumStashes(aux_matrix);
+   hypre_AuxParCSRStash **stashes          = hypre_AuxParCSRMatrixStashes(aux_matrix);
+
+   HYPRE_BigInt          *off_i, *off_j;
+   HYPRE_Complex         *off_data;
+   char                  *off_sora;
+   HYPRE_Int             *off_entry;
+   HYPRE_Int             *perm, *work;
+   HYPRE_BigInt          *off_proc_i;
+   HYPRE_BigInt          *off_proc_j;
+   HYPRE_Complex         *off_proc_data;
+   HYPRE_Int              off_proc_i_indx;
+   HYPRE_Int              num_off, num_off_global, num_reduced;
+   HYPRE_Int             *reduced_ptr = NULL;
+   HYPRE_Int             *reduced_entries = NULL;
+   HYPRE_Int              s, k, m, kk, pk, last_set, entry;
+   HYPRE_Complex          value;
+
+   /* count and gather the off-processor entries */
+   num_off = 0;
+   for (s = 0; s < num_stashes; s++)
+   {
+      HYPRE_BigInt *stash_i = hypre_AuxParCSRStashI(stashes[s]);
+
+      for (k = 0; k < hypre_AuxParCSRStashSize(stashes[s]); k++)
+      {
+         if (stash_i[k] < row_0 || stash_i[k] > row_n)
+         {
+            num_off++;
+         }
+      }
+   }
+
+   off_i     = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   off_j     = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   off_data  = hypre_TAlloc(HYPRE_Complex, num_off, HYPRE_MEMORY_HOST);
+   off_sora  = hypre_TAlloc(char,          num_off, HYPRE_MEMORY_HOST);
+   off_entry = hypre_TAlloc(HYPRE_Int,     num_off, HYPRE_MEMORY_HOST);
+   perm      = hypre_TAlloc(HYPRE_Int,     num_off, HYPRE_MEMORY_HOST);
+   work      = hypre_TAlloc(HYPRE_Int,     num_off, HYPRE_MEMORY_HOST);
+
+   m = 0;
+   entry = 0;
+   for (s = 0; s < num_stashes; s++)
+   {
+      HYPRE_BigInt  *stash_i    = hypre_AuxParCSRStashI(stashes[s]);
+      HYPRE_BigInt  *stash_j    = hypre_AuxParCSRStashJ(stashes[s]);
+      HYPRE_Complex *stash_data = hypre_AuxParCSRStashData(stashes[s]);
+      char          *stash_sora = hypre_AuxParCSRStashSorA(stashes[s]);
+
+      for (k = 0; k < hypre_AuxParCSRStashSize(stashes[s]); k++)
+      {
+         if (stash_i[k] < row_0 || stash_i[k] > row_n)
+         {
+            off_i[m]     = stash_i[k];
+            off_j[m]     = stash_j[k];
+            off_data[m]  = stash_data[k];
+            off_sora[m]  = stash_sora[k];
+            off_entry[m] = entry + k;
+            perm[m]      = m;
+            m++;
+         }
+      }
+      entry += hypre_AuxParCSRStashSize(stashes[s]);
+   }
+
+   /* sort by (row, col) and reduce: only the additions after the last Set count */
+   hypre_IJStashStableSort(num_off, off_i, off_j, perm, work);
+
+   off_proc_i    = hypre_TAlloc(HYPRE_BigInt,  2 * num_off, HYPRE_MEMORY_HOST);
+   off_proc_j    = hypre_TAlloc(HYPRE_BigInt,  num_off,     HYPRE_MEMORY_HOST);
+   off_proc_data = hypre_TAlloc(HYPRE_Complex, num_off,     HYPRE_MEMORY_HOST);
+   if (pattern)
+   {
+      reduced_ptr     = hypre_TAlloc(HYPRE_Int, num_off + 1, HYPRE_MEMORY_HOST);
+      reduced_entries = hypre_TAlloc(HYPRE_Int, num_off,     HYPRE_MEMORY_HOST);
+   }
+
+   off_proc_i_indx = 0;
+   num_reduced = 0;
+   for (k = 0; k < num_off; k = m)
+   {
+      pk = perm[k];
+      last_set = -1;
+      for (m = k; m < num_off; m++)
+      {
+         if (off_i[perm[m]] != off_i[pk] || off_j[perm[m]] != off_j[pk])
+         {
+            break;
+         }
+         if (off_sora[perm[m]])
+         {
+            last_set = m;
+         }
+      }
+
+      value = 0.0;
+      for (kk = (last_set < 0) ? k : last_set + 1; kk < m; kk++)
+      {
+         value += off_data[perm[kk]];
+      }
+
+      if (pattern)
+      {
+         reduced_ptr[num_reduced] = k;
+         for (kk = k; kk < m; kk++)
+         {
+            reduced_entries[kk] = off_entry[perm[kk]];
+         }
+      }
+
+      if (off_proc_i_indx == 0 || off_proc_i[off_proc_i_indx - 2] != off_i[pk])
+      {
+         off_proc_i[off_proc_i_indx++] = off_i[pk];
+         off_proc_i[off_proc_i_indx++] = 0;
+      }
+      off_proc_i[off_proc_i_indx - 1]++;
+      off_proc_j[num_reduced]    = off_j[pk];
+      off_proc_data[num_reduced] = value;
+      num_reduced++;
+   }
+
+   hypre_TFree(off_i,     HYPRE_MEMORY_HOST);
+   hypre_TFree(off_j,     HYPRE_MEMORY_HOST);
+   hypre_TFree(off_data,  HYPRE_MEMORY_HOST);
+   hypre_TFree(off_sora,  HYPRE_MEMORY_HOST);
+   hypre_TFree(off_entry, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm,      HYPRE_MEMORY_HOST);
+   hypre_TFree(work,      HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Allreduce(&num_reduced, &num_off_global, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+   if (num_off_global)
+   {
+      /* with a pattern, this records the owners of the rows and the messages received */
+      hypre_IJMatrixAssembleOffProcValsParCSR(matrix, off_proc_i_indx, num_reduced, num_reduced,
+                                              HYPRE_MEMORY_HOST,
+                                              off_proc_i, off_proc_j, off_proc_data);
+   }
+
+   if (pattern)
+   {
+      HYPRE_Int  num_off_rows  = off_proc_i_indx / 2;
+      HYPRE_Int *off_row_procs = pattern -> off_row_procs;
+      HYPRE_Int  num_sends, r, q, p, i;
+      HYPRE_Int *send_procs, *send_starts, *send_map;
+
+      reduced_ptr[num_reduced] = num_off;
+      pattern -> num_reduced     = num_reduced;
+      pattern -> reduced_ptr     = reduced_ptr;
+      pattern -> reduced_entries = reduced_entries;
+
+      /* group the reduced values by owner, in the order in which they were sent */
+      send_procs = hypre_TAlloc(HYPRE_Int, num_off_rows, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(send_procs, off_row_procs, HYPRE_Int, num_off_rows,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_qsort0(send_procs, 0, num_off_rows - 1);
+      num_sends = 0;
+      for (q = 0; q < num_off_rows; q++)
+      {
+         if (num_sends == 0 || send_procs[q] != send_procs[num_sends - 1])
+         {
+            send_procs[num_sends++] = send_procs[q];
+         }
+      }
+
+      send_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      for (q = 0; q < num_off_rows; q++)
+      {
+         i = hypre_BinarySearch(send_procs, off_row_procs[q], num_sends);
+         send_starts[i + 1] += (HYPRE_Int) off_proc_i[2 * q + 1];
+      }
+      for (i = 0; i < num_sends; i++)
+      {
+         send_starts[i + 1] += send_starts[i];
+      }
+
+      send_map = hypre_TAlloc(HYPRE_Int, num_reduced, HYPRE_MEMORY_HOST);
+      r = 0;
+      for (q = 0; q < num_off_rows; q++)
+      {
+         i = hypre_BinarySearch(send_procs, off_row_procs[q], num_sends);
+         for (p = 0; p < (HYPRE_Int) off_proc_i[2 * q + 1]; p++)
+         {
+            send_map[send_starts[i]++] = r++;
+         }
+      }
+      for (i = num_sends; i > 0; i--)
+      {
+         send_starts[i] = send_starts[i - 1];
+      }
+      send_starts[0] = 0;
+
+      pattern -> num_sends   = num_sends;
+      pattern -> send_procs  = send_procs;
+      pattern -> send_starts = send_starts;
+      pattern -> send_map    = send_map;
+      pattern -> send_buf    = hypre_TAlloc(HYPRE_Complex, num_reduced, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(off_proc_i,    HYPRE_MEMORY_HOST);
+   hypre_TFree(off_proc_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(off_proc_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStashPatternCreate
+ *
+ * Starts recording the assembly pattern of the stashed entries.
+ *--------------------------------------------------------------------------*/
+
+static hypre_AuxParCSRPattern *
+hypre_IJMatrixStashPatternCreate( hypre_IJMatrix *matrix )
+{
+   hypre_AuxParCSRMatrix  *aux_matrix  = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int               num_stashes = hypre_AuxParCSRMatrixNumStashes(aux_matrix);
+   hypre_AuxParCSRStash  **stashes     = hypre_AuxParCSRMatrixStashes(aux_matrix);
+   hypre_AuxParCSRPattern *pattern;
+   HYPRE_Int              *stash_starts;
+   HYPRE_Int               s, size;
+
+   pattern = hypre_CTAlloc(hypre_AuxParCSRPattern, 1, HYPRE_MEMORY_HOST);
+
+   stash_starts = hypre_TAlloc(HYPRE_Int, num_stashes + 1, HYPRE_MEMORY_HOST);
+   stash_starts[0] = 0;
+   for (s = 0; s < num_stashes; s++)
+   {
+      stash_starts[s + 1] = stash_starts[s] + hypre_AuxParCSRStashSize(stashes[s]);
+   }
+
+   pattern -> num_stashes  = num_stashes;
+   pattern -> stash_starts = stash_starts;
+   pattern -> stash_i      = hypre_TAlloc(HYPRE_BigInt, stash_starts[num_stashes], HYPRE_MEMORY_HOST);
+   pattern -> stash_j      = hypre_TAlloc(HYPRE_BigInt, stash_starts[num_stashes], HYPRE_MEMORY_HOST);
+   for (s = 0; s < num_stashes; s++)
+   {
+      size = hypre_AuxParCSRStashSize(stashes[s]);
+      hypre_TMemcpy(pattern -> stash_i + stash_starts[s], hypre_AuxParCSRStashI(stashes[s]),
+                    HYPRE_BigInt, size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(pattern -> stash_j + stash_starts[s], hypre_AuxParCSRStashJ(stashes[s]),
+                    HYPRE_BigInt, size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   return pattern;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStashPatternSetupExchange
+ *
+ * Allocates the values of the entries and creates the persistent requests
+ * of the off-processor exchange. The received values are stored directly
+ * after the values of the stashed entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixStashPatternSetupExchange( hypre_IJMatrix         *matrix,
+                                         hypre_AuxParCSRPattern *pattern )
+{
+   MPI_Comm        comm        = hypre_IJMatrixComm(matrix);
+   HYPRE_Int       num_stashed = pattern -> stash_starts[pattern -> num_stashes];
+   HYPRE_Int       num_sends   = pattern -> num_sends;
+   HYPRE_Int       num_recvs   = pattern -> num_recvs;
+   HYPRE_Int      *send_starts = pattern -> send_starts;
+   HYPRE_Int      *recv_starts = pattern -> recv_starts;
+   HYPRE_Complex  *recv_buf;
+   HYPRE_Int       i;
+
+   /* recv_starts holds the size of each message */
+   if (!recv_starts)
+   {
+      recv_starts = pattern -> recv_starts = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_starts[i + 1] += recv_starts[i];
+   }
+
+   pattern -> num_entries = num_stashed + recv_starts[num_recvs];
+   pattern -> data        = hypre_TAlloc(HYPRE_Complex, pattern -> num_entries, HYPRE_MEMORY_HOST);
+   pattern -> sora        = hypre_CTAlloc(char, pattern -> num_entries, HYPRE_MEMORY_HOST);
+   pattern -> requests    = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+   recv_buf = pattern -> data + num_stashed;
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_MPI_Recv_init(recv_buf + recv_starts[i], recv_starts[i + 1] - recv_starts[i],
+                          HYPRE_MPI_COMPLEX, pattern -> recv_procs[i],
+                          HYPRE_IJ_STASH_PATTERN_TAG, comm,
+                          &(pattern -> requests[i]));
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_MPI_Send_init(pattern -> send_buf + send_starts[i], send_starts[i + 1] - send_starts[i],
+                          HYPRE_MPI_COMPLEX, pattern -> send_procs[i],
+                          HYPRE_IJ_STASH_PATTERN_TAG, comm,
+                          &(pattern -> requests[num_recvs + i]));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStashPatternMatches
+ *
+ * Checks whether the stashed entries have the same indices, in the same
+ * order, as the ones recorded in the pattern of the assembled matrix.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixStashPatternMatches( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix     *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix  *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   hypre_AuxParCSRPattern *pattern    = (hypre_AuxParCSRPattern *) hypre_IJMatrixPattern(matrix);
+   hypre_AuxParCSRStash  **stashes    = hypre_AuxParCSRMatrixStashes(aux_matrix);
+   HYPRE_Int               num_stashes = hypre_AuxParCSRMatrixNumStashes(aux_matrix);
+   HYPRE_Int              *stash_starts;
+   HYPRE_Int               num_diff = 0;
+   HYPRE_Int               s, k;
+
+   if (!pattern || !hypre_IJMatrixAssembleFlag(matrix) ||
+       pattern -> par_matrix != (void *) par_matrix ||
+       pattern -> diag_nnz != hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix)) ||
+       pattern -> offd_nnz != hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(par_matrix)) ||
+       pattern -> num_stashes != num_stashes)
+   {
+      return 0;
+   }
+
+   stash_starts = pattern -> stash_starts;
+   for (s = 0; s < num_stashes; s++)
+   {
+      if (hypre_AuxParCSRStashSize(stashes[s]) != stash_starts[s + 1] - stash_starts[s])
+      {
+         return 0;
+      }
+   }
+
+   for (s = 0; s < num_stashes; s++)
+   {
+      HYPRE_BigInt *stash_i = hypre_AuxParCSRStashI(stashes[s]);
+      HYPRE_BigInt *stash_j = hypre_AuxParCSRStashJ(stashes[s]);
+      HYPRE_BigInt *rec_i   = pattern -> stash_i + stash_starts[s];
+      HYPRE_BigInt *rec_j   = pattern -> stash_j + stash_starts[s];
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) reduction(+:num_diff) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < hypre_AuxParCSRStashSize(stashes[s]); k++)
+      {
+         if (stash_i[k] != rec_i[k] || stash_j[k] != rec_j[k])
+         {
+            num_diff++;
+         }
+      }
+   }
+
+   return (num_diff == 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleParCSRPattern
+ *
+ * Assembles the values of stashed entries that match the recorded pattern:
+ * the off-processor values are reduced and sent with the persistent
+ * requests, and all the other values are reduced directly into their slots
+ * of the ParCSR matrix. The entries are reduced as in the full assembly.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixAssembleParCSRPattern( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix     *par_matrix   = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix  *aux_matrix   = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   hypre_AuxParCSRPattern *pattern      = (hypre_AuxParCSRPattern *) hypre_IJMatrixPattern(matrix);
+   hypre_AuxParCSRStash  **stashes      = hypre_AuxParCSRMatrixStashes(aux_matrix);
+   HYPRE_Int               num_stashes  = pattern -> num_stashes;
+   HYPRE_Int              *stash_starts = pattern -> stash_starts;
+   HYPRE_Complex          *data         = pattern -> data;
+   char                   *sora         = pattern -> sora;
+   HYPRE_Int               num_requests = pattern -> num_sends + pattern -> num_recvs;
+   HYPRE_Int              *reduced_ptr  = pattern -> reduced_ptr;
+   HYPRE_Int              *reduced_entries = pattern -> reduced_entries;
+   HYPRE_Int              *send_map     = pattern -> send_map;
+   HYPRE_Complex          *send_buf     = pattern -> send_buf;
+   HYPRE_Int              *slots        = pattern -> slots;
+   HYPRE_Int              *slot_ptr     = pattern -> slot_ptr;
+   HYPRE_Int              *slot_entries = pattern -> slot_entries;
+   HYPRE_Complex          *diag_data    = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex          *offd_data    = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int               i, k, s;
+
+   /* gather the values of the thread stashes */
+   for (s = 0; s < num_stashes; s++)
+   {
+      hypre_TMemcpy(data + stash_starts[s], hypre_AuxParCSRStashData(stashes[s]), HYPRE_Complex,
+                    stash_starts[s + 1] - stash_starts[s], HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(sora + stash_starts[s], hypre_AuxParCSRStashSorA(stashes[s]), char,
+                    stash_starts[s + 1] - stash_starts[s], HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   /* reduce the off-processor values and send them to their owners */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < pattern -> num_reduced; i++)
+   {
+      HYPRE_Int     r = send_map[i];
+      HYPRE_Complex value = 0.0;
+
+      for (k = reduced_ptr[r]; k < reduced_ptr[r + 1]; k++)
+      {
+         value = sora[reduced_entries[k]] ? 0.0 : value + data[reduced_entries[k]];
+      }
+      send_buf[i] = value;
+   }
+
+   if (num_requests)
+   {
+      hypre_MPI_Startall(num_requests, pattern -> requests);
+      hypre_MPI_Waitall(num_requests, pattern -> requests, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   /* reduce the local and received values into the matrix */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < pattern -> num_slots; i++)
+   {
+      HYPRE_Int      slot  = slots[i];
+      HYPRE_Complex *value = (slot < 0) ? &offd_data[-slot - 1] : &diag_data[slot];
+
+      for (k = slot_ptr[i]; k < slot_ptr[i + 1]; k++)
+      {
+         *value = sora[slot_entries[k]] ? data[slot_entries[k]] : *value + data[slot_entries[k]];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleParCSRStash
+ *
+ * Assembles the ParCSR matrix from the per-thread COO stashes.
+ *
+ * The local entries are sorted by row in two stable counting passes: the
+ * first one distributes the entries into one contiguous block of rows per
+ * thread, the second one sorts each block by row. Each thread then sorts its
+ * rows by column and reduces duplicates. Finally, the diag and offd parts are
+ * built (diagonal entry first in each row), or, if the matrix was already
+ * assembled, the values are merged into the existing sparsity pattern.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleParCSRStash( hypre_IJMatrix *matrix )
+{
+   MPI_Comm               comm             = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix    *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix       = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt           row_0            = row_partitioning[0];
+   HYPRE_BigInt           row_n            = row_partitioning[1] - 1;
+   HYPRE_BigInt           col_0            = col_partitioning[0];
+   HYPRE_BigInt           col_n            = col_partitioning[1] - 1;
+   HYPRE_BigInt           base             = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int              num_rows         = (HYPRE_Int)(row_partitioning[1] - row_partitioning[0]);
+   HYPRE_Int              print_level      = hypre_IJMatrixPrintLevel(matrix);
+
+   hypre_CSRMatrix       *diag             = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix       *offd             = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int             *diag_i           = hypre_CSRMatrixI(diag);
+   HYPRE_Int             *offd_i           = hypre_CSRMatrixI(offd);
+   HYPRE_Int             *diag_j;
+   HYPRE_Int             *offd_j;
+   HYPRE_Complex         *diag_data;
+   HYPRE_Complex         *offd_data;
+   HYPRE_BigInt          *big_offd_j;
+   HYPRE_BigInt          *col_map_offd;
+   HYPRE_BigInt          *tmp_j;
+   HYPRE_Int              num_cols_offd, nnz_offd;
+
+   hypre_AuxParCSRStash **stashes;
+   HYPRE_Int              num_stashes;
+   HYPRE_Int             *stash_start;
+   hypre_AuxParCSRPattern *pattern;
+   HYPRE_Int             *block_idx;
+   HYPRE_Int             *sort_idx;
+   HYPRE_Int             *rec_entries;
+   HYPRE_Int             *rec_slot;
+   char                  *rec_first;
+   HYPRE_Int              match, match_global;
+   HYPRE_Int              max_num_threads;
+   HYPRE_Int             *block_counts;
+   HYPRE_Int             *block_start;
+   HYPRE_Int             *block_row;
+   HYPRE_BigInt          *block_j;
+   HYPRE_Complex         *block_data;
+   char                  *block_sora;
+   HYPRE_Int             *row_ptr;
+   HYPRE_Int             *row_end;
+   HYPRE_BigInt          *sort_j;
+   HYPRE_Complex         *sort_data;
+   char                  *sort_sora;
+   HYPRE_Int             *row_perm, *row_work;
+   HYPRE_BigInt          *row_j;
+   HYPRE_Complex         *row_data;
+   char                  *row_sora;
+   HYPRE_Int              max_row_length;
+   HYPRE_Int              num_missing;
+   HYPRE_Int              aux_flag, aux_flag_global;
+   HYPRE_Int              i, s;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /* first find out if anyone has an aux_matrix, and create one if you don't
+    * have one, but other procs do */
+   aux_flag = aux_matrix ? 1 : 0;
+   hypre_MPI_Allreduce(&aux_flag, &aux_flag_global, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+   if ((aux_flag_global && !aux_flag) || (!aux_matrix && !hypre_IJMatrixAssembleFlag(matrix)))
+   {
+      hypre_AuxParCSRMatrixCreate(&aux_matrix, num_rows, hypre_ParCSRMatrixNumCols(par_matrix), NULL);
+      hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
+      hypre_IJMatrixTranslator(matrix) = aux_matrix;
+   }
+
+   if (!aux_matrix)
+   {
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+   hypre_AuxParCSRMatrixInitializeStashes(aux_matrix);
+
+   pattern = NULL;
+   if (hypre_IJMatrixAssemblyMode(matrix) == 2)
+   {
+      /* only move values if the entries of all processors match the pattern */
+      match = hypre_IJMatrixStashPatternMatches(matrix);
+      hypre_MPI_Allreduce(&match, &match_global, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+      if (match_global)
+      {
+         hypre_IJMatrixAssembleParCSRPattern(matrix);
+
+         hypre_AuxParCSRMatrixDestroy(aux_matrix);
+         hypre_IJMatrixTranslator(matrix) = NULL;
+
+         HYPRE_PRINT_MEMORY_USAGE(comm);
+         HYPRE_ANNOTATE_FUNC_END;
+
+         return hypre_error_flag;
+      }
+
+      /* record a new pattern */
+      hypre_AuxParCSRPatternDestroy((hypre_AuxParCSRPattern *) hypre_IJMatrixPattern(matrix));
+      pattern = hypre_IJMatrixStashPatternCreate(matrix);
+      hypre_IJMatrixPattern(matrix) = pattern;
+   }
+
+   /* send off-processor entries to their owners */
+   hypre_IJMatrixAssembleOffProcValsParCSRStash(matrix, pattern);
+   if (pattern)
+   {
+      hypre_IJMatrixStashPatternSetupExchange(matrix, pattern);
+   }
+
+   /* the thread stashes, followed by the receive stash */
+   num_stashes = hypre_AuxParCSRMatrixNumStashes(aux_matrix) + 1;
+   stashes     = hypre_AuxParCSRMatrixStashes(aux_matrix);
+   stash_start = hypre_TAlloc(HYPRE_Int, num_stashes + 1, HYPRE_MEMORY_HOST);
+   stash_start[0] = 0;
+   for (s = 0; s < num_stashes; s++)
+   {
+      stash_start[s + 1] = stash_start[s] + hypre_AuxParCSRStashSize(stashes[s]);
+   }
+
+   max_num_threads = hypre_NumThreads();
+   block_counts = hypre_CTAlloc(HYPRE_Int, max_num_threads * max_num_threads, HYPRE_MEMORY_HOST);
+   block_start  = hypre_CTAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+   row_ptr      = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_end      = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+   block_row  = NULL;
+   block_j    = NULL;
+   block_data = NULL;
+   block_sora = NULL;
+   block_idx  = NULL;
+   sort_idx   = NULL;
+   rec_entries = NULL;
+   rec_first  = NULL;
+   rec_slot   = NULL;
+   sort_j     = NULL;
+   sort_data  = NULL;
+   sort_sora  = NULL;
+   row_perm   = NULL;
+   row_work   = NULL;
+   row_j      = NULL;
+   row_data   = NULL;
+   row_sora   = NULL;
+   max_row_length = 0;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, s)
+#endif
+   {
+      HYPRE_Int      num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int     *my_counts     = block_counts + my_thread_num * max_num_threads;
+      HYPRE_Int      gs, ge, lo, hi, rs, re, b, t, k, kk, pk, r, cnt, len, nu;
+      HYPRE_Int      my_max_row_length;
+      HYPRE_Int     *perm, *work;
+      HYPRE_BigInt  *wj;
+      HYPRE_Complex *wdata;
+      char          *wsora;
+
+      /* Pass 1: count the local entries of each row block in this chunk */
+      hypre_partition1D(stash_start[num_stashes], num_threads, my_thread_num, &gs, &ge);
+      for (s = 0; s < num_stashes; s++)
+      {
+         HYPRE_BigInt *stash_i = hypre_AuxParCSRStashI(stashes[s]);
+
+         lo = hypre_max(gs, stash_start[s]);
+         hi = hypre_min(ge, stash_start[s + 1]);
+         for (k = lo - stash_start[s]; k < hi - stash_start[s]; k++)
+         {
+            if (stash_i[k] >= row_0 && stash_i[k] <= row_n)
+            {
+               r = (HYPRE_Int)(stash_i[k] - row_0);
+               my_counts[hypre_IJStashRowBlock(r, num_rows, num_threads)]++;
+            }
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         cnt = 0;
+         for (b = 0; b < num_threads; b++)
+         {
+            block_start[b] = cnt;
+            for (t = 0; t < num_threads; t++)
+            {
+               k = block_counts[t * max_num_threads + b];
+               block_counts[t * max_num_threads + b] = cnt;
+               cnt += k;
+            }
+         }
+         block_start[num_threads] = cnt;
+         row_ptr[num_rows] = cnt;
+
+         block_row  = hypre_TAlloc(HYPRE_Int,     cnt, HYPRE_MEMORY_HOST);
+         block_j    = hypre_TAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
+         block_data = hypre_TAlloc(HYPRE_Complex, cnt, HYPRE_MEMORY_HOST);
+         block_sora = hypre_TAlloc(char,          cnt, HYPRE_MEMORY_HOST);
+         sort_j     = hypre_TAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
+         sort_data  = hypre_TAlloc(HYPRE_Complex, cnt, HYPRE_MEMORY_HOST);
+         sort_sora  = hypre_TAlloc(char,          cnt, HYPRE_MEMORY_HOST);
+         if (pattern)
+         {
+            /* track the entry numbers through the sort */
+            block_idx   = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+            sort_idx    = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+            rec_entries = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+            rec_first   = hypre_TAlloc(char,      cnt, HYPRE_MEMORY_HOST);
+            rec_slot    = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Pass 2: stable scatter of the chunk into the row blocks */
+      for (s = 0; s < num_stashes; s++)
+      {
+         HYPRE_BigInt  *stash_i    = hypre_AuxParCSRStashI(stashes[s]);
+         HYPRE_BigInt  *stash_j    = hypre_AuxParCSRStashJ(stashes[s]);
+         HYPRE_Complex *stash_data = hypre_AuxParCSRStashData(stashes[s]);
+         char          *stash_sora = hypre_AuxParCSRStashSorA(stashes[s]);
+
+         lo = hypre_max(gs, stash_start[s]);
+         hi = hypre_min(ge, stash_start[s + 1]);
+         for (k = lo - stash_start[s]; k < hi - stash_start[s]; k++)
+         {
+            if (stash_i[k] >= row_0 && stash_i[k] <= row_n)
+            {
+               r  = (HYPRE_Int)(stash_i[k] - row_0);
+               kk = my_counts[hypre_IJStashRowBlock(r, num_rows, num_threads)]++;
+               block_row[kk]  = r;
+               block_j[kk]    = stash_j[k];
+               block_data[kk] = stash_data[k];
+               block_sora[kk] = stash_sora[k];
+               if (block_idx)
+               {
+                  block_idx[kk] = stash_start[s] + k;
+               }
+            }
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Pass 3: stable counting sort of this thread's row block by row */
+      hypre_partition1D(num_rows, num_threads, my_thread_num, &rs, &re);
+      for (k = block_start[my_thread_num]; k < block_start[my_thread_num + 1]; k++)
+      {
+         row_ptr[block_row[k]]++;
+      }
+      cnt = block_start[my_thread_num];
+      my_max_row_length = 0;
+      for (r = rs; r < re; r++)
+      {
+         len = row_ptr[r];
+         my_max_row_length = hypre_max(my_max_row_length, len);
+         row_ptr[r] = cnt;
+         row_end[r] = cnt;
+         cnt += len;
+      }
+      for (k = block_start[my_thread_num]; k < block_start[my_thread_num + 1]; k++)
+      {
+         kk = row_end[block_row[k]]++;
+         sort_j[kk]    = block_j[k];
+         sort_data[kk] = block_data[k];
+         sort_sora[kk] = block_sora[k];
+         if (sort_idx)
+         {
+            sort_idx[kk] = block_idx[k];
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp critical
+#endif
+      {
+         max_row_length = hypre_max(max_row_length, my_max_row_length);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         cnt = max_row_length * num_threads;
+         row_perm = hypre_TAlloc(HYPRE_Int,     cnt, HYPRE_MEMORY_HOST);
+         row_work = hypre_TAlloc(HYPRE_Int,     cnt, HYPRE_MEMORY_HOST);
+         row_j    = hypre_TAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
+         row_data = hypre_TAlloc(HYPRE_Complex, cnt, HYPRE_MEMORY_HOST);
+         row_sora = hypre_TAlloc(char,          cnt, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Pass 4: stable sort of each row by column and reduction of duplicates.
+         On exit, row r holds row_end[r] - row_ptr[r] unique entries */
+      perm  = row_perm + my_thread_num * max_row_length;
+      work  = row_work + my_thread_num * max_row_length;
+      wj    = row_j    + my_thread_num * max_row_length;
+      wdata = row_data + my_thread_num * max_row_length;
+      wsora = row_sora + my_thread_num * max_row_length;
+      for (r = rs; r < re; r++)
+      {
+         len = row_end[r] - row_ptr[r];
+
+         /* nothing to do for rows that are already sorted without duplicates */
+         for (k = row_ptr[r] + 1; k < row_end[r]; k++)
+         {
+            if (sort_j[k] <= sort_j[k - 1])
+            {
+               break;
+            }
+         }
+         if (k >= row_end[r])
+         {
+            for (k = row_ptr[r]; rec_entries && k < row_end[r]; k++)
+            {
+               rec_entries[k] = sort_idx[k];
+               rec_first[k]   = 1;
+            }
+            continue;
+         }
+
+         for (k = 0; k < len; k++)
+         {
+            perm[k] = row_ptr[r] + k;
+         }
+         hypre_IJStashStableSort(len, NULL, sort_j, perm, work);
+
+         nu = 0;
+         for (k = 0; k < len; k++)
+         {
+            pk = perm[k];
+            if (rec_entries)
+            {
+               rec_entries[row_ptr[r] + k] = sort_idx[pk];
+               rec_first[row_ptr[r] + k]   = !(nu > 0 && wj[nu - 1] == sort_j[pk]);
+            }
+            if (nu > 0 && wj[nu - 1] == sort_j[pk])
+            {
+               if (sort_sora[pk])
+               {
+                  wdata[nu - 1] = sort_data[pk];
+                  wsora[nu - 1] = 1;
+               }
+               else
+               {
+                  wdata[nu - 1] += sort_data[pk];
+               }
+            }
+            else
+            {
+               wj[nu]    = sort_j[pk];
+               wdata[nu] = sort_data[pk];
+               wsora[nu] = sort_sora[pk];
+               nu++;
+            }
+         }
+
+         for (k = 0; k < nu; k++)
+         {
+            sort_j[row_ptr[r] + k]    = wj[k];
+            sort_data[row_ptr[r] + k] = wdata[k];
+            sort_sora[row_ptr[r] + k] = wsora[k];
+         }
+         row_end[r] = row_ptr[r] + nu;
+      }
+   } /* end parallel region */
+
+   hypre_TFree(stash_start,  HYPRE_MEMORY_HOST);
+   hypre_TFree(block_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(block_start,  HYPRE_MEMORY_HOST);
+   hypre_TFree(block_row,    HYPRE_MEMORY_HOST);
+   hypre_TFree(block_j,      HYPRE_MEMORY_HOST);
+   hypre_TFree(block_data,   HYPRE_MEMORY_HOST);
+   hypre_TFree(block_sora,   HYPRE_MEMORY_HOST);
+   hypre_TFree(block_idx,    HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_idx,     HYPRE_MEMORY_HOST);
+   hypre_TFree(row_perm,     HYPRE_MEMORY_HOST);
+   hypre_TFree(row_work,     HYPRE_MEMORY_HOST);
+   hypre_TFree(row_j,        HYPRE_MEMORY_HOST);
+   hypre_TFree(row_data,     HYPRE_MEMORY_HOST);
+   hypre_TFree(row_sora,     HYPRE_MEMORY_HOST);
+
+   if (hypre_IJMatrixAssembleFlag(matrix) == 0)
+   {
+      /* count the diag and offd entries of each row */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, s) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         diag_i[i + 1] = 0;
+         offd_i[i + 1] = 0;
+         for (s = row_ptr[i]; s < row_end[i]; s++)
+         {
+            if (sort_j[s] < col_0 || sort_j[s] > col_n)
+            {
+               offd_i[i + 1]++;
+            }
+            else
+            {
+               diag_i[i + 1]++;
+            }
+         }
+      }
+
+      diag_i[0] = 0;
+      offd_i[0] = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         diag_i[i + 1] += diag_i[i];
+         offd_i[i + 1] += offd_i[i];
+      }
+
+      hypre_TFree(hypre_CSRMatrixJ(diag),    hypre_CSRMatrixMemoryLocation(diag));
+      hypre_TFree(hypre_CSRMatrixData(diag), hypre_CSRMatrixMemoryLocation(diag));
+      hypre_TFree(hypre_CSRMatrixJ(offd),    hypre_CSRMatrixMemoryLocation(offd));
+      hypre_TFree(hypre_CSRMatrixData(offd), hypre_CSRMatrixMemoryLocation(offd));
+      hypre_TFree(hypre_CSRMatrixBigJ(offd), hypre_CSRMatrixMemoryLocation(offd));
+
+      diag_j     = hypre_CTAlloc(HYPRE_Int,     diag_i[num_rows], hypre_CSRMatrixMemoryLocation(diag));
+      diag_data  = hypre_CTAlloc(HYPRE_Complex, diag_i[num_rows], hypre_CSRMatrixMemoryLocation(diag));
+      offd_j     = hypre_CTAlloc(HYPRE_Int,     offd_i[num_rows], hypre_CSRMatrixMemoryLocation(offd));
+      offd_data  = hypre_CTAlloc(HYPRE_Complex, offd_i[num_rows], hypre_CSRMatrixMemoryLocation(offd));
+      big_offd_j = hypre_CTAlloc(HYPRE_BigInt,  offd_i[num_rows], HYPRE_MEMORY_HOST);
+
+      /* fill diag (diagonal entry first) and offd */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, s) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int i_diag = diag_i[i];
+         HYPRE_Int i_offd = offd_i[i];
+
+         for (s = row_ptr[i]; s < row_end[i]; s++)
+         {
+            if (sort_j[s] - col_0 == (HYPRE_BigInt) i)
+            {
+               if (rec_slot)
+               {
+                  rec_slot[s] = i_diag;
+               }
+               diag_j[i_diag] = i;
+               diag_data[i_diag++] = sort_data[s];
+               break;
+            }
+         }
+         for (s = row_ptr[i]; s < row_end[i]; s++)
+         {
+            if (sort_j[s] < col_0 || sort_j[s] > col_n)
+            {
+               if (rec_slot)
+               {
+                  rec_slot[s] = -i_offd - 1;
+               }
+               big_offd_j[i_offd] = sort_j[s];
+               offd_data[i_offd++] = sort_data[s];
+            }
+            else if (sort_j[s] - col_0 != (HYPRE_BigInt) i)
+            {
+               if (rec_slot)
+               {
+                  rec_slot[s] = i_diag;
+               }
+               diag_j[i_diag] = (HYPRE_Int)(sort_j[s] - col_0);
+               diag_data[i_diag++] = sort_data[s];
+            }
+         }
+      }
+
+      hypre_CSRMatrixJ(diag) = diag_j;
+      hypre_CSRMatrixData(diag) = diag_data;
+      hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+      hypre_CSRMatrixJ(offd) = offd_j;
+      hypre_CSRMatrixData(offd) = offd_data;
+      hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+
+      /* generate col_map_offd */
+      nnz_offd = offd_i[num_rows];
+      if (nnz_offd)
+      {
+         tmp_j = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(tmp_j, big_offd_j, HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_BigQsort0(tmp_j, 0, nnz_offd - 1);
+         num_cols_offd = 1;
+         for (i = 0; i < nnz_offd - 1; i++)
+         {
+            if (tmp_j[i + 1] > tmp_j[i])
+            {
+               tmp_j[num_cols_offd++] = tmp_j[i + 1];
+            }
+         }
+         col_map_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(col_map_offd, tmp_j, HYPRE_BigInt, num_cols_offd,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < nnz_offd; i++)
+         {
+            offd_j[i] = hypre_BigBinarySearch(col_map_offd, big_offd_j[i], num_cols_offd);
+         }
+
+         if (base)
+         {
+            for (i = 0; i < num_cols_offd; i++)
+            {
+               col_map_offd[i] -= base;
+            }
+         }
+         hypre_TFree(hypre_ParCSRMatrixColMapOffd(par_matrix), HYPRE_MEMORY_HOST);
+         hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+         hypre_CSRMatrixNumCols(offd) = num_cols_offd;
+         hypre_TFree(tmp_j, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(big_offd_j, HYPRE_MEMORY_HOST);
+
+      hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+      /* Generate the nonzero rows in the diag and offd matrices */
+      hypre_CSRMatrixSetRownnz(diag);
+      hypre_CSRMatrixSetRownnz(offd);
+   }
+   else
+   {
+      /* merge into the existing sparsity pattern */
+      diag_j        = hypre_CSRMatrixJ(diag);
+      diag_data     = hypre_CSRMatrixData(diag);
+      offd_j        = hypre_CSRMatrixJ(offd);
+      offd_data     = hypre_CSRMatrixData(offd);
+      col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+      num_cols_offd = hypre_CSRMatrixNumCols(offd);
+      num_missing   = 0;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, s) reduction(+:num_missing) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int  j, j_offd, pos;
+
+         for (s = row_ptr[i]; s < row_end[i]; s++)
+         {
+            pos = -1;
+            if (sort_j[s] < col_0 || sort_j[s] > col_n)
+            {
+               j_offd = num_cols_offd ?
+                        hypre_BigBinarySearch(col_map_offd, sort_j[s] - base, num_cols_offd) : -1;
+               for (j = offd_i[i]; j_offd > -1 && j < offd_i[i + 1]; j++)
+               {
+                  if (offd_j[j] == j_offd)
+                  {
+                     pos = j;
+                     break;
+                  }
+               }
+               if (pos > -1)
+               {
+                  offd_data[pos] = sort_sora[s] ? sort_data[s] : offd_data[pos] + sort_data[s];
+                  if (rec_slot)
+                  {
+                     rec_slot[s] = -pos - 1;
+                  }
+               }
+            }
+            else
+            {
+               for (j = diag_i[i]; j < diag_i[i + 1]; j++)
+               {
+                  if (diag_j[j] == (HYPRE_Int)(sort_j[s] - col_0))
+                  {
+                     pos = j;
+                     break;
+                  }
+               }
+               if (pos > -1)
+               {
+                  diag_data[pos] = sort_sora[s] ? sort_data[s] : diag_data[pos] + sort_data[s];
+                  if (rec_slot)
+                  {
+                     rec_slot[s] = pos;
+                  }
+               }
+            }
+
+            if (pos < 0)
+            {
+               num_missing++;
+            }
+         }
+      }
+
+      if (num_missing)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Values were set for elements that are not in the matrix pattern!");
+         if (print_level)
+         {
+            hypre_printf(" Error, %d elements do not exist\n", num_missing);
+         }
+
+         /* do not reuse a pattern that does not match the matrix */
+         hypre_AuxParCSRPatternDestroy(pattern);
+         hypre_IJMatrixPattern(matrix) = NULL;
+         pattern = NULL;
+      }
+   }
+
+   if (pattern)
+   {
+      /* one slot per unique entry of each row, with the entries reduced into it */
+      HYPRE_Int num_slots = 0;
+      HYPRE_Int k, u;
+
+      for (i = 0; i < num_rows; i++)
+      {
+         num_slots += row_end[i] - row_ptr[i];
+      }
+      pattern -> num_slots    = num_slots;
+      pattern -> slots        = hypre_TAlloc(HYPRE_Int, num_slots,     HYPRE_MEMORY_HOST);
+      pattern -> slot_ptr     = hypre_TAlloc(HYPRE_Int, num_slots + 1, HYPRE_MEMORY_HOST);
+      pattern -> slot_entries = rec_entries;
+      rec_entries = NULL;
+
+      k = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         u = row_ptr[i];
+         for (s = row_ptr[i]; s < row_ptr[i + 1]; s++)
+         {
+            if (rec_first[s])
+            {
+               pattern -> slots[k]      = rec_slot[u++];
+               pattern -> slot_ptr[k++] = s;
+            }
+         }
+      }
+      pattern -> slot_ptr[num_slots] = row_ptr[num_rows];
+
+      pattern -> par_matrix = (void *) par_matrix;
+      pattern -> diag_nnz   = hypre_CSRMatrixNumNonzeros(diag);
+      pattern -> offd_nnz   = hypre_CSRMatrixNumNonzeros(offd);
+   }
+   hypre_TFree(rec_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(rec_first,   HYPRE_MEMORY_HOST);
+   hypre_TFree(rec_slot,    HYPRE_MEMORY_HOST);
+
+   hypre_TFree(row_ptr,   HYPRE_MEMORY_HOST);
+   hypre_TFree(row_end,   HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_sora, HYPRE_MEMORY_HOST);
+
+   /* Free memory */
+   hypre_AuxParCSRMatrixDestroy(aux_matrix);
+   hypre_IJMatrixTranslator(matrix) = NULL;
+
+   HYPRE_PRINT_MEMORY_USAGE(comm);
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
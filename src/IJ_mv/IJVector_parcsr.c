@@ -1095,26 +1095,41 @@ hypre_IJVectorAssembleOffProcValsPar( hypre_IJVector       *vector,
    /* use the send_proc_obj for the info kept from contacts */
    /*estimate inital storage allocation */
 
-   send_proc_obj.length = 0;
-   send_proc_obj.storage_length = num_real_procs + 5;
-   send_proc_obj.id = NULL; /* don't care who sent it to us */
-   send_proc_obj.vec_starts =
-      hypre_CTAlloc(HYPRE_Int,  send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
-   send_proc_obj.vec_starts[0] = 0;
-   send_proc_obj.element_storage_length = storage + 20;
-   send_proc_obj.v_elements =
-      hypre_TAlloc(char, obj_size_bytes * send_proc_obj.element_storage_length, HYPRE_MEMORY_HOST);
-
-   response_obj2.fill_response = hypre_FillResponseIJOffProcVals;
-   response_obj2.data1 = NULL;
-   response_obj2.data2 = &send_proc_obj;
-
-   max_response_size = 0;
-
-   hypre_DataExchangeList(num_real_procs, ex_contact_procs,
-                          void_contact_buf, ex_contact_vec_starts, obj_size_bytes,
-                          0, &response_obj2, max_response_size, 5,
-                          comm,  (void **) &response_buf, &response_buf_starts);
+   if (hypre_HandleUseNeighborColl(hypre_handle()))
+   {
+      /* the destinations are known now, so the sizes and the data can be
+         exchanged with neighborhood collectives */
+      hypre_DataExchangeNeighborList(num_real_procs, ex_contact_procs,
+                                     void_contact_buf, ex_contact_vec_starts, obj_size_bytes,
+                                     comm, &hypre_IJVectorExchangeGraph(vector),
+                                     &send_proc_obj.length, &send_proc_obj.id,
+                                     &send_proc_obj.vec_starts, &send_proc_obj.v_elements);
+      /* don't care who sent it to us */
+      hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      send_proc_obj.length = 0;
+      send_proc_obj.storage_length = num_real_procs + 5;
+      send_proc_obj.id = NULL; /* don't care who sent it to us */
+      send_proc_obj.vec_starts =
+         hypre_CTAlloc(HYPRE_Int,  send_proc_obj.storage_length + 1, HYPRE_MEMORY_HOST);
+      send_proc_obj.vec_starts[0] = 0;
+      send_proc_obj.element_storage_length = storage + 20;
+      send_proc_obj.v_elements =
+         hypre_TAlloc(char, obj_size_bytes * send_proc_obj.element_storage_length, HYPRE_MEMORY_HOST);
+
+      response_obj2.fill_response = hypre_FillResponseIJOffProcVals;
+      response_obj2.data1 = NULL;
+      response_obj2.data2 = &send_proc_obj;
+
+      max_response_size = 0;
+
+      hypre_DataExchangeList(num_real_procs, ex_contact_procs,
+                             void_contact_buf, ex_contact_vec_starts, obj_size_bytes,
+                             0, &response_obj2, max_response_size, 5,
+                             comm,  (void **) &response_buf, &response_buf_starts);
+   }
 
    /***********************************/
 
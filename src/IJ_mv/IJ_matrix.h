@@ -38,6 +38,13 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     assembly_mode;       /* host assembly algorithm (0: per-row
+                                         aux arrays, 1: COO stash and sort,
+                                         2: as 1, reusing the assembly pattern) */
+   void         *pattern;             /* assembly pattern recorded with
+                                         assembly_mode = 2 */
+   hypre_DataExchangeGraph *exchange_graph; /* graph communicator for the
+                                               off-processor value exchange */
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -62,6 +69,9 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixAssemblyMode(matrix)     ((matrix) -> assembly_mode)
+#define hypre_IJMatrixPattern(matrix)          ((matrix) -> pattern)
+#define hypre_IJMatrixExchangeGraph(matrix)    ((matrix) -> exchange_graph)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -31,6 +31,8 @@ typedef struct hypre_IJVector_struct
    HYPRE_BigInt  global_first_row;  /* these for data items are necessary */
    HYPRE_BigInt  global_num_rows;   /* to be able to avoid using the global partition */
    HYPRE_Int     print_level;
+   hypre_DataExchangeGraph *exchange_graph; /* graph communicator for the
+                                               off-processor value exchange */
 } hypre_IJVector;
 
 /*--------------------------------------------------------------------------
@@ -47,6 +49,7 @@ typedef struct hypre_IJVector_struct
 #define hypre_IJVectorGlobalFirstRow(vector)  ((vector) -> global_first_row)
 #define hypre_IJVectorGlobalNumRows(vector)   ((vector) -> global_num_rows)
 #define hypre_IJVectorPrintLevel(vector)      ((vector) -> print_level)
+#define hypre_IJVectorExchangeGraph(vector)   ((vector) -> exchange_graph)
 
 static inline HYPRE_MemoryLocation
 hypre_IJVectorMemoryLocation(hypre_IJVector *vector)
@@ -31,6 +31,75 @@ extern "C" {
 #ifndef hypre_AUX_PARCSR_MATRIX_HEADER
 #define hypre_AUX_PARCSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * Coordinate (COO) stash used by the host stash-and-sort assembly.
+ * Each thread appends to its own stash.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            size;                    /* number of stored entries */
+   HYPRE_Int            max_size;                /* allocated length */
+   HYPRE_BigInt        *i;                       /* global row indices */
+   HYPRE_BigInt        *j;                       /* global column indices */
+   HYPRE_Complex       *data;                    /* values */
+   char                *sora;                    /* Set (1) or Add (0) */
+} hypre_AuxParCSRStash;
+
+#define hypre_AuxParCSRStashSize(stash)           ((stash) -> size)
+#define hypre_AuxParCSRStashMaxSize(stash)        ((stash) -> max_size)
+#define hypre_AuxParCSRStashI(stash)              ((stash) -> i)
+#define hypre_AuxParCSRStashJ(stash)              ((stash) -> j)
+#define hypre_AuxParCSRStashData(stash)           ((stash) -> data)
+#define hypre_AuxParCSRStashSorA(stash)           ((stash) -> sora)
+
+/*--------------------------------------------------------------------------
+ * Assembly pattern recorded by the host stash assembly with assembly mode 2.
+ *
+ * The entries are numbered in stash order: the entries of the thread stashes
+ * 0, 1, ..., followed by the entries received from other processors. The
+ * pattern maps these entries to the slots of the assembled ParCSR matrix and
+ * keeps persistent requests for the exchange of the off-processor values, so
+ * that a later assembly of the same sequence of entries only moves values.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   void                *par_matrix;              /* matrix the slots refer to */
+   HYPRE_Int            diag_nnz;
+   HYPRE_Int            offd_nnz;
+
+   HYPRE_Int            num_stashes;             /* recorded thread stashes */
+   HYPRE_Int           *stash_starts;            /* first entry of each thread stash */
+   HYPRE_BigInt        *stash_i;                 /* recorded row and column indices */
+   HYPRE_BigInt        *stash_j;                 /* of the thread stash entries */
+   HYPRE_Int            num_entries;             /* stashed plus received entries */
+   HYPRE_Complex       *data;                    /* values of all entries */
+   char                *sora;                    /* Set (1) or Add (0) of all entries */
+
+   /* off-processor entries */
+   HYPRE_Int            num_off_rows;
+   HYPRE_Int           *off_row_procs;           /* owner of each off-processor row */
+   HYPRE_Int            num_reduced;             /* reduced off-processor values */
+   HYPRE_Int           *reduced_ptr;             /* entries reduced into each value */
+   HYPRE_Int           *reduced_entries;
+   HYPRE_Int            num_sends;
+   HYPRE_Int           *send_procs;
+   HYPRE_Int           *send_starts;
+   HYPRE_Int           *send_map;                /* reduced value at each send position */
+   HYPRE_Complex       *send_buf;
+   HYPRE_Int            num_recvs;
+   HYPRE_Int           *recv_procs;
+   HYPRE_Int           *recv_starts;             /* received values are stored in data */
+   hypre_MPI_Request   *requests;                /* persistent, receives first */
+
+   /* local entries */
+   HYPRE_Int            num_slots;
+   HYPRE_Int           *slots;                   /* k >= 0: diag_data[k], k < 0: offd_data[-k-1] */
+   HYPRE_Int           *slot_ptr;                /* entries reduced into each slot */
+   HYPRE_Int           *slot_entries;
+} hypre_AuxParCSRPattern;
+
 /*--------------------------------------------------------------------------
  * Auxiliary Parallel CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -80,6 +149,11 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   HYPRE_Int              num_stashes;           /* if > 0, entries are collected in per-thread
+                                                    COO stashes instead of aux_j, aux_data */
+   hypre_AuxParCSRStash **stashes;               /* num_stashes thread stashes, followed by
+                                                    the stash of the received entries */
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_BigInt         max_stack_elmts;
    HYPRE_BigInt         current_stack_elmts;
@@ -124,6 +198,10 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumStashes(matrix)           ((matrix) -> num_stashes)
+#define hypre_AuxParCSRMatrixStashes(matrix)              ((matrix) -> stashes)
+#define hypre_AuxParCSRMatrixRecvStash(matrix)            ((matrix) -> stashes[(matrix) -> num_stashes])
+
 #if defined(HYPRE_USING_GPU)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -247,6 +325,13 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     assembly_mode;       /* host assembly algorithm (0: per-row
+                                         aux arrays, 1: COO stash and sort,
+                                         2: as 1, reusing the assembly pattern) */
+   void         *pattern;             /* assembly pattern recorded with
+                                         assembly_mode = 2 */
+   hypre_DataExchangeGraph *exchange_graph; /* graph communicator for the
+                                               off-processor value exchange */
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -271,6 +356,9 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixAssemblyMode(matrix)     ((matrix) -> assembly_mode)
+#define hypre_IJMatrixPattern(matrix)          ((matrix) -> pattern)
+#define hypre_IJMatrixExchangeGraph(matrix)    ((matrix) -> exchange_graph)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -334,6 +422,8 @@ typedef struct hypre_IJVector_struct
    HYPRE_BigInt  global_first_row;  /* these for data items are necessary */
    HYPRE_BigInt  global_num_rows;   /* to be able to avoid using the global partition */
    HYPRE_Int     print_level;
+   hypre_DataExchangeGraph *exchange_graph; /* graph communicator for the
+                                               off-processor value exchange */
 } hypre_IJVector;
 
 /*--------------------------------------------------------------------------
@@ -350,6 +440,7 @@ typedef struct hypre_IJVector_struct
 #define hypre_IJVectorGlobalFirstRow(vector)  ((vector) -> global_first_row)
 #define hypre_IJVectorGlobalNumRows(vector)   ((vector) -> global_num_rows)
 #define hypre_IJVectorPrintLevel(vector)      ((vector) -> print_level)
+#define hypre_IJVectorExchangeGraph(vector)   ((vector) -> exchange_graph)
 
 static inline HYPRE_MemoryLocation
 hypre_IJVectorMemoryLocation(hypre_IJVector *vector)
@@ -381,6 +472,13 @@ HYPRE_Int hypre_AuxParCSRMatrixCreate ( hypre_AuxParCSRMatrix **aux_matrix,
 HYPRE_Int hypre_AuxParCSRMatrixDestroy ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixSetRownnz ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
+HYPRE_Int hypre_AuxParCSRStashDestroy ( hypre_AuxParCSRStash *stash );
+HYPRE_Int hypre_AuxParCSRStashResize ( hypre_AuxParCSRStash *stash, HYPRE_Int max_size );
+HYPRE_Int hypre_AuxParCSRPatternDestroy ( hypre_AuxParCSRPattern *pattern );
+HYPRE_Int hypre_AuxParCSRStashAppend ( hypre_AuxParCSRStash *stash, HYPRE_Int nrows,
+                                       HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes,
+                                       const HYPRE_BigInt *cols, const HYPRE_Complex *values, char sora );
+HYPRE_Int hypre_AuxParCSRMatrixInitializeStashes ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                               HYPRE_MemoryLocation memory_location );
 
@@ -479,6 +577,16 @@ HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix,
                                                        HYPRE_Complex value );
 
+/* IJMatrix_parcsr_stash.c */
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRStash ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                  HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                                  const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixAssembleParCSRStash ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_mm.c */
+HYPRE_Int hypre_IJMatrixReadMMParCSR ( const char *filename, MPI_Comm comm,
+                                       HYPRE_IJMatrix *matrix_ptr );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
                                             HYPRE_Int local_n );
@@ -572,6 +680,7 @@ HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int t
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetAssemblyMode ( HYPRE_IJMatrix matrix, HYPRE_Int mode );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
@@ -52,6 +52,8 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
+   hypre_AuxParCSRMatrixNumStashes(matrix) = 0;
+   hypre_AuxParCSRMatrixStashes(matrix) = NULL;
 #if defined(HYPRE_USING_GPU)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
    hypre_AuxParCSRMatrixCurrentStackElmts(matrix) = 0;
@@ -142,6 +144,15 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      if (hypre_AuxParCSRMatrixStashes(matrix))
+      {
+         for (i = 0; i <= hypre_AuxParCSRMatrixNumStashes(matrix); i++)
+         {
+            hypre_AuxParCSRStashDestroy(hypre_AuxParCSRMatrixStashes(matrix)[i]);
+         }
+         hypre_TFree(hypre_AuxParCSRMatrixStashes(matrix), HYPRE_MEMORY_HOST);
+      }
+
 #if defined(HYPRE_USING_GPU)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
@@ -242,6 +253,213 @@ hypre_AuxParCSRMatrixSetRownnz( hypre_AuxParCSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRStashDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRStashDestroy( hypre_AuxParCSRStash *stash )
+{
+   if (stash)
+   {
+      hypre_TFree(hypre_AuxParCSRStashI(stash),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRStashJ(stash),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRStashData(stash), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRStashSorA(stash), HYPRE_MEMORY_HOST);
+      hypre_TFree(stash, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRStashResize
+ *
+ * Makes room for at least max_size entries, preserving the stored ones.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRStashResize( hypre_AuxParCSRStash *stash,
+                            HYPRE_Int             max_size )
+{
+   HYPRE_Int old_max_size = hypre_AuxParCSRStashMaxSize(stash);
+
+   if (max_size > old_max_size)
+   {
+      hypre_AuxParCSRStashI(stash)    = hypre_TReAlloc(hypre_AuxParCSRStashI(stash),
+                                                       HYPRE_BigInt, max_size, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashJ(stash)    = hypre_TReAlloc(hypre_AuxParCSRStashJ(stash),
+                                                       HYPRE_BigInt, max_size, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashData(stash) = hypre_TReAlloc(hypre_AuxParCSRStashData(stash),
+                                                       HYPRE_Complex, max_size, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashSorA(stash) = hypre_TReAlloc(hypre_AuxParCSRStashSorA(stash),
+                                                       char, max_size, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashMaxSize(stash) = max_size;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRPatternDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRPatternDestroy( hypre_AuxParCSRPattern *pattern )
+{
+   HYPRE_Int i;
+
+   if (pattern)
+   {
+      if (pattern -> requests)
+      {
+         for (i = 0; i < pattern -> num_sends + pattern -> num_recvs; i++)
+         {
+            hypre_MPI_Request_free(&(pattern -> requests[i]));
+         }
+      }
+      hypre_TFree(pattern -> requests,        HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> stash_starts,    HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> stash_i,         HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> stash_j,         HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> data,            HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> sora,            HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> off_row_procs,   HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> reduced_ptr,     HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> reduced_entries, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_procs,      HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_starts,     HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_map,        HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_buf,        HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> recv_procs,      HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> recv_starts,     HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> slots,           HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> slot_ptr,        HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> slot_entries,    HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRStashAppend
+ *
+ * Appends nrows rows of entries to the stash. The arguments follow
+ * HYPRE_IJMatrixSetValues2; ncols and row_indexes may be NULL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRStashAppend( hypre_AuxParCSRStash *stash,
+                            HYPRE_Int             nrows,
+                            HYPRE_Int            *ncols,
+                            const HYPRE_BigInt   *rows,
+                            const HYPRE_Int      *row_indexes,
+                            const HYPRE_BigInt   *cols,
+                            const HYPRE_Complex  *values,
+                            char                  sora )
+{
+   HYPRE_BigInt          *stash_i;
+   HYPRE_BigInt          *stash_j;
+   HYPRE_Complex         *stash_data;
+   char                  *stash_sora;
+   HYPRE_Int              nnz, pos, indx, n;
+   HYPRE_Int              i, k;
+
+   /* count the entries and make room for them */
+   nnz = nrows;
+   if (ncols)
+   {
+      nnz = 0;
+      for (i = 0; i < nrows; i++)
+      {
+         nnz += hypre_max(ncols[i], 0);
+      }
+   }
+
+   pos = hypre_AuxParCSRStashSize(stash);
+   if (pos + nnz > hypre_AuxParCSRStashMaxSize(stash))
+   {
+      hypre_AuxParCSRStashResize(stash, hypre_max(pos + nnz, 2 * hypre_AuxParCSRStashMaxSize(stash)));
+   }
+
+   stash_i    = hypre_AuxParCSRStashI(stash);
+   stash_j    = hypre_AuxParCSRStashJ(stash);
+   stash_data = hypre_AuxParCSRStashData(stash);
+   stash_sora = hypre_AuxParCSRStashSorA(stash);
+
+   indx = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      n = ncols ? ncols[i] : 1;
+      if (row_indexes)
+      {
+         indx = row_indexes[i];
+      }
+      for (k = 0; k < n; k++)
+      {
+         stash_i[pos]    = rows[i];
+         stash_j[pos]    = cols[indx];
+         stash_data[pos] = values[indx];
+         stash_sora[pos] = sora;
+         pos++;
+         indx++;
+      }
+   }
+   hypre_AuxParCSRStashSize(stash) = pos;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRMatrixInitializeStashes
+ *
+ * Allocates one COO stash per thread, plus one for the entries received
+ * from other processors. Each stash is a separate allocation so that threads
+ * appending concurrently do not share cache lines.
+ *
+ * The stash array is built and filled before it is stored in the matrix, so
+ * that a thread seeing a non-NULL array (see
+ * hypre_IJMatrixSetAddValuesParCSRStash) always sees it fully initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRMatrixInitializeStashes( hypre_AuxParCSRMatrix *matrix )
+{
+   HYPRE_Int               num_stashes = hypre_AuxParCSRMatrixNumStashes(matrix);
+   hypre_AuxParCSRStash  **stashes;
+   HYPRE_Int               i;
+
+   if (hypre_AuxParCSRMatrixStashes(matrix))
+   {
+      return hypre_error_flag;
+   }
+
+   if (num_stashes < 1)
+   {
+      /* inside a parallel region, the team may be larger than the default */
+      num_stashes = hypre_max(hypre_NumThreads(), hypre_NumActiveThreads());
+   }
+
+   stashes = hypre_TAlloc(hypre_AuxParCSRStash *, num_stashes + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_stashes; i++)
+   {
+      stashes[i] = hypre_CTAlloc(hypre_AuxParCSRStash, 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_AuxParCSRMatrixNumStashes(matrix) = num_stashes;
+
+   /* publish the array last */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp flush
+#endif
+   hypre_AuxParCSRMatrixStashes(matrix) = stashes;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp flush
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AuxParCSRMatrixInitialize_v2
  *--------------------------------------------------------------------------*/
@@ -259,6 +477,12 @@ hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
       return -1;
    }
 
+   /* COO stash assembly does not use any of the row based structures */
+   if (hypre_AuxParCSRMatrixNumStashes(matrix) > 0)
+   {
+      return hypre_AuxParCSRMatrixInitializeStashes(matrix);
+   }
+
    if (local_num_rows == 0)
    {
       return 0;
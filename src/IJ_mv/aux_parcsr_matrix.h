@@ -16,6 +16,75 @@
 #ifndef hypre_AUX_PARCSR_MATRIX_HEADER
 #define hypre_AUX_PARCSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * Coordinate (COO) stash used by the host stash-and-sort assembly.
+ * Each thread appends to its own stash.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            size;                    /* number of stored entries */
+   HYPRE_Int            max_size;                /* allocated length */
+   HYPRE_BigInt        *i;                       /* global row indices */
+   HYPRE_BigInt        *j;                       /* global column indices */
+   HYPRE_Complex       *data;                    /* values */
+   char                *sora;                    /* Set (1) or Add (0) */
+} hypre_AuxParCSRStash;
+
+#define hypre_AuxParCSRStashSize(stash)           ((stash) -> size)
+#define hypre_AuxParCSRStashMaxSize(stash)        ((stash) -> max_size)
+#define hypre_AuxParCSRStashI(stash)              ((stash) -> i)
+#define hypre_AuxParCSRStashJ(stash)              ((stash) -> j)
+#define hypre_AuxParCSRStashData(stash)           ((stash) -> data)
+#define hypre_AuxParCSRStashSorA(stash)           ((stash) -> sora)
+
+/*--------------------------------------------------------------------------
+ * Assembly pattern recorded by the host stash assembly with assembly mode 2.
+ *
+ * The entries are numbered in stash order: the entries of the thread stashes
+ * 0, 1, ..., followed by the entries received from other processors. The
+ * pattern maps these entries to the slots of the assembled ParCSR matrix and
+ * keeps persistent requests for the exchange of the off-processor values, so
+ * that a later assembly of the same sequence of entries only moves values.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   void                *par_matrix;              /* matrix the slots refer to */
+   HYPRE_Int            diag_nnz;
+   HYPRE_Int            offd_nnz;
+
+   HYPRE_Int            num_stashes;             /* recorded thread stashes */
+   HYPRE_Int           *stash_starts;            /* first entry of each thread stash */
+   HYPRE_BigInt        *stash_i;                 /* recorded row and column indices */
+   HYPRE_BigInt        *stash_j;                 /* of the thread stash entries */
+   HYPRE_Int            num_entries;             /* stashed plus received entries */
+   HYPRE_Complex       *data;                    /* values of all entries */
+   char                *sora;                    /* Set (1) or Add (0) of all entries */
+
+   /* off-processor entries */
+   HYPRE_Int            num_off_rows;
+   HYPRE_Int           *off_row_procs;           /* owner of each off-processor row */
+   HYPRE_Int            num_reduced;             /* reduced off-processor values */
+   HYPRE_Int           *reduced_ptr;             /* entries reduced into each value */
+   HYPRE_Int           *reduced_entries;
+   HYPRE_Int            num_sends;
+   HYPRE_Int           *send_procs;
+   HYPRE_Int           *send_starts;
+   HYPRE_Int           *send_map;                /* reduced value at each send position */
+   HYPRE_Complex       *send_buf;
+   HYPRE_Int            num_recvs;
+   HYPRE_Int           *recv_procs;
+   HYPRE_Int           *recv_starts;             /* received values are stored in data */
+   hypre_MPI_Request   *requests;                /* persistent, receives first */
+
+   /* local entries */
+   HYPRE_Int            num_slots;
+   HYPRE_Int           *slots;                   /* k >= 0: diag_data[k], k < 0: offd_data[-k-1] */
+   HYPRE_Int           *slot_ptr;                /* entries reduced into each slot */
+   HYPRE_Int           *slot_entries;
+} hypre_AuxParCSRPattern;
+
 /*--------------------------------------------------------------------------
  * Auxiliary Parallel CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -65,6 +134,11 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   HYPRE_Int              num_stashes;           /* if > 0, entries are collected in per-thread
+                                                    COO stashes instead of aux_j, aux_data */
+   hypre_AuxParCSRStash **stashes;               /* num_stashes thread stashes, followed by
+                                                    the stash of the received entries */
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_BigInt         max_stack_elmts;
    HYPRE_BigInt         current_stack_elmts;
@@ -109,6 +183,10 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumStashes(matrix)           ((matrix) -> num_stashes)
+#define hypre_AuxParCSRMatrixStashes(matrix)              ((matrix) -> stashes)
+#define hypre_AuxParCSRMatrixRecvStash(matrix)            ((matrix) -> stashes[(matrix) -> num_stashes])
+
 #if defined(HYPRE_USING_GPU)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -11,6 +11,13 @@ HYPRE_Int hypre_AuxParCSRMatrixCreate ( hypre_AuxParCSRMatrix **aux_matrix,
 HYPRE_Int hypre_AuxParCSRMatrixDestroy ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixSetRownnz ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
+HYPRE_Int hypre_AuxParCSRStashDestroy ( hypre_AuxParCSRStash *stash );
+HYPRE_Int hypre_AuxParCSRStashResize ( hypre_AuxParCSRStash *stash, HYPRE_Int max_size );
+HYPRE_Int hypre_AuxParCSRPatternDestroy ( hypre_AuxParCSRPattern *pattern );
+HYPRE_Int hypre_AuxParCSRStashAppend ( hypre_AuxParCSRStash *stash, HYPRE_Int nrows,
+                                       HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes,
+                                       const HYPRE_BigInt *cols, const HYPRE_Complex *values, char sora );
+HYPRE_Int hypre_AuxParCSRMatrixInitializeStashes ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                               HYPRE_MemoryLocation memory_location );
 
@@ -109,6 +116,16 @@ HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix,
                                                        HYPRE_Complex value );
 
+/* IJMatrix_parcsr_stash.c */
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRStash ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                  HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                                  const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixAssembleParCSRStash ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_mm.c */
+HYPRE_Int hypre_IJMatrixReadMMParCSR ( const char *filename, MPI_Comm comm,
+                                       HYPRE_IJMatrix *matrix_ptr );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
                                             HYPRE_Int local_n );
@@ -202,6 +219,7 @@ HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int t
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetAssemblyMode ( HYPRE_IJMatrix matrix, HYPRE_Int mode );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
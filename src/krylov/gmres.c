@@ -65,6 +65,24 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetFusedOps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetFusedOps(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+)
+{
+   gmres_functions->MassAxpy = MassAxpy;
+   gmres_functions->AxpyNorm = AxpyNorm;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -542,9 +560,21 @@ hypre_GMRESSolve(void  *gmres_vdata,
          for (j = 0; j < i; j++)
          {
             hh[j][i - 1] = (*(gmres_functions->InnerProd))(p[j], p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+            if (j == i - 1 && gmres_functions->AxpyNorm)
+            {
+               /* fuse the last projection with the norm of p[i] */
+               t = (*(gmres_functions->AxpyNorm))(-hh[j][i - 1], p[j], p[i]);
+            }
+            else
+            {
+               (*(gmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+            }
+         }
+         if (!gmres_functions->AxpyNorm)
+         {
+            t = (*(gmres_functions->InnerProd))(p[i], p[i]);
          }
-         t = hypre_sqrt((*(gmres_functions->InnerProd))(p[i], p[i]));
+         t = hypre_sqrt(t);
          hh[i][i - 1] = t;
          if (t != 0.0)
          {
@@ -651,11 +681,19 @@ hypre_GMRESSolve(void  *gmres_vdata,
                   rs_2[k] = t / hh[k][k];
                }
 
-               (*(gmres_functions->CopyVector))(p[i - 1], w);
-               (*(gmres_functions->ScaleVector))(rs_2[i - 1], w);
-               for (j = i - 2; j >= 0; j--)
+               if (gmres_functions->MassAxpy)
+               {
+                  (*(gmres_functions->ClearVector))(w);
+                  (*(gmres_functions->MassAxpy))(rs_2, p, w, i, 0);
+               }
+               else
                {
-                  (*(gmres_functions->Axpy))(rs_2[j], p[j], w);
+                  (*(gmres_functions->CopyVector))(p[i - 1], w);
+                  (*(gmres_functions->ScaleVector))(rs_2[i - 1], w);
+                  for (j = i - 2; j >= 0; j--)
+                  {
+                     (*(gmres_functions->Axpy))(rs_2[j], p[j], w);
+                  }
                }
                (*(gmres_functions->ClearVector))(r);
                /* find correction (in r) */
@@ -749,11 +787,19 @@ hypre_GMRESSolve(void  *gmres_vdata,
          rs[k] = t / hh[k][k];
       }
 
-      (*(gmres_functions->CopyVector))(p[i - 1], w);
-      (*(gmres_functions->ScaleVector))(rs[i - 1], w);
-      for (j = i - 2; j >= 0; j--)
+      if (gmres_functions->MassAxpy)
       {
-         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+         (*(gmres_functions->ClearVector))(w);
+         (*(gmres_functions->MassAxpy))(rs, p, w, i, 0);
+      }
+      else
+      {
+         (*(gmres_functions->CopyVector))(p[i - 1], w);
+         (*(gmres_functions->ScaleVector))(rs[i - 1], w);
+         for (j = i - 2; j >= 0; j--)
+         {
+            (*(gmres_functions->Axpy))(rs[j], p[j], w);
+         }
       }
 
       (*(gmres_functions->ClearVector))(r);
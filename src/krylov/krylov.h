@@ -412,6 +412,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional fused vector operations (NULL if not provided) */
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll );
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
 
@@ -498,6 +503,19 @@ extern "C" {
       HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Registers optional fused vector operations.  Any of them may be NULL, in
+    * which case GMRES falls back on the basic operations.
+    **/
+
+   HYPRE_Int
+   hypre_GMRESFunctionsSetFusedOps(
+      hypre_GMRESFunctions *gmres_functions,
+      HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                      HYPRE_Int unroll ),
+      HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y )
+   );
+
    /**
     * Description...
     *
@@ -1067,6 +1085,12 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional fused vector operations (NULL if not provided) */
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result );
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y );
+
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
@@ -1191,6 +1215,20 @@ extern "C" {
       HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Registers optional fused vector operations.  Any of them may be NULL, in
+    * which case PCG falls back on the basic operations.
+    **/
+
+   HYPRE_Int
+   hypre_PCGFunctionsSetFusedOps(
+      hypre_PCGFunctions *pcg_functions,
+      HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll,
+                                      void *result ),
+      HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y ),
+      HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y )
+   );
+
    /**
     * Description...
     *
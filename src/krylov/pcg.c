@@ -72,6 +72,26 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetFusedOps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetFusedOps(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y )
+)
+{
+   pcg_functions->MassInnerProd = MassInnerProd;
+   pcg_functions->AxpyNorm      = AxpyNorm;
+   pcg_functions->Xpay          = Xpay;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -367,6 +387,8 @@ hypre_PCGSolve( void *pcg_vdata,
 
    HYPRE_Real      i_prod = 0.0;
    HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      r_prod = 0.0;
+   HYPRE_Int       have_r_prod = 0;
    HYPRE_Real      cf_ave_0 = 0.0;
    HYPRE_Real      cf_ave_1 = 0.0;
    HYPRE_Real      weight;
@@ -641,7 +663,16 @@ hypre_PCGSolve( void *pcg_vdata,
       /* r = r - alpha*s */
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->Axpy))(-alpha, s, r);
+         if (two_norm && pcg_functions->AxpyNorm)
+         {
+            /* fuse the update with <r,r> needed by the convergence test */
+            r_prod = (*(pcg_functions->AxpyNorm))(-alpha, s, r);
+            have_r_prod = 1;
+         }
+         else
+         {
+            (*(pcg_functions->Axpy))(-alpha, s, r);
+         }
       }
       else
       {
@@ -716,10 +747,25 @@ hypre_PCGSolve( void *pcg_vdata,
       precond(precond_data, A, r, s);
 
       /* gamma = <r,s> */
-      gamma = (*(pcg_functions->InnerProd))(r, s);
-      if (flex)
+      if (flex && pcg_functions->MassInnerProd)
       {
-         delta = gamma - (*(pcg_functions->InnerProd))(r_old, s);
+         /* compute <s,r> and <s,r_old> with a single reduction */
+         void       *rr[2];
+         HYPRE_Real  prods[2];
+
+         rr[0] = r;
+         rr[1] = r_old;
+         (*(pcg_functions->MassInnerProd))(s, rr, 2, 0, prods);
+         gamma = prods[0];
+         delta = gamma - prods[1];
+      }
+      else
+      {
+         gamma = (*(pcg_functions->InnerProd))(r, s);
+         if (flex)
+         {
+            delta = gamma - (*(pcg_functions->InnerProd))(r_old, s);
+         }
       }
 
       /* residual-based stopping criteria: ||r_new-r_old||_C < rtol ||b||_C */
@@ -744,7 +790,8 @@ hypre_PCGSolve( void *pcg_vdata,
       /* set i_prod for convergence test */
       if (two_norm)
       {
-         i_prod = (*(pcg_functions->InnerProd))(r, r);
+         i_prod = have_r_prod ? r_prod : (*(pcg_functions->InnerProd))(r, r);
+         have_r_prod = 0;
       }
       else
       {
@@ -964,11 +1011,18 @@ hypre_PCGSolve( void *pcg_vdata,
          beta = delta / gamma_old;
       }
 
-      /* p = s + beta p */
+      /* p = s + beta p (no dot is fused here: the next one needs A*p) */
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->ScaleVector))(beta, p);
-         (*(pcg_functions->Axpy))(1.0, s, p);
+         if (pcg_functions->Xpay)
+         {
+            (*(pcg_functions->Xpay))(beta, s, p);
+         }
+         else
+         {
+            (*(pcg_functions->ScaleVector))(beta, p);
+            (*(pcg_functions->Axpy))(1.0, s, p);
+         }
       }
       else
       {
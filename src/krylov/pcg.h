@@ -64,6 +64,12 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional fused vector operations (NULL if not provided) */
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result );
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -188,6 +194,20 @@ hypre_PCGFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
 );
 
+/**
+ * Registers optional fused vector operations.  Any of them may be NULL, in
+ * which case PCG falls back on the basic operations.
+ **/
+
+HYPRE_Int
+hypre_PCGFunctionsSetFusedOps(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll,
+                                   void *result ),
+   HYPRE_Real   (*AxpyNorm)      ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y )
+);
+
 /**
  * Description...
  *
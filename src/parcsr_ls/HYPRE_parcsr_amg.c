@@ -1508,6 +1508,17 @@ HYPRE_BoomerAMGSetFSAIKapTolerance( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetFSAIKapTolerance( (void *) solver, kap_tolerance ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFSAIPatternReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFSAIPatternReuse( HYPRE_Solver  solver,
+                                    HYPRE_Int     pattern_reuse  )
+{
+   return ( hypre_BoomerAMGSetFSAIPatternReuse( (void *) solver, pattern_reuse ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetNumFunctions
  *--------------------------------------------------------------------------*/
@@ -1966,6 +1977,17 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyEigReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyEigReuse( HYPRE_Solver  solver,
+                                 HYPRE_Int     eig_reuse )
+{
+   return ( hypre_BoomerAMGSetChebyEigReuse( (void *) solver, eig_reuse ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -264,6 +264,28 @@ HYPRE_FSAIGetKapTolerance( HYPRE_Solver  solver,
    return ( hypre_FSAIGetKapTolerance( (void *) solver, kap_tolerance ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAISetPatternReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAISetPatternReuse( HYPRE_Solver solver,
+                           HYPRE_Int    pattern_reuse )
+{
+   return ( hypre_FSAISetPatternReuse( (void *) solver, pattern_reuse ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAIGetPatternReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAIGetPatternReuse( HYPRE_Solver  solver,
+                           HYPRE_Int    *pattern_reuse )
+{
+   return ( hypre_FSAIGetPatternReuse( (void *) solver, pattern_reuse ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_FSAISetTolerance
  *--------------------------------------------------------------------------*/
@@ -265,6 +265,26 @@ HYPRE_ILUSetLocalReordering(  HYPRE_Solver solver, HYPRE_Int ordering_type )
    return hypre_ILUSetLocalReordering(solver, ordering_type);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetNumLocalParts
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ILUSetNumLocalParts( HYPRE_Solver solver, HYPRE_Int num_local_parts )
+{
+   return hypre_ILUSetNumLocalParts(solver, num_local_parts);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetBlockSize
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ILUSetBlockSize( HYPRE_Solver solver, HYPRE_Int block_size )
+{
+   return hypre_ILUSetBlockSize(solver, block_size);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ILUGetNumIterations
  *--------------------------------------------------------------------------*/
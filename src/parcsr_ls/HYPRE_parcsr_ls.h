@@ -926,7 +926,15 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyScale (HYPRE_Solver solver,
 
 /**
  * (Optional) Defines which polynomial variant should be used.
- *  The default is 0 (i.e., scaled).
+ * The following options exist for \e variant:
+ *
+ *    - 0 : standard Chebyshev (default)
+ *    - 1 : modified Chebyshev, T(t) * (1 - b/t)
+ *    - 2 : fourth-kind Chebyshev. Only the upper bound of the spectrum
+ *          is used, so the Chebyshev fraction is ignored
+ *    - 3 : fourth-kind Chebyshev with optimized weights
+ *
+ * Variants 2 and 3 are currently available for host execution only.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
                                           HYPRE_Int   variant);
@@ -942,6 +950,18 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                          HYPRE_Int   eig_est);
 
+/**
+ * (Optional) Reuses the CG eigenvalue estimates across setup calls.
+ *  If eig_reuse=1 and eig_est is positive, the CG estimates of each level
+ *  are computed only in the first setup, where their ratios to the
+ *  Gershgorin bound of the level are cached. Subsequent setups compute the
+ *  Gershgorin bound only (no matrix-vector products) and scale it by the
+ *  cached ratios. Levels that did not exist in the first setup still use CG.
+ *  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse (HYPRE_Solver solver,
+                                           HYPRE_Int   eig_reuse);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1142,7 +1162,8 @@ HYPRE_Int HYPRE_BoomerAMGSetILUDroptol( HYPRE_Solver  solver,
                                         HYPRE_Real    ilu_droptol);
 
 /**
- * (Optional) Defines triangular solver for ILU(k,T) smoother: 0-iterative, 1-direct (default)
+ * (Optional) Defines triangular solver for ILU(k,T) smoother: 0-iterative, 1-direct (default),
+ * 2-direct with level scheduling
  * For further explanation see description of ILU.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetILUTriSolve( HYPRE_Solver  solver,
@@ -1261,6 +1282,15 @@ HYPRE_Int HYPRE_BoomerAMGSetFSAIEigMaxIters(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetFSAIKapTolerance(HYPRE_Solver solver,
                                              HYPRE_Real   kap_tolerance);
 
+/**
+ * (Optional) Keeps the sparsity pattern of the FSAI smoothers across setup
+ * calls. When the hierarchy is rebuilt, the smoother of a level whose local
+ * size is unchanged only recomputes its coefficients.
+ * For further explanation see \e HYPRE_FSAISetPatternReuse.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFSAIPatternReuse(HYPRE_Solver solver,
+                                             HYPRE_Int    pattern_reuse);
+
 /**
  * (Optional) Defines which parallel restriction operator is used.
  * There are the following options for restr_type:
@@ -1684,6 +1714,10 @@ HYPRE_Int HYPRE_FSAISolve( HYPRE_Solver       solver,
  *      - 1: Adaptive (can use OpenMP with static scheduling)
  *      - 2: Adaptive OpenMP with dynamic scheduling
  *      - 3: Static - power pattern
+ *
+ * With algorithm type 3, the pattern of G is known before computing its
+ * coefficients, so on the host the local linear systems are solved in batches
+ * (see \e HYPRE_FSAISetLocalSolveType).
  **/
 HYPRE_Int HYPRE_FSAISetAlgoType( HYPRE_Solver solver,
                                  HYPRE_Int    algo_type );
@@ -1695,6 +1729,9 @@ HYPRE_Int HYPRE_FSAISetAlgoType( HYPRE_Solver solver,
  *      - 0: Gauss-Jordan solver
  *      - 1: Vendor solver (cuSOLVER/rocSOLVER)
  *      - 2: MAGMA solver
+ *
+ * On the host, the static algorithm (type 3) always uses a batched Cholesky
+ * solver that groups local systems of equal size and is threaded with OpenMP.
  **/
 HYPRE_Int HYPRE_FSAISetLocalSolveType( HYPRE_Solver solver,
                                        HYPRE_Int    local_solve_type );
@@ -1747,6 +1784,20 @@ HYPRE_Int HYPRE_FSAISetThreshold( HYPRE_Solver solver,
 HYPRE_Int HYPRE_FSAISetKapTolerance( HYPRE_Solver solver,
                                      HYPRE_Real   kap_tolerance );
 
+/**
+ * (Optional) Keeps the sparsity pattern of G across calls to
+ * \e HYPRE_FSAISetup. This is useful when the matrix changes values but not
+ * its nonzero structure, e.g., across time steps. When set to 1, the first
+ * setup computes the pattern as usual, while subsequent setups with a matrix
+ * of the same local size skip the pattern computation and only recompute the
+ * coefficients of G using batched dense solves. The default is 0.
+ *
+ * Pattern reuse is currently available for host execution only. On the
+ * device, every setup computes a new pattern.
+ **/
+HYPRE_Int HYPRE_FSAISetPatternReuse( HYPRE_Solver solver,
+                                     HYPRE_Int    pattern_reuse );
+
 /**
  * (Optional) Sets the relaxation factor for FSAI. This input parameter makes
  * sense to all algorithm types for setting up FSAI.
@@ -4556,6 +4607,38 @@ HYPRE_Int
 HYPRE_MGRSetLevelPMaxElmts( HYPRE_Solver solver,
                             HYPRE_Int *P_max_elmts );
 
+/**
+ * (Optional) Set how much of the setup data computed by a previous call to
+ * HYPRE_MGRSetup is reused by subsequent calls. This is useful when solving a
+ * sequence of linear systems with the same sparsity pattern and slowly varying
+ * coefficients. Options for \e setup_reuse are:
+ *
+ *    - 0 : rebuild all setup data (default).
+ *    - 1 : keep the C/F splitting. The interpolation and restriction
+ *          operators, the coarse level matrices and the smoothers are
+ *          recomputed from the new matrix.
+ *    - 2 : same as 1, but lag the interpolation and restriction operators,
+ *          i.e., keep the ones computed from the previous matrix. Only the
+ *          coarse level matrices and the smoothers are recomputed.
+ *    - 3 : same as 2, and also lag the F-relaxation solver (e.g., the
+ *          AMG hierarchy built for A_FF of the previous matrix).
+ *
+ * Levels can only be reused from the finest level down: when a level is
+ * rebuilt, all coarser levels are rebuilt as well. Options 2 and 3 fall back
+ * to 1 for levels that use a non-Galerkin coarse grid method other than 5.
+ **/
+HYPRE_Int
+HYPRE_MGRSetSetupReuse( HYPRE_Solver solver,
+                        HYPRE_Int setup_reuse );
+
+/**
+ * (Optional) Set the setup reuse option for each level. See
+ * HYPRE_MGRSetSetupReuse for the available options.
+ **/
+HYPRE_Int
+HYPRE_MGRSetLevelSetupReuse( HYPRE_Solver solver,
+                             HYPRE_Int *setup_reuse );
+
 /**
  * (Optional) Return the norm of the final relative residual.
  **/
@@ -4634,7 +4717,11 @@ HYPRE_ILUSetMaxIter( HYPRE_Solver solver, HYPRE_Int max_iter );
  *    -  3 : Synchronous with explicit storage splitting
  *    -  4 : Semi-synchronous with explicit storage splitting
  *
- * Note: Iterative ILU is available only for zero fill-in and it depends on rocSPARSE.
+ * Note: On the device, iterative ILU is available only for zero fill-in and it depends
+ * on rocSPARSE. On the host, it is available for block-Jacobi ILU(k) (\e ilu_type 0) with
+ * any level of fill. There, the nonzeros of the factors are updated with OpenMP by the
+ * fixed-point sweeps of Chow and Patel on the ILU(k) pattern; types 1 and 2 update the
+ * factors in place.
  **/
 HYPRE_Int
 HYPRE_ILUSetIterativeSetupType( HYPRE_Solver solver, HYPRE_Int iter_setup_type );
@@ -4656,7 +4743,9 @@ HYPRE_ILUSetIterativeSetupType( HYPRE_Solver solver, HYPRE_Int iter_setup_type )
  * To use correction norms instead, enable option 4. Lastly, the convergence history for
  * computing the triangular factors can be saved and printed out by enabling option 16.
  *
- * Note: Iterative ILU is available only for zero fill-in, and it depends on rocSPARSE.
+ * Note: Iterative ILU is available only for zero fill-in on the device, and it depends on
+ * rocSPARSE. See \e HYPRE_ILUSetIterativeSetupType for the host algorithm, which ignores
+ * option 32.
  **/
 HYPRE_Int
 HYPRE_ILUSetIterativeSetupOption( HYPRE_Solver solver, HYPRE_Int iter_setup_option );
@@ -4664,7 +4753,7 @@ HYPRE_ILUSetIterativeSetupOption( HYPRE_Solver solver, HYPRE_Int iter_setup_opti
 /**
  * (Optional) Set the max. number of iterations for the iterative ILU algorithm.
  *
- * Note: Iterative ILU is available only for zero fill-in and it depends on rocSPARSE.
+ * Note: See \e HYPRE_ILUSetIterativeSetupType for availability.
  **/
 HYPRE_Int
 HYPRE_ILUSetIterativeSetupMaxIter( HYPRE_Solver solver, HYPRE_Int iter_setup_max_iter );
@@ -4672,7 +4761,7 @@ HYPRE_ILUSetIterativeSetupMaxIter( HYPRE_Solver solver, HYPRE_Int iter_setup_max
 /**
  * (Optional) Set the stop tolerance for the iterative ILU algorithm.
  *
- * Note: Iterative ILU is available only for zero fill-in and it depends on rocSPARSE.
+ * Note: See \e HYPRE_ILUSetIterativeSetupType for availability.
  **/
 HYPRE_Int
 HYPRE_ILUSetIterativeSetupTolerance( HYPRE_Solver solver, HYPRE_Real iter_setup_tolerance );
@@ -4682,6 +4771,10 @@ HYPRE_ILUSetIterativeSetupTolerance( HYPRE_Solver solver, HYPRE_Real iter_setup_
  *
  *    -  0 : iterative
  *    -  1 : direct (default)
+ *    -  2 : direct, level-scheduled. The levels of the L and U factors are
+ *           computed at setup, and the rows of each level are solved in parallel
+ *           with OpenMP. Used by the host block Jacobi (0, 1) and RAS (30, 31)
+ *           ILU types; otherwise the same as 1.
  **/
 HYPRE_Int
 HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
@@ -4798,10 +4891,41 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
  * Options for \e reordering_type are:
  *    - 0 : No reordering
  *    - 1 : RCM (default)
+ *    - 2 : RCM followed by a dissection of the local matrix into independent
+ *          interior subdomains and a separator. For block-Jacobi ILU(k) and
+ *          ILUT (types 0 and 1) on the host, the interior subdomains are then
+ *          factored concurrently with OpenMP. Other ILU types use RCM.
  **/
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Set the number of interior subdomains of the local matrix used
+ * by the dissection reordering (\e reordering_type = 2). The default (0)
+ * uses one subdomain per OpenMP thread.
+ **/
+HYPRE_Int
+HYPRE_ILUSetNumLocalParts( HYPRE_Solver solver, HYPRE_Int num_local_parts );
+
+/**
+ * (Optional) Set the number of unknowns per node. When \e block_size > 1,
+ * block-Jacobi ILU(k) (\e ilu_type = 0) on the host factors the local matrix
+ * with dense block_size x block_size blocks, and applies the block triangular
+ * factors directly. The local rows must be ordered node by node, i.e., the
+ * unknowns of a node are contiguous. Reordering, if requested, is applied to
+ * the node graph. If the number of local rows is not a multiple of
+ * \e block_size, the scalar factorization is used. Other ILU types ignore
+ * this option. The default is 1.
+ *
+ * Note: Block ILU(k) does not support the iterative setup and uses RCM for
+ * the dissection reordering (\e reordering_type = 2). A singular diagonal
+ * block is replaced by the inverse of its diagonal. In each of these cases,
+ * a warning is issued through the error flag (\e HYPRE_ERROR_ARG, or
+ * \e HYPRE_ERROR_GENERIC for singular blocks) and the setup proceeds.
+ **/
+HYPRE_Int
+HYPRE_ILUSetBlockSize( HYPRE_Solver solver, HYPRE_Int block_size );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -933,6 +933,40 @@ HYPRE_MGRSetLevelPMaxElmts( HYPRE_Solver  solver,
    return hypre_MGRSetLevelPMaxElmts(solver, P_max_elmts);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetSetupReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_MGRSetSetupReuse( HYPRE_Solver solver,
+                        HYPRE_Int    setup_reuse )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return hypre_MGRSetSetupReuse(solver, setup_reuse);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_MGRSetLevelSetupReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_MGRSetLevelSetupReuse( HYPRE_Solver  solver,
+                             HYPRE_Int    *setup_reuse )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return hypre_MGRSetLevelSetupReuse(solver, setup_reuse);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_MGRGetCoarseGridConvergenceFactor
  *--------------------------------------------------------------------------*/
@@ -186,6 +186,7 @@ typedef struct
    HYPRE_Real           fsai_threshold;
    HYPRE_Int            fsai_eig_max_iters;
    HYPRE_Real           fsai_kap_tolerance;
+   HYPRE_Int            fsai_pattern_reuse;
 
    HYPRE_Real          *max_eig_est;
    HYPRE_Real          *min_eig_est;
@@ -196,6 +197,9 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_reuse;
+   HYPRE_Int            cheby_num_eig_ratios;
+   HYPRE_Real          *cheby_eig_ratios;  /* cached CG/Gershgorin eigenvalue ratios */
 
    HYPRE_Real           cum_nnz_AP;
 
@@ -450,6 +454,7 @@ typedef struct
 #define hypre_ParAMGDataFSAIThreshold(amg_data) ((amg_data)->fsai_threshold)
 #define hypre_ParAMGDataFSAIEigMaxIters(amg_data) ((amg_data)->fsai_eig_max_iters)
 #define hypre_ParAMGDataFSAIKapTolerance(amg_data) ((amg_data)->fsai_kap_tolerance)
+#define hypre_ParAMGDataFSAIPatternReuse(amg_data) ((amg_data)->fsai_pattern_reuse)
 
 #define hypre_ParAMGDataMaxEigEst(amg_data) ((amg_data)->max_eig_est)
 #define hypre_ParAMGDataMinEigEst(amg_data) ((amg_data)->min_eig_est)
@@ -460,6 +465,9 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigReuse(amg_data) ((amg_data)->cheby_eig_reuse)
+#define hypre_ParAMGDataChebyNumEigRatios(amg_data) ((amg_data)->cheby_num_eig_ratios)
+#define hypre_ParAMGDataChebyEigRatios(amg_data) ((amg_data)->cheby_eig_ratios)
 
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
@@ -842,6 +850,12 @@ typedef struct
 
 //#define DEBUG_FSAI
 
+/* Number of local systems packed together by the host batched solver */
+#define HYPRE_FSAI_BATCH_SIZE 32
+
+/* Larger local systems are solved one at a time with LAPACK */
+#define HYPRE_FSAI_BATCH_MAX_SIZE 64
+
 /*--------------------------------------------------------------------------
  * hypre_ParFSAIData
  *--------------------------------------------------------------------------*/
@@ -857,6 +871,7 @@ typedef struct hypre_ParFSAIData_struct
    HYPRE_Int             num_levels;       /* Number of levels for computing the candidate pattern */
    HYPRE_Real            threshold;        /* Filtering threshold for the candidate pattern */
    HYPRE_Real            kap_tolerance;    /* Min. amount of change between two steps */
+   HYPRE_Int             pattern_reuse;    /* Keep the pattern of G across setup calls */
 
    /* FSAI Setup data */
    HYPRE_Real            density;          /* Density of matrix G wrt. A */
@@ -894,6 +909,7 @@ typedef struct hypre_ParFSAIData_struct
 #define hypre_ParFSAIDataNumLevels(fsai_data)               ((fsai_data) -> num_levels)
 #define hypre_ParFSAIDataThreshold(fsai_data)               ((fsai_data) -> threshold)
 #define hypre_ParFSAIDataKapTolerance(fsai_data)            ((fsai_data) -> kap_tolerance)
+#define hypre_ParFSAIDataPatternReuse(fsai_data)            ((fsai_data) -> pattern_reuse)
 
 /* FSAI Setup data */
 #define hypre_ParFSAIDataGmat(fsai_data)                    ((fsai_data) -> Gmat)
@@ -1182,6 +1198,25 @@ typedef struct hypre_ParILUData_struct
    HYPRE_Int             nI;
    HYPRE_Int            *u_end; /* used when schur block is formed */
 
+   /* Level schedules of L and U for the host direct triangular solves (tri_solve = 2).
+    * Rows lower_level_rows[lower_level_ptr[k]:lower_level_ptr[k+1]-1] of L only depend
+    * on rows of lower levels, and similarly for U */
+   HYPRE_Int             num_lower_levels;
+   HYPRE_Int            *lower_level_ptr;
+   HYPRE_Int            *lower_level_rows;
+   HYPRE_Int             num_upper_levels;
+   HYPRE_Int            *upper_level_ptr;
+   HYPRE_Int            *upper_level_rows;
+
+   /* Block ILU(k) factors on the host, for systems with block_size unknowns per node.
+    * L and U are strictly triangular block CSR matrices in the (node) ordering given
+    * by block_perm, and block_D holds the inverses of the diagonal blocks */
+   HYPRE_Int             block_size;
+   HYPRE_Int            *block_perm;
+   hypre_CSRBlockMatrix *matBL;
+   HYPRE_Real           *matBD;
+   hypre_CSRBlockMatrix *matBU;
+
    /* Iterative ILU parameters */
    HYPRE_Int             iter_setup_type;
    HYPRE_Int             iter_setup_option;
@@ -1263,6 +1298,8 @@ typedef struct hypre_ParILUData_struct
 
    /* local reordering */
    HYPRE_Int             reordering_type;
+   HYPRE_Int             num_local_parts; /* interior subdomains for reordering_type = 2 */
+   HYPRE_Int            *local_part_ptr;  /* interior subdomains offsets in perm */
 } hypre_ParILUData;
 
 #define hypre_ParILUDataTestOption(ilu_data)                   ((ilu_data) -> test_opt)
@@ -1318,6 +1355,17 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataNLU(ilu_data)                          ((ilu_data) -> nLU)
 #define hypre_ParILUDataNI(ilu_data)                           ((ilu_data) -> nI)
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
+#define hypre_ParILUDataNumLowerLevels(ilu_data)               ((ilu_data) -> num_lower_levels)
+#define hypre_ParILUDataLowerLevelPtr(ilu_data)                ((ilu_data) -> lower_level_ptr)
+#define hypre_ParILUDataLowerLevelRows(ilu_data)               ((ilu_data) -> lower_level_rows)
+#define hypre_ParILUDataNumUpperLevels(ilu_data)               ((ilu_data) -> num_upper_levels)
+#define hypre_ParILUDataUpperLevelPtr(ilu_data)                ((ilu_data) -> upper_level_ptr)
+#define hypre_ParILUDataUpperLevelRows(ilu_data)               ((ilu_data) -> upper_level_rows)
+#define hypre_ParILUDataBlockSize(ilu_data)                    ((ilu_data) -> block_size)
+#define hypre_ParILUDataBlockPerm(ilu_data)                    ((ilu_data) -> block_perm)
+#define hypre_ParILUDataMatBL(ilu_data)                        ((ilu_data) -> matBL)
+#define hypre_ParILUDataMatBD(ilu_data)                        ((ilu_data) -> matBD)
+#define hypre_ParILUDataMatBU(ilu_data)                        ((ilu_data) -> matBU)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
 #define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
@@ -1330,6 +1378,8 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
 #define hypre_ParILUDataX(ilu_data)                            ((ilu_data) -> x)
 #define hypre_ParILUDataReorderingType(ilu_data)               ((ilu_data) -> reordering_type)
+#define hypre_ParILUDataNumLocalParts(ilu_data)                ((ilu_data) -> num_local_parts)
+#define hypre_ParILUDataLocalPartPtr(ilu_data)                 ((ilu_data) -> local_part_ptr)
 
 /* Iterative ILU setup */
 #define hypre_ParILUDataIterativeSetupType(ilu_data)           ((ilu_data) -> iter_setup_type)
@@ -1980,6 +2030,7 @@ HYPRE_Int HYPRE_BoomerAMGSetFSAINumLevels ( HYPRE_Solver solver, HYPRE_Int num_l
 HYPRE_Int HYPRE_BoomerAMGSetFSAIEigMaxIters ( HYPRE_Solver solver, HYPRE_Int eig_max_iters );
 HYPRE_Int HYPRE_BoomerAMGSetFSAIThreshold ( HYPRE_Solver solver, HYPRE_Real threshold );
 HYPRE_Int HYPRE_BoomerAMGSetFSAIKapTolerance ( HYPRE_Solver solver, HYPRE_Real kap_tolerance );
+HYPRE_Int HYPRE_BoomerAMGSetFSAIPatternReuse ( HYPRE_Solver solver, HYPRE_Int pattern_reuse );
 HYPRE_Int HYPRE_BoomerAMGSetNumFunctions ( HYPRE_Solver solver, HYPRE_Int num_functions );
 HYPRE_Int HYPRE_BoomerAMGGetNumFunctions ( HYPRE_Solver solver, HYPRE_Int *num_functions );
 HYPRE_Int HYPRE_BoomerAMGSetFilterFunctions ( HYPRE_Solver solver, HYPRE_Int filter_functions );
@@ -2023,6 +2074,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse ( HYPRE_Solver solver, HYPRE_Int eig_reuse );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -2392,6 +2444,8 @@ HYPRE_Int HYPRE_FSAISetThreshold ( HYPRE_Solver solver, HYPRE_Real threshold );
 HYPRE_Int HYPRE_FSAIGetThreshold ( HYPRE_Solver solver, HYPRE_Real *threshold );
 HYPRE_Int HYPRE_FSAISetKapTolerance ( HYPRE_Solver solver, HYPRE_Real kap_tolerance );
 HYPRE_Int HYPRE_FSAIGetKapTolerance ( HYPRE_Solver solver, HYPRE_Real *kap_tolerance );
+HYPRE_Int HYPRE_FSAISetPatternReuse ( HYPRE_Solver solver, HYPRE_Int pattern_reuse );
+HYPRE_Int HYPRE_FSAIGetPatternReuse ( HYPRE_Solver solver, HYPRE_Int *pattern_reuse );
 HYPRE_Int HYPRE_FSAISetTolerance ( HYPRE_Solver solver, HYPRE_Real tolerance );
 HYPRE_Int HYPRE_FSAIGetTolerance ( HYPRE_Solver solver, HYPRE_Real *tolerance );
 HYPRE_Int HYPRE_FSAISetOmega ( HYPRE_Solver solver, HYPRE_Real omega );
@@ -2646,11 +2700,13 @@ HYPRE_Int hypre_BoomerAMGSetFSAINumLevels ( void *data, HYPRE_Int fsai_num_level
 HYPRE_Int hypre_BoomerAMGSetFSAIEigMaxIters ( void *data, HYPRE_Int fsai_eig_max_iters );
 HYPRE_Int hypre_BoomerAMGSetFSAIThreshold ( void *data, HYPRE_Real fsai_threshold );
 HYPRE_Int hypre_BoomerAMGSetFSAIKapTolerance ( void *data, HYPRE_Real fsai_kap_tolerance );
+HYPRE_Int hypre_BoomerAMGSetFSAIPatternReuse ( void *data, HYPRE_Int fsai_pattern_reuse );
 HYPRE_Int hypre_BoomerAMGSetChebyOrder ( void *data, HYPRE_Int order );
 HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyEigReuse ( void *data, HYPRE_Int eig_reuse );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -2736,6 +2792,10 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_SolveHost ( hypre_ParCSRMatrix *A, hypre_ParVe
                                               HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                               hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
                                               hypre_ParVector *tmp_vec);
+HYPRE_Int hypre_ParCSRRelax_Cheby_FourthKindSolve ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                    HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale,
+                                                    hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r,
+                                                    hypre_ParVector *tmp_vec);
 
 /* par_cheby_device.c */
 HYPRE_Int hypre_ParCSRRelax_Cheby_SolveDevice ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -3470,17 +3530,20 @@ HYPRE_Int hypre_AMGNodalSchwarzSmoother ( hypre_CSRMatrix *A, HYPRE_Int num_func
 HYPRE_Int hypre_ParMPSchwarzSolve ( hypre_ParCSRMatrix *par_A, hypre_CSRMatrix *A_boundary,
                                     hypre_ParVector *rhs_vector, hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x,
                                     HYPRE_Real relax_wt, HYPRE_Real *scale, hypre_ParVector *Vtemp, HYPRE_Int *pivots,
-                                    HYPRE_Int use_nonsymm );
+                                    HYPRE_Int use_nonsymm, HYPRE_Int *domain_offsets,
+                                    hypre_CSRMatrix *domain_colors );
 HYPRE_Int hypre_MPSchwarzSolve ( hypre_ParCSRMatrix *par_A, hypre_Vector *rhs_vector,
                                  hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x, HYPRE_Real relax_wt,
-                                 hypre_Vector *aux_vector, HYPRE_Int *pivots, HYPRE_Int use_nonsymm );
+                                 hypre_Vector *aux_vector, HYPRE_Int *pivots, HYPRE_Int use_nonsymm,
+                                 HYPRE_Int *domain_offsets, hypre_CSRMatrix *domain_colors );
 HYPRE_Int hypre_MPSchwarzCFSolve ( hypre_ParCSRMatrix *par_A, hypre_Vector *rhs_vector,
                                    hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x, HYPRE_Real relax_wt,
                                    hypre_Vector *aux_vector, HYPRE_Int *CF_marker, HYPRE_Int rlx_pt, HYPRE_Int *pivots,
                                    HYPRE_Int use_nonsymm );
 HYPRE_Int hypre_MPSchwarzFWSolve ( hypre_ParCSRMatrix *par_A, hypre_Vector *rhs_vector,
                                    hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x, HYPRE_Real relax_wt,
-                                   hypre_Vector *aux_vector, HYPRE_Int *pivots, HYPRE_Int use_nonsymm );
+                                   hypre_Vector *aux_vector, HYPRE_Int *pivots, HYPRE_Int use_nonsymm,
+                                   HYPRE_Int *domain_offsets, hypre_CSRMatrix *domain_colors );
 HYPRE_Int hypre_MPSchwarzCFFWSolve ( hypre_ParCSRMatrix *par_A, hypre_Vector *rhs_vector,
                                      hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x, HYPRE_Real relax_wt,
                                      hypre_Vector *aux_vector, HYPRE_Int *CF_marker, HYPRE_Int rlx_pt, HYPRE_Int *pivots,
@@ -3511,7 +3574,8 @@ HYPRE_Int hypre_parCorrRes ( hypre_ParCSRMatrix *A, hypre_ParVector *x, hypre_Ve
                              hypre_Vector **tmp_ptr );
 HYPRE_Int hypre_AdSchwarzSolve ( hypre_ParCSRMatrix *par_A, hypre_ParVector *par_rhs,
                                  hypre_CSRMatrix *domain_structure, HYPRE_Real *scale, hypre_ParVector *par_x,
-                                 hypre_ParVector *par_aux, HYPRE_Int *pivots, HYPRE_Int use_nonsymm );
+                                 hypre_ParVector *par_aux, HYPRE_Int *pivots, HYPRE_Int use_nonsymm,
+                                 HYPRE_Int *domain_offsets, hypre_CSRMatrix *dof_domain );
 HYPRE_Int hypre_AdSchwarzCFSolve ( hypre_ParCSRMatrix *par_A, hypre_ParVector *par_rhs,
                                    hypre_CSRMatrix *domain_structure, HYPRE_Real *scale, hypre_ParVector *par_x,
                                    hypre_ParVector *par_aux, HYPRE_Int *CF_marker, HYPRE_Int rlx_pt, HYPRE_Int *pivots,
@@ -3520,7 +3584,8 @@ HYPRE_Int hypre_GenerateScale ( hypre_CSRMatrix *domain_structure, HYPRE_Int num
                                 HYPRE_Real relaxation_weight, HYPRE_Real **scale_pointer );
 HYPRE_Int hypre_ParAdSchwarzSolve ( hypre_ParCSRMatrix *A, hypre_ParVector *F,
                                     hypre_CSRMatrix *domain_structure, HYPRE_Real *scale, hypre_ParVector *X, hypre_ParVector *Vtemp,
-                                    HYPRE_Int *pivots, HYPRE_Int use_nonsymm );
+                                    HYPRE_Int *pivots, HYPRE_Int use_nonsymm, HYPRE_Int *domain_offsets,
+                                    hypre_CSRMatrix *dof_domain );
 HYPRE_Int hypre_ParAMGCreateDomainDof ( hypre_ParCSRMatrix *A, HYPRE_Int domain_type,
                                         HYPRE_Int overlap, HYPRE_Int num_functions, HYPRE_Int *dof_func,
                                         hypre_CSRMatrix **domain_structure_pointer, HYPRE_Int **piv_pointer, HYPRE_Int use_nonsymm );
@@ -3528,6 +3593,13 @@ HYPRE_Int hypre_ParGenerateScale ( hypre_ParCSRMatrix *A, hypre_CSRMatrix *domai
                                    HYPRE_Real relaxation_weight, HYPRE_Real **scale_pointer );
 HYPRE_Int hypre_ParGenerateHybridScale ( hypre_ParCSRMatrix *A, hypre_CSRMatrix *domain_structure,
                                          hypre_CSRMatrix **A_boundary_pointer, HYPRE_Real **scale_pointer );
+HYPRE_Int hypre_SchwarzDomainOffsets ( hypre_CSRMatrix *domain_structure,
+                                       HYPRE_Int **domain_offsets_pointer );
+HYPRE_Int hypre_SchwarzDofDomainCreate ( hypre_CSRMatrix *domain_structure, HYPRE_Int num_dofs,
+                                         hypre_CSRMatrix **dof_domain_pointer );
+HYPRE_Int hypre_SchwarzDomainColoring ( hypre_CSRMatrix *domain_structure, hypre_CSRMatrix *A_diag,
+                                        hypre_CSRMatrix *A_offd, hypre_CSRMatrix *A_boundary, HYPRE_Int num_blocks,
+                                        hypre_CSRMatrix **domain_colors_pointer );
 
 /* par_restr.c,  par_lr_restr.c */
 HYPRE_Int hypre_BoomerAMGBuildRestrAIR( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
@@ -3691,6 +3763,8 @@ HYPRE_Int hypre_MGRSetLogging( void *mgr_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_MGRSetMaxIter( void *mgr_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_MGRSetPMaxElmts( void *mgr_vdata, HYPRE_Int P_max_elmts );
 HYPRE_Int hypre_MGRSetLevelPMaxElmts( void *mgr_vdata, HYPRE_Int *P_max_elmts );
+HYPRE_Int hypre_MGRSetSetupReuse( void *mgr_vdata, HYPRE_Int setup_reuse );
+HYPRE_Int hypre_MGRSetLevelSetupReuse( void *mgr_vdata, HYPRE_Int *setup_reuse );
 HYPRE_Int hypre_MGRSetTol( void *mgr_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_MGRDataPrint(void *mgr_vdata);
 #ifdef HYPRE_USING_DSUPERLU
@@ -3811,6 +3885,8 @@ HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetNumLocalParts( void *ilu_vdata, HYPRE_Int num_local_parts );
+HYPRE_Int hypre_ILUSetBlockSize( void *ilu_vdata, HYPRE_Int block_size );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
 HYPRE_Int hypre_ILUSetSchurSolverAbsoluteTol( void *ilu_vdata, HYPRE_Real ss_absolute_tol );
@@ -3869,6 +3945,9 @@ HYPRE_Int hypre_ILUGetInteriorExteriorPerm( hypre_ParCSRMatrix *A,
                                             HYPRE_Int reordering_type );
 HYPRE_Int hypre_ILUGetLocalPerm( hypre_ParCSRMatrix *A, HYPRE_Int **perm_ptr,
                                  HYPRE_Int *nLU, HYPRE_Int reordering_type );
+HYPRE_Int hypre_ILUGetLocalPermDissection( hypre_ParCSRMatrix *A, HYPRE_Int **perm_ptr,
+                                           HYPRE_Int *nLU, HYPRE_Int num_parts,
+                                           HYPRE_Int **part_ptr_ptr );
 HYPRE_Int hypre_ILUBuildRASExternalMatrix( hypre_ParCSRMatrix *A, HYPRE_Int *rperm,
                                            HYPRE_Int **E_i, HYPRE_Int **E_j, HYPRE_Real **E_data );
 HYPRE_Int hypre_ILUSortOffdColmap( hypre_ParCSRMatrix *A );
@@ -3951,6 +4030,9 @@ HYPRE_Int hypre_ILUSetup( void *ilu_vdata, hypre_ParCSRMatrix *A,
 HYPRE_Int hypre_ParILUExtractEBFC( hypre_CSRMatrix *A_diag, HYPRE_Int nLU,
                                    hypre_CSRMatrix **Bp, hypre_CSRMatrix **Cp,
                                    hypre_CSRMatrix **Ep, hypre_CSRMatrix **Fp );
+HYPRE_Int hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *T, HYPRE_Int upper,
+                                       HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr,
+                                       HYPRE_Int **level_rows_ptr );
 HYPRE_Int hypre_ParILURAPReorder( hypre_ParCSRMatrix *A, HYPRE_Int *perm,
                                   HYPRE_Int *rqperm, hypre_ParCSRMatrix **A_pq );
 HYPRE_Int hypre_ILUSetupLDUtoCusparse( hypre_ParCSRMatrix *L, HYPRE_Real *D,
@@ -3993,6 +4075,21 @@ HYPRE_Int hypre_ILUSetupILUT( hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real
                               HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
                               hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr,
                               HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupThreaded( hypre_ParCSRMatrix *A, HYPRE_Int ilu_type, HYPRE_Int lfil,
+                                  HYPRE_Real *tol, HYPRE_Int *perm, HYPRE_Int num_parts,
+                                  HYPRE_Int *part_ptr, hypre_ParCSRMatrix **Lptr,
+                                  HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr,
+                                  HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupILUKIterative( hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm,
+                                       HYPRE_Int type, HYPRE_Int option, HYPRE_Int max_iter,
+                                       HYPRE_Real tolerance, HYPRE_Int *num_iter_ptr,
+                                       HYPRE_Complex **history_ptr, hypre_ParCSRMatrix **Lptr,
+                                       HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr,
+                                       HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupBlockILUK( hypre_ParCSRMatrix *A, HYPRE_Int block_size, HYPRE_Int lfil,
+                                   HYPRE_Int reordering_type, HYPRE_Int **block_perm_ptr,
+                                   hypre_CSRBlockMatrix **BLptr, HYPRE_Real **BDptr,
+                                   hypre_CSRBlockMatrix **BUptr );
 HYPRE_Int hypre_NSHSetup( void *nsh_vdata, hypre_ParCSRMatrix *A,
                           hypre_ParVector *f, hypre_ParVector *u );
 HYPRE_Int hypre_ILUSetupILU0RAS( hypre_ParCSRMatrix *A, HYPRE_Int *perm,
@@ -4048,6 +4145,11 @@ HYPRE_Int hypre_ILUSolveLU( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                             hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
                             hypre_ParVector *ftemp, hypre_ParVector *utemp );
+HYPRE_Int hypre_ILUSolveBlockLU( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                 hypre_ParVector *u, HYPRE_Int *block_perm,
+                                 hypre_CSRBlockMatrix *BL, HYPRE_Real *BD,
+                                 hypre_CSRBlockMatrix *BU, hypre_ParVector *ftemp,
+                                 hypre_ParVector *utemp );
 HYPRE_Int hypre_ILUSolveLUIter( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                 hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                 hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
@@ -4057,6 +4159,21 @@ HYPRE_Int hypre_ILUSolveLURAS( hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_
                                HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real *D,
                                hypre_ParCSRMatrix *U, hypre_ParVector *ftemp,
                                hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext );
+HYPRE_Int hypre_ILUSolveLULevels( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                  hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
+                                  hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
+                                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr,
+                                  HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels,
+                                  HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows );
+HYPRE_Int hypre_ILUSolveLURASLevels( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                     hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L,
+                                     HYPRE_Real *D, hypre_ParCSRMatrix *U,
+                                     hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                                     HYPRE_Real *fext, HYPRE_Real *uext,
+                                     HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr,
+                                     HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels,
+                                     HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows );
 HYPRE_Int hypre_ILUSolveRAPGMRESHost( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                       hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                       hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
@@ -4287,6 +4404,7 @@ HYPRE_Int hypre_FSAISetMaxNnzRow ( void *data, HYPRE_Int max_nnz_row );
 HYPRE_Int hypre_FSAISetNumLevels ( void *data, HYPRE_Int num_levels );
 HYPRE_Int hypre_FSAISetThreshold ( void *data, HYPRE_Real threshold );
 HYPRE_Int hypre_FSAISetKapTolerance ( void *data, HYPRE_Real kap_tolerance );
+HYPRE_Int hypre_FSAISetPatternReuse ( void *data, HYPRE_Int pattern_reuse );
 HYPRE_Int hypre_FSAISetMaxIterations ( void *data, HYPRE_Int max_iterations );
 HYPRE_Int hypre_FSAISetEigMaxIters ( void *data, HYPRE_Int eig_max_iters );
 HYPRE_Int hypre_FSAISetZeroGuess ( void *data, HYPRE_Int zero_guess );
@@ -4303,6 +4421,7 @@ HYPRE_Int hypre_FSAIGetMaxNnzRow ( void *data, HYPRE_Int *max_nnz_row );
 HYPRE_Int hypre_FSAIGetNumLevels ( void *data, HYPRE_Int *num_levels );
 HYPRE_Int hypre_FSAIGetThreshold ( void *data, HYPRE_Real *threshold );
 HYPRE_Int hypre_FSAIGetKapTolerance ( void *data, HYPRE_Real *kap_tolerance );
+HYPRE_Int hypre_FSAIGetPatternReuse ( void *data, HYPRE_Int *pattern_reuse );
 HYPRE_Int hypre_FSAIGetMaxIterations ( void *data, HYPRE_Int *max_iterations );
 HYPRE_Int hypre_FSAIGetEigMaxIters ( void *data, HYPRE_Int *eig_max_iters );
 HYPRE_Int hypre_FSAIGetZeroGuess ( void *data, HYPRE_Int *zero_guess );
@@ -4331,6 +4450,9 @@ HYPRE_Int hypre_FSAISetupNative ( void *fsai_vdata, hypre_ParCSRMatrix *A,
                                   hypre_ParVector *f, hypre_ParVector *u );
 HYPRE_Int hypre_FSAISetupOMPDyn ( void *fsai_vdata, hypre_ParCSRMatrix *A,
                                   hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_FSAISetupValuesBatched ( hypre_CSRMatrix *A_diag, hypre_CSRMatrix *G_diag );
+HYPRE_Int hypre_FSAISetupStaticPower ( void *fsai_vdata, hypre_ParCSRMatrix *A,
+                                       hypre_ParVector *f, hypre_ParVector *u );
 HYPRE_Int hypre_FSAIPrintStats ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_FSAIComputeOmega ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 void hypre_swap2_ci ( HYPRE_Complex *v, HYPRE_Int *w, HYPRE_Int i, HYPRE_Int j );
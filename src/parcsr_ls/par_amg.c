@@ -120,11 +120,13 @@ hypre_BoomerAMGCreate( void )
    HYPRE_Real   fsai_threshold;
    HYPRE_Int    fsai_eig_maxiter;
    HYPRE_Real   fsai_kap_tolerance;
+   HYPRE_Int    fsai_pattern_reuse;
 
    HYPRE_Int cheby_order;
    HYPRE_Int cheby_eig_est;
    HYPRE_Int cheby_variant;
    HYPRE_Int cheby_scale;
+   HYPRE_Int cheby_eig_reuse;
    HYPRE_Real cheby_eig_ratio;
 
    HYPRE_Int block_mode;
@@ -253,6 +255,7 @@ hypre_BoomerAMGCreate( void )
    fsai_threshold = 0.01;
    fsai_eig_maxiter = 5;
    fsai_kap_tolerance = 0.001;
+   fsai_pattern_reuse = 0;
 
    /* solve params */
    min_iter  = 0;
@@ -274,6 +277,7 @@ hypre_BoomerAMGCreate( void )
    cheby_variant = 0;
    cheby_scale = 1;
    cheby_eig_est = 10;
+   cheby_eig_reuse = 0;
    cheby_eig_ratio = .3;
 
    block_mode = 0;
@@ -415,6 +419,7 @@ hypre_BoomerAMGCreate( void )
    hypre_BoomerAMGSetFSAIThreshold(amg_data, fsai_threshold);
    hypre_BoomerAMGSetFSAIEigMaxIters(amg_data, fsai_eig_maxiter);
    hypre_BoomerAMGSetFSAIKapTolerance(amg_data, fsai_kap_tolerance);
+   hypre_BoomerAMGSetFSAIPatternReuse(amg_data, fsai_pattern_reuse);
 
    hypre_BoomerAMGSetMinIter(amg_data, min_iter);
    hypre_BoomerAMGSetMaxIter(amg_data, max_iter);
@@ -438,6 +443,7 @@ hypre_BoomerAMGCreate( void )
    hypre_BoomerAMGSetChebyEigEst(amg_data, cheby_eig_est);
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
+   hypre_BoomerAMGSetChebyEigReuse(amg_data, cheby_eig_reuse);
 
    hypre_BoomerAMGSetNumIterations(amg_data, num_iterations);
 
@@ -498,6 +504,8 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyNumEigRatios(amg_data) = 0;
+   hypre_ParAMGDataChebyEigRatios(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
@@ -608,6 +616,7 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataMinEigEst(amg_data), HYPRE_MEMORY_HOST);
          hypre_ParAMGDataMinEigEst(amg_data) = NULL;
       }
+      hypre_TFree(hypre_ParAMGDataChebyEigRatios(amg_data), HYPRE_MEMORY_HOST);
       if (hypre_ParAMGDataNumGridSweeps(amg_data))
       {
          hypre_TFree(hypre_ParAMGDataNumGridSweeps(amg_data), HYPRE_MEMORY_HOST);
@@ -4579,6 +4588,22 @@ hypre_BoomerAMGSetFSAIKapTolerance( void      *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetFSAIPatternReuse( void      *data,
+                                    HYPRE_Int  fsai_pattern_reuse)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFSAIPatternReuse(amg_data) = fsai_pattern_reuse;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetChebyOrder( void     *data,
                               HYPRE_Int       order)
@@ -4669,6 +4694,21 @@ hypre_BoomerAMGSetChebyScale( void     *data,
 
    return hypre_error_flag;
 }
+HYPRE_Int
+hypre_BoomerAMGSetChebyEigReuse( void      *data,
+                                 HYPRE_Int  cheby_eig_reuse)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyEigReuse(amg_data) = cheby_eig_reuse;
+
+   return hypre_error_flag;
+}
 
 
 /*--------------------------------------------------------------------------
@@ -168,6 +168,7 @@ typedef struct
    HYPRE_Real           fsai_threshold;
    HYPRE_Int            fsai_eig_max_iters;
    HYPRE_Real           fsai_kap_tolerance;
+   HYPRE_Int            fsai_pattern_reuse;
 
    HYPRE_Real          *max_eig_est;
    HYPRE_Real          *min_eig_est;
@@ -178,6 +179,9 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_reuse;
+   HYPRE_Int            cheby_num_eig_ratios;
+   HYPRE_Real          *cheby_eig_ratios;  /* cached CG/Gershgorin eigenvalue ratios */
 
    HYPRE_Real           cum_nnz_AP;
 
@@ -432,6 +436,7 @@ typedef struct
 #define hypre_ParAMGDataFSAIThreshold(amg_data) ((amg_data)->fsai_threshold)
 #define hypre_ParAMGDataFSAIEigMaxIters(amg_data) ((amg_data)->fsai_eig_max_iters)
 #define hypre_ParAMGDataFSAIKapTolerance(amg_data) ((amg_data)->fsai_kap_tolerance)
+#define hypre_ParAMGDataFSAIPatternReuse(amg_data) ((amg_data)->fsai_pattern_reuse)
 
 #define hypre_ParAMGDataMaxEigEst(amg_data) ((amg_data)->max_eig_est)
 #define hypre_ParAMGDataMinEigEst(amg_data) ((amg_data)->min_eig_est)
@@ -442,6 +447,9 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigReuse(amg_data) ((amg_data)->cheby_eig_reuse)
+#define hypre_ParAMGDataChebyNumEigRatios(amg_data) ((amg_data)->cheby_num_eig_ratios)
+#define hypre_ParAMGDataChebyEigRatios(amg_data) ((amg_data)->cheby_eig_ratios)
 
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
@@ -183,6 +183,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real    fsai_threshold;
    HYPRE_Int     fsai_eig_max_iters;
    HYPRE_Real    fsai_kap_tolerance;
+   HYPRE_Int     fsai_pattern_reuse;
    HYPRE_Int     needZ = 0;
 
    HYPRE_Int interp_type, restri_type;
@@ -287,6 +288,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    fsai_threshold = hypre_ParAMGDataFSAIThreshold(amg_data);
    fsai_eig_max_iters = hypre_ParAMGDataFSAIEigMaxIters(amg_data);
    fsai_kap_tolerance = hypre_ParAMGDataFSAIKapTolerance(amg_data);
+   fsai_pattern_reuse = hypre_ParAMGDataFSAIPatternReuse(amg_data);
    interp_type = hypre_ParAMGDataInterpType(amg_data);
    restri_type = hypre_ParAMGDataRestriction(amg_data); /* RL */
    post_interp_type = hypre_ParAMGDataPostInterpType(amg_data);
@@ -581,7 +583,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
-      if (smooth_num_levels && smoother)
+      /* FSAI smoothers are kept when their pattern is reused */
+      if (smooth_num_levels && smoother &&
+          !(hypre_ParAMGDataSmoothType(amg_data) == 4 && fsai_pattern_reuse))
       {
          if (smooth_num_levels > 1 &&
              smooth_num_levels > old_num_levels - 1)
@@ -979,8 +983,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
    if (smooth_num_levels > level)
    {
-      smoother = hypre_CTAlloc(HYPRE_Solver, smooth_num_levels, HYPRE_MEMORY_HOST);
-      hypre_ParAMGDataSmoother(amg_data) = smoother;
+      if (!hypre_ParAMGDataSmoother(amg_data))
+      {
+         hypre_ParAMGDataSmoother(amg_data) = hypre_CTAlloc(HYPRE_Solver, smooth_num_levels,
+                                                            HYPRE_MEMORY_HOST);
+      }
+      smoother = hypre_ParAMGDataSmoother(amg_data);
    }
 
    /*-----------------------------------------------------
@@ -3282,6 +3290,20 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
+
+      /* Cached eigenvalue ratios (max, min) per level. These persist across setup calls */
+      if (hypre_ParAMGDataChebyEigReuse(amg_data) &&
+          hypre_ParAMGDataChebyNumEigRatios(amg_data) < num_levels)
+      {
+         hypre_ParAMGDataChebyEigRatios(amg_data) =
+            hypre_TReAlloc(hypre_ParAMGDataChebyEigRatios(amg_data), HYPRE_Real,
+                           2 * num_levels, HYPRE_MEMORY_HOST);
+         for (j = 2 * hypre_ParAMGDataChebyNumEigRatios(amg_data); j < 2 * num_levels; j++)
+         {
+            hypre_ParAMGDataChebyEigRatios(amg_data)[j] = 0.0;
+         }
+         hypre_ParAMGDataChebyNumEigRatios(amg_data) = num_levels;
+      }
    }
 
    /* CG */
@@ -3520,10 +3542,32 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int cheby_order = hypre_ParAMGDataChebyOrder(amg_data);
          HYPRE_Int cheby_eig_est = hypre_ParAMGDataChebyEigEst(amg_data);
          HYPRE_Real cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
-         if (cheby_eig_est)
+         HYPRE_Real *eig_ratios = hypre_ParAMGDataChebyEigReuse(amg_data) ?
+                                  hypre_ParAMGDataChebyEigRatios(amg_data) : NULL;
+         HYPRE_Real gersh_max, gersh_min, gersh_bnd;
+
+         if (cheby_eig_est && eig_ratios && eig_ratios[2 * j] != 0.0)
+         {
+            /* Gershgorin bound scaled by the ratios cached in a previous setup */
+            hypre_ParCSRMaxEigEstimate(A_array[j], scale, &gersh_max, &gersh_min);
+            gersh_bnd = hypre_max(hypre_abs(gersh_max), hypre_abs(gersh_min));
+            max_eig = eig_ratios[2 * j] * gersh_bnd;
+            min_eig = eig_ratios[2 * j + 1] * gersh_bnd;
+         }
+         else if (cheby_eig_est)
          {
             hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
                                          &max_eig, &min_eig);
+            if (eig_ratios)
+            {
+               hypre_ParCSRMaxEigEstimate(A_array[j], scale, &gersh_max, &gersh_min);
+               gersh_bnd = hypre_max(hypre_abs(gersh_max), hypre_abs(gersh_min));
+               if (gersh_bnd > 0.0)
+               {
+                  eig_ratios[2 * j]     = max_eig / gersh_bnd;
+                  eig_ratios[2 * j + 1] = min_eig / gersh_bnd;
+               }
+            }
          }
          else
          {
@@ -3669,7 +3713,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             return hypre_error_flag;
          }
 
-         HYPRE_FSAICreate(&smoother[j]);
+         if (!smoother[j])
+         {
+            HYPRE_FSAICreate(&smoother[j]);
+         }
          HYPRE_FSAISetAlgoType(smoother[j], fsai_algo_type);
          HYPRE_FSAISetLocalSolveType(smoother[j], fsai_local_solve_type);
          HYPRE_FSAISetMaxSteps(smoother[j], fsai_max_steps);
@@ -3678,6 +3725,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_FSAISetNumLevels(smoother[j], fsai_num_levels);
          HYPRE_FSAISetThreshold(smoother[j], fsai_threshold);
          HYPRE_FSAISetKapTolerance(smoother[j], fsai_kap_tolerance);
+         HYPRE_FSAISetPatternReuse(smoother[j], fsai_pattern_reuse);
          HYPRE_FSAISetTolerance(smoother[j], 0.0);
          HYPRE_FSAISetOmega(smoother[j], relax_weight[level]);
          HYPRE_FSAISetEigMaxIters(smoother[j], fsai_eig_max_iters);
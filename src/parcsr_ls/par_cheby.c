@@ -32,6 +32,11 @@ this is rlx 11 if scale = 0, and 16 if scale == 1
 variant 1: modified cheby: T(t)* f(t) where f(t) = (1-b/t)
 this is rlx 15 if scale = 0, and 17 if scale == 1
 
+variant 2: fourth-kind chebyshev (Lottes, 2022). Only uses the upper
+bound of the spectrum, so the fraction parameter is ignored
+
+variant 3: fourth-kind chebyshev with optimized weights (Lottes, 2022)
+
 ratio indicates the percentage of the whole spectrum to use (so .5
 means half, and .1 means 10percent)
 
@@ -50,7 +55,8 @@ means half, and .1 means 10percent)
  * @param[in] fraction Fraction used to calculate lower bound
  * @param[in] order Polynomial order to use [1,4]
  * @param[in] scale Whether or not to scale by the diagonal
- * @param[in] variant Whether or not to use a variant of Chebyshev (0 standard, 1 variant)
+ * @param[in] variant Whether or not to use a variant of Chebyshev (0 standard, 1 variant,
+ *                    2 fourth-kind, 3 optimized fourth-kind)
  * @param[out] coefs_ptr *coefs_ptr will be allocated to contain coefficients of the polynomial
  * @param[out] ds_ptr *ds_ptr will be allocated to allow scaling by the diagonal
  */
@@ -73,6 +79,16 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
    HYPRE_Real      *coefs        = NULL;
    HYPRE_Int        cheby_order;
    HYPRE_Real      *ds_data = NULL;
+   HYPRE_Int        i;
+
+   /* optimized fourth-kind weights (Lottes, 2022, Table 1) */
+   const HYPRE_Real opt_betas[4][4] =
+   {
+      {1.12500000000000, 0.0, 0.0, 0.0},
+      {1.02387287570313, 1.26408905371085, 0.0, 0.0},
+      {1.00842544782028, 1.08867839208730, 1.33753125909618, 0.0},
+      {1.00391310427285, 1.04035811188593, 1.14863498546254, 1.38268869241000}
+   };
 
    /* u = u + p(A)r */
    if (order > 4)
@@ -106,7 +122,17 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
    theta = (upper_bound + lower_bound) / 2;
    delta = (upper_bound - lower_bound) / 2;
 
-   if (variant == 1)
+   if (variant == 2 || variant == 3)
+   {
+      /* fourth-kind chebyshev: coefs[0] holds the inverse of the upper bound of the
+         spectrum and coefs[1..order] hold the weights of each step */
+      coefs[0] = 1.0 / upper_bound;
+      for (i = 0; i < order; i++)
+      {
+         coefs[i + 1] = (variant == 3) ? opt_betas[order - 1][i] : 1.0;
+      }
+   }
+   else if (variant == 1)
    {
       switch (cheby_order) /* these are the corresponding cheby polynomials: u = u_o + s(A)r_0  - so order is
                                one less that  resid poly: r(t) = 1 - t*s(t) */
@@ -196,9 +222,10 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
 
    if (scale)
    {
-      /*grab 1/hypre_sqrt(abs(diagonal)) */
+      /*grab 1/hypre_sqrt(abs(diagonal)), or abs(diagonal) for the fourth-kind variants */
       ds_data = hypre_CTAlloc(HYPRE_Real, num_rows, hypre_ParCSRMatrixMemoryLocation(A));
-      hypre_CSRMatrixExtractDiagonal(hypre_ParCSRMatrixDiag(A), ds_data, 4);
+      hypre_CSRMatrixExtractDiagonal(hypre_ParCSRMatrixDiag(A), ds_data,
+                                     (variant == 2 || variant == 3) ? 1 : 4);
    } /* end of scaling code */
    *ds_ptr = ds_data;
 
@@ -235,8 +262,6 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
                                   hypre_ParVector    *orig_u_vec, /*another temp vector */
                                   hypre_ParVector    *tmp_vec) /*a potential temp vector */
 {
-   HYPRE_UNUSED_VAR(variant);
-
    hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
    HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
    HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
@@ -269,6 +294,75 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
    /* we are using the order of p(A) */
    cheby_order = order - 1;
 
+   if (variant == 2 || variant == 3)
+   {
+      /* fourth-kind chebyshev (Lottes, 2022) on D^{-1}A:
+         r = f - A*u,  d = 4/(3*rho) D^{-1} r
+         for i = 1, ..., order - 1:
+            u = u + beta_i d
+            r = r - A*d
+            d = (2i-1)/(2i+3) d + (8i+4)/((2i+3)*rho) D^{-1} r
+         u = u + beta_order d */
+      HYPRE_Real  inv_rho = coefs[0];
+      HYPRE_Real *betas   = coefs + 1;
+      HYPRE_Real  dfac, rfac, beta;
+
+      /* r = f - A*u */
+      hypre_ParVectorCopy(f, r);
+      hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+
+      /* d = 4/(3*rho) D^{-1} r */
+      rfac = 4.0 * inv_rho / 3.0;
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_rows; j++)
+      {
+         v_data[j] = (scale) ? rfac * r_data[j] / ds_data[j] : rfac * r_data[j];
+      }
+
+      for (i = 1; i < order; i++)
+      {
+         beta = betas[i - 1];
+         dfac = (HYPRE_Real) (2 * i - 1) / (HYPRE_Real) (2 * i + 3);
+         rfac = (HYPRE_Real) (8 * i + 4) / (HYPRE_Real) (2 * i + 3) * inv_rho;
+
+         /* u = u + beta * d */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < num_rows; j++)
+         {
+            u_data[j] += beta * v_data[j];
+         }
+
+         /* r = r - A*d */
+         hypre_ParCSRMatrixMatvec(-1.0, A, v, 1.0, r);
+
+         /* d = dfac * d + rfac * D^{-1} r */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < num_rows; j++)
+         {
+            v_data[j] = dfac * v_data[j] +
+                        ((scale) ? rfac * r_data[j] / ds_data[j] : rfac * r_data[j]);
+         }
+      }
+
+      /* u = u + beta_order * d */
+      beta = betas[order - 1];
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_rows; j++)
+      {
+         u_data[j] += beta * v_data[j];
+      }
+
+      return hypre_error_flag;
+   }
+
    hypre_assert(hypre_VectorSize(hypre_ParVectorLocalVector(orig_u_vec)) >= num_rows);
    orig_u = hypre_VectorData(hypre_ParVectorLocalVector(orig_u_vec));
 
@@ -384,6 +478,112 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
    return hypre_error_flag;
 }
 
+/**
+ * @brief Solve using a fourth-kind chebyshev polynomial with vector kernels
+ *
+ * Same algorithm as the fourth-kind variants of hypre_ParCSRRelax_Cheby_SolveHost,
+ * but written only in terms of matvecs and vector operations, so it runs
+ * wherever A and the vectors live (used for device execution)
+ *
+ * @param[in] A Matrix to relax with
+ * @param[in] f right-hand side
+ * @param[in] ds_data Absolute value of the diagonal (if scale)
+ * @param[in] coefs Inverse of the spectrum bound followed by the step weights
+ * @param[in] order Order of the polynomial
+ * @param[in] scale Whether or not to scale by diagonal
+ * @param[in,out] u Initial/updated approximation
+ * @param[out] v Temp vector
+ * @param[out] r Temp Vector
+ * @param[out] tmp_vec Temp Vector
+ */
+HYPRE_Int
+hypre_ParCSRRelax_Cheby_FourthKindSolve(hypre_ParCSRMatrix *A,
+                                        hypre_ParVector    *f,
+                                        HYPRE_Real         *ds_data,
+                                        HYPRE_Real         *coefs,
+                                        HYPRE_Int           order,
+                                        HYPRE_Int           scale,
+                                        hypre_ParVector    *u,
+                                        hypre_ParVector    *v,
+                                        hypre_ParVector    *r,
+                                        hypre_ParVector    *tmp_vec)
+{
+   hypre_Vector *v_local   = hypre_ParVectorLocalVector(v);
+   hypre_Vector *tmp_local = hypre_ParVectorLocalVector(tmp_vec);
+   hypre_Vector *ds        = NULL;
+   HYPRE_Real    inv_rho   = coefs[0];
+   HYPRE_Real   *betas     = coefs + 1;
+   HYPRE_Real    dfac, rfac;
+   HYPRE_Int     i;
+
+   if (order > 4)
+   {
+      order = 4;
+   }
+   if (order < 1)
+   {
+      order = 1;
+   }
+
+   if (scale)
+   {
+      /* wrap the diagonal without copying it */
+      ds = hypre_SeqVectorCreate(hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)));
+      hypre_VectorData(ds) = ds_data;
+      hypre_VectorMemoryLocation(ds) = hypre_ParCSRMatrixMemoryLocation(A);
+      hypre_SeqVectorSetDataOwner(ds, 0);
+   }
+
+   /* r = f - A*u */
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+
+   /* d = 4/(3*rho) D^{-1} r */
+   rfac = 4.0 * inv_rho / 3.0;
+   if (scale)
+   {
+      hypre_ParVectorAxpyz(rfac, r, 0.0, r, tmp_vec);
+      hypre_ParVectorSetZeros(v);
+      hypre_SeqVectorElmdivpy(tmp_local, ds, v_local);
+   }
+   else
+   {
+      hypre_ParVectorAxpyz(rfac, r, 0.0, r, v);
+   }
+
+   for (i = 1; i < order; i++)
+   {
+      dfac = (HYPRE_Real) (2 * i - 1) / (HYPRE_Real) (2 * i + 3);
+      rfac = (HYPRE_Real) (8 * i + 4) / (HYPRE_Real) (2 * i + 3) * inv_rho;
+
+      /* u = u + beta * d */
+      hypre_ParVectorAxpy(betas[i - 1], v, u);
+
+      /* r = r - A*d */
+      hypre_ParCSRMatrixMatvec(-1.0, A, v, 1.0, r);
+
+      /* d = dfac * d + rfac * D^{-1} r */
+      if (scale)
+      {
+         hypre_ParVectorScale(dfac, v);
+         hypre_ParVectorAxpyz(rfac, r, 0.0, r, tmp_vec);
+         hypre_SeqVectorElmdivpy(tmp_local, ds, v_local);
+      }
+      else
+      {
+         hypre_ParVectorAxpyz(rfac, r, dfac, v, v);
+      }
+   }
+
+   /* u = u + beta_order * d */
+   hypre_ParVectorAxpy(betas[order - 1], v, u);
+   hypre_ParVectorAllZeros(u) = 0;
+
+   hypre_SeqVectorDestroy(ds);
+
+   return hypre_error_flag;
+}
+
 /**
  * @brief Solve using a chebyshev polynomial
  *
@@ -429,7 +629,12 @@ hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to relax with */
 
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A));
-   if (exec == HYPRE_EXEC_DEVICE)
+   if (exec == HYPRE_EXEC_DEVICE && (variant == 2 || variant == 3))
+   {
+      ierr = hypre_ParCSRRelax_Cheby_FourthKindSolve(A, f, ds_data, coefs, order, scale, u, v, r,
+                                                     orig_u_vec);
+   }
+   else if (exec == HYPRE_EXEC_DEVICE)
    {
       ierr = hypre_ParCSRRelax_Cheby_SolveDevice(A, f, ds_data, coefs, order, scale, variant, u, v, r,
                                                  orig_u_vec, tmp_vec);
@@ -10,6 +10,12 @@
 
 //#define DEBUG_FSAI
 
+/* Number of local systems packed together by the host batched solver */
+#define HYPRE_FSAI_BATCH_SIZE 32
+
+/* Larger local systems are solved one at a time with LAPACK */
+#define HYPRE_FSAI_BATCH_MAX_SIZE 64
+
 /*--------------------------------------------------------------------------
  * hypre_ParFSAIData
  *--------------------------------------------------------------------------*/
@@ -25,6 +31,7 @@ typedef struct hypre_ParFSAIData_struct
    HYPRE_Int             num_levels;       /* Number of levels for computing the candidate pattern */
    HYPRE_Real            threshold;        /* Filtering threshold for the candidate pattern */
    HYPRE_Real            kap_tolerance;    /* Min. amount of change between two steps */
+   HYPRE_Int             pattern_reuse;    /* Keep the pattern of G across setup calls */
 
    /* FSAI Setup data */
    HYPRE_Real            density;          /* Density of matrix G wrt. A */
@@ -62,6 +69,7 @@ typedef struct hypre_ParFSAIData_struct
 #define hypre_ParFSAIDataNumLevels(fsai_data)               ((fsai_data) -> num_levels)
 #define hypre_ParFSAIDataThreshold(fsai_data)               ((fsai_data) -> threshold)
 #define hypre_ParFSAIDataKapTolerance(fsai_data)            ((fsai_data) -> kap_tolerance)
+#define hypre_ParFSAIDataPatternReuse(fsai_data)            ((fsai_data) -> pattern_reuse)
 
 /* FSAI Setup data */
 #define hypre_ParFSAIDataGmat(fsai_data)                    ((fsai_data) -> Gmat)
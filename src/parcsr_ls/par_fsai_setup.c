@@ -398,8 +398,844 @@ hypre_DenseSPDSystemSolve( hypre_Vector *mat,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FSAIBatchedLocalSolve
+ *
+ * Solve a batch of bs local systems of the same size m. For each row
+ * rows[bb] with pattern P = patterns[bb], the system A[P, P] g = -A[P, i]
+ * is solved and psi = A[i, i] + A[i, P] g is computed.
+ *
+ * The systems are packed with the system index running fastest: entry
+ * (j, k) of system bb is stored at position (j * m + k) * bs + bb, and
+ * entry j of its solution at position j * bs + bb. This way, the dense
+ * Cholesky factorizations and triangular solves are vectorized across
+ * systems. The operations are done in the same order as in LAPACK's
+ * unblocked dpotf2/dpotrs, so the results do not depend on batching.
+ * Systems larger than HYPRE_FSAI_BATCH_MAX_SIZE are solved one at a time
+ * (bs = 1) with LAPACK.
+ *
+ * On output, info[bb] is nonzero if the Cholesky factorization failed.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_FSAIBatchedLocalSolve( hypre_CSRMatrix  *A_diag,
+                             HYPRE_Int         m,
+                             HYPRE_Int         bs,
+                             HYPRE_Int        *rows,
+                             HYPRE_Int       **patterns,
+                             HYPRE_Int        *marker,
+                             HYPRE_Complex    *mat,
+                             HYPRE_Complex    *rhs,
+                             HYPRE_Complex    *sol,
+                             HYPRE_Complex    *psi,
+                             HYPRE_Int        *info )
+{
+   HYPRE_Int        *A_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex    *A_a = hypre_CSRMatrixData(A_diag);
+
+   HYPRE_Int         use_lapack = (m > HYPRE_FSAI_BATCH_MAX_SIZE);
+   HYPRE_Int         num_rhs = 1;
+   char              uplo = 'L';
+   HYPRE_Int        *pattern;
+   HYPRE_Int         bb, row, i, j, k, kk, c;
+   HYPRE_Complex     val;
+
+   /* Gather the local systems */
+   for (k = 0; k < m * m * bs; k++)
+   {
+      mat[k] = 0.0;
+   }
+   for (k = 0; k < m * bs; k++)
+   {
+      rhs[k] = 0.0;
+   }
+   for (bb = 0; bb < bs; bb++)
+   {
+      row     = rows[bb];
+      pattern = patterns[bb];
+      for (j = 0; j < m; j++)
+      {
+         marker[pattern[j]] = j;
+      }
+
+      /* A[P, P], lower triangular part (column-major for LAPACK) */
+      for (j = 0; j < m; j++)
+      {
+         i = pattern[j];
+         for (kk = A_i[i]; kk < A_i[i + 1]; kk++)
+         {
+            if ((c = marker[A_j[kk]]) >= 0 && c <= j)
+            {
+               mat[use_lapack ? (c * m + j) : ((j * m + c) * bs + bb)] = A_a[kk];
+            }
+         }
+      }
+
+      /* A[i, P] */
+      for (kk = A_i[row]; kk < A_i[row + 1]; kk++)
+      {
+         if ((c = marker[A_j[kk]]) >= 0)
+         {
+            rhs[c * bs + bb] = A_a[kk];
+         }
+      }
+
+      for (j = 0; j < m; j++)
+      {
+         marker[pattern[j]] = -1;
+      }
+      info[bb] = 0;
+   }
+
+   for (k = 0; k < m * bs; k++)
+   {
+      sol[k] = -rhs[k];
+   }
+
+   if (use_lapack)
+   {
+      hypre_dpotrf(&uplo, &m, mat, &m, &info[0]);
+      if (!info[0])
+      {
+         hypre_dpotrs(&uplo, &m, &num_rhs, mat, &m, sol, &m, &info[0]);
+      }
+   }
+   else
+   {
+      /* Batched Cholesky factorization: A[P, P] = L L' */
+      for (k = 0; k < m; k++)
+      {
+         /* L(k, k) = sqrt(A(k, k) - L(k, 0:k-1) L(k, 0:k-1)') */
+         for (bb = 0; bb < bs; bb++)
+         {
+            psi[bb] = 0.0;
+         }
+         for (c = 0; c < k; c++)
+         {
+            for (bb = 0; bb < bs; bb++)
+            {
+               psi[bb] += mat[(k * m + c) * bs + bb] * mat[(k * m + c) * bs + bb];
+            }
+         }
+         for (bb = 0; bb < bs; bb++)
+         {
+            val = mat[(k * m + k) * bs + bb] - psi[bb];
+            if (hypre_creal(val) <= 0.0)
+            {
+               info[bb] = k + 1;
+               val = 1.0;
+            }
+            mat[(k * m + k) * bs + bb] = hypre_csqrt(val);
+         }
+
+         /* L(k+1:m-1, k) = (A(k+1:m-1, k) - L(k+1:m-1, 0:k-1) L(k, 0:k-1)') / L(k, k) */
+         for (c = 0; c < k; c++)
+         {
+            for (j = k + 1; j < m; j++)
+            {
+               for (bb = 0; bb < bs; bb++)
+               {
+                  mat[(j * m + k) * bs + bb] -= mat[(k * m + c) * bs + bb] *
+                                                mat[(j * m + c) * bs + bb];
+               }
+            }
+         }
+         for (bb = 0; bb < bs; bb++)
+         {
+            psi[bb] = 1.0 / mat[(k * m + k) * bs + bb];
+         }
+         for (j = k + 1; j < m; j++)
+         {
+            for (bb = 0; bb < bs; bb++)
+            {
+               mat[(j * m + k) * bs + bb] *= psi[bb];
+            }
+         }
+      }
+
+      /* Batched triangular solves: L L' g = -A[P, i] */
+      for (j = 0; j < m; j++)
+      {
+         for (k = 0; k < j; k++)
+         {
+            for (bb = 0; bb < bs; bb++)
+            {
+               sol[j * bs + bb] -= mat[(j * m + k) * bs + bb] * sol[k * bs + bb];
+            }
+         }
+         for (bb = 0; bb < bs; bb++)
+         {
+            sol[j * bs + bb] /= mat[(j * m + j) * bs + bb];
+         }
+      }
+      for (j = m - 1; j >= 0; j--)
+      {
+         for (k = j + 1; k < m; k++)
+         {
+            for (bb = 0; bb < bs; bb++)
+            {
+               sol[j * bs + bb] -= mat[(k * m + j) * bs + bb] * sol[k * bs + bb];
+            }
+         }
+         for (bb = 0; bb < bs; bb++)
+         {
+            sol[j * bs + bb] /= mat[(j * m + j) * bs + bb];
+         }
+      }
+   }
+
+   /* psi = A[i, i] + A[i, P] g */
+   for (bb = 0; bb < bs; bb++)
+   {
+      psi[bb] = A_a[A_i[rows[bb]]];
+   }
+   for (j = 0; j < m; j++)
+   {
+      for (bb = 0; bb < bs; bb++)
+      {
+         psi[bb] += sol[j * bs + bb] * rhs[j * bs + bb];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIBatchedWorkSize
+ *
+ * Size of the dense matrix buffer used by hypre_FSAIBatchedLocalSolve for
+ * systems of size up to max_size.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_FSAIBatchedWorkSize( HYPRE_Int max_size )
+{
+   HYPRE_Int  m = hypre_min(max_size, HYPRE_FSAI_BATCH_MAX_SIZE);
+
+   return hypre_max(1, hypre_max(m * m * HYPRE_FSAI_BATCH_SIZE, max_size * max_size));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupValuesBatched
+ *
+ * Compute the coefficients of G_diag for a given sparsity pattern. Each row
+ * of G_diag holds the diagonal entry first, followed by the column indices
+ * of the pattern P of that row. For each row i, the local system
+ * A[P, P] g = -A[P, i] is solved and G[i, :] = [1, g'] / sqrt(psi), where
+ * psi = A[i, i] + A[i, P] g.
+ *
+ * The rows are grouped by pattern size and the local systems of each group
+ * are solved in batches of HYPRE_FSAI_BATCH_SIZE systems (see
+ * hypre_FSAIBatchedLocalSolve). Batches are distributed among the OpenMP
+ * threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetupValuesBatched( hypre_CSRMatrix *A_diag,
+                              hypre_CSRMatrix *G_diag )
+{
+   HYPRE_Int         num_rows  = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        *A_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Complex    *A_a       = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int        *G_i       = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int        *G_j       = hypre_CSRMatrixJ(G_diag);
+   HYPRE_Complex    *G_a       = hypre_CSRMatrixData(G_diag);
+
+   HYPRE_Int         max_size;     /* Largest local system size */
+   HYPRE_Int        *size_ptr;     /* Rows with m off-diagonals: order[size_ptr[m]:...] */
+   HYPRE_Int        *order;        /* Rows sorted by pattern size */
+   HYPRE_Int         num_batches;
+   HYPRE_Int        *batch_start;  /* First position in order of each batch */
+   HYPRE_Int        *batch_end;
+   HYPRE_Int         i, m, b, nb;
+
+   /* Group rows by pattern size (counting sort) */
+   max_size = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      max_size = hypre_max(max_size, G_i[i + 1] - G_i[i] - 1);
+   }
+   size_ptr = hypre_CTAlloc(HYPRE_Int, max_size + 2, HYPRE_MEMORY_HOST);
+   order    = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      size_ptr[G_i[i + 1] - G_i[i]]++;
+   }
+   for (m = 0; m <= max_size; m++)
+   {
+      size_ptr[m + 1] += size_ptr[m];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      order[size_ptr[G_i[i + 1] - G_i[i] - 1]++] = i;
+   }
+   for (m = max_size; m >= 0; m--)
+   {
+      size_ptr[m + 1] = size_ptr[m];
+   }
+   size_ptr[0] = 0;
+
+   /* Split each group into batches. Large systems are solved one at a time */
+   num_batches = 0;
+   for (m = 0; m <= max_size; m++)
+   {
+      nb = (m > HYPRE_FSAI_BATCH_MAX_SIZE) ? 1 : HYPRE_FSAI_BATCH_SIZE;
+      num_batches += (size_ptr[m + 1] - size_ptr[m] + nb - 1) / nb;
+   }
+   batch_start = hypre_TAlloc(HYPRE_Int, num_batches, HYPRE_MEMORY_HOST);
+   batch_end   = hypre_TAlloc(HYPRE_Int, num_batches, HYPRE_MEMORY_HOST);
+   for (m = 0, b = 0; m <= max_size; m++)
+   {
+      nb = (m > HYPRE_FSAI_BATCH_MAX_SIZE) ? 1 : HYPRE_FSAI_BATCH_SIZE;
+      for (i = size_ptr[m]; i < size_ptr[m + 1]; i += nb)
+      {
+         batch_start[b] = i;
+         batch_end[b++] = hypre_min(i + nb, size_ptr[m + 1]);
+      }
+   }
+
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "BatchedSolve");
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, m, b)
+#endif
+   {
+      HYPRE_Complex  *mat;      /* Batch of dense matrices A[P, P] (lower part) */
+      HYPRE_Complex  *rhs;      /* Batch of A[P, i] */
+      HYPRE_Complex  *sol;      /* Batch of solutions g */
+      HYPRE_Complex  *psi;      /* Batch of scaling factors */
+      HYPRE_Int      *info;     /* Batch of Cholesky failure flags */
+      HYPRE_Int      *marker;   /* Marker array with nonzeros pointing to P */
+      HYPRE_Int      *patterns[HYPRE_FSAI_BATCH_SIZE];
+      HYPRE_Int      *rows;
+      HYPRE_Int       bb, bs, row, j;
+      HYPRE_Complex   val;
+      char            msg[512];
+
+      mat    = hypre_TAlloc(HYPRE_Complex, hypre_FSAIBatchedWorkSize(max_size),
+                            HYPRE_MEMORY_HOST);
+      rhs    = hypre_TAlloc(HYPRE_Complex, hypre_max(1, max_size) * HYPRE_FSAI_BATCH_SIZE,
+                            HYPRE_MEMORY_HOST);
+      sol    = hypre_TAlloc(HYPRE_Complex, hypre_max(1, max_size) * HYPRE_FSAI_BATCH_SIZE,
+                            HYPRE_MEMORY_HOST);
+      psi    = hypre_TAlloc(HYPRE_Complex, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+      info   = hypre_TAlloc(HYPRE_Int, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+      marker = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      hypre_Memset(marker, -1, num_rows * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (b = 0; b < num_batches; b++)
+      {
+         bs   = batch_end[b] - batch_start[b];
+         rows = order + batch_start[b];
+         m    = G_i[rows[0] + 1] - G_i[rows[0]] - 1;
+         for (bb = 0; bb < bs; bb++)
+         {
+            patterns[bb] = G_j + G_i[rows[bb]] + 1;
+         }
+
+         hypre_FSAIBatchedLocalSolve(A_diag, m, bs, rows, patterns, marker,
+                                     mat, rhs, sol, psi, info);
+
+         /* Scatter the scaled solutions into G */
+         for (bb = 0; bb < bs; bb++)
+         {
+            row = rows[bb];
+            if (!info[bb] && hypre_creal(psi[bb]) > 0 && hypre_cimag(psi[bb]) == 0)
+            {
+               val = 1.0 / hypre_csqrt(psi[bb]);
+               G_a[G_i[row]] = val;
+               for (j = 0; j < m; j++)
+               {
+                  G_a[G_i[row] + 1 + j] = val * sol[j * bs + bb];
+               }
+            }
+            else
+            {
+               hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", row);
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+               G_a[G_i[row]] = 1.0 / hypre_cabs(A_a[A_i[row]]);
+               for (j = 0; j < m; j++)
+               {
+                  G_a[G_i[row] + 1 + j] = 0.0;
+               }
+            }
+         }
+      } /* omp for schedule(dynamic) */
+
+      hypre_TFree(mat, HYPRE_MEMORY_HOST);
+      hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(sol, HYPRE_MEMORY_HOST);
+      hypre_TFree(psi, HYPRE_MEMORY_HOST);
+      hypre_TFree(info, HYPRE_MEMORY_HOST);
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end openmp region */
+   HYPRE_ANNOTATE_REGION_END("%s", "BatchedSolve");
+
+   /* Free memory */
+   hypre_TFree(size_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+   hypre_TFree(batch_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(batch_end, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIAdaptiveWork
+ *
+ * Per-thread work space of the adaptive FSAI setup. The rows of a batch
+ * advance together through the adaptive steps, so that the local systems
+ * of each step can be solved with hypre_FSAIBatchedLocalSolve.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int       max_nnzrow;   /* Max. number of nonzeros per row of G */
+
+   hypre_Vector   *G_temp;       /* Vector holding the values of G[i,:] */
+   hypre_Vector   *kap_grad;     /* Vector holding the Kaporin gradient values */
+   HYPRE_Int      *kg_pos;       /* Indices of nonzero entries of kap_grad */
+   HYPRE_Int      *kg_marker;    /* Marker array with nonzeros pointing to kg_pos */
+   HYPRE_Int      *marker;       /* Marker array with nonzeros pointing to P */
+
+   /* Batched solver buffers */
+   HYPRE_Complex  *mat;
+   HYPRE_Complex  *rhs;
+   HYPRE_Complex  *sol;
+   HYPRE_Complex  *psi;
+   HYPRE_Int      *info;
+
+   /* State of the rows of the batch */
+   HYPRE_Int      *pattern;      /* Column indices of G[i,:], max_nnzrow per row */
+   HYPRE_Int      *patt_size;    /* Number of entries in the current patterns */
+   HYPRE_Complex  *values;       /* Values of G[i,:], max_nnzrow per row */
+   HYPRE_Complex  *old_psi;      /* GAG' before the current step */
+   HYPRE_Complex  *new_psi;      /* GAG' after the current step */
+   HYPRE_Complex  *row_scale;    /* Scaling factors of G[i,:] */
+   HYPRE_Int      *active;       /* Rows whose pattern is still growing */
+} hypre_FSAIAdaptiveWork;
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIAdaptiveWorkCreate
+ *--------------------------------------------------------------------------*/
+
+static hypre_FSAIAdaptiveWork *
+hypre_FSAIAdaptiveWorkCreate( HYPRE_Int num_rows,
+                              HYPRE_Int max_nnzrow )
+{
+   hypre_FSAIAdaptiveWork  *work = hypre_CTAlloc(hypre_FSAIAdaptiveWork, 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int                max_size = max_nnzrow - 1;
+
+   work -> max_nnzrow = max_nnzrow;
+
+   work -> G_temp     = hypre_SeqVectorCreate(max_nnzrow);
+   work -> kap_grad   = hypre_SeqVectorCreate(num_rows);
+   hypre_SeqVectorInitialize_v2(work -> G_temp, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInitialize_v2(work -> kap_grad, HYPRE_MEMORY_HOST);
+   work -> kg_pos     = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   work -> kg_marker  = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   work -> marker     = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   hypre_Memset(work -> marker, -1, num_rows * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+   work -> mat        = hypre_TAlloc(HYPRE_Complex, hypre_FSAIBatchedWorkSize(max_size),
+                                     HYPRE_MEMORY_HOST);
+   work -> rhs        = hypre_TAlloc(HYPRE_Complex, max_nnzrow * HYPRE_FSAI_BATCH_SIZE,
+                                     HYPRE_MEMORY_HOST);
+   work -> sol        = hypre_TAlloc(HYPRE_Complex, max_nnzrow * HYPRE_FSAI_BATCH_SIZE,
+                                     HYPRE_MEMORY_HOST);
+   work -> psi        = hypre_TAlloc(HYPRE_Complex, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+   work -> info       = hypre_TAlloc(HYPRE_Int, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+
+   work -> pattern    = hypre_TAlloc(HYPRE_Int, max_nnzrow * HYPRE_FSAI_BATCH_SIZE,
+                                     HYPRE_MEMORY_HOST);
+   work -> patt_size  = hypre_TAlloc(HYPRE_Int, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+   work -> values     = hypre_TAlloc(HYPRE_Complex, max_nnzrow * HYPRE_FSAI_BATCH_SIZE,
+                                     HYPRE_MEMORY_HOST);
+   work -> old_psi    = hypre_TAlloc(HYPRE_Complex, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+   work -> new_psi    = hypre_TAlloc(HYPRE_Complex, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+   work -> row_scale  = hypre_TAlloc(HYPRE_Complex, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+   work -> active     = hypre_TAlloc(HYPRE_Int, HYPRE_FSAI_BATCH_SIZE, HYPRE_MEMORY_HOST);
+
+   return work;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIAdaptiveWorkDestroy
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_FSAIAdaptiveWorkDestroy( hypre_FSAIAdaptiveWork *work )
+{
+   hypre_SeqVectorDestroy(work -> G_temp);
+   hypre_SeqVectorDestroy(work -> kap_grad);
+   hypre_TFree(work -> kg_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> kg_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> mat, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> rhs, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> sol, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> psi, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> info, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> pattern, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> patt_size, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> values, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> old_psi, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> new_psi, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> row_scale, HYPRE_MEMORY_HOST);
+   hypre_TFree(work -> active, HYPRE_MEMORY_HOST);
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIAdaptiveBatch
+ *
+ * Run the adaptive FSAI algorithm on the rows [first_row, first_row + nr),
+ * with nr <= HYPRE_FSAI_BATCH_SIZE. At each step, the pattern of every row
+ * that is still active is extended with the largest entries of its Kaporin
+ * gradient, and the resulting local systems are grouped by size and solved
+ * with hypre_FSAIBatchedLocalSolve.
+ *
+ * On output, row first_row + bb of G is given by the column indices
+ * pattern[bb * max_nnzrow : ...] and the values values[bb * max_nnzrow : ...]
+ * (patt_size[bb] entries, diagonal excluded) scaled by row_scale[bb].
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_FSAIAdaptiveBatch( hypre_CSRMatrix        *A_diag,
+                         HYPRE_Real              kap_tolerance,
+                         HYPRE_Int               max_steps,
+                         HYPRE_Int               max_step_size,
+                         HYPRE_Int               first_row,
+                         HYPRE_Int               nr,
+                         hypre_FSAIAdaptiveWork *work )
+{
+   HYPRE_Int       *A_i          = hypre_CSRMatrixI(A_diag);
+   HYPRE_Complex   *A_a          = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int        max_nnzrow   = work -> max_nnzrow;
+   HYPRE_Int       *kg_marker    = work -> kg_marker;
+   HYPRE_Int       *patt_size    = work -> patt_size;
+   HYPRE_Complex   *values       = work -> values;
+   HYPRE_Complex   *old_psi      = work -> old_psi;
+   HYPRE_Complex   *new_psi      = work -> new_psi;
+   HYPRE_Int       *active       = work -> active;
+   HYPRE_Complex   *G_temp_data  = hypre_VectorData(work -> G_temp);
+
+   HYPRE_Int        list[HYPRE_FSAI_BATCH_SIZE];      /* Rows with a new pattern */
+   HYPRE_Int        rows[HYPRE_FSAI_BATCH_SIZE];
+   HYPRE_Int       *patterns[HYPRE_FSAI_BATCH_SIZE];
+   HYPRE_Int        num_list, num_active;
+   HYPRE_Int        bb, g, gs, ge, bs, i, j, k, m, size_old;
+   HYPRE_Int       *pattern;
+   char             msg[512];
+
+   for (bb = 0; bb < nr; bb++)
+   {
+      /* Set old_psi up front so we don't have to compute GAG' twice */
+      patt_size[bb] = 0;
+      new_psi[bb]   = old_psi[bb] = A_a[A_i[first_row + bb]];
+      active[bb]    = 1;
+   }
+   num_active = nr;
+
+   /* Cycle through the adaptive steps */
+   for (k = 0; k < max_steps && num_active > 0; k++)
+   {
+      /* Extend the pattern of each active row */
+      num_list = 0;
+      for (bb = 0; bb < nr; bb++)
+      {
+         if (!active[bb])
+         {
+            continue;
+         }
+
+         i       = first_row + bb;
+         pattern = work -> pattern + bb * max_nnzrow;
+         for (j = 0; j < patt_size[bb]; j++)
+         {
+            kg_marker[pattern[j]] = -1;
+            G_temp_data[j] = values[bb * max_nnzrow + j];
+         }
+         hypre_VectorSize(work -> G_temp) = patt_size[bb];
+
+         /* Compute Kaporin Gradient */
+         hypre_FindKapGrad(A_diag, work -> kap_grad, work -> kg_pos, work -> G_temp,
+                           pattern, patt_size[bb], max_nnzrow, i, kg_marker);
+
+         /* Find max_step_size largest values of the kaporin gradient,
+            find their column indices, and add it to pattern */
+         size_old = patt_size[bb];
+         hypre_AddToPattern(work -> kap_grad, work -> kg_pos, pattern, &patt_size[bb],
+                            kg_marker, max_step_size);
+         for (j = 0; j < patt_size[bb]; j++)
+         {
+            kg_marker[pattern[j]] = 0;
+         }
+
+         if (patt_size[bb] == size_old)
+         {
+            new_psi[bb] = old_psi[bb];
+            active[bb]  = 0;
+            num_active--;
+         }
+         else
+         {
+            /* Insert in the list, sorted by pattern size */
+            for (j = num_list; j > 0 && patt_size[list[j - 1]] > patt_size[bb]; j--)
+            {
+               list[j] = list[j - 1];
+            }
+            list[j] = bb;
+            num_list++;
+         }
+      }
+
+      /* Solve A[P, P] G[i, P]' = -A[i, P] for groups of rows with the same pattern size */
+      for (gs = 0; gs < num_list; gs = ge)
+      {
+         m  = patt_size[list[gs]];
+         for (ge = gs; ge < num_list && patt_size[list[ge]] == m; ge++)
+         {
+            if (m > HYPRE_FSAI_BATCH_MAX_SIZE && ge > gs)
+            {
+               break;
+            }
+            rows[ge - gs]     = first_row + list[ge];
+            patterns[ge - gs] = work -> pattern + list[ge] * max_nnzrow;
+         }
+         bs = ge - gs;
+
+         hypre_FSAIBatchedLocalSolve(A_diag, m, bs, rows, patterns, work -> marker,
+                                     work -> mat, work -> rhs, work -> sol,
+                                     work -> psi, work -> info);
+
+         for (g = 0; g < bs; g++)
+         {
+            bb = list[gs + g];
+            if (work -> info[g])
+            {
+               hypre_sprintf(msg, "Error: dpotrf failed with code %d\n", work -> info[g]);
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+            }
+            for (j = 0; j < m; j++)
+            {
+               values[bb * max_nnzrow + j] = work -> sol[j * bs + g];
+            }
+
+            /* Check psi reduction */
+            new_psi[bb] = work -> psi[g];
+            if (hypre_cabs(new_psi[bb] - old_psi[bb]) <
+                hypre_creal(kap_tolerance * old_psi[bb]))
+            {
+               active[bb] = 0;
+               num_active--;
+            }
+            else
+            {
+               old_psi[bb] = new_psi[bb];
+            }
+         }
+      }
+   }
+
+   /* Compute scaling factors */
+   for (bb = 0; bb < nr; bb++)
+   {
+      i = first_row + bb;
+      if (hypre_creal(new_psi[bb]) > 0 && hypre_cimag(new_psi[bb]) == 0)
+      {
+         work -> row_scale[bb] = 1.0 / hypre_csqrt(new_psi[bb]);
+      }
+      else
+      {
+         hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+         work -> row_scale[bb] = 1.0 / hypre_cabs(A_a[A_i[i]]);
+         patt_size[bb] = 0;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupStaticPower
+ *
+ * Static FSAI on the host. The sparsity pattern of G is taken from the
+ * lower triangular part of a (filtered) power of A, keeping the max_nnz_row
+ * largest entries per row. The coefficients are then computed with the
+ * batched local solver (see hypre_FSAISetupValuesBatched).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetupStaticPower( void               *fsai_vdata,
+                            hypre_ParCSRMatrix *A,
+                            hypre_ParVector    *f,
+                            hypre_ParVector    *u )
+{
+   HYPRE_UNUSED_VAR(f);
+   HYPRE_UNUSED_VAR(u);
+
+   hypre_ParFSAIData      *fsai_data        = (hypre_ParFSAIData*) fsai_vdata;
+   hypre_ParCSRMatrix     *G                = hypre_ParFSAIDataGmat(fsai_data);
+   hypre_CSRMatrix        *G_diag           = hypre_ParCSRMatrixDiag(G);
+   HYPRE_Int              *G_i              = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int              *G_j              = hypre_CSRMatrixJ(G_diag);
+   HYPRE_Int               max_nnz_row      = hypre_ParFSAIDataMaxNnzRow(fsai_data);
+   HYPRE_Int               num_levels       = hypre_ParFSAIDataNumLevels(fsai_data);
+   HYPRE_Real              threshold        = hypre_ParFSAIDataThreshold(fsai_data);
+
+   hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               num_rows         = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_ParCSRMatrix     *Atilde;
+   hypre_ParCSRMatrix     *B;
+   hypre_ParCSRMatrix     *Ktilde;
+   hypre_CSRMatrix        *K_diag;
+   HYPRE_Int              *K_i;
+   HYPRE_Int              *K_j;
+   HYPRE_Complex          *K_a;
+   HYPRE_Int               i;
+
+   /*-----------------------------------------------------
+    *  Compute candidate pattern
+    *-----------------------------------------------------*/
+
+   /* Compute filtered version of A */
+   Atilde = hypre_ParCSRMatrixClone(A, 1);
+
+   /* Pre-filter to reduce SpGEMM cost */
+   if (num_levels > 1)
+   {
+      hypre_ParCSRMatrixDropSmallEntries(Atilde, threshold, 2);
+   }
+
+   /* Compute power pattern */
+   switch (num_levels)
+   {
+      case 1:
+         Ktilde = Atilde;
+         break;
+
+      case 2:
+         Ktilde = hypre_ParCSRMatMat(Atilde, Atilde);
+         break;
+
+      case 3:
+         B = hypre_ParCSRMatMat(Atilde, Atilde);
+         Ktilde = hypre_ParCSRMatMat(Atilde, B);
+         hypre_ParCSRMatrixDestroy(B);
+         break;
+
+      case 4:
+         B = hypre_ParCSRMatMat(Atilde, Atilde);
+         hypre_ParCSRMatrixDropSmallEntries(B, threshold, 2);
+         Ktilde = hypre_ParCSRMatMat(B, B);
+         hypre_ParCSRMatrixDestroy(B);
+         break;
+
+      default:
+         Ktilde = hypre_ParCSRMatrixClone(Atilde, 1);
+         for (i = 1; i < num_levels; i++)
+         {
+            B = hypre_ParCSRMatMat(Atilde, Ktilde);
+            hypre_ParCSRMatrixDestroy(Ktilde);
+            Ktilde = B;
+         }
+   }
+
+   /*-----------------------------------------------------
+    *  Truncate candidate pattern into G
+    *-----------------------------------------------------*/
+
+   K_diag = hypre_ParCSRMatrixDiag(Ktilde);
+   K_i    = hypre_CSRMatrixI(K_diag);
+   K_j    = hypre_CSRMatrixJ(K_diag);
+   K_a    = hypre_CSRMatrixData(K_diag);
+
+   /* Rows are first written at a stride of (max_nnz_row + 1) */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Complex  *cand_a;
+      HYPRE_Int      *cand_j;
+      HYPRE_Int       j, k, size, nentries;
+
+      cand_a = hypre_TAlloc(HYPRE_Complex, num_rows, HYPRE_MEMORY_HOST);
+      cand_j = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         /* Lower triangular candidates */
+         size = 0;
+         for (j = K_i[i]; j < K_i[i + 1]; j++)
+         {
+            if (K_j[j] < i)
+            {
+               cand_a[size]   = hypre_cabs(K_a[j]);
+               cand_j[size++] = K_j[j];
+            }
+         }
+
+         /* Keep the largest ones in ascending column order */
+         nentries = hypre_min(size, max_nnz_row);
+         hypre_PartialSelectSortCI(cand_a, cand_j, size, nentries);
+         hypre_qsort0(cand_j, 0, nentries - 1);
+
+         k = i * (max_nnz_row + 1);
+         G_j[k] = i;
+         for (j = 0; j < nentries; j++)
+         {
+            G_j[k + 1 + j] = cand_j[j];
+         }
+         G_i[i + 1] = nentries + 1;
+      }
+
+      hypre_TFree(cand_a, HYPRE_MEMORY_HOST);
+      hypre_TFree(cand_j, HYPRE_MEMORY_HOST);
+   } /* end openmp region */
+
+   /* Compress rows */
+   G_i[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int j, jj = i * (max_nnz_row + 1);
+
+      G_i[i + 1] += G_i[i];
+      for (j = G_i[i]; j < G_i[i + 1]; j++)
+      {
+         G_j[j] = G_j[jj++];
+      }
+   }
+   hypre_CSRMatrixNumNonzeros(G_diag) = G_i[num_rows];
+
+   /*-----------------------------------------------------
+    *  Compute coefficients
+    *-----------------------------------------------------*/
+
+   hypre_FSAISetupValuesBatched(A_diag, G_diag);
+
+   /* Free memory */
+   hypre_ParCSRMatrixDestroy(Ktilde);
+   if (num_levels > 1)
+   {
+      hypre_ParCSRMatrixDestroy(Atilde);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FSAISetupNative
+ *
+ * Adaptive FSAI with a static partitioning of the rows among the OpenMP
+ * threads. Each thread processes its rows in batches of
+ * HYPRE_FSAI_BATCH_SIZE (see hypre_FSAIAdaptiveBatch).
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -419,8 +1255,6 @@ hypre_FSAISetupNative( void               *fsai_vdata,
 
    /* CSRMatrix A_diag variables */
    hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
-   HYPRE_Complex          *A_a              = hypre_CSRMatrixData(A_diag);
    HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
 
    /* Matrix G variables */
@@ -432,7 +1266,6 @@ hypre_FSAISetupNative( void               *fsai_vdata,
    HYPRE_Int               max_nnzrow_diag_G;   /* Max. number of nonzeros per row in G_diag */
 
    /* Local variables */
-   char                    msg[512];    /* Warning message */
    HYPRE_Int              *twspace;     /* shared work space for omp threads */
 
    /* Initalize some variables */
@@ -456,25 +1289,12 @@ hypre_FSAISetupNative( void               *fsai_vdata,
    #pragma omp parallel
 #endif
    {
-      hypre_Vector   *G_temp;        /* Vector holding the values of G[i,:] */
-      hypre_Vector   *A_sub;         /* Vector holding the dense submatrix A[P, P] */
-      hypre_Vector   *A_subrow;      /* Vector holding A[i, P] */
-      hypre_Vector   *kap_grad;      /* Vector holding the Kaporin gradient values */
-      HYPRE_Int      *kg_pos;        /* Indices of nonzero entries of kap_grad */
-      HYPRE_Int      *kg_marker;     /* Marker array with nonzeros pointing to kg_pos */
-      HYPRE_Int      *marker;        /* Marker array with nonzeros pointing to P */
-      HYPRE_Int      *pattern;       /* Array holding column indices of G[i,:] */
-      HYPRE_Int       patt_size;     /* Number of entries in current pattern */
-      HYPRE_Int       patt_size_old; /* Number of entries in previous pattern */
+      hypre_FSAIAdaptiveWork *work;
       HYPRE_Int       ii;            /* Thread identifier */
       HYPRE_Int       num_threads;   /* Number of active threads */
       HYPRE_Int       ns, ne;        /* Initial and last row indices */
       HYPRE_Int       i, j, k, iloc; /* Loop variables */
-      HYPRE_Complex   old_psi;       /* GAG' before k-th interation of aFSAI */
-      HYPRE_Complex   new_psi;       /* GAG' after k-th interation of aFSAI */
-      HYPRE_Complex   row_scale;     /* Scaling factor for G_temp */
-      HYPRE_Complex  *G_temp_data;
-      HYPRE_Complex  *A_subrow_data;
+      HYPRE_Int       bb, nr;
 
       HYPRE_Int       num_rows_Gloc;
       HYPRE_Int       num_nnzs_Gloc;
@@ -482,25 +1302,8 @@ hypre_FSAISetupNative( void               *fsai_vdata,
       HYPRE_Int      *Gloc_j;
       HYPRE_Complex  *Gloc_a;
 
-      /* Allocate and initialize local vector variables */
-      G_temp    = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      A_subrow  = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      kap_grad  = hypre_SeqVectorCreate(num_rows_diag_A);
-      A_sub     = hypre_SeqVectorCreate(max_nnzrow_diag_G * max_nnzrow_diag_G);
-      pattern   = hypre_CTAlloc(HYPRE_Int, max_nnzrow_diag_G, HYPRE_MEMORY_HOST);
-      kg_pos    = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-      kg_marker = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-      marker    = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-
-      hypre_SeqVectorInitialize_v2(G_temp, HYPRE_MEMORY_HOST);
-      hypre_SeqVectorInitialize_v2(A_subrow, HYPRE_MEMORY_HOST);
-      hypre_SeqVectorInitialize_v2(kap_grad, HYPRE_MEMORY_HOST);
-      hypre_SeqVectorInitialize_v2(A_sub, HYPRE_MEMORY_HOST);
-      hypre_Memset(marker, -1, num_rows_diag_A * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
-
-      /* Setting data variables for vectors */
-      G_temp_data   = hypre_VectorData(G_temp);
-      A_subrow_data = hypre_VectorData(A_subrow);
+      /* Allocate work space */
+      work = hypre_FSAIAdaptiveWorkCreate(num_rows_diag_A, max_nnzrow_diag_G);
 
       ii = hypre_GetThreadNum();
       num_threads = hypre_NumActiveThreads();
@@ -522,100 +1325,26 @@ hypre_FSAISetupNative( void               *fsai_vdata,
          Gloc_a = hypre_CTAlloc(HYPRE_Complex, num_nnzs_Gloc, HYPRE_MEMORY_HOST);
       }
 
-      for (i = ns; i < ne; i++)
+      for (i = ns; i < ne; i += nr)
       {
-         patt_size = 0;
-
-         /* Set old_psi up front so we don't have to compute GAG' twice in the inner for-loop */
-         new_psi = old_psi = A_a[A_i[i]];
+         nr = hypre_min(HYPRE_FSAI_BATCH_SIZE, ne - i);
+         hypre_FSAIAdaptiveBatch(A_diag, kap_tolerance, max_steps, max_step_size,
+                                 i, nr, work);
 
-         /* Cycle through each iteration for that row */
-         for (k = 0; k < max_steps; k++)
+         /* Pass values of the batch into G */
+         for (bb = 0; bb < nr; bb++)
          {
-            /* Compute Kaporin Gradient */
-            hypre_FindKapGrad(A_diag, kap_grad, kg_pos, G_temp, pattern,
-                              patt_size, max_nnzrow_diag_G, i, kg_marker);
-
-            /* Find max_step_size largest values of the kaporin gradient,
-               find their column indices, and add it to pattern */
-            patt_size_old = patt_size;
-            hypre_AddToPattern(kap_grad, kg_pos, pattern, &patt_size,
-                               kg_marker, max_step_size);
-
-            /* Update sizes */
-            hypre_VectorSize(A_sub)    = patt_size * patt_size;
-            hypre_VectorSize(A_subrow) = patt_size;
-            hypre_VectorSize(G_temp)   = patt_size;
-
-            if (patt_size == patt_size_old)
+            iloc = i + bb - ns;
+            Gloc_j[Gloc_i[iloc]] = i + bb;
+            Gloc_a[Gloc_i[iloc]] = work -> row_scale[bb];
+            for (k = 0; k < work -> patt_size[bb]; k++)
             {
-               new_psi = old_psi;
-               break;
+               j = Gloc_i[iloc] + k + 1;
+               Gloc_j[j] = work -> pattern[bb * max_nnzrow_diag_G + k];
+               Gloc_a[j] = work -> row_scale[bb] * work -> values[bb * max_nnzrow_diag_G + k];
             }
-            else
-            {
-               /* Gather A[P, P] and -A[i, P] */
-               for (j = 0; j < patt_size; j++)
-               {
-                  marker[pattern[j]] = j;
-               }
-               hypre_CSRMatrixExtractDenseMat(A_diag, A_sub, pattern, patt_size, marker);
-               hypre_CSRMatrixExtractDenseRow(A_diag, A_subrow, marker, i);
-
-               /* Solve A[P, P] G[i, P]' = -A[i, P] */
-               hypre_DenseSPDSystemSolve(A_sub, A_subrow, G_temp);
-
-               /* Determine psi_{k+1} = G_temp[i] * A[P, P] * G_temp[i]' */
-               new_psi = A_a[A_i[i]];
-               for (j = 0; j < patt_size; j++)
-               {
-                  new_psi += G_temp_data[j] * A_subrow_data[j];
-               }
-
-               /* Check psi reduction */
-               if (hypre_cabs(new_psi - old_psi) < hypre_creal(kap_tolerance * old_psi))
-               {
-                  break;
-               }
-               else
-               {
-                  old_psi = new_psi;
-               }
-            }
-         }
-
-         /* Reset marker for building dense linear system */
-         for (j = 0; j < patt_size; j++)
-         {
-            marker[pattern[j]] = -1;
-         }
-
-         /* Compute scaling factor */
-         if (hypre_creal(new_psi) > 0 && hypre_cimag(new_psi) == 0)
-         {
-            row_scale = 1.0 / hypre_csqrt(new_psi);
-         }
-         else
-         {
-            hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
-            hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
-
-            row_scale = 1.0 / hypre_cabs(A_a[A_i[i]]);
-            hypre_VectorSize(G_temp) = patt_size = 0;
+            Gloc_i[iloc + 1] = Gloc_i[iloc] + k + 1;
          }
-
-         /* Pass values of G_temp into G */
-         iloc = i - ns;
-         Gloc_j[Gloc_i[iloc]] = i;
-         Gloc_a[Gloc_i[iloc]] = row_scale;
-         for (k = 0; k < patt_size; k++)
-         {
-            j = Gloc_i[iloc] + k + 1;
-            Gloc_j[j] = pattern[k];
-            Gloc_a[j] = row_scale * G_temp_data[k];
-            kg_marker[pattern[k]] = 0;
-         }
-         Gloc_i[iloc + 1] = Gloc_i[iloc] + k + 1;
       }
 
       /* Copy data to shared memory */
@@ -657,14 +1386,7 @@ hypre_FSAISetupNative( void               *fsai_vdata,
       }
 
       /* Free memory */
-      hypre_SeqVectorDestroy(G_temp);
-      hypre_SeqVectorDestroy(A_subrow);
-      hypre_SeqVectorDestroy(kap_grad);
-      hypre_SeqVectorDestroy(A_sub);
-      hypre_TFree(kg_pos, HYPRE_MEMORY_HOST);
-      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
-      hypre_TFree(marker, HYPRE_MEMORY_HOST);
-      hypre_TFree(kg_marker, HYPRE_MEMORY_HOST);
+      hypre_FSAIAdaptiveWorkDestroy(work);
    } /* end openmp region */
    HYPRE_ANNOTATE_REGION_END("%s", "MainLoop");
 
@@ -679,6 +1401,9 @@ hypre_FSAISetupNative( void               *fsai_vdata,
 
 /*--------------------------------------------------------------------------
  * hypre_FSAISetupOMPDyn
+ *
+ * Adaptive FSAI with a dynamic distribution of batches of
+ * HYPRE_FSAI_BATCH_SIZE rows among the OpenMP threads.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -698,8 +1423,6 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
 
    /* CSRMatrix A_diag variables */
    hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
-   HYPRE_Complex          *A_a              = hypre_CSRMatrixData(A_diag);
    HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
 
    /* Matrix G variables */
@@ -712,12 +1435,12 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    HYPRE_Int               max_nnzrow_diag_G; /* Max. number of nonzeros per row in G_diag */
 
    /* Local variables */
+   HYPRE_Int               num_batches;
    HYPRE_Int               i, j, jj;
-   char                    msg[512];    /* Warning message */
-   HYPRE_Complex          *twspace;     /* shared work space for omp threads */
 
    /* Initalize some variables */
    max_nnzrow_diag_G = max_steps * max_step_size + 1;
+   num_batches = (num_rows_diag_A + HYPRE_FSAI_BATCH_SIZE - 1) / HYPRE_FSAI_BATCH_SIZE;
 
    G_diag = hypre_ParCSRMatrixDiag(G);
    G_a = hypre_CSRMatrixData(G_diag);
@@ -725,9 +1448,6 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    G_j = hypre_CSRMatrixJ(G_diag);
    G_nnzcnt = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
 
-   /* Allocate shared work space array for OpenMP threads */
-   twspace = hypre_CTAlloc(HYPRE_Complex, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
-
    /**********************************************************************
    * Start of Adaptive FSAI algorithm
    ***********************************************************************/
@@ -738,151 +1458,40 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    #pragma omp parallel
 #endif
    {
-      hypre_Vector   *G_temp;        /* Vector holding the values of G[i,:] */
-      hypre_Vector   *A_sub;         /* Vector holding the dense submatrix A[P, P] */
-      hypre_Vector   *A_subrow;      /* Vector holding A[i, P] */
-      hypre_Vector   *kap_grad;      /* Vector holding the Kaporin gradient values */
-      HYPRE_Int      *kg_pos;        /* Indices of nonzero entries of kap_grad */
-      HYPRE_Int      *kg_marker;     /* Marker array with nonzeros pointing to kg_pos */
-      HYPRE_Int      *marker;        /* Marker array with nonzeros pointing to P */
-      HYPRE_Int      *pattern;       /* Array holding column indices of G[i,:] */
-      HYPRE_Int       patt_size;     /* Number of entries in current pattern */
-      HYPRE_Int       patt_size_old; /* Number of entries in previous pattern */
-      HYPRE_Int       i, j, k;       /* Loop variables */
-      HYPRE_Complex   old_psi;       /* GAG' before k-th interation of aFSAI */
-      HYPRE_Complex   new_psi;       /* GAG' after k-th interation of aFSAI */
-      HYPRE_Complex   row_scale;     /* Scaling factor for G_temp */
-      HYPRE_Complex  *G_temp_data;
-      HYPRE_Complex  *A_subrow_data;
-
-      /* Allocate and initialize local vector variables */
-      G_temp    = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      A_subrow  = hypre_SeqVectorCreate(max_nnzrow_diag_G);
-      kap_grad  = hypre_SeqVectorCreate(num_rows_diag_A);
-      A_sub     = hypre_SeqVectorCreate(max_nnzrow_diag_G * max_nnzrow_diag_G);
-      pattern   = hypre_CTAlloc(HYPRE_Int, max_nnzrow_diag_G, HYPRE_MEMORY_HOST);
-      kg_pos    = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-      kg_marker = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-      marker    = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
-
-      hypre_SeqVectorInitialize_v2(G_temp, HYPRE_MEMORY_HOST);
-      hypre_SeqVectorInitialize_v2(A_subrow, HYPRE_MEMORY_HOST);
-      hypre_SeqVectorInitialize_v2(kap_grad, HYPRE_MEMORY_HOST);
-      hypre_SeqVectorInitialize_v2(A_sub, HYPRE_MEMORY_HOST);
-      hypre_Memset(marker, -1, num_rows_diag_A * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
-
-      /* Setting data variables for vectors */
-      G_temp_data   = hypre_VectorData(G_temp);
-      A_subrow_data = hypre_VectorData(A_subrow);
+      hypre_FSAIAdaptiveWork *work;
+      HYPRE_Int       b, bb, nr, i, j, k;
+
+      /* Allocate work space */
+      work = hypre_FSAIAdaptiveWorkCreate(num_rows_diag_A, max_nnzrow_diag_G);
 
 #ifdef HYPRE_USING_OPENMP
       #pragma omp for schedule(dynamic)
 #endif
-      for (i = 0; i < num_rows_diag_A; i++)
+      for (b = 0; b < num_batches; b++)
       {
-         patt_size = 0;
-
-         /* Set old_psi up front so we don't have to compute GAG' twice in the inner for-loop */
-         new_psi = old_psi = A_a[A_i[i]];
+         i  = b * HYPRE_FSAI_BATCH_SIZE;
+         nr = hypre_min(HYPRE_FSAI_BATCH_SIZE, num_rows_diag_A - i);
+         hypre_FSAIAdaptiveBatch(A_diag, kap_tolerance, max_steps, max_step_size,
+                                 i, nr, work);
 
-         /* Cycle through each iteration for that row */
-         for (k = 0; k < max_steps; k++)
+         /* Pass values of the batch into G */
+         for (bb = 0; bb < nr; bb++, i++)
          {
-            /* Compute Kaporin Gradient */
-            hypre_FindKapGrad(A_diag, kap_grad, kg_pos, G_temp, pattern,
-                              patt_size, max_nnzrow_diag_G, i, kg_marker);
-
-            /* Find max_step_size largest values of the kaporin gradient,
-               find their column indices, and add it to pattern */
-            patt_size_old = patt_size;
-            hypre_AddToPattern(kap_grad, kg_pos, pattern, &patt_size,
-                               kg_marker, max_step_size);
-
-            /* Update sizes */
-            hypre_VectorSize(A_sub)    = patt_size * patt_size;
-            hypre_VectorSize(A_subrow) = patt_size;
-            hypre_VectorSize(G_temp)   = patt_size;
-
-            if (patt_size == patt_size_old)
+            j = i * max_nnzrow_diag_G;
+            G_j[j] = i;
+            G_a[j] = work -> row_scale[bb];
+            j++;
+            for (k = 0; k < work -> patt_size[bb]; k++)
             {
-               new_psi = old_psi;
-               break;
-            }
-            else
-            {
-               /* Gather A[P, P] and -A[i, P] */
-               for (j = 0; j < patt_size; j++)
-               {
-                  marker[pattern[j]] = j;
-               }
-               hypre_CSRMatrixExtractDenseMat(A_diag, A_sub, pattern, patt_size, marker);
-               hypre_CSRMatrixExtractDenseRow(A_diag, A_subrow, marker, i);
-
-               /* Solve A[P, P] G[i, P]' = -A[i, P] */
-               hypre_DenseSPDSystemSolve(A_sub, A_subrow, G_temp);
-
-               /* Determine psi_{k+1} = G_temp[i] * A[P, P] * G_temp[i]' */
-               new_psi = A_a[A_i[i]];
-               for (j = 0; j < patt_size; j++)
-               {
-                  new_psi += G_temp_data[j] * A_subrow_data[j];
-               }
-
-               /* Check psi reduction */
-               if (hypre_cabs(new_psi - old_psi) < hypre_creal(kap_tolerance * old_psi))
-               {
-                  break;
-               }
-               else
-               {
-                  old_psi = new_psi;
-               }
+               G_j[j] = work -> pattern[bb * max_nnzrow_diag_G + k];
+               G_a[j++] = work -> row_scale[bb] * work -> values[bb * max_nnzrow_diag_G + k];
             }
+            G_nnzcnt[i] = work -> patt_size[bb] + 1;
          }
-
-         /* Reset marker for building dense linear system */
-         for (j = 0; j < patt_size; j++)
-         {
-            marker[pattern[j]] = -1;
-         }
-
-         /* Compute scaling factor */
-         if (hypre_creal(new_psi) > 0 && hypre_cimag(new_psi) == 0)
-         {
-            row_scale = 1.0 / hypre_csqrt(new_psi);
-         }
-         else
-         {
-            hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
-            hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
-
-            row_scale = 1.0 / hypre_cabs(A_a[A_i[i]]);
-            hypre_VectorSize(G_temp) = patt_size = 0;
-         }
-
-         /* Pass values of G_temp into G */
-         j = i * max_nnzrow_diag_G;
-         G_j[j] = i;
-         G_a[j] = row_scale;
-         j++;
-         for (k = 0; k < patt_size; k++)
-         {
-            G_j[j] = pattern[k];
-            G_a[j++] = row_scale * G_temp_data[k];
-            kg_marker[pattern[k]] = 0;
-         }
-         G_nnzcnt[i] = patt_size + 1;
       } /* omp for schedule(dynamic) */
 
       /* Free memory */
-      hypre_SeqVectorDestroy(G_temp);
-      hypre_SeqVectorDestroy(A_subrow);
-      hypre_SeqVectorDestroy(kap_grad);
-      hypre_SeqVectorDestroy(A_sub);
-      hypre_TFree(kg_pos, HYPRE_MEMORY_HOST);
-      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
-      hypre_TFree(marker, HYPRE_MEMORY_HOST);
-      hypre_TFree(kg_marker, HYPRE_MEMORY_HOST);
+      hypre_FSAIAdaptiveWorkDestroy(work);
    } /* end openmp region */
    HYPRE_ANNOTATE_REGION_END("%s", "MainLoop");
 
@@ -900,7 +1509,6 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    }
 
    /* Free memory */
-   hypre_TFree(twspace, HYPRE_MEMORY_HOST);
    hypre_TFree(G_nnzcnt, HYPRE_MEMORY_HOST);
 
    /* Update local number of nonzeros of G */
@@ -924,6 +1532,7 @@ hypre_FSAISetup( void               *fsai_vdata,
    HYPRE_Int                max_step_size = hypre_ParFSAIDataMaxStepSize(fsai_data);
    HYPRE_Int                max_nnz_row   = hypre_ParFSAIDataMaxNnzRow(fsai_data);
    HYPRE_Int                algo_type     = hypre_ParFSAIDataAlgoType(fsai_data);
+   HYPRE_Int                pattern_reuse = hypre_ParFSAIDataPatternReuse(fsai_data);
    HYPRE_Int                print_level   = hypre_ParFSAIDataPrintLevel(fsai_data);
    HYPRE_Int                eig_max_iters = hypre_ParFSAIDataEigMaxIters(fsai_data);
 
@@ -956,66 +1565,90 @@ hypre_FSAISetup( void               *fsai_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
-   /* Create and initialize work vectors used in the solve phase */
-   r_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
-   z_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
-
-   hypre_ParVectorInitialize(r_work);
-   hypre_ParVectorInitialize(z_work);
-
-   hypre_ParFSAIDataRWork(fsai_data) = r_work;
-   hypre_ParFSAIDataZWork(fsai_data) = z_work;
-
-   /* Create the matrix G */
-   if (algo_type == 1 || algo_type == 2)
+   /* Reuse the pattern of G from a previous setup call */
+   G = hypre_ParFSAIDataGmat(fsai_data);
+   if (pattern_reuse && G &&
+       hypre_ParCSRMatrixGlobalNumRows(G) == num_rows_A &&
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(G)) == num_rows_diag_A &&
+       hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_HOST)
    {
-      max_nnzrow_diag_G = max_steps * max_step_size + 1;
+      /* Recompute the coefficients of G only */
+      hypre_FSAISetupValuesBatched(A_diag, hypre_ParCSRMatrixDiag(G));
    }
    else
    {
-      max_nnzrow_diag_G = max_nnz_row + 1;
-   }
-   max_nonzeros_diag_G = num_rows_diag_A * max_nnzrow_diag_G;
-   G = hypre_ParCSRMatrixCreate(comm, num_rows_A, num_cols_A,
-                                row_starts_A, col_starts_A,
-                                0, max_nonzeros_diag_G, 0);
-   hypre_ParFSAIDataGmat(fsai_data) = G;
+      /* Free data from a previous setup call */
+      hypre_ParCSRMatrixDestroy(hypre_ParFSAIDataGmat(fsai_data));
+      hypre_ParVectorDestroy(hypre_ParFSAIDataRWork(fsai_data));
+      hypre_ParVectorDestroy(hypre_ParFSAIDataZWork(fsai_data));
+      hypre_ParFSAIDataGmat(fsai_data) = NULL;
+
+      /* Create and initialize work vectors used in the solve phase */
+      r_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
+      z_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
+
+      hypre_ParVectorInitialize(r_work);
+      hypre_ParVectorInitialize(z_work);
+
+      hypre_ParFSAIDataRWork(fsai_data) = r_work;
+      hypre_ParFSAIDataZWork(fsai_data) = z_work;
 
-   /* Initialize and compute lower triangular factor G */
+      /* Create the matrix G */
+      if (algo_type == 1 || algo_type == 2)
+      {
+         max_nnzrow_diag_G = max_steps * max_step_size + 1;
+      }
+      else
+      {
+         max_nnzrow_diag_G = max_nnz_row + 1;
+      }
+      max_nonzeros_diag_G = num_rows_diag_A * max_nnzrow_diag_G;
+      G = hypre_ParCSRMatrixCreate(comm, num_rows_A, num_cols_A,
+                                   row_starts_A, col_starts_A,
+                                   0, max_nonzeros_diag_G, 0);
+      hypre_ParFSAIDataGmat(fsai_data) = G;
+
+      /* Initialize and compute lower triangular factor G */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-   HYPRE_MemoryLocation  memloc_A = hypre_ParCSRMatrixMemoryLocation(A);
-   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(memloc_A);
+      HYPRE_MemoryLocation  memloc_A = hypre_ParCSRMatrixMemoryLocation(A);
+      HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(memloc_A);
 
-   if (exec == HYPRE_EXEC_DEVICE)
-   {
-      hypre_FSAISetupDevice(fsai_vdata, A, f, u);
-   }
-   else
+      if (exec == HYPRE_EXEC_DEVICE)
+      {
+         hypre_FSAISetupDevice(fsai_vdata, A, f, u);
+      }
+      else
 #endif
-   {
-      /* Initialize matrix */
-      hypre_ParCSRMatrixInitialize(G);
-
-      switch (algo_type)
       {
-         case 1:
-            // TODO: Change name to hypre_FSAISetupAdaptive
-            hypre_FSAISetupNative(fsai_vdata, A, f, u);
-            break;
-
-         case 2:
-            // TODO: Change name to hypre_FSAISetupAdaptiveOMPDynamic
-            hypre_FSAISetupOMPDyn(fsai_vdata, A, f, u);
-            break;
-
-         default:
-            hypre_FSAISetupNative(fsai_vdata, A, f, u);
-            break;
+         /* Initialize matrix */
+         hypre_ParCSRMatrixInitialize(G);
+
+         switch (algo_type)
+         {
+            case 1:
+               // TODO: Change name to hypre_FSAISetupAdaptive
+               hypre_FSAISetupNative(fsai_vdata, A, f, u);
+               break;
+
+            case 2:
+               // TODO: Change name to hypre_FSAISetupAdaptiveOMPDynamic
+               hypre_FSAISetupOMPDyn(fsai_vdata, A, f, u);
+               break;
+
+            case 3:
+               hypre_FSAISetupStaticPower(fsai_vdata, A, f, u);
+               break;
+
+            default:
+               hypre_FSAISetupNative(fsai_vdata, A, f, u);
+               break;
+         }
       }
    }
 
    /* Compute G^T */
    G  = hypre_ParFSAIDataGmat(fsai_data);
+   hypre_ParCSRMatrixDestroy(hypre_ParFSAIDataGTmat(fsai_data));
    hypre_ParCSRMatrixTranspose(G, &hypre_ParFSAIDataGTmat(fsai_data), 1);
 
    /* Update omega if requested */
@@ -93,6 +93,17 @@ hypre_ILUCreate( void )
    hypre_ParILUDataNLU(ilu_data)                          = 0;
    hypre_ParILUDataNI(ilu_data)                           = 0;
    hypre_ParILUDataUEnd(ilu_data)                         = NULL;
+   hypre_ParILUDataNumLowerLevels(ilu_data)               = 0;
+   hypre_ParILUDataLowerLevelPtr(ilu_data)                = NULL;
+   hypre_ParILUDataLowerLevelRows(ilu_data)               = NULL;
+   hypre_ParILUDataNumUpperLevels(ilu_data)               = 0;
+   hypre_ParILUDataUpperLevelPtr(ilu_data)                = NULL;
+   hypre_ParILUDataUpperLevelRows(ilu_data)               = NULL;
+   hypre_ParILUDataBlockSize(ilu_data)                    = 1;
+   hypre_ParILUDataBlockPerm(ilu_data)                    = NULL;
+   hypre_ParILUDataMatBL(ilu_data)                        = NULL;
+   hypre_ParILUDataMatBD(ilu_data)                        = NULL;
+   hypre_ParILUDataMatBU(ilu_data)                        = NULL;
 
    /* Iterative setup variables */
    hypre_ParILUDataIterativeSetupType(ilu_data)           = 0;
@@ -104,6 +115,8 @@ hypre_ILUCreate( void )
 
    /* reordering_type default to use local RCM */
    hypre_ParILUDataReorderingType(ilu_data)               = 1;
+   hypre_ParILUDataNumLocalParts(ilu_data)                = 0;
+   hypre_ParILUDataLocalPartPtr(ilu_data)                 = NULL;
 
    /* see hypre_ILUSetType for more default values */
    hypre_ParILUDataTestOption(ilu_data)                   = 0;
@@ -207,6 +220,18 @@ hypre_ILUDestroy( void *data )
       /* u_end */
       hypre_TFree( hypre_ParILUDataUEnd(ilu_data), HYPRE_MEMORY_HOST );
 
+      /* level schedules */
+      hypre_TFree( hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST );
+
+      /* block factors */
+      hypre_TFree( hypre_ParILUDataBlockPerm(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_CSRBlockMatrixDestroy( hypre_ParILUDataMatBL(ilu_data) );
+      hypre_TFree( hypre_ParILUDataMatBD(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_CSRBlockMatrixDestroy( hypre_ParILUDataMatBU(ilu_data) );
+
       /* Factors */
       hypre_ParCSRMatrixDestroy( hypre_ParILUDataMatS(ilu_data) );
       hypre_ParCSRMatrixDestroy( hypre_ParILUDataMatL(ilu_data) );
@@ -255,6 +280,7 @@ hypre_ILUDestroy( void *data )
       /* permutation array */
       hypre_TFree( hypre_ParILUDataPerm(ilu_data), memory_location );
       hypre_TFree( hypre_ParILUDataQPerm(ilu_data), memory_location );
+      hypre_TFree( hypre_ParILUDataLocalPartPtr(ilu_data), HYPRE_MEMORY_HOST );
 
       /* Iterative ILU data */
       hypre_TFree( hypre_ParILUDataIterativeSetupHistory(ilu_data), HYPRE_MEMORY_HOST );
@@ -571,6 +597,29 @@ hypre_ILUSetTriSolve( void      *ilu_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetBlockSize
+ *
+ * Set number of unknowns per node. Block Jacobi ILU(k) on the host factors
+ * block_size x block_size blocks when block_size > 1
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetBlockSize( void      *ilu_vdata,
+                       HYPRE_Int  block_size )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+
+   if (block_size < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParILUDataBlockSize(ilu_data) = block_size;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ILUSetLowerJacobiIters
  *
@@ -673,6 +722,25 @@ hypre_ILUSetLocalReordering( void      *ilu_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetNumLocalParts
+ *
+ * Set number of interior subdomains of the local matrix used by the
+ * dissection reordering (reordering_type = 2). Zero means one subdomain
+ * per OpenMP thread.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetNumLocalParts( void      *ilu_vdata,
+                           HYPRE_Int  num_local_parts )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+
+   hypre_ParILUDataNumLocalParts(ilu_data) = num_local_parts;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ILUSetSchurSolverKDIM
  *
@@ -1118,6 +1186,14 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
          }
          else
 #endif
+         if (hypre_ParILUDataMatBL(ilu_data))
+         {
+            hypre_printf("Block Jacobi with block ILU(%d), block size %d \n",
+                         hypre_ParILUDataLfil(ilu_data), hypre_ParILUDataBlockSize(ilu_data));
+            hypre_printf("Operator Complexity (Fill factor) = %f \n",
+                         hypre_ParILUDataOperatorComplexity(ilu_data));
+         }
+         else
          {
             hypre_printf("Block Jacobi with ILU(%d) \n", hypre_ParILUDataLfil(ilu_data));
             hypre_printf("Operator Complexity (Fill factor) = %f \n",
@@ -1228,7 +1304,11 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
 
    hypre_printf("\n ILU Solver Parameters: \n");
    hypre_printf("Max number of iterations: %d\n", hypre_ParILUDataMaxIter(ilu_data));
-   if (hypre_ParILUDataTriSolve(ilu_data))
+   if (hypre_ParILUDataTriSolve(ilu_data) == 2)
+   {
+      hypre_printf("  Triangular solver type: exact, level-scheduled (2)\n");
+   }
+   else if (hypre_ParILUDataTriSolve(ilu_data))
    {
       hypre_printf("  Triangular solver type: exact (1)\n");
    }
@@ -2143,6 +2223,105 @@ hypre_ILUGetLocalPerm(hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUGetLocalPermDissection
+ *
+ * Get a dissection ordering of the diag (local) matrix for the threaded
+ * block-jacobi factorizations on the host. The RCM ordering is split into num_parts
+ * contiguous chunks of equal size. Rows with a connection to a row in a
+ * later chunk are moved to a trailing separator, so that the remaining
+ * (interior) rows of different chunks are decoupled.
+ *
+ * Parameters:
+ *   A: parcsr matrix
+ *   perm: permutation array, interior rows of each part followed by the
+ *         separator rows
+ *   nLU: number of rows
+ *   num_parts: number of interior subdomains
+ *   part_ptr: interior rows of part p are perm[part_ptr[p]:part_ptr[p+1]-1],
+ *             separator rows are perm[part_ptr[num_parts]:nLU-1]
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUGetLocalPermDissection(hypre_ParCSRMatrix  *A,
+                                HYPRE_Int          **perm_ptr,
+                                HYPRE_Int           *nLU,
+                                HYPRE_Int            num_parts,
+                                HYPRE_Int          **part_ptr_ptr)
+{
+   HYPRE_Int             num_rows = hypre_ParCSRMatrixNumRows(A);
+   hypre_CSRMatrix      *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int            *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int            *A_diag_j = hypre_CSRMatrixJ(A_diag);
+
+   HYPRE_Int            *rcm_perm = NULL;
+   HYPRE_Int            *perm;
+   HYPRE_Int            *part_ptr;
+   HYPRE_Int            *part;
+   HYPRE_Int             i, ii, j, p, q, col;
+
+   num_parts = hypre_max(1, hypre_min(num_parts, num_rows));
+
+   /* Start from the RCM ordering, which keeps the separators small */
+   hypre_ILULocalRCM(A_diag, 0, num_rows, &rcm_perm, &rcm_perm, 1);
+
+   /* Assign contiguous chunks of the RCM ordering to parts */
+   part = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      part[rcm_perm[ii]] = (HYPRE_Int) (((HYPRE_BigInt) ii * num_parts) / num_rows);
+   }
+
+   /* Move to the separator (part = num_parts) the endpoint of each coupling
+    * between two different parts that lies in the part with smaller index */
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         col = A_diag_j[j];
+         p   = part[i];
+         q   = part[col];
+         if (p != q && p < num_parts && q < num_parts)
+         {
+            part[(p < q) ? i : col] = num_parts;
+         }
+      }
+   }
+
+   /* Build the permutation, keeping the RCM ordering within each part */
+   part_ptr = hypre_CTAlloc(HYPRE_Int, num_parts + 2, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      part_ptr[part[i] + 1]++;
+   }
+   for (p = 0; p <= num_parts; p++)
+   {
+      part_ptr[p + 1] += part_ptr[p];
+   }
+
+   perm = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      i = rcm_perm[ii];
+      perm[part_ptr[part[i]]++] = i;
+   }
+   for (p = num_parts; p > 0; p--)
+   {
+      part_ptr[p] = part_ptr[p - 1];
+   }
+   part_ptr[0] = 0;
+
+   hypre_TFree(rcm_perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(part, HYPRE_MEMORY_HOST);
+
+   /* Set output pointers */
+   *nLU          = num_rows;
+   *perm_ptr     = perm;
+   *part_ptr_ptr = part_ptr;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ILUBuildRASExternalMatrix
  *
@@ -54,6 +54,25 @@ typedef struct hypre_ParILUData_struct
    HYPRE_Int             nI;
    HYPRE_Int            *u_end; /* used when schur block is formed */
 
+   /* Level schedules of L and U for the host direct triangular solves (tri_solve = 2).
+    * Rows lower_level_rows[lower_level_ptr[k]:lower_level_ptr[k+1]-1] of L only depend
+    * on rows of lower levels, and similarly for U */
+   HYPRE_Int             num_lower_levels;
+   HYPRE_Int            *lower_level_ptr;
+   HYPRE_Int            *lower_level_rows;
+   HYPRE_Int             num_upper_levels;
+   HYPRE_Int            *upper_level_ptr;
+   HYPRE_Int            *upper_level_rows;
+
+   /* Block ILU(k) factors on the host, for systems with block_size unknowns per node.
+    * L and U are strictly triangular block CSR matrices in the (node) ordering given
+    * by block_perm, and block_D holds the inverses of the diagonal blocks */
+   HYPRE_Int             block_size;
+   HYPRE_Int            *block_perm;
+   hypre_CSRBlockMatrix *matBL;
+   HYPRE_Real           *matBD;
+   hypre_CSRBlockMatrix *matBU;
+
    /* Iterative ILU parameters */
    HYPRE_Int             iter_setup_type;
    HYPRE_Int             iter_setup_option;
@@ -135,6 +154,8 @@ typedef struct hypre_ParILUData_struct
 
    /* local reordering */
    HYPRE_Int             reordering_type;
+   HYPRE_Int             num_local_parts; /* interior subdomains for reordering_type = 2 */
+   HYPRE_Int            *local_part_ptr;  /* interior subdomains offsets in perm */
 } hypre_ParILUData;
 
 #define hypre_ParILUDataTestOption(ilu_data)                   ((ilu_data) -> test_opt)
@@ -190,6 +211,17 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataNLU(ilu_data)                          ((ilu_data) -> nLU)
 #define hypre_ParILUDataNI(ilu_data)                           ((ilu_data) -> nI)
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
+#define hypre_ParILUDataNumLowerLevels(ilu_data)               ((ilu_data) -> num_lower_levels)
+#define hypre_ParILUDataLowerLevelPtr(ilu_data)                ((ilu_data) -> lower_level_ptr)
+#define hypre_ParILUDataLowerLevelRows(ilu_data)               ((ilu_data) -> lower_level_rows)
+#define hypre_ParILUDataNumUpperLevels(ilu_data)               ((ilu_data) -> num_upper_levels)
+#define hypre_ParILUDataUpperLevelPtr(ilu_data)                ((ilu_data) -> upper_level_ptr)
+#define hypre_ParILUDataUpperLevelRows(ilu_data)               ((ilu_data) -> upper_level_rows)
+#define hypre_ParILUDataBlockSize(ilu_data)                    ((ilu_data) -> block_size)
+#define hypre_ParILUDataBlockPerm(ilu_data)                    ((ilu_data) -> block_perm)
+#define hypre_ParILUDataMatBL(ilu_data)                        ((ilu_data) -> matBL)
+#define hypre_ParILUDataMatBD(ilu_data)                        ((ilu_data) -> matBD)
+#define hypre_ParILUDataMatBU(ilu_data)                        ((ilu_data) -> matBU)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
 #define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
@@ -202,6 +234,8 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
 #define hypre_ParILUDataX(ilu_data)                            ((ilu_data) -> x)
 #define hypre_ParILUDataReorderingType(ilu_data)               ((ilu_data) -> reordering_type)
+#define hypre_ParILUDataNumLocalParts(ilu_data)                ((ilu_data) -> num_local_parts)
+#define hypre_ParILUDataLocalPartPtr(ilu_data)                 ((ilu_data) -> local_part_ptr)
 
 /* Iterative ILU setup */
 #define hypre_ParILUDataIterativeSetupType(ilu_data)           ((ilu_data) -> iter_setup_type)
@@ -64,6 +64,14 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParCSRMatrix   *matS                = hypre_ParILUDataMatS(ilu_data);
    HYPRE_Int             n                   = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
    HYPRE_Int             reordering_type     = hypre_ParILUDataReorderingType(ilu_data);
+   HYPRE_Int             num_local_parts     = hypre_ParILUDataNumLocalParts(ilu_data);
+   HYPRE_Int            *local_part_ptr      = hypre_ParILUDataLocalPartPtr(ilu_data);
+   HYPRE_Int             block_size          = hypre_ParILUDataBlockSize(ilu_data);
+   HYPRE_Int            *block_perm          = hypre_ParILUDataBlockPerm(ilu_data);
+   hypre_CSRBlockMatrix *matBL               = hypre_ParILUDataMatBL(ilu_data);
+   HYPRE_Real           *matBD               = hypre_ParILUDataMatBD(ilu_data);
+   hypre_CSRBlockMatrix *matBU               = hypre_ParILUDataMatBU(ilu_data);
+   HYPRE_Int             block_ilu;
    HYPRE_Real            nnzS;  /* Total nnz in S */
    HYPRE_Real            nnzS_offd_local;
    HYPRE_Real            nnzS_offd;
@@ -176,6 +184,11 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_TFree(matmD, HYPRE_MEMORY_DEVICE);
    hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
 
+   hypre_CSRBlockMatrixDestroy(matBL); matBL = NULL;
+   hypre_CSRBlockMatrixDestroy(matBU); matBU = NULL;
+   hypre_TFree(matBD, HYPRE_MEMORY_HOST);
+   hypre_TFree(block_perm, HYPRE_MEMORY_HOST);
+
    /* clear old l1_norm data, if created */
    hypre_TFree(hypre_ParILUDataL1Norms(ilu_data), HYPRE_MEMORY_HOST);
 
@@ -191,6 +204,12 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_TFree(hypre_ParILUDataFExt(ilu_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParILUDataUEnd(ilu_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParILUDataRelResNorms(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataNumLowerLevels(ilu_data) = 0;
+   hypre_ParILUDataNumUpperLevels(ilu_data) = 0;
 
    hypre_ParILUDataUTemp(ilu_data) = NULL;
    hypre_ParILUDataFTemp(ilu_data) = NULL;
@@ -249,8 +268,45 @@ hypre_ILUSetup( void               *ilu_vdata,
    F_array = f;
    U_array = u;
 
+   /* The dissection ordering is recomputed at every setup */
+   if (local_part_ptr)
+   {
+      hypre_TFree(perm, memory_location);
+      hypre_TFree(local_part_ptr, HYPRE_MEMORY_HOST);
+   }
+
+   /* Block ILU(k) (host BJ only) works with its own node ordering */
+   block_ilu = (block_size > 1 && ilu_type == 0 && (n % block_size) == 0 &&
+                hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST);
+   if (block_ilu && hypre_ParILUDataIterativeSetupType(ilu_data))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_ARG,
+                        "WARNING: block ILU(k) ignores the iterative setup.\n");
+   }
+   if (block_ilu && reordering_type == 2)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_ARG,
+                        "WARNING: block ILU(k) uses RCM instead of the dissection reordering.\n");
+   }
+
+   /* Threaded factorization of the interior subdomains (host BJ only) */
+   if (!block_ilu && reordering_type == 2 && (ilu_type == 0 || ilu_type == 1) &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      if (num_local_parts <= 0)
+      {
+         num_local_parts = hypre_NumThreads();
+      }
+      num_local_parts = hypre_max(1, hypre_min(num_local_parts, n));
+      hypre_ILUGetLocalPermDissection(matA, &perm, &nLU, num_local_parts, &local_part_ptr);
+   }
+
    /* Create perm array if necessary */
-   if (!perm)
+   if (block_ilu)
+   {
+      nLU = n;
+   }
+   else if (!perm)
    {
       switch (ilu_type)
       {
@@ -284,6 +340,28 @@ hypre_ILUSetup( void               *ilu_vdata,
          }
          else
 #endif
+         if (block_ilu)
+         {
+            hypre_ILUSetupBlockILUK(matA, block_size, fill_level, reordering_type,
+                                    &block_perm, &matBL, &matBD, &matBU);
+         }
+         else if (hypre_ParILUDataIterativeSetupType(ilu_data))
+         {
+            hypre_ILUSetupILUKIterative(matA, fill_level, perm,
+                                        hypre_ParILUDataIterativeSetupType(ilu_data),
+                                        hypre_ParILUDataIterativeSetupOption(ilu_data),
+                                        hypre_ParILUDataIterativeSetupMaxIter(ilu_data),
+                                        hypre_ParILUDataIterativeSetupTolerance(ilu_data),
+                                        &hypre_ParILUDataIterativeSetupNumIter(ilu_data),
+                                        &hypre_ParILUDataIterativeSetupHistory(ilu_data),
+                                        &matL, &matD, &matU, &u_end);
+         }
+         else if (local_part_ptr)
+         {
+            hypre_ILUSetupThreaded(matA, ilu_type, fill_level, droptol, perm,
+                                   num_local_parts, local_part_ptr, &matL, &matD, &matU, &u_end);
+         }
+         else
          {
             hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n,
                                &matL, &matD, &matU, &matS, &u_end);
@@ -299,6 +377,12 @@ hypre_ILUSetup( void               *ilu_vdata,
          }
          else
 #endif
+         if (local_part_ptr)
+         {
+            hypre_ILUSetupThreaded(matA, ilu_type, max_row_elmts, droptol, perm,
+                                   num_local_parts, local_part_ptr, &matL, &matD, &matU, &u_end);
+         }
+         else
          {
             hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, n, n,
                                &matL, &matD, &matU, &matS, &u_end);
@@ -516,7 +600,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                      hypre_ParKrylovCreateVectorArray,
                      hypre_ParKrylovDestroyVector,
                      hypre_ParKrylovMatvecCreate, //parCSR A -- inactive
-                     ((tri_solve == 1) ?
+                     (tri_solve ?
                       hypre_ParILUSchurGMRESMatvecDevice :
                       hypre_ParILUSchurGMRESMatvecJacIterDevice), //parCSR A -> ilu_data
                      hypre_ParKrylovMatvecDestroy, //parCSR A -- inactive
@@ -1059,12 +1143,32 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParILUDataMatS(ilu_data)          = matS;
    hypre_ParILUDataCFMarkerArray(ilu_data) = CF_marker_array;
    hypre_ParILUDataPerm(ilu_data)          = perm;
+   hypre_ParILUDataLocalPartPtr(ilu_data)  = local_part_ptr;
    hypre_ParILUDataQPerm(ilu_data)         = qperm;
    hypre_ParILUDataNLU(ilu_data)           = nLU;
    hypre_ParILUDataNI(ilu_data)            = nI;
    hypre_ParILUDataUEnd(ilu_data)          = u_end;
    hypre_ParILUDataUExt(ilu_data)          = uext;
    hypre_ParILUDataFExt(ilu_data)          = fext;
+   hypre_ParILUDataBlockPerm(ilu_data)     = block_perm;
+   hypre_ParILUDataMatBL(ilu_data)         = matBL;
+   hypre_ParILUDataMatBD(ilu_data)         = matBD;
+   hypre_ParILUDataMatBU(ilu_data)         = matBU;
+
+   /* Level schedules for the host direct triangular solves */
+   if (tri_solve == 2 && matL &&
+       hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_HOST &&
+       (ilu_type == 0 || ilu_type == 1 || ilu_type == 30 || ilu_type == 31))
+   {
+      hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matL), 0,
+                                  &hypre_ParILUDataNumLowerLevels(ilu_data),
+                                  &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                                  &hypre_ParILUDataLowerLevelRows(ilu_data));
+      hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matU), 1,
+                                  &hypre_ParILUDataNumUpperLevels(ilu_data),
+                                  &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                                  &hypre_ParILUDataUpperLevelRows(ilu_data));
+   }
 
    /* compute operator complexity */
    hypre_ParCSRMatrixSetDNumNonzeros(matA);
@@ -1169,10 +1273,25 @@ hypre_ILUSetup( void               *ilu_vdata,
          }
       }
 
-      hypre_ParILUDataOperatorComplexity(ilu_data) = ((HYPRE_Real)size_C + nnzS +
-                                                      hypre_ParCSRMatrixDNumNonzeros(matL) +
-                                                      hypre_ParCSRMatrixDNumNonzeros(matU)) /
-                                                     hypre_ParCSRMatrixDNumNonzeros(matA);
+      if (matBL)
+      {
+         /* Block factors, counted entrywise */
+         nnzS_offd_local = ((HYPRE_Real) hypre_CSRBlockMatrixNumNonzeros(matBL) +
+                            (HYPRE_Real) hypre_CSRBlockMatrixNumNonzeros(matBU) +
+                            (HYPRE_Real) hypre_CSRBlockMatrixNumRows(matBL)) *
+                           (HYPRE_Real) (block_size * block_size);
+         hypre_MPI_Allreduce(&nnzS_offd_local, &nnzS_offd, 1, HYPRE_MPI_REAL,
+                             hypre_MPI_SUM, comm);
+         hypre_ParILUDataOperatorComplexity(ilu_data) = nnzS_offd /
+                                                        hypre_ParCSRMatrixDNumNonzeros(matA);
+      }
+      else
+      {
+         hypre_ParILUDataOperatorComplexity(ilu_data) = ((HYPRE_Real)size_C + nnzS +
+                                                         hypre_ParCSRMatrixDNumNonzeros(matL) +
+                                                         hypre_ParCSRMatrixDNumNonzeros(matU)) /
+                                                        hypre_ParCSRMatrixDNumNonzeros(matA);
+      }
    }
 
    /* TODO (VPM): Move ILU statistics printout to its own function */
@@ -1180,7 +1299,13 @@ hypre_ILUSetup( void               *ilu_vdata,
    {
       hypre_printf("ILU SETUP: operator complexity = %f  \n",
                    hypre_ParILUDataOperatorComplexity(ilu_data));
-      if (hypre_ParILUDataTriSolve(ilu_data))
+      if (hypre_ParILUDataNumLowerLevels(ilu_data))
+      {
+         hypre_printf("ILU SOLVE: using level-scheduled direct solves (%d/%d levels)\n",
+                      hypre_ParILUDataNumLowerLevels(ilu_data),
+                      hypre_ParILUDataNumUpperLevels(ilu_data));
+      }
+      else if (hypre_ParILUDataTriSolve(ilu_data))
       {
          hypre_printf("ILU SOLVE: using direct triangular solves\n",
                       hypre_ParILUDataOperatorComplexity(ilu_data));
@@ -1191,7 +1316,6 @@ hypre_ILUSetup( void               *ilu_vdata,
                       hypre_ParILUDataOperatorComplexity(ilu_data));
       }
 
-#if defined (HYPRE_USING_ROCSPARSE)
       HYPRE_Int i;
 
       if (hypre_ParILUDataIterativeSetupType(ilu_data))
@@ -1218,7 +1342,8 @@ hypre_ILUSetup( void               *ilu_vdata,
                       hypre_ParILUDataIterativeSetupNumIter(ilu_data));
 
          /* Show convergence history */
-         if (hypre_ParILUDataIterativeSetupOption(ilu_data) & 0x10)
+         if ((hypre_ParILUDataIterativeSetupOption(ilu_data) & 0x10) &&
+             hypre_ParILUDataIterativeSetupHistory(ilu_data))
          {
             hypre_printf("ILU: iterative setup convergence history at rank 0:\n");
             hypre_printf("%8s", "iter");
@@ -1265,7 +1390,6 @@ hypre_ILUSetup( void               *ilu_vdata,
             }
          }
       }
-#endif
    }
 
    if (logging > 1)
@@ -1292,6 +1416,83 @@ hypre_ILUSetup( void               *ilu_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupLevelSchedule
+ *
+ * Compute the level schedule of the strictly lower (upper = 0) or strictly
+ * upper (upper = 1) triangular matrix T, stored without its diagonal.  Rows in
+ * the same level do not depend on each other and only depend on rows of
+ * previous levels, so they can be solved concurrently.
+ *
+ * T = triangular matrix (the diag part of L or U)
+ * num_levels_ptr = number of levels
+ * level_ptr_ptr = level pointer array of size num_levels + 1
+ * level_rows_ptr = rows sorted by level
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupLevelSchedule(hypre_CSRMatrix  *T,
+                            HYPRE_Int         upper,
+                            HYPRE_Int        *num_levels_ptr,
+                            HYPRE_Int       **level_ptr_ptr,
+                            HYPRE_Int       **level_rows_ptr)
+{
+   HYPRE_Int   n      = hypre_CSRMatrixNumRows(T);
+   HYPRE_Int  *T_i    = hypre_CSRMatrixI(T);
+   HYPRE_Int  *T_j    = hypre_CSRMatrixJ(T);
+
+   HYPRE_Int  *level;
+   HYPRE_Int  *level_ptr;
+   HYPRE_Int  *level_rows;
+   HYPRE_Int   num_levels = 0;
+   HYPRE_Int   i, ii, j, lev;
+
+   level = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* level of a row is one plus the largest level of the rows it depends on */
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? (n - 1 - ii) : ii;
+      lev = 0;
+      for (j = T_i[i]; j < T_i[i + 1]; j++)
+      {
+         lev = hypre_max(lev, level[T_j[j]] + 1);
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* bucket the rows by level, keeping the solve order within each level */
+   level_ptr  = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_ptr[level[i] + 1]++;
+   }
+   for (lev = 0; lev < num_levels; lev++)
+   {
+      level_ptr[lev + 1] += level_ptr[lev];
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? (n - 1 - ii) : ii;
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (lev = num_levels; lev > 0; lev--)
+   {
+      level_ptr[lev] = level_ptr[lev - 1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levels_ptr = num_levels;
+   *level_ptr_ptr  = level_ptr;
+   *level_rows_ptr = level_rows;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParILUExtractEBFC
  *
@@ -4732,6 +4933,1609 @@ hypre_ILUSetupILUT(hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupILUKRange
+ *
+ * ILU(k) symbolic and numeric factorization of rows ibegin to iend - 1 of a
+ * reordered matrix B, following hypre_ILUSetupILUKSymbolic and
+ * hypre_ILUSetupILUK with nLU = n. Row ii of B is stored in position
+ * ii - ibegin of (B_i, B_j, B_data) and has column indices less than ncols.
+ *
+ * The factors of rows before ibegin must already be available in L, D, U
+ * and U_lev (levels of the U entries). L_i[ibegin] and U_i[ibegin] give the
+ * current lengths of the L and U arrays, which are expanded as needed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ILUSetupILUKRange(HYPRE_Int             ibegin,
+                        HYPRE_Int             iend,
+                        HYPRE_Int             ncols,
+                        HYPRE_Int            *B_i,
+                        HYPRE_Int            *B_j,
+                        HYPRE_Real           *B_data,
+                        HYPRE_Int             lfil,
+                        HYPRE_Real           *D_data,
+                        HYPRE_Int            *L_i,
+                        HYPRE_Int           **L_j_ptr,
+                        HYPRE_Real          **L_data_ptr,
+                        HYPRE_Int            *capacity_L_ptr,
+                        HYPRE_Int            *U_i,
+                        HYPRE_Int           **U_j_ptr,
+                        HYPRE_Real          **U_data_ptr,
+                        HYPRE_Int           **U_lev_ptr,
+                        HYPRE_Int            *capacity_U_ptr,
+                        HYPRE_MemoryLocation  memory_location)
+{
+   HYPRE_Int     *L_j        = *L_j_ptr;
+   HYPRE_Real    *L_data     = *L_data_ptr;
+   HYPRE_Int     *U_j        = *U_j_ptr;
+   HYPRE_Real    *U_data     = *U_data_ptr;
+   HYPRE_Int     *U_lev      = *U_lev_ptr;
+   HYPRE_Int      capacity_L = *capacity_L_ptr;
+   HYPRE_Int      capacity_U = *capacity_U_ptr;
+   HYPRE_Int      ctrL       = L_i[ibegin];
+   HYPRE_Int      ctrU       = U_i[ibegin];
+
+   HYPRE_Int     *iw, *iL, *iLev;
+   HYPRE_Int      ii, j, k, kl, ku, lenl, lenu, lenh, ilev, lev, col, icol, jpiv, tmp;
+
+   /* working arrays, see hypre_ILUSetupILUKSymbolic */
+   iw   = hypre_TAlloc(HYPRE_Int, 3 * ncols, HYPRE_MEMORY_HOST);
+   iL   = iw + ncols;
+   iLev = iw + 2 * ncols;
+   for (j = 0; j < ncols; j++)
+   {
+      iw[j] = -1;
+   }
+
+   /* symbolic factorization */
+   for (ii = ibegin; ii < iend; ii++)
+   {
+      lenl = 0;
+      lenh = 0;
+      lenu = ii;
+
+      /* pattern of B, with level 0. L is kept in a heap */
+      for (j = B_i[ii - ibegin]; j < B_i[ii - ibegin + 1]; j++)
+      {
+         col = B_j[j];
+         if (col < ii)
+         {
+            iL[lenh] = col;
+            iLev[lenh] = 0;
+            iw[col] = lenh++;
+            hypre_ILUMinHeapAddIIIi(iL, iLev, iw, lenh);
+         }
+         else if (col > ii)
+         {
+            iL[lenu] = col;
+            iLev[lenu] = 0;
+            iw[col] = lenu++;
+         }
+      }
+
+      /* eliminate the rows of L in increasing order, updating levels */
+      while (lenh > 0)
+      {
+         k = iL[0];
+         ilev = iLev[0];
+         hypre_ILUMinHeapRemoveIIIi(iL, iLev, iw, lenh);
+         lenh--;
+         lenl++;
+         iw[k] = -1;
+         hypre_swap2i(iL, iLev, ii - lenl, lenh);
+
+         for (j = U_i[k]; j < U_i[k + 1]; j++)
+         {
+            col  = U_j[j];
+            lev  = U_lev[j] + ilev + 1;
+            icol = iw[col];
+            if (lev > lfil)
+            {
+               continue;
+            }
+            if (icol < 0)
+            {
+               if (col < ii)
+               {
+                  iL[lenh] = col;
+                  iLev[lenh] = lev;
+                  iw[col] = lenh++;
+                  hypre_ILUMinHeapAddIIIi(iL, iLev, iw, lenh);
+               }
+               else if (col > ii)
+               {
+                  iL[lenu] = col;
+                  iLev[lenu] = lev;
+                  iw[col] = lenu++;
+               }
+            }
+            else
+            {
+               iLev[icol] = hypre_min(lev, iLev[icol]);
+            }
+         }
+      }
+
+      /* copy L pattern, reverse order */
+      L_i[ii + 1] = L_i[ii] + lenl;
+      while (ctrL + lenl > capacity_L)
+      {
+         tmp = capacity_L;
+         capacity_L = (HYPRE_Int)(capacity_L * EXPAND_FACT + 1);
+         L_j = hypre_TReAlloc_v2(L_j, HYPRE_Int, tmp, HYPRE_Int, capacity_L, memory_location);
+         L_data = hypre_TReAlloc_v2(L_data, HYPRE_Real, tmp, HYPRE_Real, capacity_L,
+                                    memory_location);
+      }
+      for (j = 0; j < lenl; j++)
+      {
+         L_j[ctrL + j] = iL[ii - j - 1];
+      }
+      ctrL += lenl;
+
+      /* copy U pattern and levels */
+      k = lenu - ii;
+      U_i[ii + 1] = U_i[ii] + k;
+      while (ctrU + k > capacity_U)
+      {
+         tmp = capacity_U;
+         capacity_U = (HYPRE_Int)(capacity_U * EXPAND_FACT + 1);
+         U_j = hypre_TReAlloc_v2(U_j, HYPRE_Int, tmp, HYPRE_Int, capacity_U, memory_location);
+         U_data = hypre_TReAlloc_v2(U_data, HYPRE_Real, tmp, HYPRE_Real, capacity_U,
+                                    memory_location);
+         U_lev = hypre_TReAlloc_v2(U_lev, HYPRE_Int, tmp, HYPRE_Int, capacity_U,
+                                   HYPRE_MEMORY_HOST);
+      }
+      hypre_TMemcpy(U_j + ctrU, iL + ii, HYPRE_Int, k, memory_location, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(U_lev + ctrU, iLev + ii, HYPRE_Int, k, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      ctrU += k;
+
+      /* reset iw */
+      for (j = ii; j < lenu; j++)
+      {
+         iw[iL[j]] = -1;
+      }
+   }
+
+   /* numeric factorization */
+   for (ii = ibegin; ii < iend; ii++)
+   {
+      kl = L_i[ii + 1];
+      ku = U_i[ii + 1];
+      for (j = L_i[ii]; j < kl; j++)
+      {
+         iw[L_j[j]] = j;
+         L_data[j] = 0.0;
+      }
+      D_data[ii] = 0.0;
+      iw[ii] = ii;
+      for (j = U_i[ii]; j < ku; j++)
+      {
+         iw[U_j[j]] = j;
+         U_data[j] = 0.0;
+      }
+
+      /* copy data from B into L, D and U */
+      for (j = B_i[ii - ibegin]; j < B_i[ii - ibegin + 1]; j++)
+      {
+         col = B_j[j];
+         icol = iw[col];
+         if (col < ii)
+         {
+            L_data[icol] = B_data[j];
+         }
+         else if (col == ii)
+         {
+            D_data[ii] = B_data[j];
+         }
+         else
+         {
+            U_data[icol] = B_data[j];
+         }
+      }
+
+      /* elimination */
+      for (j = L_i[ii]; j < kl; j++)
+      {
+         jpiv = L_j[j];
+         L_data[j] *= D_data[jpiv];
+         for (k = U_i[jpiv]; k < U_i[jpiv + 1]; k++)
+         {
+            col = U_j[k];
+            icol = iw[col];
+            if (icol < 0)
+            {
+               continue;
+            }
+            if (col < ii)
+            {
+               L_data[icol] -= L_data[j] * U_data[k];
+            }
+            else if (col == ii)
+            {
+               D_data[icol] -= L_data[j] * U_data[k];
+            }
+            else
+            {
+               U_data[icol] -= L_data[j] * U_data[k];
+            }
+         }
+      }
+
+      /* reset working array */
+      for (j = L_i[ii]; j < kl; j++)
+      {
+         iw[L_j[j]] = -1;
+      }
+      iw[ii] = -1;
+      for (j = U_i[ii]; j < ku; j++)
+      {
+         iw[U_j[j]] = -1;
+      }
+
+      /* diagonal part (we store the inverse) */
+      if (hypre_abs(D_data[ii]) < MAT_TOL)
+      {
+         D_data[ii] = 1.0e-06;
+      }
+      D_data[ii] = 1. / D_data[ii];
+   }
+
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+
+   *L_j_ptr        = L_j;
+   *L_data_ptr     = L_data;
+   *capacity_L_ptr = capacity_L;
+   *U_j_ptr        = U_j;
+   *U_data_ptr     = U_data;
+   *U_lev_ptr      = U_lev;
+   *capacity_U_ptr = capacity_U;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupILUTRange
+ *
+ * ILUT factorization of rows ibegin to iend - 1 of a reordered matrix B,
+ * following hypre_ILUSetupILUT with nLU = n. The arguments are the same
+ * as in hypre_ILUSetupILUKRange, where lfil is the maximum number of
+ * nonzeros per row of L and U and tol the drop tolerance.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ILUSetupILUTRange(HYPRE_Int             ibegin,
+                        HYPRE_Int             iend,
+                        HYPRE_Int             ncols,
+                        HYPRE_Int            *B_i,
+                        HYPRE_Int            *B_j,
+                        HYPRE_Real           *B_data,
+                        HYPRE_Int             lfil,
+                        HYPRE_Real            tol,
+                        HYPRE_Real           *D_data,
+                        HYPRE_Int            *L_i,
+                        HYPRE_Int           **L_j_ptr,
+                        HYPRE_Real          **L_data_ptr,
+                        HYPRE_Int            *capacity_L_ptr,
+                        HYPRE_Int            *U_i,
+                        HYPRE_Int           **U_j_ptr,
+                        HYPRE_Real          **U_data_ptr,
+                        HYPRE_Int            *capacity_U_ptr,
+                        HYPRE_MemoryLocation  memory_location)
+{
+   HYPRE_Int     *L_j        = *L_j_ptr;
+   HYPRE_Real    *L_data     = *L_data_ptr;
+   HYPRE_Int     *U_j        = *U_j_ptr;
+   HYPRE_Real    *U_data     = *U_data_ptr;
+   HYPRE_Int      capacity_L = *capacity_L_ptr;
+   HYPRE_Int      capacity_U = *capacity_U_ptr;
+   HYPRE_Int      ctrL       = L_i[ibegin];
+   HYPRE_Int      ctrU       = U_i[ibegin];
+
+   HYPRE_Int     *iw, *iL;
+   HYPRE_Real    *w;
+   HYPRE_Int      ii, j, k1, k2, kl, ku, col, icol, lenl, lenu, lenhu, lenhlr, lenhll;
+   HYPRE_Int      jpos, jrow, tmp;
+   HYPRE_Real     inorm, itol, dpiv, lxu;
+
+   /* working arrays, see hypre_ILUSetupILUT */
+   iw = hypre_TAlloc(HYPRE_Int, 2 * ncols, HYPRE_MEMORY_HOST);
+   iL = iw + ncols;
+   w  = hypre_CTAlloc(HYPRE_Real, ncols, HYPRE_MEMORY_HOST);
+   for (j = 0; j < ncols; j++)
+   {
+      iw[j] = -1;
+   }
+
+   for (ii = ibegin; ii < iend; ii++)
+   {
+      k1 = B_i[ii - ibegin];
+      k2 = B_i[ii - ibegin + 1];
+      kl = ii - 1;
+
+      /* scaled tolerance of this row */
+      inorm = .0;
+      for (j = k1; j < k2; j++)
+      {
+         inorm += hypre_abs(B_data[j]);
+      }
+      if (inorm == .0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_ARG, "WARNING: ILUT with zero row.\n");
+      }
+      inorm /= (HYPRE_Real)(k2 - k1);
+      itol = tol * inorm;
+
+      /* copy in data from B */
+      lenhll = lenhlr = lenu = 0;
+      w[ii] = 0.0;
+      iw[ii] = ii;
+      for (j = k1; j < k2; j++)
+      {
+         col = B_j[j];
+         if (col < ii)
+         {
+            iL[lenhll] = col;
+            w[lenhll] = B_data[j];
+            iw[col] = lenhll++;
+            hypre_ILUMinHeapAddIRIi(iL, w, iw, lenhll);
+         }
+         else if (col == ii)
+         {
+            w[ii] = B_data[j];
+         }
+         else
+         {
+            lenu++;
+            jpos = lenu + ii;
+            iL[jpos] = col;
+            w[jpos] = B_data[j];
+            iw[col] = jpos;
+         }
+      }
+
+      /* main elimination, see hypre_ILUSetupILUT */
+      while (lenhll > 0)
+      {
+         jrow = iL[0];
+         dpiv = w[0] * D_data[jrow];
+         w[0] = dpiv;
+         hypre_ILUMinHeapRemoveIRIi(iL, w, iw, lenhll);
+         lenhll--;
+         iw[jrow] = -1;
+         hypre_swap2(iL, w, lenhll, kl - lenhlr);
+         lenhlr++;
+         hypre_ILUMaxrHeapAddRabsI(w + kl, iL + kl, lenhlr);
+
+         for (j = U_i[jrow]; j < U_i[jrow + 1]; j++)
+         {
+            col = U_j[j];
+            icol = iw[col];
+            lxu = - dpiv * U_data[j];
+            if ((icol == -1) && (hypre_abs(lxu) < itol))
+            {
+               continue;
+            }
+            if (icol == -1)
+            {
+               if (col < ii)
+               {
+                  iL[lenhll] = col;
+                  w[lenhll] = lxu;
+                  iw[col] = lenhll++;
+                  hypre_ILUMinHeapAddIRIi(iL, w, iw, lenhll);
+               }
+               else if (col == ii)
+               {
+                  w[ii] += lxu;
+               }
+               else
+               {
+                  lenu++;
+                  jpos = lenu + ii;
+                  iL[jpos] = col;
+                  w[jpos] = lxu;
+                  iw[col] = jpos;
+               }
+            }
+            else
+            {
+               w[icol] += lxu;
+            }
+         }
+      }
+
+      /* diagonal part (we store the inverse) */
+      if (hypre_abs(w[ii]) < MAT_TOL)
+      {
+         w[ii] = 1.0e-06;
+      }
+      D_data[ii] = 1. / w[ii];
+      iw[ii] = -1;
+
+      /* keep the largest lfil entries of L */
+      lenl = lenhlr < lfil ? lenhlr : lfil;
+      L_i[ii + 1] = L_i[ii] + lenl;
+      while (ctrL + lenl > capacity_L)
+      {
+         tmp = capacity_L;
+         capacity_L = (HYPRE_Int)(capacity_L * EXPAND_FACT + 1);
+         L_j = hypre_TReAlloc_v2(L_j, HYPRE_Int, tmp, HYPRE_Int, capacity_L, memory_location);
+         L_data = hypre_TReAlloc_v2(L_data, HYPRE_Real, tmp, HYPRE_Real, capacity_L,
+                                    memory_location);
+      }
+      ctrL += lenl;
+      for (j = L_i[ii]; j < ctrL; j++)
+      {
+         L_j[j] = iL[kl];
+         L_data[j] = w[kl];
+         hypre_ILUMaxrHeapRemoveRabsI(w + kl, iL + kl, lenhlr);
+         lenhlr--;
+      }
+
+      /* reset working array, only U part */
+      ku = lenu + ii;
+      for (j = ii + 1; j <= ku; j++)
+      {
+         iw[iL[j]] = -1;
+      }
+
+      /* keep the largest lfil entries of U */
+      if (lenu < lfil)
+      {
+         lenhu = lenu;
+      }
+      else
+      {
+         lenhu = lfil;
+         hypre_ILUMaxQSplitRabsI(w, iL, ii + 1, ii + lenhu, ii + lenu);
+      }
+      U_i[ii + 1] = U_i[ii] + lenhu;
+      while (ctrU + lenhu > capacity_U)
+      {
+         tmp = capacity_U;
+         capacity_U = (HYPRE_Int)(capacity_U * EXPAND_FACT + 1);
+         U_j = hypre_TReAlloc_v2(U_j, HYPRE_Int, tmp, HYPRE_Int, capacity_U, memory_location);
+         U_data = hypre_TReAlloc_v2(U_data, HYPRE_Real, tmp, HYPRE_Real, capacity_U,
+                                    memory_location);
+      }
+      ctrU += lenhu;
+      for (j = U_i[ii]; j < ctrU; j++)
+      {
+         jpos = ii + 1 + j - U_i[ii];
+         U_j[j] = iL[jpos];
+         U_data[j] = w[jpos];
+      }
+   }
+
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+   hypre_TFree(w, HYPRE_MEMORY_HOST);
+
+   *L_j_ptr        = L_j;
+   *L_data_ptr     = L_data;
+   *capacity_L_ptr = capacity_L;
+   *U_j_ptr        = U_j;
+   *U_data_ptr     = U_data;
+   *capacity_U_ptr = capacity_U;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupThreaded
+ *
+ * Threaded block-jacobi ILU(k) (ilu_type = 0) or ILUT (ilu_type = 1)
+ * factorization of the diag (local) matrix on the host.
+ *
+ * perm and part_ptr come from hypre_ILUGetLocalPermDissection: the interior
+ * rows of different parts are decoupled, so they can be factored
+ * concurrently. The separator rows are factored afterwards. The factors are
+ * the same as the ones of hypre_ILUSetupILUK/hypre_ILUSetupILUT with the
+ * same permutation.
+ *
+ * A: input matrix
+ * lfil: level of fill-in for ILU(k), maximum nnz per row in L and U for ILUT
+ * tol: droptol array in ILUT, only tol[0] is used
+ * perm: permutation array
+ * num_parts, part_ptr: interior subdomains of the permutation
+ * Lptr, Dptr, Uptr: L, D, U factors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupThreaded(hypre_ParCSRMatrix  *A,
+                       HYPRE_Int            ilu_type,
+                       HYPRE_Int            lfil,
+                       HYPRE_Real          *tol,
+                       HYPRE_Int           *perm,
+                       HYPRE_Int            num_parts,
+                       HYPRE_Int           *part_ptr,
+                       hypre_ParCSRMatrix **Lptr,
+                       HYPRE_Real         **Dptr,
+                       hypre_ParCSRMatrix **Uptr,
+                       HYPRE_Int          **u_end)
+{
+   MPI_Comm                 comm            = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix         *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real              *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_MemoryLocation     memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   HYPRE_Int                n               = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int                n_int           = part_ptr[num_parts]; /* interior rows */
+   HYPRE_Int                n_sep           = n - n_int;           /* separator rows */
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j;
+   HYPRE_Real              *L_diag_data;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j;
+   HYPRE_Real              *U_diag_data;
+   HYPRE_Int               *U_lev      = NULL;
+   HYPRE_Int                capacity_L, capacity_U;
+   HYPRE_Int               *u_end_array;
+
+   /* factors of the interior rows of each part, in local numbering:
+    * interior columns first, followed by the separator columns */
+   HYPRE_Int              **part_L_i, **part_L_j, **part_U_i, **part_U_j, **part_U_lev;
+   HYPRE_Real             **part_L_data, **part_U_data;
+
+   /* reordered rows */
+   HYPRE_Int               *B_i, *B_j;
+   HYPRE_Real              *B_data;
+   HYPRE_Int               *rperm;
+
+   HYPRE_Int                p, s, e, np, i, ii, j, k, col, nnz, pcap_L, pcap_U;
+   HYPRE_Real               local_nnz, total_nnz;
+
+   /* reverse permutation */
+   rperm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   D_data   = hypre_CTAlloc(HYPRE_Real, n, memory_location);
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, n + 1, memory_location);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, n + 1, memory_location);
+
+   part_L_i    = hypre_CTAlloc(HYPRE_Int *, num_parts, HYPRE_MEMORY_HOST);
+   part_L_j    = hypre_CTAlloc(HYPRE_Int *, num_parts, HYPRE_MEMORY_HOST);
+   part_L_data = hypre_CTAlloc(HYPRE_Real *, num_parts, HYPRE_MEMORY_HOST);
+   part_U_i    = hypre_CTAlloc(HYPRE_Int *, num_parts, HYPRE_MEMORY_HOST);
+   part_U_j    = hypre_CTAlloc(HYPRE_Int *, num_parts, HYPRE_MEMORY_HOST);
+   part_U_data = hypre_CTAlloc(HYPRE_Real *, num_parts, HYPRE_MEMORY_HOST);
+   part_U_lev  = hypre_CTAlloc(HYPRE_Int *, num_parts, HYPRE_MEMORY_HOST);
+
+   /*
+    * 1: Factor the interior rows of each part concurrently
+    */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(p, s, e, np, i, ii, j, k, col, B_i, B_j, B_data, \
+                                    pcap_L, pcap_U) HYPRE_SMP_SCHEDULE
+#endif
+   for (p = 0; p < num_parts; p++)
+   {
+      s  = part_ptr[p];
+      e  = part_ptr[p + 1];
+      np = e - s;
+
+      /* extract the reordered rows of this part in local numbering */
+      k = 0;
+      for (ii = s; ii < e; ii++)
+      {
+         k += A_diag_i[perm[ii] + 1] - A_diag_i[perm[ii]];
+      }
+      B_i    = hypre_TAlloc(HYPRE_Int, np + 1, HYPRE_MEMORY_HOST);
+      B_j    = hypre_TAlloc(HYPRE_Int, k, HYPRE_MEMORY_HOST);
+      B_data = hypre_TAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+
+      B_i[0] = k = 0;
+      for (ii = s; ii < e; ii++)
+      {
+         i = perm[ii];
+         for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+         {
+            col         = rperm[A_diag_j[j]];
+            B_j[k]      = (col < e) ? (col - s) : (np + col - n_int);
+            B_data[k++] = A_diag_data[j];
+         }
+         B_i[ii - s + 1] = k;
+      }
+
+      /* initial guess of the factors size, see hypre_ILUSetupILUK */
+      pcap_L = pcap_U = np + (k + 1) / 2 + 1;
+
+      part_L_i[p]    = hypre_CTAlloc(HYPRE_Int, np + 1, HYPRE_MEMORY_HOST);
+      part_L_j[p]    = hypre_TAlloc(HYPRE_Int, pcap_L, HYPRE_MEMORY_HOST);
+      part_L_data[p] = hypre_TAlloc(HYPRE_Real, pcap_L, HYPRE_MEMORY_HOST);
+      part_U_i[p]    = hypre_CTAlloc(HYPRE_Int, np + 1, HYPRE_MEMORY_HOST);
+      part_U_j[p]    = hypre_TAlloc(HYPRE_Int, pcap_U, HYPRE_MEMORY_HOST);
+      part_U_data[p] = hypre_TAlloc(HYPRE_Real, pcap_U, HYPRE_MEMORY_HOST);
+
+      if (ilu_type == 0)
+      {
+         part_U_lev[p] = hypre_TAlloc(HYPRE_Int, pcap_U, HYPRE_MEMORY_HOST);
+         hypre_ILUSetupILUKRange(0, np, np + n_sep, B_i, B_j, B_data, lfil, D_data + s,
+                                 part_L_i[p], &part_L_j[p], &part_L_data[p], &pcap_L,
+                                 part_U_i[p], &part_U_j[p], &part_U_data[p], &part_U_lev[p],
+                                 &pcap_U, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         hypre_ILUSetupILUTRange(0, np, np + n_sep, B_i, B_j, B_data, lfil, tol[0], D_data + s,
+                                 part_L_i[p], &part_L_j[p], &part_L_data[p], &pcap_L,
+                                 part_U_i[p], &part_U_j[p], &part_U_data[p], &pcap_U,
+                                 HYPRE_MEMORY_HOST);
+      }
+
+      hypre_TFree(B_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(B_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(B_data, HYPRE_MEMORY_HOST);
+   }
+
+   /*
+    * 2: Assemble the factors of the interior rows
+    */
+   for (p = 0; p < num_parts; p++)
+   {
+      s = part_ptr[p];
+      e = part_ptr[p + 1];
+      for (ii = s; ii < e; ii++)
+      {
+         L_diag_i[ii + 1] = L_diag_i[s] + part_L_i[p][ii - s + 1];
+         U_diag_i[ii + 1] = U_diag_i[s] + part_U_i[p][ii - s + 1];
+      }
+   }
+
+   /* room for the separator rows */
+   nnz = 0;
+   for (ii = n_int; ii < n; ii++)
+   {
+      nnz += A_diag_i[perm[ii] + 1] - A_diag_i[perm[ii]];
+   }
+   capacity_L = L_diag_i[n_int] + n_sep + (nnz + 1) / 2 + 1;
+   capacity_U = U_diag_i[n_int] + n_sep + (nnz + 1) / 2 + 1;
+
+   L_diag_j    = hypre_TAlloc(HYPRE_Int, capacity_L, memory_location);
+   L_diag_data = hypre_TAlloc(HYPRE_Real, capacity_L, memory_location);
+   U_diag_j    = hypre_TAlloc(HYPRE_Int, capacity_U, memory_location);
+   U_diag_data = hypre_TAlloc(HYPRE_Real, capacity_U, memory_location);
+   if (ilu_type == 0)
+   {
+      U_lev = hypre_TAlloc(HYPRE_Int, capacity_U, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(p, s, e, np, j, k, col) HYPRE_SMP_SCHEDULE
+#endif
+   for (p = 0; p < num_parts; p++)
+   {
+      s  = part_ptr[p];
+      e  = part_ptr[p + 1];
+      np = e - s;
+
+      /* map back to the global (reordered) numbering */
+      k = L_diag_i[s];
+      for (j = 0; j < part_L_i[p][np]; j++)
+      {
+         L_diag_j[k + j]    = s + part_L_j[p][j];
+         L_diag_data[k + j] = part_L_data[p][j];
+      }
+      k = U_diag_i[s];
+      for (j = 0; j < part_U_i[p][np]; j++)
+      {
+         col                = part_U_j[p][j];
+         U_diag_j[k + j]    = (col < np) ? (s + col) : (n_int + col - np);
+         U_diag_data[k + j] = part_U_data[p][j];
+      }
+      if (U_lev)
+      {
+         hypre_TMemcpy(U_lev + k, part_U_lev[p], HYPRE_Int, part_U_i[p][np],
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_TFree(part_L_i[p], HYPRE_MEMORY_HOST);
+      hypre_TFree(part_L_j[p], HYPRE_MEMORY_HOST);
+      hypre_TFree(part_L_data[p], HYPRE_MEMORY_HOST);
+      hypre_TFree(part_U_i[p], HYPRE_MEMORY_HOST);
+      hypre_TFree(part_U_j[p], HYPRE_MEMORY_HOST);
+      hypre_TFree(part_U_data[p], HYPRE_MEMORY_HOST);
+      hypre_TFree(part_U_lev[p], HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(part_L_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_L_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_L_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_U_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_U_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_U_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_U_lev, HYPRE_MEMORY_HOST);
+
+   /*
+    * 3: Factor the separator rows
+    */
+   if (n_sep > 0)
+   {
+      B_i    = hypre_TAlloc(HYPRE_Int, n_sep + 1, HYPRE_MEMORY_HOST);
+      B_j    = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+      B_data = hypre_TAlloc(HYPRE_Real, nnz, HYPRE_MEMORY_HOST);
+
+      B_i[0] = k = 0;
+      for (ii = n_int; ii < n; ii++)
+      {
+         i = perm[ii];
+         for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+         {
+            B_j[k]      = rperm[A_diag_j[j]];
+            B_data[k++] = A_diag_data[j];
+         }
+         B_i[ii - n_int + 1] = k;
+      }
+
+      if (ilu_type == 0)
+      {
+         hypre_ILUSetupILUKRange(n_int, n, n, B_i, B_j, B_data, lfil, D_data,
+                                 L_diag_i, &L_diag_j, &L_diag_data, &capacity_L,
+                                 U_diag_i, &U_diag_j, &U_diag_data, &U_lev, &capacity_U,
+                                 memory_location);
+      }
+      else
+      {
+         hypre_ILUSetupILUTRange(n_int, n, n, B_i, B_j, B_data, lfil, tol[0], D_data,
+                                 L_diag_i, &L_diag_j, &L_diag_data, &capacity_L,
+                                 U_diag_i, &U_diag_j, &U_diag_data, &capacity_U,
+                                 memory_location);
+      }
+
+      hypre_TFree(B_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(B_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(B_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(U_lev, HYPRE_MEMORY_HOST);
+   hypre_TFree(rperm, HYPRE_MEMORY_HOST);
+
+   /*
+    * 4: Assemble LDU matrices
+    */
+   u_end_array = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < n; ii++)
+   {
+      /* Everything is in U */
+      u_end_array[ii] = U_diag_i[ii + 1];
+   }
+
+   matL = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0 /* num_cols_offd */,
+                                    L_diag_i[n],
+                                    0 /* num_nonzeros_offd */);
+
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (L_diag_i[n] > 0)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      hypre_TFree(L_diag_j, memory_location);
+      hypre_TFree(L_diag_data, memory_location);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (L_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0,
+                                    U_diag_i[n],
+                                    0 );
+
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (U_diag_i[n] > 0)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      hypre_TFree(U_diag_j, memory_location);
+      hypre_TFree(U_diag_data, memory_location);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (U_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   /* set matrix pointers */
+   *Lptr  = matL;
+   *Dptr  = D_data;
+   *Uptr  = matU;
+   *u_end = u_end_array;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUIterativeSparseDot
+ *
+ * Sum of a_k * b_k over the common indices k < bound of two sparse vectors
+ * with sorted indices.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Real
+hypre_ILUIterativeSparseDot(HYPRE_Int   a_begin,
+                            HYPRE_Int   a_end,
+                            HYPRE_Int  *a_j,
+                            HYPRE_Real *a_data,
+                            HYPRE_Int   b_begin,
+                            HYPRE_Int   b_end,
+                            HYPRE_Int  *b_j,
+                            HYPRE_Real *b_data,
+                            HYPRE_Int   bound)
+{
+   HYPRE_Int   ka = a_begin;
+   HYPRE_Int   kb = b_begin;
+   HYPRE_Real  sum = 0.0;
+
+   while (ka < a_end && kb < b_end && a_j[ka] < bound && b_j[kb] < bound)
+   {
+      if (a_j[ka] == b_j[kb])
+      {
+         sum += a_data[ka++] * b_data[kb++];
+      }
+      else if (a_j[ka] < b_j[kb])
+      {
+         ka++;
+      }
+      else
+      {
+         kb++;
+      }
+   }
+
+   return sum;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupILUKIterative
+ *
+ * Setup ILU(k) on the host with the fixed-point iteration of Chow and Patel.
+ * The pattern of L and U comes from the ILU(k) symbolic factorization. Each
+ * sweep then updates all nonzeros concurrently:
+ *
+ *    l_ij = (a_ij - sum_{k<j} l_ik u_kj) / u_jj,   i > j
+ *    u_ij =  a_ij - sum_{k<i} l_ik u_kj,           i <= j
+ *
+ * U is kept by columns (with its diagonal) during the sweeps, so that each
+ * sum is a merge of a row of L with a column of U. The fixed point of the
+ * iteration is the ILU(k) factorization.
+ *
+ * A: input matrix
+ * lfil: level of fill-in, the k in ILU(k)
+ * perm: permutation array indicating ordering of factorization.
+ * type: 1/2: the factors are updated in place (Gauss-Seidel-like).
+ *       3: synchronous, every sweep only reads the previous iterate.
+ *       4: semi-synchronous, as 3, but U is updated with the new L.
+ *       Each row of L and column of U is only written by one thread, so
+ *       the result does not depend on the number of threads.
+ * option: same bits as in hypre_ILUSetIterativeSetupOption
+ * max_iter: maximum number of sweeps
+ * tolerance: stopping tolerance, used if (option & 2)
+ * num_iter_ptr: number of sweeps performed
+ * history_ptr: correction norms followed by residual norms, one entry per
+ *              sweep, computed if (option & 16)
+ * Lptr, Dptr, Uptr: L, D, U factors.
+ * u_end: end position of the upper part of each row of U
+ *
+ * The norms are local and relative: the correction norm is taken against
+ * the norm of the factors and the residual norm of A - LU (on the pattern)
+ * against the norm of the diagonal block of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupILUKIterative(hypre_ParCSRMatrix  *A,
+                            HYPRE_Int            lfil,
+                            HYPRE_Int           *perm,
+                            HYPRE_Int            type,
+                            HYPRE_Int            option,
+                            HYPRE_Int            max_iter,
+                            HYPRE_Real           tolerance,
+                            HYPRE_Int           *num_iter_ptr,
+                            HYPRE_Complex      **history_ptr,
+                            hypre_ParCSRMatrix **Lptr,
+                            HYPRE_Real         **Dptr,
+                            hypre_ParCSRMatrix **Uptr,
+                            HYPRE_Int          **u_end)
+{
+   MPI_Comm                 comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_MemoryLocation     memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   hypre_CSRMatrix         *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int                n               = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real              *A_diag_data     = hypre_CSRMatrixData(A_diag);
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j      = NULL;
+   HYPRE_Real              *L_diag_data   = NULL;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j      = NULL;
+   HYPRE_Real              *U_diag_data   = NULL;
+   HYPRE_Int               *S_diag_i;
+   HYPRE_Int               *S_diag_j      = NULL;
+   HYPRE_Int               *u_end_array   = NULL;
+
+   /* U (with diagonal) stored by columns, and values of A on the patterns */
+   HYPRE_Int               *UT_i, *UT_j, *UT_pos;
+   HYPRE_Real              *UT_data, *UT_A, *L_A;
+
+   /* Buffers holding the previous iterate for (semi-)synchronous sweeps */
+   HYPRE_Real              *L_old         = NULL;
+   HYPRE_Real              *UT_old        = NULL;
+   HYPRE_Real              *L_r, *L_w, *L_u, *UT_r, *UT_w, *tmp;
+
+   /* Convergence monitoring */
+   HYPRE_Complex           *history       = NULL;
+   HYPRE_Real               a_norm, f_norm, c_norm, r_norm;
+   HYPRE_Real               res, val, dd;
+   HYPRE_Int                num_iter = 0;
+
+   HYPRE_Real               local_nnz, total_nnz;
+   HYPRE_Int                i, ii, j, k, col, nnz_L, nnz_U, iter;
+   HYPRE_Int               *iw, *rperm;
+
+   /*
+    * 1: Symbolic factorization
+    */
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, n + 1, memory_location);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, n + 1, memory_location);
+   S_diag_i = hypre_CTAlloc(HYPRE_Int, 1, memory_location);
+   D_data   = hypre_CTAlloc(HYPRE_Real, n, memory_location);
+
+   iw    = hypre_CTAlloc(HYPRE_Int, 4 * n, HYPRE_MEMORY_HOST);
+   rperm = iw + 3 * n;
+   for (i = 0; i < n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   hypre_ILUSetupILUKSymbolic(n, A_diag_i, A_diag_j, lfil, perm, rperm, iw, n,
+                              L_diag_i, U_diag_i, S_diag_i,
+                              &L_diag_j, &U_diag_j, &S_diag_j, &u_end_array);
+   hypre_TFree(S_diag_i, memory_location);
+   hypre_TFree(S_diag_j, memory_location);
+
+   nnz_L = L_diag_i[n];
+   nnz_U = U_diag_i[n];
+   L_diag_data = hypre_CTAlloc(HYPRE_Real, nnz_L, memory_location);
+   U_diag_data = hypre_CTAlloc(HYPRE_Real, nnz_U, memory_location);
+   L_A         = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+
+   /*
+    * 2: Sort the patterns and copy A into them (fill-in starts from zero)
+    */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, i, j, k, col) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      hypre_qsort0(L_diag_j, L_diag_i[ii], L_diag_i[ii + 1] - 1);
+      hypre_qsort0(U_diag_j, U_diag_i[ii], U_diag_i[ii + 1] - 1);
+      u_end_array[ii] = U_diag_i[ii + 1];
+
+      i = perm[ii];
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         col = rperm[A_diag_j[j]];
+         if (col < ii)
+         {
+            k = hypre_BinarySearch(L_diag_j + L_diag_i[ii], col,
+                                   L_diag_i[ii + 1] - L_diag_i[ii]);
+            L_A[L_diag_i[ii] + k] = A_diag_data[j];
+         }
+         else if (col == ii)
+         {
+            D_data[ii] = A_diag_data[j];
+         }
+         else
+         {
+            k = hypre_BinarySearch(U_diag_j + U_diag_i[ii], col,
+                                   U_diag_i[ii + 1] - U_diag_i[ii]);
+            U_diag_data[U_diag_i[ii] + k] = A_diag_data[j];
+         }
+      }
+   }
+
+   /* Transpose U, appending the diagonal at the end of each column */
+   UT_i    = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+   UT_j    = hypre_TAlloc(HYPRE_Int, nnz_U + n, HYPRE_MEMORY_HOST);
+   UT_A    = hypre_TAlloc(HYPRE_Real, nnz_U + n, HYPRE_MEMORY_HOST);
+   UT_data = hypre_TAlloc(HYPRE_Real, nnz_U + n, HYPRE_MEMORY_HOST);
+   UT_pos  = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+   for (j = 0; j < nnz_U; j++)
+   {
+      UT_i[U_diag_j[j] + 1]++;
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      UT_i[ii + 1] += UT_i[ii] + 1;
+      iw[ii] = UT_i[ii];
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      /* all entries of column ii come from previous rows */
+      UT_j[iw[ii]]   = ii;
+      UT_A[iw[ii]++] = D_data[ii];
+      for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+      {
+         col         = U_diag_j[j];
+         UT_pos[j]   = iw[col];
+         UT_j[iw[col]]   = ii;
+         UT_A[iw[col]++] = U_diag_data[j];
+      }
+   }
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+
+   /* Initial guess: L = strict lower part of A scaled by diag(A), U = upper part of A */
+   a_norm = 0.0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, j) reduction(+:a_norm) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+      {
+         L_diag_data[j] = L_A[j] / ((hypre_abs(D_data[L_diag_j[j]]) < MAT_TOL) ?
+                                    1.0 : D_data[L_diag_j[j]]);
+         a_norm += L_A[j] * L_A[j];
+      }
+      for (j = UT_i[ii]; j < UT_i[ii + 1]; j++)
+      {
+         UT_data[j] = UT_A[j];
+         a_norm += UT_A[j] * UT_A[j];
+      }
+      hypre_assert(UT_j[UT_i[ii + 1] - 1] == ii);
+   }
+   a_norm = (a_norm > 0.0) ? hypre_sqrt(a_norm) : 1.0;
+
+   if (type > 2)
+   {
+      L_old  = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+      UT_old = hypre_TAlloc(HYPRE_Real, nnz_U + n, HYPRE_MEMORY_HOST);
+   }
+   if (option & 0x10)
+   {
+      hypre_TFree(*history_ptr, HYPRE_MEMORY_HOST);
+      history = hypre_CTAlloc(HYPRE_Complex, 2 * hypre_max(max_iter, 1), HYPRE_MEMORY_HOST);
+   }
+
+   /*
+    * 3: Fixed-point sweeps
+    * L_r/UT_r hold the values read by the sweep, L_w/UT_w the values written,
+    * and L_u the values of L read when updating U
+    */
+   L_w  = L_diag_data;
+   UT_w = UT_data;
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      if (type > 2)
+      {
+         tmp = L_old;  L_old  = L_w;  L_w  = tmp;
+         tmp = UT_old; UT_old = UT_w; UT_w = tmp;
+         L_r  = L_old;
+         UT_r = UT_old;
+      }
+      else
+      {
+         L_r  = L_w;
+         UT_r = UT_w;
+      }
+      L_u = (type == 3) ? L_r : L_w;
+
+      c_norm = r_norm = f_norm = 0.0;
+
+      /* Rows of L */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii, j, col, res, val, dd) \
+      reduction(+:c_norm, r_norm, f_norm) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+         {
+            col = L_diag_j[j];
+            res = L_A[j] - hypre_ILUIterativeSparseDot(L_diag_i[ii], j, L_diag_j, L_r,
+                                                       UT_i[col], UT_i[col + 1] - 1,
+                                                       UT_j, UT_r, col);
+            dd  = UT_r[UT_i[col + 1] - 1];
+            dd  = (hypre_abs(dd) < MAT_TOL) ? 1.0e-06 : dd;
+            val = res / dd;
+
+            r_norm += (res - L_r[j] * dd) * (res - L_r[j] * dd);
+            c_norm += (val - L_r[j]) * (val - L_r[j]);
+            f_norm += val * val;
+            L_w[j]  = val;
+         }
+      }
+
+      /* Columns of U */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii, j, i, res) \
+      reduction(+:c_norm, r_norm, f_norm) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         for (j = UT_i[ii]; j < UT_i[ii + 1]; j++)
+         {
+            i   = UT_j[j];
+            res = UT_A[j] - hypre_ILUIterativeSparseDot(L_diag_i[i], L_diag_i[i + 1],
+                                                        L_diag_j, L_u,
+                                                        UT_i[ii], j, UT_j, UT_r, i);
+
+            r_norm += (res - UT_r[j]) * (res - UT_r[j]);
+            c_norm += (res - UT_r[j]) * (res - UT_r[j]);
+            f_norm += res * res;
+            UT_w[j] = res;
+         }
+      }
+
+      /* The residual above was evaluated at the previous iterate (for U,
+       * with the L used in the update) */
+      num_iter++;
+      c_norm = hypre_sqrt(c_norm) / ((f_norm > 0.0) ? hypre_sqrt(f_norm) : 1.0);
+      r_norm = hypre_sqrt(r_norm) / a_norm;
+      if (history)
+      {
+         history[iter]            = c_norm;
+         history[max_iter + iter] = r_norm;
+      }
+
+      if ((option & 0x2) && (((option & 0x8) ? r_norm : c_norm) < tolerance))
+      {
+         break;
+      }
+   }
+
+   /* Save convergence history: correction norms followed by residual norms */
+   if (history)
+   {
+      for (iter = 0; iter < num_iter; iter++)
+      {
+         history[num_iter + iter] = history[max_iter + iter];
+      }
+      *history_ptr = history;
+   }
+   *num_iter_ptr = num_iter;
+
+   /*
+    * 4: Copy back to L, D (inverse), and U
+    */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, j, dd) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      if (L_w != L_diag_data)
+      {
+         for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+         {
+            L_diag_data[j] = L_w[j];
+         }
+      }
+      for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+      {
+         U_diag_data[j] = UT_w[UT_pos[j]];
+      }
+
+      /* diagonal part (we store the inverse) */
+      dd = UT_w[UT_i[ii + 1] - 1];
+      if (hypre_abs(dd) < MAT_TOL)
+      {
+         dd = 1.0e-06;
+      }
+      D_data[ii] = 1. / dd;
+   }
+
+   /* Free work arrays */
+   if (L_w != L_diag_data)
+   {
+      L_old = L_w;
+   }
+   if (UT_w != UT_data)
+   {
+      UT_old = UT_w;
+   }
+   hypre_TFree(L_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(L_A, HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_A, HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(UT_pos, HYPRE_MEMORY_HOST);
+
+   /*
+    * 5: Assemble LDU matrices
+    */
+   matL = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0 /* num_cols_offd */,
+                                    L_diag_i[n],
+                                    0 /* num_nonzeros_offd */);
+
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (L_diag_i[n] > 0)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      hypre_TFree(L_diag_j, memory_location);
+      hypre_TFree(L_diag_data, memory_location);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (L_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0,
+                                    U_diag_i[n],
+                                    0 );
+
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (U_diag_i[n] > 0)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      hypre_TFree(U_diag_j, memory_location);
+      hypre_TFree(U_diag_data, memory_location);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) (U_diag_i[n]);
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   /* set matrix pointers */
+   *Lptr  = matL;
+   *Dptr  = D_data;
+   *Uptr  = matU;
+   *u_end = u_end_array;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupBlockILUK
+ *
+ * Block ILU(k) setup of the diag (local) matrix on the host. The unknowns
+ * of each node are assumed to be contiguous (node-interleaved ordering), so
+ * that the local matrix can be viewed as a block CSR matrix with dense
+ * block_size x block_size blocks. The symbolic ILU(k) phase is done on the
+ * node graph, and the numeric phase replaces the scalar operations of the
+ * IKJ factorization by small dense block kernels.
+ *
+ * A: input matrix
+ * block_size: number of unknowns per node
+ * lfil: level of fill-in, the k in ILU(k)
+ * reordering_type: 0 for no reordering, RCM of the node graph otherwise
+ * block_perm_ptr: node ordering of the factorization
+ * BLptr: unit block lower factor, blocks scaled by the inverse of the
+ *        diagonal blocks (unit diagonal not stored)
+ * BDptr: inverse of the diagonal blocks, block_size^2 entries per node
+ * BUptr: strict block upper factor (not scaled)
+ *
+ * A singular diagonal block is replaced by the inverse of its diagonal, and
+ * a warning is issued.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupBlockILUK(hypre_ParCSRMatrix     *A,
+                        HYPRE_Int               block_size,
+                        HYPRE_Int               lfil,
+                        HYPRE_Int               reordering_type,
+                        HYPRE_Int             **block_perm_ptr,
+                        hypre_CSRBlockMatrix  **BLptr,
+                        HYPRE_Real            **BDptr,
+                        hypre_CSRBlockMatrix  **BUptr)
+{
+   hypre_CSRMatrix         *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int                n      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int                bnnz   = block_size * block_size;
+
+   /* Block view of A */
+   hypre_CSRBlockMatrix    *Ab;
+   hypre_CSRMatrix         *Ac;
+   HYPRE_Int                nb;
+   HYPRE_Int               *Ab_i, *Ab_j;
+   HYPRE_Real              *Ab_data;
+
+   /* Block factors */
+   hypre_CSRBlockMatrix    *BL, *BU;
+   HYPRE_Int               *BL_i, *BL_j = NULL;
+   HYPRE_Int               *BU_i, *BU_j = NULL;
+   HYPRE_Int               *S_i,  *S_j  = NULL;
+   HYPRE_Int               *u_end       = NULL;
+   HYPRE_Real              *BL_data, *BU_data, *BD_data;
+
+   HYPRE_MemoryLocation     memory_location;
+   HYPRE_Int               *perm = NULL;
+   HYPRE_Int               *rcm_perm = NULL;
+   HYPRE_Int               *rperm, *iw;
+   HYPRE_Real              *ident, *work, *dst;
+   HYPRE_Int                i, ii, j, jj, k, kk, col, pos, nnz_L, nnz_U;
+   HYPRE_Int                num_singular = 0;
+
+   if (block_size < 1 || n % block_size)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_ARG,
+                        "Local matrix size is not a multiple of the ILU block size!");
+      return hypre_error_flag;
+   }
+
+   /* A is node-interleaved: convert to block CSR */
+   Ab      = hypre_CSRBlockMatrixConvertFromCSRMatrix(A_diag, block_size);
+   nb      = hypre_CSRBlockMatrixNumRows(Ab);
+   Ab_i    = hypre_CSRBlockMatrixI(Ab);
+   Ab_j    = hypre_CSRBlockMatrixJ(Ab);
+   Ab_data = hypre_CSRBlockMatrixData(Ab);
+
+   /* Node ordering */
+   perm = hypre_TAlloc(HYPRE_Int, nb, HYPRE_MEMORY_HOST);
+   if (reordering_type != 0)
+   {
+      Ac = hypre_CSRBlockMatrixCompress(Ab);
+      hypre_ILULocalRCM(Ac, 0, nb, &rcm_perm, &rcm_perm, 1);
+      hypre_TMemcpy(perm, rcm_perm, HYPRE_Int, nb, HYPRE_MEMORY_HOST,
+                    hypre_CSRMatrixMemoryLocation(Ac));
+      hypre_TFree(rcm_perm, hypre_CSRMatrixMemoryLocation(Ac));
+      hypre_CSRMatrixDestroy(Ac);
+   }
+   else
+   {
+      for (i = 0; i < nb; i++)
+      {
+         perm[i] = i;
+      }
+   }
+
+   /*
+    * 1: Symbolic factorization of the node graph
+    */
+   HYPRE_GetMemoryLocation(&memory_location);
+   BL_i = hypre_CTAlloc(HYPRE_Int, nb + 1, HYPRE_MEMORY_HOST);
+   BU_i = hypre_CTAlloc(HYPRE_Int, nb + 1, HYPRE_MEMORY_HOST);
+   S_i  = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+   iw   = hypre_CTAlloc(HYPRE_Int, 4 * nb, HYPRE_MEMORY_HOST);
+   rperm = iw + 3 * nb;
+   for (i = 0; i < nb; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   hypre_ILUSetupILUKSymbolic(nb, Ab_i, Ab_j, lfil, perm, rperm, iw, nb,
+                              BL_i, BU_i, S_i, &BL_j, &BU_j, &S_j, &u_end);
+   hypre_TFree(S_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_j, memory_location);
+   hypre_TFree(u_end, HYPRE_MEMORY_HOST);
+
+   nnz_L = BL_i[nb];
+   nnz_U = BU_i[nb];
+
+   /* The block factors live on the host */
+   if (memory_location != HYPRE_MEMORY_HOST)
+   {
+      HYPRE_Int *tmp_j;
+
+      tmp_j = hypre_TAlloc(HYPRE_Int, nnz_L, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(tmp_j, BL_j, HYPRE_Int, nnz_L, HYPRE_MEMORY_HOST, memory_location);
+      hypre_TFree(BL_j, memory_location);
+      BL_j = tmp_j;
+
+      tmp_j = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(tmp_j, BU_j, HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST, memory_location);
+      hypre_TFree(BU_j, memory_location);
+      BU_j = tmp_j;
+   }
+
+   BL = hypre_CSRBlockMatrixCreate(block_size, nb, nb, nnz_L);
+   BU = hypre_CSRBlockMatrixCreate(block_size, nb, nb, nnz_U);
+   hypre_CSRBlockMatrixI(BL) = BL_i;
+   hypre_CSRBlockMatrixJ(BL) = BL_j;
+   hypre_CSRBlockMatrixI(BU) = BU_i;
+   hypre_CSRBlockMatrixJ(BU) = BU_j;
+   BL_data = hypre_CTAlloc(HYPRE_Real, nnz_L * bnnz, HYPRE_MEMORY_HOST);
+   BU_data = hypre_CTAlloc(HYPRE_Real, nnz_U * bnnz, HYPRE_MEMORY_HOST);
+   BD_data = hypre_CTAlloc(HYPRE_Real, nb * bnnz, HYPRE_MEMORY_HOST);
+   hypre_CSRBlockMatrixData(BL) = BL_data;
+   hypre_CSRBlockMatrixData(BU) = BU_data;
+
+   ident = hypre_CTAlloc(HYPRE_Real, 2 * bnnz, HYPRE_MEMORY_HOST);
+   work  = ident + bnnz;
+   for (i = 0; i < block_size; i++)
+   {
+      ident[i * block_size + i] = 1.0;
+   }
+
+   /*
+    * 2: Numeric factorization, IKJ version with block operations.
+    *    iw maps a column to its position in the current row of L (first nb
+    *    entries) or U (next nb entries), -1 if not in the pattern.
+    */
+   for (i = 0; i < 2 * nb; i++)
+   {
+      iw[i] = -1;
+   }
+
+   for (ii = 0; ii < nb; ii++)
+   {
+      /* The symbolic phase does not sort the U part */
+      hypre_qsort0(BL_j, BL_i[ii], BL_i[ii + 1] - 1);
+      hypre_qsort0(BU_j, BU_i[ii], BU_i[ii + 1] - 1);
+
+      for (j = BL_i[ii]; j < BL_i[ii + 1]; j++)
+      {
+         iw[BL_j[j]] = j;
+      }
+      for (j = BU_i[ii]; j < BU_i[ii + 1]; j++)
+      {
+         iw[nb + BU_j[j]] = j;
+      }
+
+      /* Load the block row of A (fill-in starts from zero) */
+      i = perm[ii];
+      for (j = Ab_i[i]; j < Ab_i[i + 1]; j++)
+      {
+         col = rperm[Ab_j[j]];
+         if (col < ii)
+         {
+            dst = BL_data + iw[col] * bnnz;
+         }
+         else if (col > ii)
+         {
+            dst = BU_data + iw[nb + col] * bnnz;
+         }
+         else
+         {
+            dst = BD_data + ii * bnnz;
+         }
+         for (k = 0; k < bnnz; k++)
+         {
+            dst[k] = Ab_data[j * bnnz + k];
+         }
+      }
+
+      /* Eliminate with the previous block rows, in increasing column order */
+      for (j = BL_i[ii]; j < BL_i[ii + 1]; j++)
+      {
+         jj = BL_j[j];
+
+         /* L_(ii,jj) = A_(ii,jj) * inv(D_jj) */
+         hypre_CSRBlockMatrixBlockMultAdd(BL_data + j * bnnz, BD_data + jj * bnnz,
+                                          0.0, work, block_size);
+         for (k = 0; k < bnnz; k++)
+         {
+            BL_data[j * bnnz + k] = work[k];
+         }
+
+         /* A_(ii,col) -= L_(ii,jj) * U_(jj,col) on the pattern */
+         for (kk = BU_i[jj]; kk < BU_i[jj + 1]; kk++)
+         {
+            col = BU_j[kk];
+            if (col < ii)
+            {
+               pos = iw[col];
+               dst = (pos < 0) ? NULL : BL_data + pos * bnnz;
+            }
+            else if (col > ii)
+            {
+               pos = iw[nb + col];
+               dst = (pos < 0) ? NULL : BU_data + pos * bnnz;
+            }
+            else
+            {
+               dst = BD_data + ii * bnnz;
+            }
+
+            if (dst)
+            {
+               hypre_CSRBlockMatrixBlockMultAdd(BL_data + j * bnnz, BU_data + kk * bnnz,
+                                                0.0, work, block_size);
+               for (k = 0; k < bnnz; k++)
+               {
+                  dst[k] -= work[k];
+               }
+            }
+         }
+      }
+
+      /* Store the inverse of the diagonal block. If the block is singular,
+       * fall back to the inverse of its diagonal */
+      dst = BD_data + ii * bnnz;
+      if (hypre_CSRBlockMatrixBlockInvMult(dst, ident, work, block_size))
+      {
+         num_singular++;
+         for (k = 0; k < bnnz; k++)
+         {
+            work[k] = 0.0;
+         }
+         for (k = 0; k < block_size; k++)
+         {
+            work[k * block_size + k] = (hypre_abs(dst[k * block_size + k]) < MAT_TOL) ?
+                                       1.0e+06 : 1.0 / dst[k * block_size + k];
+         }
+      }
+      for (k = 0; k < bnnz; k++)
+      {
+         dst[k] = work[k];
+      }
+
+      /* Reset the position map */
+      for (j = BL_i[ii]; j < BL_i[ii + 1]; j++)
+      {
+         iw[BL_j[j]] = -1;
+      }
+      for (j = BU_i[ii]; j < BU_i[ii + 1]; j++)
+      {
+         iw[nb + BU_j[j]] = -1;
+      }
+   }
+
+   if (num_singular)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "WARNING: singular blocks in block ILU(k), using their diagonal.\n");
+   }
+
+   /* Free memory */
+   hypre_TFree(ident, HYPRE_MEMORY_HOST);
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+   hypre_CSRBlockMatrixDestroy(Ab);
+
+   /* Set output pointers */
+   *block_perm_ptr = perm;
+   *BLptr          = BL;
+   *BDptr          = BD_data;
+   *BUptr          = BU;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_NSHSetup
  *--------------------------------------------------------------------------*/
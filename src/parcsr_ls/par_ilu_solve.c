@@ -38,11 +38,15 @@ hypre_ILUSolve( void               *ilu_vdata,
    hypre_ParCSRMatrix   *matS               = hypre_ParILUDataMatS(ilu_data);
    HYPRE_Real           *matD               = hypre_ParILUDataMatD(ilu_data);
    HYPRE_Real           *matmD              = hypre_ParILUDataMatDModified(ilu_data);
+   hypre_CSRBlockMatrix *matBL              = hypre_ParILUDataMatBL(ilu_data);
+   HYPRE_Real           *matBD              = hypre_ParILUDataMatBD(ilu_data);
+   hypre_CSRBlockMatrix *matBU              = hypre_ParILUDataMatBU(ilu_data);
 
    /* Vectors */
    HYPRE_Int             ilu_type           = hypre_ParILUDataIluType(ilu_data);
    HYPRE_Int            *perm               = hypre_ParILUDataPerm(ilu_data);
    HYPRE_Int            *qperm              = hypre_ParILUDataQPerm(ilu_data);
+   HYPRE_Int            *block_perm         = hypre_ParILUDataBlockPerm(ilu_data);
    hypre_ParVector      *F_array            = hypre_ParILUDataF(ilu_data);
    hypre_ParVector      *U_array            = hypre_ParILUDataU(ilu_data);
 
@@ -93,6 +97,14 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Int             nLU                = hypre_ParILUDataNLU(ilu_data);
    HYPRE_Int            *u_end              = hypre_ParILUDataUEnd(ilu_data);
 
+   /* Level schedules for the host direct triangular solves */
+   HYPRE_Int             num_lower_levels   = hypre_ParILUDataNumLowerLevels(ilu_data);
+   HYPRE_Int            *lower_level_ptr    = hypre_ParILUDataLowerLevelPtr(ilu_data);
+   HYPRE_Int            *lower_level_rows   = hypre_ParILUDataLowerLevelRows(ilu_data);
+   HYPRE_Int             num_upper_levels   = hypre_ParILUDataNumUpperLevels(ilu_data);
+   HYPRE_Int            *upper_level_ptr    = hypre_ParILUDataUpperLevelPtr(ilu_data);
+   HYPRE_Int            *upper_level_rows   = hypre_ParILUDataUpperLevelRows(ilu_data);
+
    /* Schur system solve */
    HYPRE_Solver          schur_solver       = hypre_ParILUDataSchurSolver(ilu_data);
    HYPRE_Solver          schur_precond      = hypre_ParILUDataSchurPrecond(ilu_data);
@@ -251,7 +263,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             if (exec == HYPRE_EXEC_DEVICE)
             {
                /* Apply GPU-accelerated LU solve - BJ-ILU0 */
-               if (tri_solve == 1)
+               if (tri_solve)
                {
                   hypre_ILUSolveLUDevice(matA, matBLU_d, F_array, U_array, perm, Utemp, Ftemp);
                }
@@ -269,7 +281,19 @@ hypre_ILUSolve( void               *ilu_vdata,
 #endif
             {
                /* BJ - hypre_ilu */
-               if (tri_solve == 1)
+               if (matBL)
+               {
+                  hypre_ILUSolveBlockLU(matA, F_array, U_array, block_perm,
+                                        matBL, matBD, matBU, Utemp, Ftemp);
+               }
+               else if (lower_level_ptr)
+               {
+                  hypre_ILUSolveLULevels(matA, F_array, U_array, perm, n,
+                                         matL, matD, matU, Utemp, Ftemp,
+                                         num_lower_levels, lower_level_ptr, lower_level_rows,
+                                         num_upper_levels, upper_level_ptr, upper_level_rows);
+               }
+               else if (tri_solve)
                {
                   hypre_ILUSolveLU(matA, F_array, U_array, perm, n,
                                    matL, matD, matU, Utemp, Ftemp);
@@ -288,7 +312,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             if (exec == HYPRE_EXEC_DEVICE)
             {
                /* Apply GPU-accelerated GMRES-ILU solve */
-               if (tri_solve == 1)
+               if (tri_solve)
                {
                   hypre_ILUSolveSchurGMRESDevice(matA, F_array, U_array, perm, nLU, matS,
                                                  Utemp, Ftemp, schur_solver, schur_precond,
@@ -340,8 +364,18 @@ hypre_ILUSolve( void               *ilu_vdata,
             }
 #endif
             /* RAS */
-            hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU,
-                                Utemp, Utemp, fext, uext);
+            if (lower_level_ptr)
+            {
+               hypre_ILUSolveLURASLevels(matA, F_array, U_array, perm, matL, matD, matU,
+                                         Utemp, Utemp, fext, uext,
+                                         num_lower_levels, lower_level_ptr, lower_level_rows,
+                                         num_upper_levels, upper_level_ptr, upper_level_rows);
+            }
+            else
+            {
+               hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU,
+                                   Utemp, Utemp, fext, uext);
+            }
             break;
 
          case 40: case 41:
@@ -941,6 +975,98 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveBlockLU
+ *
+ * Block incomplete LU solve, see hypre_ILUSetupBlockILUK
+ *
+ * The factors have local scope and are stored by nodes of block_size
+ * unknowns. block_perm contains the node ordering of the factorization,
+ * the unknowns of node i are [i * block_size, (i + 1) * block_size).
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSolveBlockLU(hypre_ParCSRMatrix   *A,
+                      hypre_ParVector      *f,
+                      hypre_ParVector      *u,
+                      HYPRE_Int            *block_perm,
+                      hypre_CSRBlockMatrix *BL,
+                      HYPRE_Real           *BD,
+                      hypre_CSRBlockMatrix *BU,
+                      hypre_ParVector      *ftemp,
+                      hypre_ParVector      *utemp)
+{
+   /* data objects for L and U */
+   HYPRE_Int        bs          = hypre_CSRBlockMatrixBlockSize(BL);
+   HYPRE_Int        bnnz        = bs * bs;
+   HYPRE_Int        nb          = hypre_CSRBlockMatrixNumRows(BL);
+   HYPRE_Real      *BL_data     = hypre_CSRBlockMatrixData(BL);
+   HYPRE_Int       *BL_i        = hypre_CSRBlockMatrixI(BL);
+   HYPRE_Int       *BL_j        = hypre_CSRBlockMatrixJ(BL);
+   HYPRE_Real      *BU_data     = hypre_CSRBlockMatrixData(BU);
+   HYPRE_Int       *BU_i        = hypre_CSRBlockMatrixI(BU);
+   HYPRE_Int       *BU_j        = hypre_CSRBlockMatrixJ(BU);
+
+   /* Vectors */
+   hypre_Vector    *utemp_local = hypre_ParVectorLocalVector(utemp);
+   HYPRE_Real      *utemp_data  = hypre_VectorData(utemp_local);
+   hypre_Vector    *ftemp_local = hypre_ParVectorLocalVector(ftemp);
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(ftemp_local);
+   HYPRE_Real       alpha       = -1.0;
+   HYPRE_Real       beta        = 1.0;
+   HYPRE_Real      *work, *ui;
+   HYPRE_Int        i, ii, j, k;
+
+   work = hypre_TAlloc(HYPRE_Real, bs, HYPRE_MEMORY_HOST);
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* L solve - Forward solve (L has unit diagonal blocks) */
+   for (ii = 0; ii < nb; ii++)
+   {
+      i  = block_perm ? block_perm[ii] : ii;
+      ui = utemp_data + i * bs;
+      for (k = 0; k < bs; k++)
+      {
+         ui[k] = ftemp_data[i * bs + k];
+      }
+      for (j = BL_i[ii]; j < BL_i[ii + 1]; j++)
+      {
+         i = block_perm ? block_perm[BL_j[j]] : BL_j[j];
+         hypre_CSRBlockMatrixBlockMatvec(-1.0, BL_data + j * bnnz, utemp_data + i * bs,
+                                         1.0, ui, bs);
+      }
+   }
+
+   /* U solve - Backward substitution */
+   for (ii = nb - 1; ii >= 0; ii--)
+   {
+      i  = block_perm ? block_perm[ii] : ii;
+      ui = utemp_data + i * bs;
+      for (j = BU_i[ii]; j < BU_i[ii + 1]; j++)
+      {
+         i = block_perm ? block_perm[BU_j[j]] : BU_j[j];
+         hypre_CSRBlockMatrixBlockMatvec(-1.0, BU_data + j * bnnz, utemp_data + i * bs,
+                                         1.0, ui, bs);
+      }
+
+      /* diagonal scaling (D is stored as its inverse) */
+      hypre_CSRBlockMatrixBlockMatvec(1.0, BD + ii * bnnz, ui, 0.0, work, bs);
+      for (k = 0; k < bs; k++)
+      {
+         ui[k] = work[k];
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_ILUSolveLUIter
  *
@@ -1299,6 +1425,215 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveLevelsHost
+ *
+ * Level-scheduled forward and backward substitutions with the local
+ * L, D and U factors. Rows within a level are independent and are
+ * distributed among threads; each row performs the same operations in
+ * the same order as the sequential solves, so results are identical.
+ *
+ * Rows i < n live in utemp_data (at perm[i], or i when perm is NULL),
+ * rows i >= n live in uext (RAS only, with right-hand side in fext).
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ILUSolveLevelsHost(HYPRE_Int        n,
+                         HYPRE_Int       *perm,
+                         hypre_CSRMatrix *L_diag,
+                         HYPRE_Real      *D,
+                         hypre_CSRMatrix *U_diag,
+                         HYPRE_Real      *ftemp_data,
+                         HYPRE_Real      *fext,
+                         HYPRE_Real      *utemp_data,
+                         HYPRE_Real      *uext,
+                         HYPRE_Int        num_lower_levels,
+                         HYPRE_Int       *lower_level_ptr,
+                         HYPRE_Int       *lower_level_rows,
+                         HYPRE_Int        num_upper_levels,
+                         HYPRE_Int       *upper_level_ptr,
+                         HYPRE_Int       *upper_level_rows)
+{
+   HYPRE_Real  *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int   *L_diag_i    = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int   *L_diag_j    = hypre_CSRMatrixJ(L_diag);
+   HYPRE_Real  *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int   *U_diag_i    = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int   *U_diag_j    = hypre_CSRMatrixJ(U_diag);
+
+   HYPRE_Int    lev, ii, i, j, col;
+   HYPRE_Real   sum;
+
+#define hypre_ILULevelsU(r) \
+   (*((r) < n ? &utemp_data[perm ? perm[r] : (r)] : &uext[(r) - n]))
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(lev, ii, i, j, col, sum)
+#endif
+   {
+      /* L solve - Forward solve (the diagonal of L is identity) */
+      for (lev = 0; lev < num_lower_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = lower_level_ptr[lev]; ii < lower_level_ptr[lev + 1]; ii++)
+         {
+            i   = lower_level_rows[ii];
+            sum = (i < n) ? ftemp_data[perm ? perm[i] : i] : fext[i - n];
+            for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+            {
+               col  = L_diag_j[j];
+               sum -= L_diag_data[j] * hypre_ILULevelsU(col);
+            }
+            hypre_ILULevelsU(i) = sum;
+         }
+      }
+
+      /* U solve - Backward substitution */
+      for (lev = 0; lev < num_upper_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = upper_level_ptr[lev]; ii < upper_level_ptr[lev + 1]; ii++)
+         {
+            i   = upper_level_rows[ii];
+            sum = hypre_ILULevelsU(i);
+            for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+            {
+               col  = U_diag_j[j];
+               sum -= U_diag_data[j] * hypre_ILULevelsU(col);
+            }
+
+            /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+            hypre_ILULevelsU(i) = sum * D[i];
+         }
+      }
+   }
+
+#undef hypre_ILULevelsU
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveLULevels
+ *
+ * Incomplete LU solve with level-scheduled triangular solves
+ * (tri_solve = 2). Same as hypre_ILUSolveLU, but the rows of each level
+ * of L and U, computed in hypre_ILUSetupLevelSchedule, are solved
+ * concurrently.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSolveLULevels(hypre_ParCSRMatrix *A,
+                       hypre_ParVector    *f,
+                       hypre_ParVector    *u,
+                       HYPRE_Int          *perm,
+                       HYPRE_Int           nLU,
+                       hypre_ParCSRMatrix *L,
+                       HYPRE_Real         *D,
+                       hypre_ParCSRMatrix *U,
+                       hypre_ParVector    *ftemp,
+                       hypre_ParVector    *utemp,
+                       HYPRE_Int           num_lower_levels,
+                       HYPRE_Int          *lower_level_ptr,
+                       HYPRE_Int          *lower_level_rows,
+                       HYPRE_Int           num_upper_levels,
+                       HYPRE_Int          *upper_level_ptr,
+                       HYPRE_Int          *upper_level_rows)
+{
+   HYPRE_Real      *utemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+   HYPRE_Real       alpha       = -1.0;
+   HYPRE_Real       beta        = 1.0;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* L and U solves */
+   hypre_ILUSolveLevelsHost(nLU, perm, hypre_ParCSRMatrixDiag(L), D, hypre_ParCSRMatrixDiag(U),
+                            ftemp_data, NULL, utemp_data, NULL,
+                            num_lower_levels, lower_level_ptr, lower_level_rows,
+                            num_upper_levels, upper_level_ptr, upper_level_rows);
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveLURASLevels
+ *
+ * Incomplete LU solve RAS with level-scheduled triangular solves
+ * (tri_solve = 2). See hypre_ILUSolveLURAS.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSolveLURASLevels(hypre_ParCSRMatrix *A,
+                          hypre_ParVector    *f,
+                          hypre_ParVector    *u,
+                          HYPRE_Int          *perm,
+                          hypre_ParCSRMatrix *L,
+                          HYPRE_Real         *D,
+                          hypre_ParCSRMatrix *U,
+                          hypre_ParVector    *ftemp,
+                          hypre_ParVector    *utemp,
+                          HYPRE_Real         *fext,
+                          HYPRE_Real         *uext,
+                          HYPRE_Int           num_lower_levels,
+                          HYPRE_Int          *lower_level_ptr,
+                          HYPRE_Int          *lower_level_rows,
+                          HYPRE_Int           num_upper_levels,
+                          HYPRE_Int          *upper_level_ptr,
+                          HYPRE_Int          *upper_level_rows)
+{
+   hypre_ParCSRCommPkg        *comm_pkg;
+   hypre_ParCSRCommHandle     *comm_handle;
+   HYPRE_Int                   num_sends, begin, end, i;
+
+   HYPRE_Int                   n          = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Real                 *utemp_data = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real                 *ftemp_data = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+   HYPRE_Real                  alpha      = -1.0;
+   HYPRE_Real                  beta       = 1.0;
+
+   /* prepare for communication */
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* communication to get external data, borrowing uext as send buffer */
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   begin     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   end       = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   for (i = begin; i < end; i++)
+   {
+      uext[i - begin] = ftemp_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, uext, fext);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* L and U solves over the local and external rows */
+   hypre_ILUSolveLevelsHost(n, perm, hypre_ParCSRMatrixDiag(L), D, hypre_ParCSRMatrixDiag(U),
+                            ftemp_data, fext, utemp_data, uext,
+                            num_lower_levels, lower_level_ptr, lower_level_rows,
+                            num_upper_levels, upper_level_ptr, upper_level_rows);
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_ILUSolveRAPGMRESHost
  *
@@ -83,6 +83,7 @@ hypre_MGRCreate(void)
    (mgr_data -> max_row_sum) = 0.9;
    (mgr_data -> strong_threshold) = 0.25;
    (mgr_data -> P_max_elmts) = NULL;
+   (mgr_data -> setup_reuse) = NULL;
 
    (mgr_data -> coarse_grid_solver) = NULL;
    (mgr_data -> coarse_grid_solver_setup) = NULL;
@@ -390,6 +391,7 @@ hypre_MGRDestroy( void *data )
    hypre_TFree((mgr_data -> restrict_type), HYPRE_MEMORY_HOST);
    hypre_TFree((mgr_data -> interp_type), HYPRE_MEMORY_HOST);
    hypre_TFree((mgr_data -> P_max_elmts), HYPRE_MEMORY_HOST);
+   hypre_TFree((mgr_data -> setup_reuse), HYPRE_MEMORY_HOST);
    /* Frelax_type */
    hypre_TFree(mgr_data -> Frelax_type, HYPRE_MEMORY_HOST);
    /* Frelax_method */
@@ -1329,26 +1331,176 @@ void hypre_blas_smat_inv_n4 (HYPRE_Real *a)
    a[12] = M41 * det_inv; a[13] = M42 * det_inv; a[14] = M43 * det_inv; a[15] = M44 * det_inv;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_blas_smat_inv_gj
+ *
+ * In-place inverse of a small dense (row-major) matrix of size n via
+ * Gauss-Jordan elimination with partial pivoting. Meant to be called with
+ * a literal n (<= HYPRE_MGR_MAX_SMALL_BLK_SIZE) so that the compiler can
+ * fully unroll the loops.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_blas_smat_inv_gj(HYPRE_Real *a, const HYPRE_Int n)
+{
+   HYPRE_Real  m[HYPRE_MGR_MAX_SMALL_BLK_SIZE * HYPRE_MGR_MAX_SMALL_BLK_SIZE];
+   HYPRE_Real  b[HYPRE_MGR_MAX_SMALL_BLK_SIZE * HYPRE_MGR_MAX_SMALL_BLK_SIZE];
+   HYPRE_Real  piv, fac, tmp;
+   HYPRE_Int   i, j, k, p;
+
+   for (i = 0; i < n; i++)
+   {
+      for (j = 0; j < n; j++)
+      {
+         m[i * n + j] = a[i * n + j];
+         b[i * n + j] = (i == j) ? 1.0 : 0.0;
+      }
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      /* Find pivot row */
+      p = k;
+      for (i = k + 1; i < n; i++)
+      {
+         if (hypre_abs(m[i * n + k]) > hypre_abs(m[p * n + k]))
+         {
+            p = i;
+         }
+      }
+
+      /* Swap rows k and p */
+      if (p != k)
+      {
+         for (j = 0; j < n; j++)
+         {
+            tmp = m[k * n + j]; m[k * n + j] = m[p * n + j]; m[p * n + j] = tmp;
+            tmp = b[k * n + j]; b[k * n + j] = b[p * n + j]; b[p * n + j] = tmp;
+         }
+      }
+
+      /* Scale pivot row */
+      piv = 1.0 / m[k * n + k];
+      for (j = 0; j < n; j++)
+      {
+         m[k * n + j] *= piv;
+         b[k * n + j] *= piv;
+      }
+
+      /* Eliminate column k from the remaining rows */
+      for (i = 0; i < n; i++)
+      {
+         if (i != k)
+         {
+            fac = m[i * n + k];
+            for (j = 0; j < n; j++)
+            {
+               m[i * n + j] -= fac * m[k * n + j];
+               b[i * n + j] -= fac * b[k * n + j];
+            }
+         }
+      }
+   }
+
+   for (i = 0; i < n * n; i++)
+   {
+      a[i] = b[i];
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_MGRSmallBlkInverse
  *
+ * Fixed-size inverse kernels for block sizes 2 to HYPRE_MGR_MAX_SMALL_BLK_SIZE.
+ * Sizes 2-4 use closed-form expressions, while larger sizes use
+ * Gauss-Jordan elimination specialized at compile time.
+ *
  * TODO (VPM): move this function to seq_ls
  *--------------------------------------------------------------------------*/
 
 void hypre_MGRSmallBlkInverse(HYPRE_Real *mat,
                               HYPRE_Int   blk_size)
 {
-   if (blk_size == 2)
+   switch (blk_size)
    {
-      hypre_blas_smat_inv_n2(mat);
+      case 2:
+         hypre_blas_smat_inv_n2(mat);
+         break;
+
+      case 3:
+         hypre_blas_smat_inv_n3(mat);
+         break;
+
+      case 4:
+         hypre_blas_smat_inv_n4(mat);
+         break;
+
+      case 5:
+         hypre_blas_smat_inv_gj(mat, 5);
+         break;
+
+      case 6:
+         hypre_blas_smat_inv_gj(mat, 6);
+         break;
+
+      case 7:
+         hypre_blas_smat_inv_gj(mat, 7);
+         break;
+
+      case 8:
+         hypre_blas_smat_inv_gj(mat, 8);
+         break;
    }
-   else if (blk_size == 3)
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRSmallBlkApplyN
+ *
+ * Computes u += D * r for a small dense (row-major) block D of size n.
+ * Meant to be called with a literal n for full unrolling.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_MGRSmallBlkApplyN(const HYPRE_Real *D,
+                        const HYPRE_Real *r,
+                        HYPRE_Real       *u,
+                        const HYPRE_Int   n)
+{
+   HYPRE_Int  j, k;
+
+   for (j = 0; j < n; j++)
    {
-      hypre_blas_smat_inv_n3(mat);
+      for (k = 0; k < n; k++)
+      {
+         u[j] += r[k] * D[j * n + k];
+      }
    }
-   else if (blk_size == 4)
-   {
-      hypre_blas_smat_inv_n4(mat);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MGRSmallBlkApply
+ *
+ * Dispatches to a fixed-size apply kernel for block sizes up to
+ * HYPRE_MGR_MAX_SMALL_BLK_SIZE.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_MGRSmallBlkApply(const HYPRE_Real *D,
+                       const HYPRE_Real *r,
+                       HYPRE_Real       *u,
+                       HYPRE_Int         blk_size)
+{
+   switch (blk_size)
+   {
+      case 1: hypre_MGRSmallBlkApplyN(D, r, u, 1); break;
+      case 2: hypre_MGRSmallBlkApplyN(D, r, u, 2); break;
+      case 3: hypre_MGRSmallBlkApplyN(D, r, u, 3); break;
+      case 4: hypre_MGRSmallBlkApplyN(D, r, u, 4); break;
+      case 5: hypre_MGRSmallBlkApplyN(D, r, u, 5); break;
+      case 6: hypre_MGRSmallBlkApplyN(D, r, u, 6); break;
+      case 7: hypre_MGRSmallBlkApplyN(D, r, u, 7); break;
+      case 8: hypre_MGRSmallBlkApplyN(D, r, u, 8); break;
+      default: hypre_MGRSmallBlkApplyN(D, r, u, blk_size); break;
    }
 }
 
@@ -1462,7 +1614,7 @@ hypre_block_jacobi_solve( hypre_ParCSRMatrix *A,
 
    HYPRE_Int        i, j, k;
    HYPRE_Int        ii, jj;
-   HYPRE_Int        bidx, bidx1;
+   HYPRE_Int        bidx, bidx1, bidxm1;
    HYPRE_Int        num_sends;
    HYPRE_Int        index, start;
    HYPRE_Int        num_procs, my_id;
@@ -1473,9 +1625,8 @@ hypre_block_jacobi_solve( hypre_ParCSRMatrix *A,
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
-   //   HYPRE_Int num_threads = hypre_NumThreads();
 
-   res = hypre_CTAlloc(HYPRE_Real, blk_size, HYPRE_MEMORY_HOST);
+   res = hypre_CTAlloc(HYPRE_Real, blk_size * hypre_NumThreads(), HYPRE_MEMORY_HOST);
 
    if (!comm_pkg)
    {
@@ -1516,15 +1667,12 @@ hypre_block_jacobi_solve( hypre_ParCSRMatrix *A,
    * Copy current approximation into temporary vector.
    *-----------------------------------------------------------------*/
 
-#if 0
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
 #endif
    for (i = 0; i < n; i++)
    {
       Vtemp_data[i] = u_data[i];
-      //printf("u_old[%d] = %e\n",i,Vtemp_data[i]);
    }
    if (num_procs > 1)
    {
@@ -1535,51 +1683,69 @@ hypre_block_jacobi_solve( hypre_ParCSRMatrix *A,
    /*-----------------------------------------------------------------
    * Relax points block by block
    *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
+
+   if (method == 1)
    {
-      for (j = 0; j < blk_size; j++)
+      /* Gauss-Seidel: blocks are relaxed in sequence */
+      for (i = 0; i < n_block; i++)
       {
-         bidx = i * blk_size + j;
-         res[j] = f_data[bidx];
-         for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+         bidxm1 = i * blk_size;
+         for (j = 0; j < blk_size; j++)
          {
-            ii = A_diag_j[jj];
-            if (method == 0)
+            bidx = bidxm1 + j;
+            res[j] = f_data[bidx];
+            for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
             {
-               // Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
-            }
-            else if (method == 1)
-            {
-               // Gauss-Seidel for diagonal part
+               ii = A_diag_j[jj];
                res[j] -= A_diag_data[jj] * u_data[ii];
             }
-            else
+            for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
             {
-               // Default do Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+               // always do Jacobi for off-diagonal part
+               ii = A_offd_j[jj];
+               res[j] -= A_offd_data[jj] * Vext_data[ii];
             }
-            //printf("%d: Au= %e * %e =%e\n",ii,A_diag_data[jj],Vtemp_data[ii], res[j]);
          }
-         for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+
+         for (j = 0; j < blk_size; j++)
          {
-            // always do Jacobi for off-diagonal part
-            ii = A_offd_j[jj];
-            res[j] -= A_offd_data[jj] * Vext_data[ii];
+            bidx1 = bidxm1 + j;
+            for (k = 0; k < blk_size; k++)
+            {
+               bidx  = i * nb2 + j * blk_size + k;
+               u_data[bidx1] += res[k] * diaginv[bidx];
+            }
          }
-         //printf("%d: res = %e\n",bidx,res[j]);
       }
-
-      for (j = 0; j < blk_size; j++)
+   }
+   else
+   {
+      /* Jacobi (default): blocks are independent of each other */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, jj, ii, bidx, bidxm1) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_block; i++)
       {
-         bidx1 = i * blk_size + j;
-         for (k = 0; k < blk_size; k++)
+         HYPRE_Real  *my_res = res + hypre_GetThreadNum() * blk_size;
+
+         bidxm1 = i * blk_size;
+         for (j = 0; j < blk_size; j++)
          {
-            bidx  = i * nb2 + j * blk_size + k;
-            u_data[bidx1] += res[k] * diaginv[bidx];
-            //printf("u[%d] = %e, diaginv[%d] = %e\n",bidx1,u_data[bidx1],bidx,diaginv[bidx]);
+            bidx = bidxm1 + j;
+            my_res[j] = f_data[bidx];
+            for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               my_res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               my_res[j] -= A_offd_data[jj] * Vext_data[ii];
+            }
          }
-         //printf("u[%d] = %e\n",bidx1,u_data[bidx1]);
+
+         hypre_MGRSmallBlkApply(diaginv + i * nb2, my_res, u_data + bidxm1, blk_size);
       }
    }
 
@@ -1692,9 +1858,8 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
-   //   HYPRE_Int num_threads = hypre_NumThreads();
 
-   res = hypre_CTAlloc(HYPRE_Real,  blk_size, HYPRE_MEMORY_HOST);
+   res = hypre_CTAlloc(HYPRE_Real, blk_size * hypre_NumThreads(), HYPRE_MEMORY_HOST);
 
    if (!comm_pkg)
    {
@@ -1735,15 +1900,12 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
    * Copy current approximation into temporary vector.
    *-----------------------------------------------------------------*/
 
-#if 0
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-#endif
 #endif
    for (i = 0; i < n; i++)
    {
       Vtemp_data[i] = u_data[i];
-      //printf("u_old[%d] = %e\n",i,Vtemp_data[i]);
    }
    if (num_procs > 1)
    {
@@ -1754,54 +1916,72 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
    /*-----------------------------------------------------------------
    * Relax points block by block
    *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
+
+   if (method == 1)
    {
-      bidxm1 = i * blk_size;
-      for (j = 0; j < blk_size; j++)
+      /* Gauss-Seidel: blocks are relaxed in sequence */
+      for (i = 0; i < n_block; i++)
       {
-         bidx = bidxm1 + j;
-         res[j] = f_data[bidx];
-         for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+         bidxm1 = i * blk_size;
+         for (j = 0; j < blk_size; j++)
          {
-            ii = A_diag_j[jj];
-            if (method == 0)
-            {
-               // Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
-            }
-            else if (method == 1)
+            bidx = bidxm1 + j;
+            res[j] = f_data[bidx];
+            for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
             {
-               // Gauss-Seidel for diagonal part
+               ii = A_diag_j[jj];
                res[j] -= A_diag_data[jj] * u_data[ii];
             }
-            else
+            for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
             {
-               // Default do Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+               // always do Jacobi for off-diagonal part
+               ii = A_offd_j[jj];
+               res[j] -= A_offd_data[jj] * Vext_data[ii];
             }
-            //printf("%d: Au= %e * %e =%e\n",ii,A_diag_data[jj],Vtemp_data[ii], res[j]);
          }
-         for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+
+         for (j = 0; j < blk_size; j++)
          {
-            // always do Jacobi for off-diagonal part
-            ii = A_offd_j[jj];
-            res[j] -= A_offd_data[jj] * Vext_data[ii];
+            bidx1 = bidxm1 + j;
+            for (k = 0; k < blk_size; k++)
+            {
+               bidx  = i * nb2 + j * blk_size + k;
+               u_data[bidx1] += res[k] * diaginv[bidx];
+            }
          }
-         //printf("%d: res = %e\n",bidx,res[j]);
       }
-
-      for (j = 0; j < blk_size; j++)
+   }
+   else
+   {
+      /* Jacobi (default): blocks are independent of each other */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, jj, ii, bidx, bidxm1) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_block; i++)
       {
-         bidx1 = bidxm1 + j;
-         for (k = 0; k < blk_size; k++)
+         HYPRE_Real  *my_res = res + hypre_GetThreadNum() * blk_size;
+
+         bidxm1 = i * blk_size;
+         for (j = 0; j < blk_size; j++)
          {
-            bidx  = i * nb2 + j * blk_size + k;
-            u_data[bidx1] += res[k] * diaginv[bidx];
-            //printf("u[%d] = %e, diaginv[%d] = %e\n",bidx1,u_data[bidx1],bidx,diaginv[bidx]);
+            bidx = bidxm1 + j;
+            my_res[j] = f_data[bidx];
+            for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               my_res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               my_res[j] -= A_offd_data[jj] * Vext_data[ii];
+            }
          }
-         //printf("u[%d] = %e\n",bidx1,u_data[bidx1]);
+
+         hypre_MGRSmallBlkApply(diaginv + i * nb2, my_res, u_data + bidxm1, blk_size);
       }
    }
+
    if (num_procs > 1)
    {
       hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
@@ -1820,48 +2000,52 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
 HYPRE_Int
 hypre_BlockDiagInvLapack(HYPRE_Real *diag, HYPRE_Int N, HYPRE_Int blk_size)
 {
-   HYPRE_Int nblock, left_size, i;
-   //HYPRE_Int *IPIV = hypre_CTAlloc(HYPRE_Int, blk_size, HYPRE_MEMORY_HOST);
-   HYPRE_Int LWORK = blk_size * blk_size;
-   HYPRE_Real *WORK = hypre_CTAlloc(HYPRE_Real, LWORK, HYPRE_MEMORY_HOST);
-   HYPRE_Int INFO;
-
-   HYPRE_Real wall_time;
-   HYPRE_Int my_id;
-   MPI_Comm comm = hypre_MPI_COMM_WORLD;
-   hypre_MPI_Comm_rank(comm, &my_id);
+   HYPRE_Int   nblock, left_size, i;
+   HYPRE_Int   LWORK = blk_size * blk_size;
+   HYPRE_Int   num_threads = hypre_NumThreads();
+   HYPRE_Int  *IPIV;
+   HYPRE_Real *WORK;
+   HYPRE_Int   INFO;
 
    nblock = N / blk_size;
    left_size = N - blk_size * nblock;
-   i = nblock;
-   HYPRE_Int *IPIV = hypre_CTAlloc(HYPRE_Int, blk_size, HYPRE_MEMORY_HOST);
 
-   wall_time = time_getWallclockSeconds();
-   if (blk_size >= 2 && blk_size <= 4)
+   /* Per-thread workspace for the LAPACK path */
+   IPIV = hypre_CTAlloc(HYPRE_Int, blk_size * num_threads, HYPRE_MEMORY_HOST);
+   WORK = hypre_CTAlloc(HYPRE_Real, LWORK * num_threads, HYPRE_MEMORY_HOST);
+
+   if (blk_size >= 2 && blk_size <= HYPRE_MGR_MAX_SMALL_BLK_SIZE)
    {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < nblock; i++)
       {
          hypre_MGRSmallBlkInverse(diag + i * LWORK, blk_size);
-         //hypre_blas_smat_inv_n2(diag+i*LWORK);
       }
    }
-   else if (blk_size > 4)
+   else if (blk_size > HYPRE_MGR_MAX_SMALL_BLK_SIZE)
    {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, INFO) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < nblock; i++)
       {
-         hypre_dgetrf(&blk_size, &blk_size, diag + i * LWORK, &blk_size, IPIV, &INFO);
-         hypre_dgetri(&blk_size, diag + i * LWORK, &blk_size, IPIV, WORK, &LWORK, &INFO);
+         HYPRE_Int   my_thread_num = hypre_GetThreadNum();
+         HYPRE_Int  *my_IPIV = IPIV + my_thread_num * blk_size;
+         HYPRE_Real *my_WORK = WORK + my_thread_num * LWORK;
+
+         hypre_dgetrf(&blk_size, &blk_size, diag + i * LWORK, &blk_size, my_IPIV, &INFO);
+         hypre_dgetri(&blk_size, diag + i * LWORK, &blk_size, my_IPIV, my_WORK, &LWORK, &INFO);
       }
    }
 
    // Left size
    if (left_size > 0)
    {
-      hypre_dgetrf(&left_size, &left_size, diag + i * LWORK, &left_size, IPIV, &INFO);
-      hypre_dgetri(&left_size, diag + i * LWORK, &left_size, IPIV, WORK, &LWORK, &INFO);
+      hypre_dgetrf(&left_size, &left_size, diag + nblock * LWORK, &left_size, IPIV, &INFO);
+      hypre_dgetri(&left_size, diag + nblock * LWORK, &left_size, IPIV, WORK, &LWORK, &INFO);
    }
-   wall_time = time_getWallclockSeconds() - wall_time;
-   //if (my_id == 0) hypre_printf("Proc = %d, Compute inverse time: %1.5f\n", my_id, wall_time);
 
    hypre_TFree(IPIV, HYPRE_MEMORY_HOST);
    hypre_TFree(WORK, HYPRE_MEMORY_HOST);
@@ -1944,6 +2128,9 @@ hypre_ParCSRMatrixExtractBlockDiagHost( hypre_ParCSRMatrix   *par_A,
    if (CF_marker == NULL)
    {
       // CF Marker is NULL. Consider all rows of matrix.
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, ii, jj, bidx, bidxm1, bidxp1) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < num_blocks; i++)
       {
          bidxm1 = i * blk_size;
@@ -2070,6 +2257,9 @@ hypre_ParCSRMatrixExtractBlockDiagHost( hypre_ParCSRMatrix   *par_A,
       }
       else
       {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
          for (i = 0; i < num_points; i++)
          {
             if (hypre_cabs(diag_data[i]) < HYPRE_REAL_MIN)
@@ -3471,6 +3661,58 @@ hypre_MGRSetLevelPMaxElmts(void *mgr_vdata, HYPRE_Int *P_max_elmts)
    return hypre_error_flag;
 }
 
+/* Set the reuse level of setup data for all levels (see hypre_ParMGRData) */
+HYPRE_Int
+hypre_MGRSetSetupReuse(void *mgr_vdata, HYPRE_Int setup_reuse)
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   HYPRE_Int           max_num_coarse_levels = (mgr_data -> max_num_coarse_levels);
+   HYPRE_Int           i;
+
+   if (setup_reuse < 0 || setup_reuse > 3)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* Allocate internal setup_reuse if needed */
+   if (!(mgr_data -> setup_reuse))
+   {
+      (mgr_data -> setup_reuse) = hypre_CTAlloc(HYPRE_Int, max_num_coarse_levels, HYPRE_MEMORY_HOST);
+   }
+
+   /* Set all setup_reuse entries to the value passed as input */
+   for (i = 0; i < max_num_coarse_levels; i++)
+   {
+      (mgr_data -> setup_reuse)[i] = setup_reuse;
+   }
+
+   return hypre_error_flag;
+}
+
+/* Set the reuse level of setup data per level */
+HYPRE_Int
+hypre_MGRSetLevelSetupReuse(void *mgr_vdata, HYPRE_Int *setup_reuse)
+{
+   hypre_ParMGRData   *mgr_data = (hypre_ParMGRData*) mgr_vdata;
+   HYPRE_Int           max_num_coarse_levels = (mgr_data -> max_num_coarse_levels);
+   HYPRE_Int           i;
+
+   /* Allocate internal setup_reuse if needed */
+   if (!(mgr_data -> setup_reuse))
+   {
+      (mgr_data -> setup_reuse) = hypre_CTAlloc(HYPRE_Int, max_num_coarse_levels, HYPRE_MEMORY_HOST);
+   }
+
+   /* Set setup_reuse entries to the values passed as input */
+   for (i = 0; i < max_num_coarse_levels; i++)
+   {
+      (mgr_data -> setup_reuse)[i] = (setup_reuse) ? setup_reuse[i] : 0;
+   }
+
+   return hypre_error_flag;
+}
+
 /* Get number of iterations for MGR solver */
 HYPRE_Int
 hypre_MGRGetNumIterations( void *mgr_vdata, HYPRE_Int *num_iterations )
@@ -149,6 +149,13 @@ typedef struct
 
    /* Data for Gaussian elimination F-relaxation */
    hypre_ParAMGData    **GSElimData;
+
+   /* Reuse of setup data across setup calls (per level)
+      0: rebuild everything
+      1: keep CF splitting
+      2: same as 1, and also keep (lag) interpolation and restriction operators
+      3: same as 2, and also keep (lag) the F-relaxation solver */
+   HYPRE_Int            *setup_reuse;
 } hypre_ParMGRData;
 
 /*--------------------------------------------------------------------------
@@ -182,6 +189,12 @@ typedef struct
 #define FPT(i, bsize) (((i) % (bsize)) == FMRK)
 #define CPT(i, bsize) (((i) % (bsize)) == CMRK)
 
+/*--------------------------------------------------------------------------
+ * Largest block size handled by the fixed-size small block kernels
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_MGR_MAX_SMALL_BLK_SIZE 8
+
 /*--------------------------------------------------------------------------
  * MGR print level codes
  *--------------------------------------------------------------------------*/
@@ -75,7 +75,7 @@ hypre_MGRSetup( void               *mgr_vdata,
    hypre_ParCSRMatrix  **P_FF_array = (mgr_data -> P_FF_array);
 #endif
    hypre_ParCSRMatrix  **P_array = (mgr_data -> P_array);
-   hypre_ParCSRMatrix  **R_array = (mgr_data -> RT_array);
+   hypre_ParCSRMatrix  **R_array = (mgr_data -> R_array);
    hypre_ParCSRMatrix  **RT_array = (mgr_data -> RT_array);
 
    hypre_ParCSRMatrix  *A_FF = NULL;
@@ -130,6 +130,9 @@ hypre_MGRSetup( void               *mgr_vdata,
    HYPRE_Int *Frelax_type = (mgr_data -> Frelax_type);
 
    HYPRE_Int *coarse_grid_method = (mgr_data -> coarse_grid_method);
+   HYPRE_Int *setup_reuse = (mgr_data -> setup_reuse);
+   HYPRE_Int *level_reuse = NULL;
+   HYPRE_Int  keep_fsolver = 0;
 
    HYPRE_MemoryLocation memory_location = hypre_ParCSRMatrixMemoryLocation(A);
 #if defined(HYPRE_USING_GPU)
@@ -193,6 +196,13 @@ hypre_MGRSetup( void               *mgr_vdata,
             hypre_printf("No coarse grid solver provided. Using default AMG solver ... \n");
          }
 
+         /* destroy default solver from a previous setup call, if any */
+         if ((mgr_data -> coarse_grid_solver))
+         {
+            hypre_BoomerAMGDestroy((mgr_data -> coarse_grid_solver));
+            (mgr_data -> coarse_grid_solver) = NULL;
+         }
+
          /* create and set default solver parameters here */
          /* create and initialize default_cg_solver */
          default_cg_solver = (HYPRE_Solver) hypre_BoomerAMGCreate();
@@ -377,6 +387,49 @@ hypre_MGRSetup( void               *mgr_vdata,
    (mgr_data -> level_coarse_indexes) = level_coarse_indexes;
    (mgr_data -> num_coarse_per_level) = level_coarse_size;
 
+   /* Determine which levels reuse data from the previous setup call.
+      Note: reuse goes from the finest level down; once a level is rebuilt,
+      the coarser levels are rebuilt as well */
+   level_reuse = hypre_CTAlloc(HYPRE_Int, max_num_coarse_levels, HYPRE_MEMORY_HOST);
+   if (setup_reuse && P_array && CF_marker_array)
+   {
+      for (lev = 0; lev < hypre_min(old_num_coarse_levels, (mgr_data -> max_num_coarse_levels));
+           lev++)
+      {
+         if (setup_reuse[lev] < 1 || !CF_marker_array[lev])
+         {
+            break;
+         }
+
+         /* Check that the fine level dimensions did not change */
+         if (lev == 0 &&
+             (hypre_IntArraySize(CF_marker_array[0]) != nloc ||
+              hypre_ParCSRMatrixGlobalNumRows(P_array[0]) != hypre_ParCSRMatrixGlobalNumRows(A)))
+         {
+            break;
+         }
+         level_reuse[lev] = 1;
+
+         /* Keep (lag) P and R. The coarse operator is recomputed from (A, P, R)
+            only for these methods, the other ones need Wp and Wr */
+         if (setup_reuse[lev] < 2 || !P_array[lev] ||
+             (coarse_grid_method && coarse_grid_method[lev] != 0 && coarse_grid_method[lev] != 5))
+         {
+            continue;
+         }
+         level_reuse[lev] = 2;
+
+         /* Keep (lag) AMG-based F-solvers, unless set up by the user outside of MGR */
+         if (setup_reuse[lev] > 2 && Frelax_type && Frelax_type[lev] == 2 &&
+             aff_solver && aff_solver[lev] && A_ff_array && A_ff_array[lev] &&
+             !(lev == 0 && (mgr_data -> fsolver_mode) == 0))
+         {
+            level_reuse[lev] = 3;
+            keep_fsolver = 1;
+         }
+      }
+   }
+
    /* Free Previously allocated data, if any not destroyed */
    if (A_array || B_array || B_FF_array ||
        P_array || R_array || RT_array || CF_marker_array)
@@ -404,6 +457,12 @@ hypre_MGRSetup( void               *mgr_vdata,
             B_FF_array[j] = NULL;
          }
 
+         /* Keep the transfer operators of lagged levels */
+         if (level_reuse[j] > 1)
+         {
+            continue;
+         }
+
          if (P_array[j])
          {
             hypre_ParCSRMatrixDestroy(P_array[j]);
@@ -422,7 +481,8 @@ hypre_MGRSetup( void               *mgr_vdata,
             RT_array[j] = NULL;
          }
 
-         if (CF_marker_array[j])
+         /* Keep the CF splitting of reused levels */
+         if (CF_marker_array[j] && !level_reuse[j])
          {
             hypre_IntArrayDestroy(CF_marker_array[j]);
             CF_marker_array[j] = NULL;
@@ -430,10 +490,13 @@ hypre_MGRSetup( void               *mgr_vdata,
       }
       hypre_TFree(B_array, HYPRE_MEMORY_HOST);
       hypre_TFree(B_FF_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(R_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(RT_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
+      if (!level_reuse[0])
+      {
+         hypre_TFree(P_array, HYPRE_MEMORY_HOST);
+         hypre_TFree(R_array, HYPRE_MEMORY_HOST);
+         hypre_TFree(RT_array, HYPRE_MEMORY_HOST);
+         hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
+      }
    }
 
 #if defined(HYPRE_USING_GPU)
@@ -525,7 +588,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       {
          if ((mgr_data -> l1_norms)[j])
          {
-            hypre_SeqVectorDestroy((mgr_data -> l1_norms)[i]);
+            hypre_SeqVectorDestroy((mgr_data -> l1_norms)[j]);
             (mgr_data -> l1_norms)[j] = NULL;
          }
       }
@@ -543,6 +606,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          }
       }
       hypre_TFree((mgr_data -> frelax_diaginv), HYPRE_MEMORY_HOST);
+      frelax_diaginv = NULL;
    }
 
    if ((mgr_data -> level_diaginv))
@@ -556,6 +620,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          }
       }
       hypre_TFree((mgr_data -> level_diaginv), HYPRE_MEMORY_HOST);
+      level_diaginv = NULL;
    }
 
    /* setup temporary storage */
@@ -586,6 +651,7 @@ hypre_MGRSetup( void               *mgr_vdata,
    }
    hypre_TFree((mgr_data -> rel_res_norms), HYPRE_MEMORY_HOST);
    hypre_TFree((mgr_data -> blk_size), HYPRE_MEMORY_HOST);
+   blk_size = NULL;
 
    Vtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
                                  hypre_ParCSRMatrixGlobalNumRows(A),
@@ -845,7 +911,7 @@ hypre_MGRSetup( void               *mgr_vdata,
    {
       for (j = 1; j < old_num_coarse_levels; j++)
       {
-         if (A_ff_array[j])
+         if (A_ff_array[j] && level_reuse[j] < 3)
          {
             hypre_ParCSRMatrixDestroy(A_ff_array[j]);
             A_ff_array[j] = NULL;
@@ -853,30 +919,34 @@ hypre_MGRSetup( void               *mgr_vdata,
       }
       if (mgr_data -> fsolver_mode != 0)
       {
-         if (A_ff_array[0])
+         if (A_ff_array[0] && level_reuse[0] < 3)
          {
             hypre_ParCSRMatrixDestroy(A_ff_array[0]);
             A_ff_array[0] = NULL;
          }
       }
-      hypre_TFree(A_ff_array, HYPRE_MEMORY_HOST);
-      A_ff_array = NULL;
+      if (!keep_fsolver)
+      {
+         hypre_TFree(A_ff_array, HYPRE_MEMORY_HOST);
+         A_ff_array = NULL;
+      }
    }
 
    if (aff_solver)
    {
       for (j = 1; j < (old_num_coarse_levels); j++)
       {
-         if (aff_solver[j])
+         if (aff_solver[j] && level_reuse[j] < 3)
          {
             aff_base = (hypre_Solver*) aff_solver[j];
             hypre_SolverDestroy(aff_base)((HYPRE_Solver) (aff_base));
             aff_solver[j] = NULL;
          }
       }
-      if (mgr_data -> fsolver_mode == 2)
+      if (mgr_data -> fsolver_mode == 2 && level_reuse[0] < 3)
       {
          hypre_BoomerAMGDestroy(aff_solver[0]);
+         aff_solver[0] = NULL;
       }
    }
 
@@ -1094,15 +1164,19 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_GpuProfilingPushRange(region_name);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
       cflag = last_level || setNonCpointToF;
-      if (interp_type[lev] == 3 || interp_type[lev] == 5 ||
-          interp_type[lev] == 6 || interp_type[lev] == 7 || !cflag)
+      if ((!level_reuse[lev] && !cflag) ||
+          (level_reuse[lev] < 2 && (interp_type[lev] == 3 || interp_type[lev] == 5 ||
+                                    interp_type[lev] == 6 || interp_type[lev] == 7)))
       {
          hypre_BoomerAMGCreateS(A_array[lev], strong_threshold, max_row_sum, 1, NULL, &S);
       }
 
-      /* Coarsen: Build CF_marker array based on rows of A */
-      hypre_MGRCoarsen(S, A_array[lev], level_coarse_size[lev], level_coarse_indexes[lev],
-                       debug_flag, &CF_marker_array[lev], cflag);
+      /* Coarsen: Build CF_marker array based on rows of A (kept for reused levels) */
+      if (!level_reuse[lev])
+      {
+         hypre_MGRCoarsen(S, A_array[lev], level_coarse_size[lev], level_coarse_indexes[lev],
+                          debug_flag, &CF_marker_array[lev], cflag);
+      }
       CF_marker = hypre_IntArrayData(CF_marker_array[lev]);
 
       /* Get global fine/coarse partitionings. TODO: generate dof_func */
@@ -1133,24 +1207,30 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_ParCSRMatrixGenerateFFFC(A_array[lev], hypre_IntArrayData(FC_marker), row_starts_fpts,
                                      NULL, &A_CF, &A_CC);
 
-      /* Build interpolation operator */
-      hypre_MGRBuildInterp(A_array[lev], A_FF, A_FC, S, CF_marker_array[lev],
-                           coarse_pnts_global, trunc_factor, P_max_elmts[lev],
-                           block_jacobi_bsize, interp_type[lev], num_interp_sweeps,
-                           &Wp, &P);
-      P_array[lev] = P;
-
-      /* Build Restriction operator */
       if (block_jacobi_bsize == 1 && restrict_type[lev] == 12)
       {
          restrict_type[lev] = 2;
       }
-      hypre_MGRBuildRestrict(A_array[lev], A_FF, A_FC, A_CF, CF_marker_array[lev],
-                             coarse_pnts_global, trunc_factor, P_max_elmts[lev],
-                             strong_threshold, max_row_sum, block_jacobi_bsize,
-                             restrict_type[lev], &Wr, &R, &RT);
-      R_array[lev]  = R;
-      RT_array[lev] = RT;
+
+      /* Interpolation and restriction operators are kept for lagged levels.
+         In this case, the coarse operator is computed via the Galerkin product */
+      if (level_reuse[lev] < 2)
+      {
+         /* Build interpolation operator */
+         hypre_MGRBuildInterp(A_array[lev], A_FF, A_FC, S, CF_marker_array[lev],
+                              coarse_pnts_global, trunc_factor, P_max_elmts[lev],
+                              block_jacobi_bsize, interp_type[lev], num_interp_sweeps,
+                              &Wp, &P);
+         P_array[lev] = P;
+
+         /* Build Restriction operator */
+         hypre_MGRBuildRestrict(A_array[lev], A_FF, A_FC, A_CF, CF_marker_array[lev],
+                                coarse_pnts_global, trunc_factor, P_max_elmts[lev],
+                                strong_threshold, max_row_sum, block_jacobi_bsize,
+                                restrict_type[lev], &Wr, &R, &RT);
+         R_array[lev]  = R;
+         RT_array[lev] = RT;
+      }
 
       /* Use block Jacobi F-relaxation with block Jacobi interpolation */
       hypre_sprintf(region_name, "F-Relax");
@@ -1195,8 +1275,11 @@ hypre_MGRSetup( void               *mgr_vdata,
             }
          }
 
-         /* Set A_ff pointer */
-         A_ff_array[lev] = A_FF;
+         /* Set A_ff pointer (the previous one is kept along with the F-solver) */
+         if (level_reuse[lev] < 3)
+         {
+            A_ff_array[lev] = A_FF;
+         }
 
          F_fine_array[lev + 1] =
             hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_FF),
@@ -1232,7 +1315,12 @@ hypre_MGRSetup( void               *mgr_vdata,
           Frelax_type[lev] == 99 ||
           Frelax_type[lev] == 199)
       {
-         if (lev == 0 && (mgr_data -> fsolver_mode) == 0)
+         if (level_reuse[lev] == 3)
+         {
+            /* Keep F-solver and its A_FF matrix from the previous setup call */
+            hypre_assert(aff_solver[lev] && A_ff_array[lev]);
+         }
+         else if (lev == 0 && (mgr_data -> fsolver_mode) == 0)
          {
             if (Frelax_type[lev] == 2)
             {
@@ -1247,6 +1335,7 @@ hypre_MGRSetup( void               *mgr_vdata,
                   {
                      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                                        "F-relaxation solver has not been setup\n");
+                     hypre_TFree(level_reuse, HYPRE_MEMORY_HOST);
                      HYPRE_ANNOTATE_FUNC_END;
                      hypre_GpuProfilingPopRange();
                      hypre_GpuProfilingPopRange();
@@ -1351,7 +1440,7 @@ hypre_MGRSetup( void               *mgr_vdata,
 #endif
 
       /* Destroy A_FF if it has not been saved on A_ff_array[lev] */
-      if (!A_ff_array[lev])
+      if (A_ff_array[lev] != A_FF)
       {
          hypre_ParCSRMatrixDestroy(A_FF);
       }
@@ -1513,6 +1602,13 @@ hypre_MGRSetup( void               *mgr_vdata,
          hypre_printf("No coarse grid solver provided. Using default AMG solver ... \n");
       }
 
+      /* destroy default solver from a previous setup call, if any */
+      if ((mgr_data -> coarse_grid_solver))
+      {
+         hypre_BoomerAMGDestroy((mgr_data -> coarse_grid_solver));
+         (mgr_data -> coarse_grid_solver) = NULL;
+      }
+
       /* create and set default solver parameters here */
       default_cg_solver = (HYPRE_Solver) hypre_BoomerAMGCreate();
       hypre_BoomerAMGSetMaxIter(default_cg_solver, 1);
@@ -1528,17 +1624,23 @@ hypre_MGRSetup( void               *mgr_vdata,
       (mgr_data -> coarse_grid_solver) = default_cg_solver;
    }
 
-   /* keep reserved coarse indexes to coarsest grid */
+   /* keep reserved coarse indexes to coarsest grid. Use a temporary array so that
+      the user's (fine level) reserved indexes are preserved for later setup calls */
    if (reserved_coarse_size > 0 && lvl_to_keep_cpoints == 0)
    {
+      HYPRE_BigInt *coarsest_reserved_indexes;
+
+      coarsest_reserved_indexes = hypre_TAlloc(HYPRE_BigInt, reserved_coarse_size,
+                                               HYPRE_MEMORY_HOST);
       ilower = hypre_ParCSRMatrixFirstRowIndex(A_array[num_c_levels]);
       for (i = 0; i < reserved_coarse_size; i++)
       {
-         reserved_coarse_indexes[i] = (HYPRE_BigInt) (reserved_Cpoint_local_indexes[i] + ilower);
+         coarsest_reserved_indexes[i] = (HYPRE_BigInt) (reserved_Cpoint_local_indexes[i] + ilower);
       }
       HYPRE_BoomerAMGSetCPoints((mgr_data ->coarse_grid_solver),
                                 25, reserved_coarse_size,
-                                reserved_coarse_indexes);
+                                coarsest_reserved_indexes);
+      hypre_TFree(coarsest_reserved_indexes, HYPRE_MEMORY_HOST);
    }
 
    /* Setup coarse grid solver */
@@ -1703,6 +1805,8 @@ hypre_MGRSetup( void               *mgr_vdata,
       (mgr_data -> num_coarse_per_level) = NULL;
    }
 
+   hypre_TFree(level_reuse, HYPRE_MEMORY_HOST);
+
    /* Print statistics */
    hypre_MGRSetupStats(mgr_vdata);
 
@@ -56,6 +56,9 @@ hypre_SchwarzCreate( void )
    hypre_SchwarzDataScale(schwarz_data) = NULL;
    hypre_SchwarzDataVtemp(schwarz_data) = NULL;
    hypre_SchwarzDataDofFunc(schwarz_data) = NULL;
+   hypre_SchwarzDataDomainOffsets(schwarz_data) = NULL;
+   hypre_SchwarzDataDofDomain(schwarz_data) = NULL;
+   hypre_SchwarzDataDomainColors(schwarz_data) = NULL;
 
    return (void *) schwarz_data;
 }
@@ -88,7 +91,9 @@ hypre_SchwarzDestroy( void *data )
    {
       hypre_TFree(hypre_SchwarzDataPivots(schwarz_data), HYPRE_MEMORY_HOST);
    }
-
+   hypre_TFree(hypre_SchwarzDataDomainOffsets(schwarz_data), HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(hypre_SchwarzDataDofDomain(schwarz_data));
+   hypre_CSRMatrixDestroy(hypre_SchwarzDataDomainColors(schwarz_data));
 
    hypre_TFree(schwarz_data, HYPRE_MEMORY_HOST);
    return hypre_error_flag;
@@ -112,6 +117,10 @@ hypre_SchwarzSetup(void               *schwarz_vdata,
    hypre_ParVector *Vtemp;
 
    HYPRE_Int *pivots = NULL;
+   HYPRE_Int *domain_offsets = NULL;
+   hypre_CSRMatrix *dof_domain = NULL;
+   hypre_CSRMatrix *domain_colors = NULL;
+   HYPRE_Int num_dofs;
 
    HYPRE_Int variant = hypre_SchwarzDataVariant(schwarz_data);
    HYPRE_Int domain_type = hypre_SchwarzDataDomainType(schwarz_data);
@@ -177,8 +186,45 @@ hypre_SchwarzSetup(void               *schwarz_vdata,
       }
    }
 
+   /* offsets of the subdomain factors for batched application, the dof to
+      domain map for summing additive corrections and, if threaded, a
+      coloring of contiguous blocks of domains (two per thread) for the
+      multiplicative sweeps */
+   if (domain_structure)
+   {
+      hypre_SchwarzDomainOffsets(domain_structure, &domain_offsets);
+
+      if (variant == 1 || variant == 2)
+      {
+         num_dofs = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+         if (variant == 2)
+         {
+            num_dofs += hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+         }
+         hypre_SchwarzDofDomainCreate(domain_structure, num_dofs, &dof_domain);
+      }
+      else if (hypre_NumThreads() > 1)
+      {
+         if (variant == 3)
+         {
+            hypre_SchwarzDomainColoring(domain_structure, hypre_ParCSRMatrixDiag(A),
+                                        hypre_ParCSRMatrixOffd(A),
+                                        hypre_SchwarzDataABoundary(schwarz_data),
+                                        2 * hypre_NumThreads(), &domain_colors);
+         }
+         else
+         {
+            hypre_SchwarzDomainColoring(domain_structure, hypre_ParCSRMatrixDiag(A),
+                                        NULL, NULL, 2 * hypre_NumThreads(), &domain_colors);
+         }
+      }
+   }
+
    hypre_SchwarzDataDomainStructure(schwarz_data) = domain_structure;
    hypre_SchwarzDataPivots(schwarz_data) = pivots;
+   hypre_SchwarzDataDomainOffsets(schwarz_data) = domain_offsets;
+   hypre_SchwarzDataDofDomain(schwarz_data) = dof_domain;
+   hypre_SchwarzDataDomainColors(schwarz_data) = domain_colors;
 
    return hypre_error_flag;
 
@@ -206,33 +252,41 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
    HYPRE_Int use_nonsymm = hypre_SchwarzDataUseNonSymm(schwarz_data);
 
    HYPRE_Int *pivots = hypre_SchwarzDataPivots(schwarz_data);
+   HYPRE_Int *domain_offsets = hypre_SchwarzDataDomainOffsets(schwarz_data);
+   hypre_CSRMatrix *dof_domain = hypre_SchwarzDataDofDomain(schwarz_data);
+   hypre_CSRMatrix *domain_colors = hypre_SchwarzDataDomainColors(schwarz_data);
 
    if (domain_structure)
    {
       if (variant == 2)
       {
-         hypre_ParAdSchwarzSolve(A, f, domain_structure, scale, u, Vtemp, pivots, use_nonsymm);
+         hypre_ParAdSchwarzSolve(A, f, domain_structure, scale, u, Vtemp, pivots, use_nonsymm,
+                                 domain_offsets, dof_domain);
       }
       else if (variant == 3)
       {
          hypre_ParMPSchwarzSolve(A, A_boundary, f, domain_structure, u,
-                                 relax_wt, scale, Vtemp, pivots, use_nonsymm);
+                                 relax_wt, scale, Vtemp, pivots, use_nonsymm,
+                                 domain_offsets, domain_colors);
       }
       else if (variant == 1)
       {
-         hypre_AdSchwarzSolve(A, f, domain_structure, scale, u, Vtemp, pivots, use_nonsymm);
+         hypre_AdSchwarzSolve(A, f, domain_structure, scale, u, Vtemp, pivots, use_nonsymm,
+                              domain_offsets, dof_domain);
       }
       else if (variant == 4)
       {
          hypre_MPSchwarzFWSolve(A, hypre_ParVectorLocalVector(f),
                                 domain_structure, u, relax_wt,
-                                hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm);
+                                hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm,
+                                domain_offsets, domain_colors);
       }
       else
       {
          hypre_MPSchwarzSolve(A, hypre_ParVectorLocalVector(f),
                               domain_structure, u, relax_wt,
-                              hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm);
+                              hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm,
+                              domain_offsets, domain_colors);
       }
    }
 
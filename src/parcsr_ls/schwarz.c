@@ -362,6 +362,204 @@ hypre_AMGNodalSchwarzSmoother( hypre_CSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzDomainSolve
+ *
+ * Solves with the stored (Cholesky or LU) factor of one subdomain matrix,
+ * overwriting aux with the local correction. Returns the LAPACK info flag.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_SchwarzDomainSolve(HYPRE_Int   matrix_size,
+                         HYPRE_Real *factor,
+                         HYPRE_Int  *pivots,
+                         HYPRE_Real *aux,
+                         HYPRE_Int   use_nonsymm)
+{
+   HYPRE_Int one = 1;
+   HYPRE_Int ierr = 0;
+   char uplo;
+
+   if (use_nonsymm)
+   {
+      uplo = 'N';
+      hypre_dgetrs(&uplo, &matrix_size, &one, factor, &matrix_size,
+                   pivots, aux, &matrix_size, &ierr);
+   }
+   else
+   {
+      uplo = 'L';
+      hypre_dpotrs(&uplo, &matrix_size, &one, factor, &matrix_size,
+                   aux, &matrix_size, &ierr);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MPSchwarzDomainUpdate
+ *
+ * One multiplicative Schwarz step on domain i using the local part of A:
+ * local residual, subdomain solve and weighted correction of x.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_MPSchwarzDomainUpdate(HYPRE_Int        i,
+                            hypre_CSRMatrix *domain_structure,
+                            HYPRE_Int       *domain_offsets,
+                            HYPRE_Int       *pivots,
+                            hypre_CSRMatrix *A,
+                            HYPRE_Real      *rhs,
+                            HYPRE_Real      *x,
+                            HYPRE_Real       relax_wt,
+                            HYPRE_Real      *aux,
+                            HYPRE_Int        use_nonsymm)
+{
+   HYPRE_Int  *i_domain_dof = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int  *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
+   HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
+   HYPRE_Int  *i_dof_dof = hypre_CSRMatrixI(A);
+   HYPRE_Int  *j_dof_dof = hypre_CSRMatrixJ(A);
+   HYPRE_Real *a_dof_dof = hypre_CSRMatrixData(A);
+   HYPRE_Int   matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+   HYPRE_Int   ierr, jj, j, k;
+
+   /* compute residual: ---------------------------------------- */
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      aux[jj] = rhs[j_domain_dof[j]];
+      for (k = i_dof_dof[j_domain_dof[j]];
+           k < i_dof_dof[j_domain_dof[j] + 1]; k++)
+      {
+         aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+      }
+      jj++;
+   }
+
+   /* solve for correction: ------------------------------------- */
+   ierr = hypre_SchwarzDomainSolve(matrix_size,
+                                   &domain_matrixinverse[domain_offsets[i]],
+                                   use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                                   aux, use_nonsymm);
+
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      x[j_domain_dof[j]] += relax_wt * aux[jj++];
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMPSchwarzDomainUpdate
+ *
+ * Same as hypre_MPSchwarzDomainUpdate for the hybrid parallel variant,
+ * where domains may contain exterior dofs (index >= number of local rows)
+ * whose rows are given by A_boundary and whose values live in x_ext.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_ParMPSchwarzDomainUpdate(HYPRE_Int        i,
+                               hypre_CSRMatrix *domain_structure,
+                               HYPRE_Int       *domain_offsets,
+                               HYPRE_Int       *pivots,
+                               hypre_CSRMatrix *A_diag,
+                               hypre_CSRMatrix *A_offd,
+                               hypre_CSRMatrix *A_boundary,
+                               HYPRE_Real      *rhs,
+                               HYPRE_Real      *rhs_ext,
+                               HYPRE_Real      *x,
+                               HYPRE_Real      *x_ext,
+                               HYPRE_Real       relax_wt,
+                               HYPRE_Real      *aux,
+                               HYPRE_Int        use_nonsymm)
+{
+   HYPRE_Int  *i_domain_dof = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int  *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
+   HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
+   HYPRE_Int   num_variables = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int  *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int  *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int  *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int  *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int  *A_boundary_i = NULL;
+   HYPRE_Int  *A_boundary_j = NULL;
+   HYPRE_Real *A_boundary_data = NULL;
+   HYPRE_Int   matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+   HYPRE_Int   ierr, jj, j, k, j_loc, k_loc;
+
+   if (A_boundary)
+   {
+      A_boundary_i = hypre_CSRMatrixI(A_boundary);
+      A_boundary_j = hypre_CSRMatrixJ(A_boundary);
+      A_boundary_data = hypre_CSRMatrixData(A_boundary);
+   }
+
+   /* compute residual: ---------------------------------------- */
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      j_loc = j_domain_dof[j];
+      if (j_loc < num_variables)
+      {
+         aux[jj] = rhs[j_loc];
+         for (k = A_diag_i[j_loc]; k < A_diag_i[j_loc + 1]; k++)
+         {
+            aux[jj] -= A_diag_data[k] * x[A_diag_j[k]];
+         }
+         for (k = A_offd_i[j_loc]; k < A_offd_i[j_loc + 1]; k++)
+         {
+            aux[jj] -= A_offd_data[k] * x_ext[A_offd_j[k]];
+         }
+      }
+      else
+      {
+         j_loc -= num_variables;
+         aux[jj] = rhs_ext[j_loc];
+         for (k = A_boundary_i[j_loc]; k < A_boundary_i[j_loc + 1]; k++)
+         {
+            k_loc = A_boundary_j[k];
+
+            if (k_loc < num_variables)
+            {
+               aux[jj] -= A_boundary_data[k] * x[k_loc];
+            }
+            else
+            {
+               aux[jj] -= A_boundary_data[k] * x_ext[k_loc - num_variables];
+            }
+         }
+      }
+      jj++;
+   }
+
+   /* solve for correction: ------------------------------------- */
+   ierr = hypre_SchwarzDomainSolve(matrix_size,
+                                   &domain_matrixinverse[domain_offsets[i]],
+                                   use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                                   aux, use_nonsymm);
+
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      j_loc = j_domain_dof[j];
+      if (j_loc < num_variables)
+      {
+         x[j_loc] += relax_wt * aux[jj++];
+      }
+      else
+      {
+         x_ext[j_loc - num_variables] += relax_wt * aux[jj++];
+      }
+   }
+
+   return ierr;
+}
+
 HYPRE_Int
 hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
                         hypre_CSRMatrix     *A_boundary,
@@ -372,7 +570,9 @@ hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
                         HYPRE_Real          *scale,
                         hypre_ParVector     *Vtemp,
                         HYPRE_Int           *pivots,
-                        HYPRE_Int            use_nonsymm)
+                        HYPRE_Int            use_nonsymm,
+                        HYPRE_Int           *domain_offsets,
+                        hypre_CSRMatrix     *domain_colors)
 {
    hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(par_A);
    HYPRE_Int num_sends = 0;
@@ -381,16 +581,9 @@ hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
 
    hypre_ParCSRCommHandle *comm_handle;
 
-   HYPRE_Int ierr = 0;
    /* HYPRE_Int num_dofs; */
    hypre_CSRMatrix *A_diag;
-   HYPRE_Int *A_diag_i;
-   HYPRE_Int *A_diag_j;
-   HYPRE_Real *A_diag_data;
    hypre_CSRMatrix *A_offd;
-   HYPRE_Int *A_offd_i = NULL;
-   HYPRE_Int *A_offd_j = NULL;
-   HYPRE_Real *A_offd_data = NULL;
    HYPRE_Real *x;
    HYPRE_Real *x_ext = NULL;
    HYPRE_Real *x_ext_old = NULL;
@@ -398,29 +591,28 @@ hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
    HYPRE_Real *rhs_ext = NULL;
    HYPRE_Real *vtemp_data;
    HYPRE_Real *aux;
+   HYPRE_Real *thread_aux;
    HYPRE_Real *buf_data = NULL;
    /*hypre_Vector *x_vector;*/
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains = hypre_CSRMatrixNumRows(domain_structure);
    HYPRE_Int max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
-   HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
-   HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
-   HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
    HYPRE_Int *A_boundary_i = NULL;
    HYPRE_Int *A_boundary_j = NULL;
    HYPRE_Real *A_boundary_data = NULL;
    HYPRE_Int num_variables;
    HYPRE_Int num_cols_offd;
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
+   HYPRE_Int num_threads = domain_colors ? hypre_NumThreads() : 1;
+   HYPRE_Int num_colors = 0;
+   HYPRE_Int num_blocks = 0;
+   HYPRE_Int *i_color_block = NULL;
+   HYPRE_Int *j_color_block = NULL;
+   HYPRE_Int num_errors = 0;
 
-   HYPRE_Int jj, i, j, k, j_loc, k_loc;
+   HYPRE_Int i, j, ii, ns, ne, color, k_loc;
    HYPRE_Int index;
 
-   HYPRE_Int matrix_size, matrix_size_counter = 0;
-
    HYPRE_Int num_procs;
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -436,25 +628,21 @@ hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
    vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
    rhs = hypre_VectorData(hypre_ParVectorLocalVector(rhs_vector));
 
-   if (use_nonsymm)
-   {
-      uplo = 'N';
-   }
-
    /*x_vector = hypre_ParVectorLocalVector(par_x);*/
-   A_diag_i = hypre_CSRMatrixI(A_diag);
-   A_diag_j = hypre_CSRMatrixJ(A_diag);
-   A_diag_data = hypre_CSRMatrixData(A_diag);
-   A_offd_i = hypre_CSRMatrixI(A_offd);
    if (num_cols_offd)
    {
-      A_offd_j = hypre_CSRMatrixJ(A_offd);
-      A_offd_data = hypre_CSRMatrixData(A_offd);
       A_boundary_i = hypre_CSRMatrixI(A_boundary);
       A_boundary_j = hypre_CSRMatrixJ(A_boundary);
       A_boundary_data = hypre_CSRMatrixData(A_boundary);
    }
-   aux = hypre_CTAlloc(HYPRE_Real,  max_domain_size, HYPRE_MEMORY_HOST);
+   if (num_threads > 1)
+   {
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      num_blocks = hypre_CSRMatrixNumCols(domain_colors);
+      i_color_block = hypre_CSRMatrixI(domain_colors);
+      j_color_block = hypre_CSRMatrixJ(domain_colors);
+   }
+   aux = hypre_CTAlloc(HYPRE_Real,  num_threads * max_domain_size, HYPRE_MEMORY_HOST);
 
    hypre_ParVectorCopy(rhs_vector, Vtemp);
    hypre_ParCSRMatrixMatvec(-1.0, par_A, par_x, 1.0, Vtemp);
@@ -517,81 +705,37 @@ hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
    }
 
    /* forward solve: ----------------------------------------------- */
-   matrix_size_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   if (num_threads > 1)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-
-      /* compute residual: ---------------------------------------- */
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      for (color = 0; color < num_colors; color++)
       {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, ii, ns, ne, thread_aux) reduction(+:num_errors) \
+         HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_block[color]; ii < i_color_block[color + 1]; ii++)
          {
-            aux[jj] = rhs[j_loc];
-            for (k = A_diag_i[j_loc]; k < A_diag_i[j_loc + 1]; k++)
+            hypre_partition1D(num_domains, num_blocks, j_color_block[ii], &ns, &ne);
+            thread_aux = &aux[hypre_GetThreadNum() * max_domain_size];
+            for (i = ns; i < ne; i++)
             {
-               aux[jj] -= A_diag_data[k] * x[A_diag_j[k]];
-            }
-            for (k = A_offd_i[j_loc]; k < A_offd_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_offd_data[k] * x_ext[A_offd_j[k]];
+               num_errors += (hypre_ParMPSchwarzDomainUpdate(i, domain_structure, domain_offsets,
+                                                             pivots, A_diag, A_offd, A_boundary,
+                                                             rhs, rhs_ext, x, x_ext, relax_wt,
+                                                             thread_aux, use_nonsymm) != 0);
             }
          }
-         else
-         {
-            j_loc -= num_variables;
-            aux[jj] = rhs_ext[j_loc];
-            for (k = A_boundary_i[j_loc]; k < A_boundary_i[j_loc + 1]; k++)
-            {
-               k_loc = A_boundary_j[k];
-
-               if (k_loc < num_variables)
-               {
-                  aux[jj] -= A_boundary_data[k] * x[k_loc];
-               }
-               else
-               {
-                  aux[jj] -= A_boundary_data[k] * x_ext[k_loc - num_variables];
-               }
-            }
-         }
-         jj++;
       }
-
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
+   }
+   else
+   {
+      for (i = 0; i < num_domains; i++)
       {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
+         num_errors += (hypre_ParMPSchwarzDomainUpdate(i, domain_structure, domain_offsets, pivots,
+                                                       A_diag, A_offd, A_boundary,
+                                                       rhs, rhs_ext, x, x_ext, relax_wt,
+                                                       aux, use_nonsymm) != 0);
       }
-
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            x[j_loc] +=  relax_wt * aux[jj++];
-         }
-         else
-         {
-            x_ext[j_loc - num_variables] +=  relax_wt * aux[jj++];
-         }
-      }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
    /*
@@ -659,82 +803,41 @@ hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix  *par_A,
         }
    */
    /* backward solve: ------------------------------------------------ */
-   for (i = num_domains - 1; i > -1; i--)
+   if (num_threads > 1)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-      matrix_size_counter -= matrix_size * matrix_size;
-      piv_counter -= matrix_size;
-
-      /* compute residual: ---------------------------------------- */
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      for (color = num_colors - 1; color > -1; color--)
       {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            aux[jj] = rhs[j_loc];
-            for (k = A_diag_i[j_loc]; k < A_diag_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_diag_data[k] * x[A_diag_j[k]];
-            }
-            for (k = A_offd_i[j_loc]; k < A_offd_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_offd_data[k] * x_ext[A_offd_j[k]];
-            }
-         }
-         else
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, ii, ns, ne, thread_aux) reduction(+:num_errors) \
+         HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_block[color]; ii < i_color_block[color + 1]; ii++)
          {
-            j_loc -= num_variables;
-            aux[jj] = rhs_ext[j_loc];
-            for (k = A_boundary_i[j_loc]; k < A_boundary_i[j_loc + 1]; k++)
+            hypre_partition1D(num_domains, num_blocks, j_color_block[ii], &ns, &ne);
+            thread_aux = &aux[hypre_GetThreadNum() * max_domain_size];
+            for (i = ne - 1; i > ns - 1; i--)
             {
-               k_loc = A_boundary_j[k];
-
-               if (k_loc < num_variables)
-               {
-                  aux[jj] -= A_boundary_data[k] * x[k_loc];
-               }
-               else
-               {
-                  aux[jj] -= A_boundary_data[k] * x_ext[k_loc - num_variables];
-               }
+               num_errors += (hypre_ParMPSchwarzDomainUpdate(i, domain_structure, domain_offsets,
+                                                             pivots, A_diag, A_offd, A_boundary,
+                                                             rhs, rhs_ext, x, x_ext, relax_wt,
+                                                             thread_aux, use_nonsymm) != 0);
             }
          }
-         jj++;
-      }
-
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
       }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
-      }
-
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   }
+   else
+   {
+      for (i = num_domains - 1; i > -1; i--)
       {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            x[j_loc] +=  relax_wt * aux[jj++];
-         }
-         else
-         {
-            x_ext[j_loc - num_variables] +=  relax_wt * aux[jj++];
-         }
+         num_errors += (hypre_ParMPSchwarzDomainUpdate(i, domain_structure, domain_offsets, pivots,
+                                                       A_diag, A_offd, A_boundary,
+                                                       rhs, rhs_ext, x, x_ext, relax_wt,
+                                                       aux, use_nonsymm) != 0);
       }
    }
 
+   if (num_errors) { hypre_error(HYPRE_ERROR_GENERIC); }
+
    for (i = 0; i < num_cols_offd; i++)
    {
       x_ext[i] -= x_ext_old[i];
@@ -780,32 +883,28 @@ hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
                      HYPRE_Real          relax_wt,
                      hypre_Vector       *aux_vector,
                      HYPRE_Int          *pivots,
-                     HYPRE_Int           use_nonsymm)
+                     HYPRE_Int           use_nonsymm,
+                     HYPRE_Int          *domain_offsets,
+                     hypre_CSRMatrix    *domain_colors)
 {
-   HYPRE_Int ierr = 0;
-   /* HYPRE_Int num_dofs; */
-   HYPRE_Int *i_dof_dof;
-   HYPRE_Int *j_dof_dof;
-   HYPRE_Real *a_dof_dof;
    HYPRE_Real *x;
    hypre_Vector *rhs;
    HYPRE_Real *aux;
+   HYPRE_Real *thread_aux;
    hypre_CSRMatrix *A;
    hypre_Vector *x_vector;
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains = hypre_CSRMatrixNumRows(domain_structure);
-   HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
-   HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
-   HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
-
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
-
-   HYPRE_Int jj, i, j, k; /*, j_loc, k_loc;*/
+   HYPRE_Int max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
 
+   HYPRE_Int num_threads = domain_colors ? hypre_NumThreads() : 1;
+   HYPRE_Int num_colors = 0;
+   HYPRE_Int num_blocks = 0;
+   HYPRE_Int *i_color_block = NULL;
+   HYPRE_Int *j_color_block = NULL;
+   HYPRE_Int num_errors = 0;
 
-   HYPRE_Int matrix_size, matrix_size_counter = 0;
+   HYPRE_Int i, ii, ns, ne, color;
 
    HYPRE_Int num_procs;
 
@@ -815,17 +914,19 @@ hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    /* num_dofs = hypre_CSRMatrixNumRows(A); */
    x_vector = hypre_ParVectorLocalVector(par_x);
    A = hypre_ParCSRMatrixDiag(par_A);
-   i_dof_dof = hypre_CSRMatrixI(A);
-   j_dof_dof = hypre_CSRMatrixJ(A);
-   a_dof_dof = hypre_CSRMatrixData(A);
    x = hypre_VectorData(x_vector);
    aux = hypre_VectorData(aux_vector);
    /* for (i=0; i < num_dofs; i++)
       x[i] = 0.e0; */
 
-   if (use_nonsymm)
+   if (num_threads > 1)
    {
-      uplo = 'N';
+      /* blocks of one color are independent; one aux array per thread */
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      num_blocks = hypre_CSRMatrixNumCols(domain_colors);
+      i_color_block = hypre_CSRMatrixI(domain_colors);
+      j_color_block = hypre_CSRMatrixJ(domain_colors);
+      aux = hypre_TAlloc(HYPRE_Real, num_threads * max_domain_size, HYPRE_MEMORY_HOST);
    }
 
    if (num_procs > 1)
@@ -838,92 +939,74 @@ hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    }
 
    /* forward solve: ----------------------------------------------- */
-   matrix_size_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   if (num_threads > 1)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-
-      /* compute residual: ---------------------------------------- */
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      for (color = 0; color < num_colors; color++)
       {
-         aux[jj] = hypre_VectorData(rhs)[j_domain_dof[j]];
-         for (k = i_dof_dof[j_domain_dof[j]];
-              k < i_dof_dof[j_domain_dof[j] + 1]; k++)
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, ii, ns, ne, thread_aux) reduction(+:num_errors) \
+         HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_block[color]; ii < i_color_block[color + 1]; ii++)
          {
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+            hypre_partition1D(num_domains, num_blocks, j_color_block[ii], &ns, &ne);
+            thread_aux = &aux[hypre_GetThreadNum() * max_domain_size];
+            for (i = ns; i < ne; i++)
+            {
+               num_errors += (hypre_MPSchwarzDomainUpdate(i, domain_structure, domain_offsets,
+                                                          pivots, A, hypre_VectorData(rhs), x,
+                                                          relax_wt, thread_aux, use_nonsymm) != 0);
+            }
          }
-         jj++;
-      }
-
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
       }
-
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   }
+   else
+   {
+      for (i = 0; i < num_domains; i++)
       {
-         x[j_domain_dof[j]] +=  relax_wt * aux[jj++];
+         num_errors += (hypre_MPSchwarzDomainUpdate(i, domain_structure, domain_offsets, pivots, A,
+                                                    hypre_VectorData(rhs), x, relax_wt,
+                                                    aux, use_nonsymm) != 0);
       }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
    /* backward solve: ------------------------------------------------ */
-   for (i = num_domains - 1; i > -1; i--)
+   if (num_threads > 1)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-      matrix_size_counter -= matrix_size * matrix_size;
-      piv_counter -= matrix_size;
-
-      /* compute residual: ---------------------------------------- */
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      for (color = num_colors - 1; color > -1; color--)
       {
-         aux[jj] = hypre_VectorData(rhs)[j_domain_dof[j]];
-         for (k = i_dof_dof[j_domain_dof[j]];
-              k < i_dof_dof[j_domain_dof[j] + 1]; k++)
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, ii, ns, ne, thread_aux) reduction(+:num_errors) \
+         HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_block[color]; ii < i_color_block[color + 1]; ii++)
          {
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+            hypre_partition1D(num_domains, num_blocks, j_color_block[ii], &ns, &ne);
+            thread_aux = &aux[hypre_GetThreadNum() * max_domain_size];
+            for (i = ne - 1; i > ns - 1; i--)
+            {
+               num_errors += (hypre_MPSchwarzDomainUpdate(i, domain_structure, domain_offsets,
+                                                          pivots, A, hypre_VectorData(rhs), x,
+                                                          relax_wt, thread_aux, use_nonsymm) != 0);
+            }
          }
-         jj++;
-      }
-
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
       }
-      else
+   }
+   else
+   {
+      for (i = num_domains - 1; i > -1; i--)
       {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
+         num_errors += (hypre_MPSchwarzDomainUpdate(i, domain_structure, domain_offsets, pivots, A,
+                                                    hypre_VectorData(rhs), x, relax_wt,
+                                                    aux, use_nonsymm) != 0);
       }
+   }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         x[j_domain_dof[j]] += relax_wt * aux[jj++];
-      }
+   if (num_errors) { hypre_error(HYPRE_ERROR_GENERIC); }
+
+   if (num_threads > 1)
+   {
+      hypre_TFree(aux, HYPRE_MEMORY_HOST);
    }
 
    if (num_procs > 1)
@@ -1116,30 +1199,29 @@ hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
                        HYPRE_Real          relax_wt,
                        hypre_Vector       *aux_vector,
                        HYPRE_Int          *pivots,
-                       HYPRE_Int           use_nonsymm)
+                       HYPRE_Int           use_nonsymm,
+                       HYPRE_Int          *domain_offsets,
+                       hypre_CSRMatrix    *domain_colors)
 {
-   HYPRE_Int ierr = 0;
-   /* HYPRE_Int num_dofs; */
-   HYPRE_Int *i_dof_dof;
-   HYPRE_Int *j_dof_dof;
-   HYPRE_Real *a_dof_dof;
    HYPRE_Real *x;
    hypre_Vector *rhs;
    HYPRE_Real *aux;
+   HYPRE_Real *thread_aux;
    hypre_CSRMatrix *A;
    hypre_Vector *x_vector;
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains = hypre_CSRMatrixNumRows(domain_structure);
-   HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
-   HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
-   HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
+   HYPRE_Int max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
-   HYPRE_Int jj, i, j, k; /*, j_loc, k_loc;*/
+   HYPRE_Int num_threads = domain_colors ? hypre_NumThreads() : 1;
+   HYPRE_Int num_colors = 0;
+   HYPRE_Int num_blocks = 0;
+   HYPRE_Int *i_color_block = NULL;
+   HYPRE_Int *j_color_block = NULL;
+   HYPRE_Int num_errors = 0;
+
+   HYPRE_Int i, ii, ns, ne, color;
 
-   HYPRE_Int matrix_size, matrix_size_counter = 0;
    HYPRE_Int num_procs;
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -1148,14 +1230,21 @@ hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
    /* num_dofs = hypre_CSRMatrixNumRows(A); */
    x_vector = hypre_ParVectorLocalVector(par_x);
    A = hypre_ParCSRMatrixDiag(par_A);
-   i_dof_dof = hypre_CSRMatrixI(A);
-   j_dof_dof = hypre_CSRMatrixJ(A);
-   a_dof_dof = hypre_CSRMatrixData(A);
    x = hypre_VectorData(x_vector);
    aux = hypre_VectorData(aux_vector);
    /* for (i=0; i < num_dofs; i++)
       x[i] = 0.e0; */
 
+   if (num_threads > 1)
+   {
+      /* blocks of one color are independent; one aux array per thread */
+      num_colors = hypre_CSRMatrixNumRows(domain_colors);
+      num_blocks = hypre_CSRMatrixNumCols(domain_colors);
+      i_color_block = hypre_CSRMatrixI(domain_colors);
+      j_color_block = hypre_CSRMatrixJ(domain_colors);
+      aux = hypre_TAlloc(HYPRE_Real, num_threads * max_domain_size, HYPRE_MEMORY_HOST);
+   }
+
    if (num_procs > 1)
    {
       hypre_parCorrRes(par_A, par_x, rhs_vector, &rhs);
@@ -1166,49 +1255,42 @@ hypre_MPSchwarzFWSolve(hypre_ParCSRMatrix *par_A,
    }
 
    /* forward solve: ----------------------------------------------- */
-   matrix_size_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   if (num_threads > 1)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-
-      /* compute residual: ---------------------------------------- */
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      for (color = 0; color < num_colors; color++)
       {
-         aux[jj] = hypre_VectorData(rhs)[j_domain_dof[j]];
-         for (k = i_dof_dof[j_domain_dof[j]];
-              k < i_dof_dof[j_domain_dof[j] + 1]; k++)
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, ii, ns, ne, thread_aux) reduction(+:num_errors) \
+         HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = i_color_block[color]; ii < i_color_block[color + 1]; ii++)
          {
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+            hypre_partition1D(num_domains, num_blocks, j_color_block[ii], &ns, &ne);
+            thread_aux = &aux[hypre_GetThreadNum() * max_domain_size];
+            for (i = ns; i < ne; i++)
+            {
+               num_errors += (hypre_MPSchwarzDomainUpdate(i, domain_structure, domain_offsets,
+                                                          pivots, A, hypre_VectorData(rhs), x,
+                                                          relax_wt, thread_aux, use_nonsymm) != 0);
+            }
          }
-         jj++;
       }
-
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
+   }
+   else
+   {
+      for (i = 0; i < num_domains; i++)
       {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
+         num_errors += (hypre_MPSchwarzDomainUpdate(i, domain_structure, domain_offsets, pivots, A,
+                                                    hypre_VectorData(rhs), x, relax_wt,
+                                                    aux, use_nonsymm) != 0);
       }
+   }
 
+   if (num_errors) { hypre_error(HYPRE_ERROR_GENERIC); }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         x[j_domain_dof[j]] +=  relax_wt * aux[jj++];
-      }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
+   if (num_threads > 1)
+   {
+      hypre_TFree(aux, HYPRE_MEMORY_HOST);
    }
 
    if (num_procs > 1)
@@ -2801,9 +2883,10 @@ hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
                      hypre_ParVector    *par_x,
                      hypre_ParVector    *par_aux,
                      HYPRE_Int          *pivots,
-                     HYPRE_Int           use_nonsymm)
+                     HYPRE_Int           use_nonsymm,
+                     HYPRE_Int          *domain_offsets,
+                     hypre_CSRMatrix    *dof_domain)
 {
-   HYPRE_Int ierr = 0;
    HYPRE_Real *x;
    HYPRE_Real *aux;
    HYPRE_Real *tmp;
@@ -2811,19 +2894,17 @@ hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
    hypre_Vector *aux_vector;
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains;
-   HYPRE_Int max_domain_size;
+   HYPRE_Int num_variables;
    HYPRE_Int *i_domain_dof;
    HYPRE_Int *j_domain_dof;
    HYPRE_Real *domain_matrixinverse;
+   HYPRE_Int *i_dof_domain = hypre_CSRMatrixI(dof_domain);
+   HYPRE_Int *j_dof_domain = hypre_CSRMatrixJ(dof_domain);
+   HYPRE_Int num_errors = 0;
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
-
-   HYPRE_Int jj, i, j; /*, j_loc, k_loc;*/
+   HYPRE_Int i, j;
 
-
-   HYPRE_Int matrix_size, matrix_size_counter = 0;
+   HYPRE_Int matrix_size;
 
    HYPRE_Int num_procs;
 
@@ -2835,58 +2916,49 @@ hypre_AdSchwarzSolve(hypre_ParCSRMatrix *par_A,
    x = hypre_VectorData(x_vector);
    aux = hypre_VectorData(aux_vector);
    num_domains = hypre_CSRMatrixNumRows(domain_structure);
-   max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
+   num_variables = hypre_VectorSize(x_vector);
    i_domain_dof = hypre_CSRMatrixI(domain_structure);
    j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
 
-   if (use_nonsymm)
-   {
-      uplo = 'N';
-   }
-
    hypre_ParVectorCopy(par_rhs, par_aux);
    hypre_ParCSRMatrixMatvec(-1.0, par_A, par_x, 1.0, par_aux);
-   tmp = hypre_CTAlloc(HYPRE_Real, max_domain_size, HYPRE_MEMORY_HOST);
-
-   /* forward solve: ----------------------------------------------- */
+   /* corrections of all domains, stored like j_domain_dof */
+   tmp = hypre_TAlloc(HYPRE_Real, i_domain_dof[num_domains], HYPRE_MEMORY_HOST);
 
-   matrix_size_counter = 0;
+   /* local solves, independent for all domains: ------------------- */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, matrix_size) reduction(+:num_errors) HYPRE_SMP_SCHEDULE
+#endif
    for (i = 0; i < num_domains; i++)
    {
       matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
 
       /* compute residual: ---------------------------------------- */
-      jj = 0;
       for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
       {
-         tmp[jj] = aux[j_domain_dof[j]];
-         jj++;
+         tmp[j] = aux[j_domain_dof[j]];
       }
+
       /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], tmp,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, tmp,
-                      &matrix_size, &ierr);
-      }
+      num_errors += (hypre_SchwarzDomainSolve(matrix_size,
+                                              &domain_matrixinverse[domain_offsets[i]],
+                                              use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                                              &tmp[i_domain_dof[i]], use_nonsymm) != 0);
+   }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   if (num_errors) { hypre_error(HYPRE_ERROR_GENERIC); }
+
+   /* add corrections dof by dof, in domain order: ------------------ */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_variables; i++)
+   {
+      for (j = i_dof_domain[i]; j < i_dof_domain[i + 1]; j++)
       {
-         x[j_domain_dof[j]] += scale[j_domain_dof[j]] * tmp[jj++];
+         x[i] += scale[i] * tmp[j_dof_domain[j]];
       }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
    hypre_TFree(tmp, HYPRE_MEMORY_HOST);
@@ -3041,7 +3113,9 @@ hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
                         hypre_ParVector    *X,
                         hypre_ParVector    *Vtemp,
                         HYPRE_Int          *pivots,
-                        HYPRE_Int           use_nonsymm)
+                        HYPRE_Int           use_nonsymm,
+                        HYPRE_Int          *domain_offsets,
+                        hypre_CSRMatrix    *dof_domain)
 {
    hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int num_sends = 0;
@@ -3050,13 +3124,12 @@ hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
 
    hypre_ParCSRCommHandle *comm_handle;
 
-   HYPRE_Int ierr = 0;
    HYPRE_Real *x_data;
    HYPRE_Real *x_ext_data = NULL;
    HYPRE_Real *aux;
    HYPRE_Real *vtemp_data;
    HYPRE_Real *vtemp_ext_data = NULL;
-   HYPRE_Int num_domains, max_domain_size;
+   HYPRE_Int num_domains;
    HYPRE_Int *i_domain_dof;
    HYPRE_Int *j_domain_dof;
    HYPRE_Real *domain_matrixinverse;
@@ -3066,14 +3139,13 @@ hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
    HYPRE_Real *scale_ext = NULL;
    HYPRE_Real *buf_data = NULL;
    HYPRE_Int index;
+   HYPRE_Int *i_dof_domain = hypre_CSRMatrixI(dof_domain);
+   HYPRE_Int *j_dof_domain = hypre_CSRMatrixJ(dof_domain);
+   HYPRE_Int num_errors = 0;
 
-   HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-
-   char uplo = 'L';
-   HYPRE_Int jj, i, j, j_loc; /*, j_loc, k_loc;*/
+   HYPRE_Int i, j, j_loc;
 
-   HYPRE_Int matrix_size, matrix_size_counter = 0;
+   HYPRE_Int matrix_size;
 
    /* initiate:      ----------------------------------------------- */
    num_variables = hypre_CSRMatrixNumRows(A_diag);
@@ -3081,22 +3153,17 @@ hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
    x_data = hypre_VectorData(hypre_ParVectorLocalVector(X));
    vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
 
-   if (use_nonsymm)
-   {
-      uplo = 'N';
-   }
-
    hypre_ParVectorCopy(F, Vtemp);
    hypre_ParCSRMatrixMatvec(-1.0, A, X, 1.0, Vtemp);
 
    /* forward solve: ----------------------------------------------- */
 
    num_domains = hypre_CSRMatrixNumRows(domain_structure);
-   max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
    i_domain_dof = hypre_CSRMatrixI(domain_structure);
    j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
-   aux = hypre_CTAlloc(HYPRE_Real,  max_domain_size, HYPRE_MEMORY_HOST);
+   /* corrections of all domains, stored like j_domain_dof */
+   aux = hypre_TAlloc(HYPRE_Real, i_domain_dof[num_domains], HYPRE_MEMORY_HOST);
 
    if (comm_pkg)
    {
@@ -3137,60 +3204,59 @@ hypre_ParAdSchwarzSolve(hypre_ParCSRMatrix *A,
       comm_handle = NULL;
    }
 
-   matrix_size_counter = 0;
+   /* local solves, independent for all domains: ------------------- */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, j_loc, matrix_size) reduction(+:num_errors) \
+   HYPRE_SMP_SCHEDULE
+#endif
    for (i = 0; i < num_domains; i++)
    {
       matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
 
       /* copy data contiguously into aux  --------------------------- */
-
-      jj = 0;
       for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
       {
          j_loc = j_domain_dof[j];
          if (j_loc < num_variables)
          {
-            aux[jj] = vtemp_data[j_loc];
+            aux[j] = vtemp_data[j_loc];
          }
          else
          {
-            aux[jj] = vtemp_ext_data[j_loc - num_variables];
+            aux[j] = vtemp_ext_data[j_loc - num_variables];
          }
-         jj++;
       }
+
       /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
+      num_errors += (hypre_SchwarzDomainSolve(matrix_size,
+                                              &domain_matrixinverse[domain_offsets[i]],
+                                              use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                                              &aux[i_domain_dof[i]], use_nonsymm) != 0);
+   }
+
+   if (num_errors) { hypre_error(HYPRE_ERROR_GENERIC); }
+
+   /* add corrections dof by dof, in domain order: ------------------ */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_variables; i++)
+   {
+      for (j = i_dof_domain[i]; j < i_dof_domain[i + 1]; j++)
       {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
+         x_data[i] += scale[i] * aux[j_dof_domain[j]];
       }
+   }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      for (j = i_dof_domain[num_variables + i]; j < i_dof_domain[num_variables + i + 1]; j++)
       {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            x_data[j_loc] += scale[j_loc] * aux[jj++];
-         }
-         else
-         {
-            j_loc -= num_variables;
-            x_ext_data[j_loc] += scale_ext[j_loc] * aux[jj++];
-         }
+         x_ext_data[i] += scale_ext[i] * aux[j_dof_domain[j]];
       }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
    }
 
    if (comm_pkg)
@@ -4070,3 +4136,332 @@ hypre_ParGenerateHybridScale(hypre_ParCSRMatrix *A,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzDomainOffsets
+ *
+ * Returns the offsets of the subdomain factors, which are stored one after
+ * the other in the data array of domain_structure. Domain i starts at
+ * domain_offsets[i]; its pivots (if any) start at i_domain_dof[i].
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzDomainOffsets(hypre_CSRMatrix  *domain_structure,
+                           HYPRE_Int       **domain_offsets_pointer)
+{
+   HYPRE_Int  num_domains  = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int *domain_offsets;
+   HYPRE_Int  i, matrix_size;
+
+   domain_offsets = hypre_TAlloc(HYPRE_Int, num_domains + 1, HYPRE_MEMORY_HOST);
+
+   domain_offsets[0] = 0;
+   for (i = 0; i < num_domains; i++)
+   {
+      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+      domain_offsets[i + 1] = domain_offsets[i] + matrix_size * matrix_size;
+   }
+
+   *domain_offsets_pointer = domain_offsets;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzDofDomainCreate
+ *
+ * Builds the transpose of domain_structure. Row i of dof_domain lists the
+ * positions j in j_domain_dof with j_domain_dof[j] = i, in increasing
+ * order, so that corrections computed for all domains at once can be
+ * summed per dof in the same order as the sequential domain loop.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzDofDomainCreate(hypre_CSRMatrix  *domain_structure,
+                             HYPRE_Int         num_dofs,
+                             hypre_CSRMatrix **dof_domain_pointer)
+{
+   HYPRE_Int  num_domains  = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
+   HYPRE_Int  num_nonzeros = i_domain_dof[num_domains];
+
+   hypre_CSRMatrix *dof_domain;
+   HYPRE_Int       *i_dof_domain;
+   HYPRE_Int       *j_dof_domain;
+   HYPRE_Int        i, j;
+
+   i_dof_domain = hypre_CTAlloc(HYPRE_Int, num_dofs + 1, HYPRE_MEMORY_HOST);
+   j_dof_domain = hypre_TAlloc(HYPRE_Int, num_nonzeros, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < num_nonzeros; j++)
+   {
+      i_dof_domain[j_domain_dof[j] + 1]++;
+   }
+   for (i = 0; i < num_dofs; i++)
+   {
+      i_dof_domain[i + 1] += i_dof_domain[i];
+   }
+   for (j = 0; j < num_nonzeros; j++)
+   {
+      j_dof_domain[i_dof_domain[j_domain_dof[j]]++] = j;
+   }
+   for (i = num_dofs; i > 0; i--)
+   {
+      i_dof_domain[i] = i_dof_domain[i - 1];
+   }
+   i_dof_domain[0] = 0;
+
+   dof_domain = hypre_CSRMatrixCreate(num_dofs, num_nonzeros, num_nonzeros);
+   hypre_CSRMatrixI(dof_domain) = i_dof_domain;
+   hypre_CSRMatrixJ(dof_domain) = j_dof_domain;
+   hypre_CSRMatrixMemoryLocation(dof_domain) = HYPRE_MEMORY_HOST;
+
+   *dof_domain_pointer = dof_domain;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzDomainColoring
+ *
+ * Coloring of the subdomains for the threaded multiplicative Schwarz
+ * sweeps. The domains are split into num_blocks contiguous blocks (see
+ * hypre_partition1D), which are then colored greedily. A domain reads x at
+ * its dofs and at their neighbors in A_diag, A_offd (shifted by the number
+ * of local rows) and A_boundary, and writes x at its dofs only. Two blocks
+ * get different colors whenever a domain of one of them writes an entry
+ * read by a domain of the other one, so that the blocks of one color can be
+ * swept concurrently, each in natural domain order, with the same result as
+ * sweeping them one after the other. A_offd and A_boundary may be NULL.
+ *
+ * Row c of domain_colors lists the blocks of color c in increasing order;
+ * the number of columns is the number of blocks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzDomainColoring(hypre_CSRMatrix  *domain_structure,
+                            hypre_CSRMatrix  *A_diag,
+                            hypre_CSRMatrix  *A_offd,
+                            hypre_CSRMatrix  *A_boundary,
+                            HYPRE_Int         num_blocks,
+                            hypre_CSRMatrix **domain_colors_pointer)
+{
+   HYPRE_Int  num_domains   = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int *i_domain_dof  = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int *j_domain_dof  = hypre_CSRMatrixJ(domain_structure);
+   HYPRE_Int  num_variables = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int  num_cols_offd = A_offd ? hypre_CSRMatrixNumCols(A_offd) : 0;
+   HYPRE_Int *A_offd_i      = A_offd ? hypre_CSRMatrixI(A_offd) : NULL;
+   HYPRE_Int *A_offd_j      = A_offd ? hypre_CSRMatrixJ(A_offd) : NULL;
+   HYPRE_Int *A_boundary_i  = A_boundary ? hypre_CSRMatrixI(A_boundary) : NULL;
+   HYPRE_Int *A_boundary_j  = A_boundary ? hypre_CSRMatrixJ(A_boundary) : NULL;
+   HYPRE_Int  num_dofs      = num_variables + num_cols_offd;
+
+   hypre_CSRMatrix *domain_colors;
+   HYPRE_Int       *i_domain_reach, *j_domain_reach;
+   HYPRE_Int       *i_dof_domain, *j_dof_domain;
+   HYPRE_Int       *i_reach_domain, *j_reach_domain;
+   HYPRE_Int       *i_color_block, *j_color_block;
+   HYPRE_Int       *dof_marker, *color_marker, *domain_block, *block_color;
+   HYPRE_Int        num_colors = 0;
+   HYPRE_Int        pass, cnt, i, j, k, m, dof, nbr, color, b, ns, ne;
+
+   /* domains may contain exterior dofs even if only A_diag is given */
+   for (j = 0; j < i_domain_dof[num_domains]; j++)
+   {
+      num_dofs = hypre_max(num_dofs, j_domain_dof[j] + 1);
+   }
+
+   /* set of dofs read by each domain: ------------------------------ */
+   dof_marker     = hypre_TAlloc(HYPRE_Int, num_dofs, HYPRE_MEMORY_HOST);
+   i_domain_reach = hypre_CTAlloc(HYPRE_Int, num_domains + 1, HYPRE_MEMORY_HOST);
+   j_domain_reach = NULL;
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (i = 0; i < num_dofs; i++)
+      {
+         dof_marker[i] = -1;
+      }
+
+      cnt = 0;
+      for (i = 0; i < num_domains; i++)
+      {
+         for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+         {
+            dof = j_domain_dof[j];
+            if (dof < num_variables)
+            {
+               for (k = A_diag_i[dof]; k < A_diag_i[dof + 1]; k++)
+               {
+                  nbr = A_diag_j[k];
+                  if (dof_marker[nbr] != i)
+                  {
+                     dof_marker[nbr] = i;
+                     if (pass) { j_domain_reach[cnt] = nbr; }
+                     cnt++;
+                  }
+               }
+               if (num_cols_offd)
+               {
+                  for (k = A_offd_i[dof]; k < A_offd_i[dof + 1]; k++)
+                  {
+                     nbr = num_variables + A_offd_j[k];
+                     if (dof_marker[nbr] != i)
+                     {
+                        dof_marker[nbr] = i;
+                        if (pass) { j_domain_reach[cnt] = nbr; }
+                        cnt++;
+                     }
+                  }
+               }
+            }
+            else if (A_boundary_i)
+            {
+               for (k = A_boundary_i[dof - num_variables];
+                    k < A_boundary_i[dof - num_variables + 1]; k++)
+               {
+                  nbr = A_boundary_j[k];
+                  if (dof_marker[nbr] != i)
+                  {
+                     dof_marker[nbr] = i;
+                     if (pass) { j_domain_reach[cnt] = nbr; }
+                     cnt++;
+                  }
+               }
+            }
+
+            /* a domain always reads the dofs it updates */
+            if (dof_marker[dof] != i)
+            {
+               dof_marker[dof] = i;
+               if (pass) { j_domain_reach[cnt] = dof; }
+               cnt++;
+            }
+         }
+         if (!pass)
+         {
+            i_domain_reach[i + 1] = cnt;
+         }
+      }
+
+      if (!pass)
+      {
+         j_domain_reach = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /* dof -> domains updating it, dof -> domains reading it: --------- */
+   transpose_matrix_create(&i_dof_domain, &j_dof_domain,
+                           i_domain_dof, j_domain_dof,
+                           num_domains, num_dofs);
+   transpose_matrix_create(&i_reach_domain, &j_reach_domain,
+                           i_domain_reach, j_domain_reach,
+                           num_domains, num_dofs);
+
+   /* greedy coloring of the blocks in natural order: ---------------- */
+   num_blocks   = hypre_max(hypre_min(num_blocks, num_domains), 1);
+   domain_block = hypre_TAlloc(HYPRE_Int, num_domains, HYPRE_MEMORY_HOST);
+   block_color  = hypre_TAlloc(HYPRE_Int, num_blocks, HYPRE_MEMORY_HOST);
+   color_marker = hypre_TAlloc(HYPRE_Int, num_blocks + 1, HYPRE_MEMORY_HOST);
+   for (b = 0; b < num_blocks; b++)
+   {
+      hypre_partition1D(num_domains, num_blocks, b, &ns, &ne);
+      for (i = ns; i < ne; i++)
+      {
+         domain_block[i] = b;
+      }
+      block_color[b]  = -1;
+      color_marker[b] = -1;
+   }
+   color_marker[num_blocks] = -1;
+
+   for (b = 0; b < num_blocks; b++)
+   {
+      hypre_partition1D(num_domains, num_blocks, b, &ns, &ne);
+      for (i = ns; i < ne; i++)
+      {
+         /* blocks updating a dof read by domain i */
+         for (j = i_domain_reach[i]; j < i_domain_reach[i + 1]; j++)
+         {
+            dof = j_domain_reach[j];
+            for (k = i_dof_domain[dof]; k < i_dof_domain[dof + 1]; k++)
+            {
+               m = domain_block[j_dof_domain[k]];
+               if (block_color[m] > -1)
+               {
+                  color_marker[block_color[m]] = b;
+               }
+            }
+         }
+
+         /* blocks reading a dof updated by domain i */
+         for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+         {
+            dof = j_domain_dof[j];
+            for (k = i_reach_domain[dof]; k < i_reach_domain[dof + 1]; k++)
+            {
+               m = domain_block[j_reach_domain[k]];
+               if (block_color[m] > -1)
+               {
+                  color_marker[block_color[m]] = b;
+               }
+            }
+         }
+      }
+
+      color = 0;
+      while (color_marker[color] == b)
+      {
+         color++;
+      }
+      block_color[b] = color;
+      num_colors = hypre_max(num_colors, color + 1);
+   }
+
+   /* group blocks by color: ----------------------------------------- */
+   i_color_block = hypre_CTAlloc(HYPRE_Int, num_colors + 1, HYPRE_MEMORY_HOST);
+   j_color_block = hypre_TAlloc(HYPRE_Int, num_blocks, HYPRE_MEMORY_HOST);
+
+   for (b = 0; b < num_blocks; b++)
+   {
+      i_color_block[block_color[b] + 1]++;
+   }
+   for (color = 0; color < num_colors; color++)
+   {
+      i_color_block[color + 1] += i_color_block[color];
+   }
+   for (b = 0; b < num_blocks; b++)
+   {
+      j_color_block[i_color_block[block_color[b]]++] = b;
+   }
+   for (color = num_colors; color > 0; color--)
+   {
+      i_color_block[color] = i_color_block[color - 1];
+   }
+   i_color_block[0] = 0;
+
+   domain_colors = hypre_CSRMatrixCreate(num_colors, num_blocks, num_blocks);
+   hypre_CSRMatrixI(domain_colors) = i_color_block;
+   hypre_CSRMatrixJ(domain_colors) = j_color_block;
+   hypre_CSRMatrixMemoryLocation(domain_colors) = HYPRE_MEMORY_HOST;
+
+   hypre_TFree(dof_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(color_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(domain_block, HYPRE_MEMORY_HOST);
+   hypre_TFree(block_color, HYPRE_MEMORY_HOST);
+   hypre_TFree(i_domain_reach, HYPRE_MEMORY_HOST);
+   hypre_TFree(j_domain_reach, HYPRE_MEMORY_HOST);
+   hypre_TFree(i_dof_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(j_dof_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(i_reach_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(j_reach_domain, HYPRE_MEMORY_HOST);
+
+   *domain_colors_pointer = domain_colors;
+
+   return hypre_error_flag;
+}
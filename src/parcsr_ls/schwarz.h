@@ -28,7 +28,10 @@ typedef struct
    HYPRE_Int     *dof_func;
    HYPRE_Int     *pivots;
 
-
+   /* batched application of the domain factors */
+   HYPRE_Int       *domain_offsets; /* start of each factor in domain_structure */
+   hypre_CSRMatrix *dof_domain;     /* dof -> domain_structure entries (additive) */
+   hypre_CSRMatrix *domain_colors;  /* color -> independent domains (multiplicative) */
 
 } hypre_SchwarzData;
 
@@ -52,6 +55,11 @@ typedef struct
 #define hypre_SchwarzDataScale(schwarz_data) ((schwarz_data)->scale)
 #define hypre_SchwarzDataDofFunc(schwarz_data) ((schwarz_data)->dof_func)
 #define hypre_SchwarzDataPivots(schwarz_data) ((schwarz_data)->pivots)
+#define hypre_SchwarzDataDomainOffsets(schwarz_data) \
+((schwarz_data)->domain_offsets)
+#define hypre_SchwarzDataDofDomain(schwarz_data) ((schwarz_data)->dof_domain)
+#define hypre_SchwarzDataDomainColors(schwarz_data) \
+((schwarz_data)->domain_colors)
 
 #endif
 
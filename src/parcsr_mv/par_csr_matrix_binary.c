@@ -0,0 +1,839 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Native binary (checkpoint) I/O for hypre_ParCSRMatrix.
+ *
+ * The matrix is stored in a single file holding the diag/offd CSR arrays,
+ * col_map_offd and the row/column partitioning of every process. The file
+ * layout is (all header entries are 8-byte unsigned integers):
+ *
+ *    Header (8 entries):
+ *       0) Magic number
+ *       1) Header version
+ *       2) Number of bytes of HYPRE_Int
+ *       3) Number of bytes of HYPRE_BigInt
+ *       4) Number of bytes of HYPRE_Complex
+ *       5) Global number of rows
+ *       6) Global number of columns
+ *       7) Number of blocks (processes that wrote the file)
+ *
+ *    Block table (8 entries per block):
+ *       0) Global index of the first row of the block
+ *       1) Global index of the last row of the block plus one
+ *       2) Global index of the first column of the diagonal part
+ *       3) Global index of the last column of the diagonal part plus one
+ *       4) Number of nonzeros in diag
+ *       5) Number of nonzeros in offd
+ *       6) Number of columns in offd
+ *       7) Byte offset of the block data
+ *
+ *    Block data: diag_i, diag_j, diag_data, offd_i, offd_j, offd_data and
+ *    col_map_offd, each padded to a multiple of 8 bytes.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define hypre_PARCSR_BINARY_MAGIC      ((hypre_uint64) 0x5253434552505948ULL) /* "HYPRECSR" */
+#define hypre_PARCSR_BINARY_VERSION    1
+#define hypre_PARCSR_BINARY_HEADER_LEN 8
+#define hypre_PARCSR_BINARY_BLOCK_LEN  8
+#define hypre_PARCSR_BINARY_NSECTIONS  7
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryPad
+ *
+ * Rounds a section size up to a multiple of 8 bytes.
+ *--------------------------------------------------------------------------*/
+
+static size_t
+hypre_ParCSRBinaryPad( size_t nbytes )
+{
+   return (nbytes + 7) & ~((size_t) 7);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinarySectionSizes
+ *
+ * Returns the unpadded byte sizes of the data sections of a block.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRBinarySectionSizes( hypre_uint64 *block,
+                                size_t       *sizes )
+{
+   size_t num_rows = (size_t) (block[1] - block[0]);
+
+   sizes[0] = (num_rows + 1) * sizeof(HYPRE_Int);
+   sizes[1] = (size_t) block[4] * sizeof(HYPRE_Int);
+   sizes[2] = (size_t) block[4] * sizeof(HYPRE_Complex);
+   sizes[3] = (num_rows + 1) * sizeof(HYPRE_Int);
+   sizes[4] = (size_t) block[5] * sizeof(HYPRE_Int);
+   sizes[5] = (size_t) block[5] * sizeof(HYPRE_Complex);
+   sizes[6] = (size_t) block[6] * sizeof(HYPRE_BigInt);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryBlockArrays
+ *
+ * Sets pointers to the arrays of a block in a file image.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRBinaryBlockArrays( char           *base,
+                               hypre_uint64   *block,
+                               HYPRE_Int     **diag_i,
+                               HYPRE_Int     **diag_j,
+                               HYPRE_Complex **diag_data,
+                               HYPRE_Int     **offd_i,
+                               HYPRE_Int     **offd_j,
+                               HYPRE_Complex **offd_data,
+                               HYPRE_BigInt  **col_map_offd )
+{
+   size_t  sizes[hypre_PARCSR_BINARY_NSECTIONS];
+   char   *ptr = base + block[7];
+
+   hypre_ParCSRBinarySectionSizes(block, sizes);
+
+   *diag_i       = (HYPRE_Int *)     ptr;  ptr += hypre_ParCSRBinaryPad(sizes[0]);
+   *diag_j       = (HYPRE_Int *)     ptr;  ptr += hypre_ParCSRBinaryPad(sizes[1]);
+   *diag_data    = (HYPRE_Complex *) ptr;  ptr += hypre_ParCSRBinaryPad(sizes[2]);
+   *offd_i       = (HYPRE_Int *)     ptr;  ptr += hypre_ParCSRBinaryPad(sizes[3]);
+   *offd_j       = (HYPRE_Int *)     ptr;  ptr += hypre_ParCSRBinaryPad(sizes[4]);
+   *offd_data    = (HYPRE_Complex *) ptr;  ptr += hypre_ParCSRBinaryPad(sizes[5]);
+   *col_map_offd = (HYPRE_BigInt *)  ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryMap
+ *
+ * Maps a file into (read-only) memory. Falls back to reading the whole
+ * file where mmap is not available.
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_ParCSRBinaryMap( const char *filename,
+                       size_t     *size_ptr )
+{
+#ifndef _WIN32
+   struct stat  st;
+   void        *base;
+   int          fd;
+
+   if ((fd = open(filename, O_RDONLY)) < 0)
+   {
+      return NULL;
+   }
+   if (fstat(fd, &st) != 0 || st.st_size <= 0)
+   {
+      close(fd);
+      return NULL;
+   }
+   base = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (base == MAP_FAILED)
+   {
+      return NULL;
+   }
+   *size_ptr = (size_t) st.st_size;
+
+   return (char *) base;
+#else
+   FILE   *fp;
+   char   *base;
+   long    size;
+
+   if ((fp = fopen(filename, "rb")) == NULL)
+   {
+      return NULL;
+   }
+   fseek(fp, 0, SEEK_END);
+   size = ftell(fp);
+   fseek(fp, 0, SEEK_SET);
+   if (size <= 0)
+   {
+      fclose(fp);
+      return NULL;
+   }
+   base = hypre_TAlloc(char, (size_t) size, HYPRE_MEMORY_HOST);
+   if (fread(base, 1, (size_t) size, fp) != (size_t) size)
+   {
+      hypre_TFree(base, HYPRE_MEMORY_HOST);
+      fclose(fp);
+      return NULL;
+   }
+   fclose(fp);
+   *size_ptr = (size_t) size;
+
+   return base;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryUnmap
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRBinaryUnmap( char   *base,
+                         size_t  size )
+{
+#ifndef _WIN32
+   munmap((void *) base, size);
+#else
+   HYPRE_UNUSED_VAR(size);
+   hypre_TFree(base, HYPRE_MEMORY_HOST);
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *
+ * Writes a ParCSRMatrix to a single file in hypre's native binary format
+ * (see the description at the top of this file). With MPI, the data of all
+ * processes is written with collective MPI-IO calls.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               const char         *filename )
+{
+   MPI_Comm              comm = hypre_ParCSRMatrixComm(matrix);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+   hypre_ParCSRMatrix   *h_matrix;
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_Int             num_rows;
+   HYPRE_Int            *diag_i, *offd_i;
+   HYPRE_Int            *zeros = NULL;
+
+   hypre_uint64          header[hypre_PARCSR_BINARY_HEADER_LEN];
+   hypre_uint64          block[hypre_PARCSR_BINARY_BLOCK_LEN];
+   hypre_uint64         *table;
+   size_t                sizes[hypre_PARCSR_BINARY_NSECTIONS];
+   size_t                offsets[hypre_PARCSR_BINARY_NSECTIONS];
+   void                 *sections[hypre_PARCSR_BINARY_NSECTIONS];
+   size_t                header_bytes, table_bytes, offset;
+   HYPRE_Int             one = 1;
+   HYPRE_Int             myid, num_procs, p, s;
+
+   /* Exit if trying to write from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* Create temporary matrix on host memory if needed */
+   h_matrix = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+              hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST) : matrix;
+
+   diag     = hypre_ParCSRMatrixDiag(h_matrix);
+   offd     = hypre_ParCSRMatrixOffd(h_matrix);
+   num_rows = hypre_ParCSRMatrixNumRows(h_matrix);
+   diag_i   = hypre_CSRMatrixI(diag);
+   offd_i   = hypre_CSRMatrixI(offd);
+   if (!diag_i || !offd_i)
+   {
+      zeros  = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+      diag_i = diag_i ? diag_i : zeros;
+      offd_i = offd_i ? offd_i : zeros;
+   }
+
+   /*---------------------------------------------
+    * Gather the block table
+    *---------------------------------------------*/
+
+   block[0] = (hypre_uint64) hypre_ParCSRMatrixFirstRowIndex(h_matrix);
+   block[1] = (hypre_uint64) (hypre_ParCSRMatrixFirstRowIndex(h_matrix) + num_rows);
+   block[2] = (hypre_uint64) hypre_ParCSRMatrixFirstColDiag(h_matrix);
+   block[3] = (hypre_uint64) (hypre_ParCSRMatrixFirstColDiag(h_matrix) +
+                              hypre_CSRMatrixNumCols(diag));
+   block[4] = (hypre_uint64) diag_i[num_rows];
+   block[5] = (hypre_uint64) offd_i[num_rows];
+   block[6] = (hypre_uint64) hypre_CSRMatrixNumCols(offd);
+   block[7] = 0;
+
+   table = hypre_TAlloc(hypre_uint64, num_procs * hypre_PARCSR_BINARY_BLOCK_LEN,
+                        HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(block, hypre_PARCSR_BINARY_BLOCK_LEN * sizeof(hypre_uint64),
+                       hypre_MPI_BYTE, table, hypre_PARCSR_BINARY_BLOCK_LEN * sizeof(hypre_uint64),
+                       hypre_MPI_BYTE, comm);
+
+   header_bytes = hypre_PARCSR_BINARY_HEADER_LEN * sizeof(hypre_uint64);
+   table_bytes  = (size_t) num_procs * hypre_PARCSR_BINARY_BLOCK_LEN * sizeof(hypre_uint64);
+   offset       = header_bytes + table_bytes;
+   for (p = 0; p < num_procs; p++)
+   {
+      hypre_uint64 *b = table + p * hypre_PARCSR_BINARY_BLOCK_LEN;
+
+      b[7] = (hypre_uint64) offset;
+      hypre_ParCSRBinarySectionSizes(b, sizes);
+      for (s = 0; s < hypre_PARCSR_BINARY_NSECTIONS; s++)
+      {
+         offset += hypre_ParCSRBinaryPad(sizes[s]);
+      }
+   }
+
+   header[0] = hypre_PARCSR_BINARY_MAGIC;
+   header[1] = (hypre_uint64) hypre_PARCSR_BINARY_VERSION;
+   header[2] = (hypre_uint64) sizeof(HYPRE_Int);
+   header[3] = (hypre_uint64) sizeof(HYPRE_BigInt);
+   header[4] = (hypre_uint64) sizeof(HYPRE_Complex);
+   header[5] = (hypre_uint64) hypre_ParCSRMatrixGlobalNumRows(h_matrix);
+   header[6] = (hypre_uint64) hypre_ParCSRMatrixGlobalNumCols(h_matrix);
+   header[7] = (hypre_uint64) num_procs;
+
+   /* Local data sections */
+   hypre_ParCSRBinarySectionSizes(table + myid * hypre_PARCSR_BINARY_BLOCK_LEN, sizes);
+   sections[0] = (void *) diag_i;
+   sections[1] = (void *) hypre_CSRMatrixJ(diag);
+   sections[2] = (void *) hypre_CSRMatrixData(diag);
+   sections[3] = (void *) offd_i;
+   sections[4] = (void *) hypre_CSRMatrixJ(offd);
+   sections[5] = (void *) hypre_CSRMatrixData(offd);
+   sections[6] = (void *) hypre_ParCSRMatrixColMapOffd(h_matrix);
+   offsets[0]  = (size_t) table[myid * hypre_PARCSR_BINARY_BLOCK_LEN + 7];
+   for (s = 1; s < hypre_PARCSR_BINARY_NSECTIONS; s++)
+   {
+      offsets[s] = offsets[s - 1] + hypre_ParCSRBinaryPad(sizes[s - 1]);
+   }
+
+   /*---------------------------------------------
+    * Write file
+    *---------------------------------------------*/
+
+#if defined(HYPRE_SEQUENTIAL)
+   {
+      FILE *fp;
+
+      if ((fp = fopen(filename, "wb")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open output file!");
+      }
+      else
+      {
+         if (fwrite(header, sizeof(hypre_uint64), hypre_PARCSR_BINARY_HEADER_LEN, fp) !=
+             hypre_PARCSR_BINARY_HEADER_LEN ||
+             fwrite(table, 1, table_bytes, fp) != table_bytes)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write header entries\n");
+         }
+         for (s = 0; s < hypre_PARCSR_BINARY_NSECTIONS; s++)
+         {
+            if (sizes[s] > 0 &&
+                (fseek(fp, (long) offsets[s], SEEK_SET) != 0 ||
+                 fwrite(sections[s], 1, sizes[s], fp) != sizes[s]))
+            {
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write matrix data\n");
+               break;
+            }
+         }
+         /* Make sure the padding of the last section is in the file */
+         if (ftell(fp) < (long) offset)
+         {
+            fseek(fp, (long) offset - 1, SEEK_SET);
+            fputc(0, fp);
+         }
+         fclose(fp);
+      }
+   }
+#else
+   {
+      MPI_File      fh;
+      MPI_Datatype  types[hypre_PARCSR_BINARY_NSECTIONS];
+      MPI_Datatype  int_type, big_type, complex_type;
+      size_t        elmt_size[hypre_PARCSR_BINARY_NSECTIONS];
+      size_t        count, first, chunk;
+      HYPRE_Int     num_chunks[hypre_PARCSR_BINARY_NSECTIONS];
+      HYPRE_Int     max_chunks[hypre_PARCSR_BINARY_NSECTIONS];
+      HYPRE_Int     ierr = 0, ierr_all, c;
+
+      /* Elements are written in units of their own size to keep counts small */
+      MPI_Type_contiguous((hypre_int) sizeof(HYPRE_Int), MPI_BYTE, &int_type);
+      MPI_Type_contiguous((hypre_int) sizeof(HYPRE_BigInt), MPI_BYTE, &big_type);
+      MPI_Type_contiguous((hypre_int) sizeof(HYPRE_Complex), MPI_BYTE, &complex_type);
+      MPI_Type_commit(&int_type);
+      MPI_Type_commit(&big_type);
+      MPI_Type_commit(&complex_type);
+      types[0] = types[1] = types[3] = types[4] = int_type;
+      types[2] = types[5] = complex_type;
+      types[6] = big_type;
+      elmt_size[0] = elmt_size[1] = elmt_size[3] = elmt_size[4] = sizeof(HYPRE_Int);
+      elmt_size[2] = elmt_size[5] = sizeof(HYPRE_Complex);
+      elmt_size[6] = sizeof(HYPRE_BigInt);
+
+      /* MPI-IO counts are plain ints: larger sections are written in chunks.
+         All processes must make the same number of collective calls */
+      for (s = 0; s < hypre_PARCSR_BINARY_NSECTIONS; s++)
+      {
+         count         = sizes[s] / elmt_size[s];
+         num_chunks[s] = (HYPRE_Int) ((count + INT_MAX - 1) / INT_MAX);
+      }
+      hypre_MPI_Allreduce(num_chunks, max_chunks, hypre_PARCSR_BINARY_NSECTIONS,
+                          HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+
+      /* The open may fail on some processes only. Agree on the outcome before
+         any collective call on the file, so that no process waits on the
+         others. Processes that did open the file leave it open in that case,
+         since closing it is collective as well */
+      ierr = (MPI_File_open(comm, (char *) filename, MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                            MPI_INFO_NULL, &fh) != MPI_SUCCESS);
+      hypre_MPI_Allreduce(&ierr, &ierr_all, 1, HYPRE_MPI_INT, hypre_MPI_BOR, comm);
+      if (ierr_all)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open output file!");
+      }
+      else
+      {
+         MPI_File_set_size(fh, (MPI_Offset) offset);
+         if (myid == 0)
+         {
+            ierr |= MPI_File_write_at(fh, 0, header, (hypre_int) header_bytes, MPI_BYTE,
+                                      MPI_STATUS_IGNORE);
+            ierr |= MPI_File_write_at(fh, (MPI_Offset) header_bytes, table,
+                                      (hypre_int) table_bytes, MPI_BYTE, MPI_STATUS_IGNORE);
+         }
+         for (s = 0; s < hypre_PARCSR_BINARY_NSECTIONS; s++)
+         {
+            count = sizes[s] / elmt_size[s];
+            for (c = 0; c < max_chunks[s]; c++)
+            {
+               first = hypre_min((size_t) c * INT_MAX, count);
+               chunk = hypre_min(count - first, (size_t) INT_MAX);
+               ierr |= MPI_File_write_at_all(fh, (MPI_Offset) (offsets[s] + first * elmt_size[s]),
+                                             (char *) sections[s] + first * elmt_size[s],
+                                             (hypre_int) chunk, types[s], MPI_STATUS_IGNORE);
+            }
+         }
+         MPI_File_close(&fh);
+
+         hypre_MPI_Allreduce(&ierr, &ierr_all, 1, HYPRE_MPI_INT, hypre_MPI_BOR, comm);
+         if (ierr_all)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write matrix data\n");
+         }
+      }
+
+      MPI_Type_free(&int_type);
+      MPI_Type_free(&big_type);
+      MPI_Type_free(&complex_type);
+   }
+#endif
+
+   /* Free memory */
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+   hypre_TFree(zeros, HYPRE_MEMORY_HOST);
+   if (h_matrix != matrix)
+   {
+      hypre_ParCSRMatrixDestroy(h_matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinaryBlock
+ *
+ * Builds the local matrix from the block written by the process with the
+ * same rank. The arrays are copied as they are from the mapped file.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRMatrix *
+hypre_ParCSRMatrixReadBinaryBlock( MPI_Comm      comm,
+                                   char         *base,
+                                   hypre_uint64 *header,
+                                   hypre_uint64 *block )
+{
+   HYPRE_MemoryLocation  memory_location = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_ParCSRMatrix   *matrix;
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_BigInt          row_starts[2], col_starts[2];
+   HYPRE_Int             num_rows = (HYPRE_Int) (block[1] - block[0]);
+   HYPRE_Int             diag_nnz = (HYPRE_Int) block[4];
+   HYPRE_Int             offd_nnz = (HYPRE_Int) block[5];
+   HYPRE_Int             num_cols_offd = (HYPRE_Int) block[6];
+
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd;
+
+   row_starts[0] = (HYPRE_BigInt) block[0];
+   row_starts[1] = (HYPRE_BigInt) block[1];
+   col_starts[0] = (HYPRE_BigInt) block[2];
+   col_starts[1] = (HYPRE_BigInt) block[3];
+
+   matrix = hypre_ParCSRMatrixCreate(comm, (HYPRE_BigInt) header[5], (HYPRE_BigInt) header[6],
+                                     row_starts, col_starts, num_cols_offd, diag_nnz, offd_nnz);
+   hypre_ParCSRMatrixInitialize_v2(matrix, memory_location);
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+
+   hypre_ParCSRBinaryBlockArrays(base, block, &diag_i, &diag_j, &diag_data,
+                                 &offd_i, &offd_j, &offd_data, &col_map_offd);
+
+   hypre_TMemcpy(hypre_CSRMatrixI(diag), diag_i, HYPRE_Int, num_rows + 1,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixJ(diag), diag_j, HYPRE_Int, diag_nnz,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixData(diag), diag_data, HYPRE_Complex, diag_nnz,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixI(offd), offd_i, HYPRE_Int, num_rows + 1,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixJ(offd), offd_j, HYPRE_Int, offd_nnz,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixData(offd), offd_data, HYPRE_Complex, offd_nnz,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(matrix), col_map_offd, HYPRE_BigInt,
+                 num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinaryRedistribute
+ *
+ * Builds the local matrix for a uniform row/column partitioning from the
+ * blocks of the file that overlap the local rows. Used when the file was
+ * written with a different number of processes.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRMatrix *
+hypre_ParCSRMatrixReadBinaryRedistribute( MPI_Comm      comm,
+                                          char         *base,
+                                          hypre_uint64 *header,
+                                          hypre_uint64 *table )
+{
+   HYPRE_MemoryLocation  memory_location = hypre_HandleMemoryLocation(hypre_handle());
+   HYPRE_BigInt          global_num_rows = (HYPRE_BigInt) header[5];
+   HYPRE_BigInt          global_num_cols = (HYPRE_BigInt) header[6];
+   HYPRE_Int             num_blocks = (HYPRE_Int) header[7];
+   hypre_ParCSRMatrix   *matrix;
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_BigInt          row_starts[2], col_starts[2];
+   HYPRE_Int             num_procs, myid, num_rows;
+
+   HYPRE_Int            *b_diag_i, *b_diag_j, *b_offd_i, *b_offd_j;
+   HYPRE_Complex        *b_diag_data, *b_offd_data;
+   HYPRE_BigInt         *b_col_map_offd;
+
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd, *big_offd_j;
+   HYPRE_Int             diag_nnz = 0, offd_nnz = 0, num_cols_offd;
+
+   HYPRE_BigInt          first_row, last_row, row, col;
+   HYPRE_Int             b, pass, i, j, k, lr, jj;
+   HYPRE_Complex         val;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   hypre_GenerateLocalPartitioning(global_num_rows, num_procs, myid, row_starts);
+   hypre_GenerateLocalPartitioning(global_num_cols, num_procs, myid, col_starts);
+   num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+
+   diag_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   diag_j = offd_j = NULL;
+   diag_data = offd_data = NULL;
+   big_offd_j = NULL;
+
+   /* First pass counts the row lengths, second pass copies the entries */
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (b = 0; b < num_blocks; b++)
+      {
+         hypre_uint64 *block = table + b * hypre_PARCSR_BINARY_BLOCK_LEN;
+
+         first_row = hypre_max((HYPRE_BigInt) block[0], row_starts[0]);
+         last_row  = hypre_min((HYPRE_BigInt) block[1], row_starts[1]);
+         if (first_row >= last_row)
+         {
+            continue;
+         }
+
+         hypre_ParCSRBinaryBlockArrays(base, block, &b_diag_i, &b_diag_j, &b_diag_data,
+                                       &b_offd_i, &b_offd_j, &b_offd_data, &b_col_map_offd);
+
+         for (row = first_row; row < last_row; row++)
+         {
+            i  = (HYPRE_Int) (row - (HYPRE_BigInt) block[0]);
+            lr = (HYPRE_Int) (row - row_starts[0]);
+
+            for (k = 0; k < 2; k++)
+            {
+               HYPRE_Int     *b_i    = k ? b_offd_i : b_diag_i;
+               HYPRE_Int     *b_j    = k ? b_offd_j : b_diag_j;
+               HYPRE_Complex *b_data = k ? b_offd_data : b_diag_data;
+
+               for (j = b_i[i]; j < b_i[i + 1]; j++)
+               {
+                  col = k ? b_col_map_offd[b_j[j]] : (HYPRE_BigInt) block[2] + b_j[j];
+                  if (col >= col_starts[0] && col < col_starts[1])
+                  {
+                     if (pass)
+                     {
+                        jj = diag_i[lr]++;
+                        diag_j[jj]    = (HYPRE_Int) (col - col_starts[0]);
+                        diag_data[jj] = b_data[j];
+                     }
+                     else
+                     {
+                        diag_i[lr + 1]++;
+                     }
+                  }
+                  else
+                  {
+                     if (pass)
+                     {
+                        jj = offd_i[lr]++;
+                        big_offd_j[jj] = col;
+                        offd_data[jj]  = b_data[j];
+                     }
+                     else
+                     {
+                        offd_i[lr + 1]++;
+                     }
+                  }
+               }
+            }
+         }
+      }
+
+      if (pass == 0)
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            diag_i[i + 1] += diag_i[i];
+            offd_i[i + 1] += offd_i[i];
+         }
+         diag_nnz   = diag_i[num_rows];
+         offd_nnz   = offd_i[num_rows];
+         diag_j     = hypre_TAlloc(HYPRE_Int, diag_nnz, HYPRE_MEMORY_HOST);
+         diag_data  = hypre_TAlloc(HYPRE_Complex, diag_nnz, HYPRE_MEMORY_HOST);
+         offd_j     = hypre_TAlloc(HYPRE_Int, offd_nnz, HYPRE_MEMORY_HOST);
+         offd_data  = hypre_TAlloc(HYPRE_Complex, offd_nnz, HYPRE_MEMORY_HOST);
+         big_offd_j = hypre_TAlloc(HYPRE_BigInt, offd_nnz, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /* The second pass advanced the row pointers by one row */
+   for (i = num_rows; i > 0; i--)
+   {
+      diag_i[i] = diag_i[i - 1];
+      offd_i[i] = offd_i[i - 1];
+   }
+   diag_i[0] = 0;
+   offd_i[0] = 0;
+
+   /* Generate col_map_offd */
+   col_map_offd  = hypre_TAlloc(HYPRE_BigInt, offd_nnz, HYPRE_MEMORY_HOST);
+   num_cols_offd = 0;
+   if (offd_nnz)
+   {
+      hypre_TMemcpy(col_map_offd, big_offd_j, HYPRE_BigInt, offd_nnz,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_BigQsort0(col_map_offd, 0, offd_nnz - 1);
+      for (i = 1; i < offd_nnz; i++)
+      {
+         if (col_map_offd[i] > col_map_offd[num_cols_offd])
+         {
+            col_map_offd[++num_cols_offd] = col_map_offd[i];
+         }
+      }
+      num_cols_offd++;
+   }
+   for (i = 0; i < offd_nnz; i++)
+   {
+      offd_j[i] = hypre_BigBinarySearch(col_map_offd, big_offd_j[i], num_cols_offd);
+   }
+   hypre_TFree(big_offd_j, HYPRE_MEMORY_HOST);
+
+   /* Move diagonal element in first position in each row */
+   if (row_starts[0] == col_starts[0] && row_starts[1] == col_starts[1])
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = diag_i[i]; j < diag_i[i + 1]; j++)
+         {
+            if (diag_j[j] == i)
+            {
+               val                  = diag_data[j];
+               diag_j[j]            = diag_j[diag_i[i]];
+               diag_data[j]         = diag_data[diag_i[i]];
+               diag_j[diag_i[i]]    = i;
+               diag_data[diag_i[i]] = val;
+               break;
+            }
+         }
+      }
+   }
+
+   /* Create the matrix */
+   matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                     row_starts, col_starts, num_cols_offd,
+                                     diag_nnz, offd_nnz);
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+
+   hypre_CSRMatrixI(diag)    = diag_i;
+   hypre_CSRMatrixJ(diag)    = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixMemoryLocation(diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(offd)    = offd_i;
+   hypre_CSRMatrixJ(offd)    = offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixMemoryLocation(offd) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(matrix) = col_map_offd;
+
+   hypre_ParCSRMatrixMigrate(matrix, memory_location);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Reads a ParCSRMatrix written by hypre_ParCSRMatrixPrintBinary. The file
+ * is memory-mapped and, when it was written with the same number of
+ * processes, the local CSR arrays are copied from it without any parsing or
+ * assembly. Otherwise, the rows are redistributed to a uniform partitioning.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReadBinary( MPI_Comm             comm,
+                              const char          *filename,
+                              hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_ParCSRMatrix  *matrix = NULL;
+   char                *base;
+   size_t               size = 0, header_bytes, table_bytes, block_end;
+   size_t               sizes[hypre_PARCSR_BINARY_NSECTIONS];
+   hypre_uint64        *header = NULL, *table = NULL;
+   HYPRE_Int            one = 1;
+   HYPRE_Int            myid, num_procs, num_blocks = 0, b, s;
+   HYPRE_Int            ierr = 0, ierr_all;
+
+   /* Exit if trying to read from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*---------------------------------------------
+    * Map file and check header
+    *---------------------------------------------*/
+
+   header_bytes = hypre_PARCSR_BINARY_HEADER_LEN * sizeof(hypre_uint64);
+   if ((base = hypre_ParCSRBinaryMap(filename, &size)) == NULL)
+   {
+      ierr = 1;
+   }
+   else
+   {
+      header = (hypre_uint64 *) base;
+      if (size < header_bytes ||
+          header[0] != hypre_PARCSR_BINARY_MAGIC ||
+          header[1] != hypre_PARCSR_BINARY_VERSION)
+      {
+         ierr = 2;
+      }
+      else if (header[2] != sizeof(HYPRE_Int) ||
+               header[3] != sizeof(HYPRE_BigInt) ||
+               header[4] != sizeof(HYPRE_Complex))
+      {
+         ierr = 3;
+      }
+      else
+      {
+         /* Check that the file holds all blocks */
+         num_blocks  = (HYPRE_Int) header[7];
+         table_bytes = (size_t) num_blocks * hypre_PARCSR_BINARY_BLOCK_LEN * sizeof(hypre_uint64);
+         table       = (hypre_uint64 *) (base + header_bytes);
+         if (size < header_bytes + table_bytes)
+         {
+            ierr = 2;
+         }
+         for (b = 0; b < num_blocks && !ierr; b++)
+         {
+            hypre_ParCSRBinarySectionSizes(table + b * hypre_PARCSR_BINARY_BLOCK_LEN, sizes);
+            block_end = (size_t) table[b * hypre_PARCSR_BINARY_BLOCK_LEN + 7];
+            for (s = 0; s < hypre_PARCSR_BINARY_NSECTIONS; s++)
+            {
+               block_end += hypre_ParCSRBinaryPad(sizes[s]);
+            }
+            if (block_end > size)
+            {
+               ierr = 2;
+            }
+         }
+      }
+   }
+
+   hypre_MPI_Allreduce(&ierr, &ierr_all, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr_all)
+   {
+      if (base)
+      {
+         hypre_ParCSRBinaryUnmap(base, size);
+      }
+      if (ierr_all == 1)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open input file\n");
+      }
+      else if (ierr_all == 2)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Invalid or truncated ParCSR binary file\n");
+      }
+      else
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "File written with different integer or real type sizes\n");
+      }
+      *matrix_ptr = NULL;
+
+      return hypre_error_flag;
+   }
+
+   /*---------------------------------------------
+    * Build the local matrix
+    *---------------------------------------------*/
+
+   if (num_blocks == num_procs)
+   {
+      matrix = hypre_ParCSRMatrixReadBinaryBlock(comm, base, header,
+                                                 table + myid * hypre_PARCSR_BINARY_BLOCK_LEN);
+   }
+   else
+   {
+      matrix = hypre_ParCSRMatrixReadBinaryRedistribute(comm, base, header, table);
+   }
+
+   hypre_ParCSRBinaryUnmap(base, size);
+
+   hypre_ParCSRMatrixSetNumNonzeros(matrix);
+   hypre_ParCSRMatrixDNumNonzeros(matrix) = (HYPRE_Real) hypre_ParCSRMatrixNumNonzeros(matrix);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
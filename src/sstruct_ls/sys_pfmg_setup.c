@@ -621,6 +621,8 @@ hypre_SysStructCoarsen( hypre_SStructPGrid  *fgrid,
 
    hypre_SStructPGridPNeighbors(cgrid) = hypre_BoxArrayCreate(0, ndim);
    hypre_SStructPGridPNborOffsets(cgrid) = NULL;
+   hypre_SStructPGridAddedBoxes(cgrid)   = hypre_BoxArrayCreate(0, ndim);
+   hypre_SStructPGridRemovedBoxes(cgrid) = hypre_BoxArrayCreate(0, ndim);
 
    hypre_SStructPGridLocalSize(cgrid)  = 0;
    hypre_SStructPGridGlobalSize(cgrid) = 0;
@@ -853,6 +853,81 @@ HYPRE_SStructGridAssemble( HYPRE_SStructGrid grid )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGridAddExtents( HYPRE_SStructGrid  grid,
+                             HYPRE_Int          part,
+                             HYPRE_Int         *ilower,
+                             HYPRE_Int         *iupper )
+{
+   HYPRE_Int            ndim  = hypre_SStructGridNDim(grid);
+   hypre_SStructPGrid  *pgrid = hypre_SStructGridPGrid(grid, part);
+   hypre_Index          cilower;
+   hypre_Index          ciupper;
+   hypre_Box           *box;
+
+   if (hypre_SStructGridBoxManagers(grid) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Grid must be assembled before adding extents");
+      return hypre_error_flag;
+   }
+
+   hypre_CopyToCleanIndex(ilower, ndim, cilower);
+   hypre_CopyToCleanIndex(iupper, ndim, ciupper);
+
+   box = hypre_BoxCreate(ndim);
+   hypre_BoxSetExtents(box, cilower, ciupper);
+   hypre_AppendBox(box, hypre_SStructPGridAddedBoxes(pgrid));
+   hypre_BoxDestroy(box);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGridRemoveExtents( HYPRE_SStructGrid  grid,
+                                HYPRE_Int          part,
+                                HYPRE_Int         *ilower,
+                                HYPRE_Int         *iupper )
+{
+   HYPRE_Int            ndim  = hypre_SStructGridNDim(grid);
+   hypre_SStructPGrid  *pgrid = hypre_SStructGridPGrid(grid, part);
+   hypre_Index          cilower;
+   hypre_Index          ciupper;
+   hypre_Box           *box;
+
+   if (hypre_SStructGridBoxManagers(grid) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Grid must be assembled before removing extents");
+      return hypre_error_flag;
+   }
+
+   hypre_CopyToCleanIndex(ilower, ndim, cilower);
+   hypre_CopyToCleanIndex(iupper, ndim, ciupper);
+
+   box = hypre_BoxCreate(ndim);
+   hypre_BoxSetExtents(box, cilower, ciupper);
+   hypre_AppendBox(box, hypre_SStructPGridRemovedBoxes(pgrid));
+   hypre_BoxDestroy(box);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGridReassemble( HYPRE_SStructGrid grid )
+{
+   hypre_SStructGridReassemble(grid);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -33,12 +33,9 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
    HYPRE_Int               nvars;
 
    HYPRE_Int               stencil_size;
-   HYPRE_Int              *stencil_vars;
-   HYPRE_Int               pstencil_size;
 
-   HYPRE_SStructVariable   vitype, vjtype;
-   HYPRE_Int               part, vi, vj, i;
-   HYPRE_Int               size, rectangular;
+   HYPRE_Int               part, vi, vj;
+   HYPRE_Int               size;
 
    matrix = hypre_TAlloc(hypre_SStructMatrix,  1, HYPRE_MEMORY_HOST);
 
@@ -55,12 +52,6 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
    hypre_SStructMatrixPMatrices(matrix) = pmatrices;
    symmetric = hypre_TAlloc(HYPRE_Int **,  nparts, HYPRE_MEMORY_HOST);
    hypre_SStructMatrixSymmetric(matrix) = symmetric;
-   /* is this a rectangular matrix? */
-   rectangular = 0;
-   if (hypre_SStructGraphGrid(graph) != hypre_SStructGraphDomainGrid(graph))
-   {
-      rectangular = 1;
-   }
    for (part = 0; part < nparts; part++)
    {
       pgrid = hypre_SStructGraphPGrid(graph, part);
@@ -70,39 +61,15 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
       for (vi = 0; vi < nvars; vi++)
       {
          stencil_size  = hypre_SStructStencilSize(stencils[part][vi]);
-         stencil_vars  = hypre_SStructStencilVars(stencils[part][vi]);
-         pstencil_size = 0;
          splits[part][vi] = hypre_TAlloc(HYPRE_Int,  stencil_size, HYPRE_MEMORY_HOST);
          symmetric[part][vi] = hypre_TAlloc(HYPRE_Int,  nvars, HYPRE_MEMORY_HOST);
-         for (i = 0; i < stencil_size; i++)
-         {
-            /* for rectangular matrices, put all coefficients in U-matrix */
-            if (rectangular)
-            {
-               splits[part][vi][i] = -1;
-            }
-            else
-            {
-               vj = stencil_vars[i];
-               vitype = hypre_SStructPGridVarType(pgrid, vi);
-               vjtype = hypre_SStructPGridVarType(pgrid, vj);
-               if (vjtype == vitype)
-               {
-                  splits[part][vi][i] = pstencil_size;
-                  pstencil_size++;
-               }
-               else
-               {
-                  splits[part][vi][i] = -1;
-               }
-            }
-         }
          for (vj = 0; vj < nvars; vj++)
          {
             symmetric[part][vi][vj] = 0;
          }
       }
    }
+   hypre_SStructMatrixSetDefaultSplits(matrix);
 
    /* GEC0902 move the IJ creation to the initialization phase
     * ilower = hypre_SStructGridGhstartRank(grid);
@@ -141,6 +108,7 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
    /* GEC0902 setting the default of the object_type to HYPRE_SSTRUCT */
 
    hypre_SStructMatrixObjectType(matrix) = HYPRE_SSTRUCT;
+   hypre_SStructMatrixDirectParCSR(matrix) = 0;
 
    *matrix_ptr = matrix;
 
@@ -192,6 +160,13 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
          hypre_TFree(splits, HYPRE_MEMORY_HOST);
          hypre_TFree(pmatrices, HYPRE_MEMORY_HOST);
          hypre_TFree(symmetric, HYPRE_MEMORY_HOST);
+         /* the directly built ParCSR matrix is owned by the SStructMatrix */
+         if (hypre_SStructMatrixDirectParCSR(matrix) && hypre_SStructMatrixIJMatrix(matrix) &&
+             hypre_SStructMatrixParCSRMatrix(matrix) !=
+             hypre_IJMatrixObject(hypre_SStructMatrixIJMatrix(matrix)))
+         {
+            hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+         }
          HYPRE_IJMatrixDestroy(hypre_SStructMatrixIJMatrix(matrix));
          hypre_TFree(hypre_SStructMatrixSEntries(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_SStructMatrixUEntries(matrix), HYPRE_MEMORY_HOST);
@@ -239,6 +214,24 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
    hypre_SStructGrid      *grid, *domain_grid;
    HYPRE_BigInt            ilower, iupper, jlower, jupper;
    HYPRE_Int               matrix_type = hypre_SStructMatrixObjectType(matrix);
+   HYPRE_Int               direct;
+
+   /* The direct ParCSR build is for square matrices on the host only.  It keeps
+    * the stencil couplings in the S-matrix, so restore the default split. */
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      if (matrix_type != HYPRE_PARCSR ||
+          hypre_SStructGraphGrid(graph) != hypre_SStructGraphDomainGrid(graph) ||
+          hypre_GetExecPolicy1(hypre_HandleMemoryLocation(hypre_handle())) == HYPRE_EXEC_DEVICE)
+      {
+         hypre_SStructMatrixDirectParCSR(matrix) = 0;
+      }
+      else
+      {
+         hypre_SStructMatrixSetDefaultSplits(matrix);
+      }
+   }
+   direct = hypre_SStructMatrixDirectParCSR(matrix);
 
    /* S-matrix */
    for (part = 0; part < nparts; part++)
@@ -280,7 +273,7 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
          for (i = 0; i < nvars; i++)
          {
             hypre_SStructPMatrixSetSymmetric(pmatrices[part], var, i,
-                                             symmetric[part][var][i]);
+                                             direct ? 0 : symmetric[part][var][i]);
          }
       }
       hypre_SStructPMatrixInitialize(pmatrices[part]);
@@ -585,6 +578,92 @@ HYPRE_SStructMatrixAddToBoxValues2( HYPRE_SStructMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixSetBoxValuesStrided( HYPRE_SStructMatrix  matrix,
+                                        HYPRE_Int            part,
+                                        HYPRE_Int           *ilower,
+                                        HYPRE_Int           *iupper,
+                                        HYPRE_Int            nvars,
+                                        HYPRE_Int           *vars,
+                                        HYPRE_Int           *nentries,
+                                        HYPRE_Int           *entries,
+                                        HYPRE_Int           *vilower,
+                                        HYPRE_Int           *viupper,
+                                        HYPRE_Complex       *values,
+                                        HYPRE_Int            point_stride,
+                                        HYPRE_Int            entry_stride )
+{
+   hypre_Box  *set_box, *value_box;
+   HYPRE_Int   d, ndim = hypre_SStructMatrixNDim(matrix);
+
+   /* This creates boxes with zeroed-out extents */
+   set_box = hypre_BoxCreate(ndim);
+   value_box = hypre_BoxCreate(ndim);
+
+   for (d = 0; d < ndim; d++)
+   {
+      hypre_BoxIMinD(set_box, d) = ilower[d];
+      hypre_BoxIMaxD(set_box, d) = iupper[d];
+      hypre_BoxIMinD(value_box, d) = vilower[d];
+      hypre_BoxIMaxD(value_box, d) = viupper[d];
+   }
+
+   hypre_SStructMatrixSetBoxValuesStrided(matrix, part, set_box, nvars, vars,
+                                          nentries, entries, value_box, values,
+                                          point_stride, entry_stride, 0);
+
+   hypre_BoxDestroy(set_box);
+   hypre_BoxDestroy(value_box);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixAddToBoxValuesStrided( HYPRE_SStructMatrix  matrix,
+                                          HYPRE_Int            part,
+                                          HYPRE_Int           *ilower,
+                                          HYPRE_Int           *iupper,
+                                          HYPRE_Int            nvars,
+                                          HYPRE_Int           *vars,
+                                          HYPRE_Int           *nentries,
+                                          HYPRE_Int           *entries,
+                                          HYPRE_Int           *vilower,
+                                          HYPRE_Int           *viupper,
+                                          HYPRE_Complex       *values,
+                                          HYPRE_Int            point_stride,
+                                          HYPRE_Int            entry_stride )
+{
+   hypre_Box  *set_box, *value_box;
+   HYPRE_Int   d, ndim = hypre_SStructMatrixNDim(matrix);
+
+   /* This creates boxes with zeroed-out extents */
+   set_box = hypre_BoxCreate(ndim);
+   value_box = hypre_BoxCreate(ndim);
+
+   for (d = 0; d < ndim; d++)
+   {
+      hypre_BoxIMinD(set_box, d) = ilower[d];
+      hypre_BoxIMaxD(set_box, d) = iupper[d];
+      hypre_BoxIMinD(value_box, d) = vilower[d];
+      hypre_BoxIMaxD(value_box, d) = viupper[d];
+   }
+
+   hypre_SStructMatrixSetBoxValuesStrided(matrix, part, set_box, nvars, vars,
+                                          nentries, entries, value_box, values,
+                                          point_stride, entry_stride, 1);
+
+   hypre_BoxDestroy(set_box);
+   hypre_BoxDestroy(value_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -850,6 +929,12 @@ HYPRE_SStructMatrixAssemble( HYPRE_SStructMatrix matrix )
    /* U-matrix */
    hypre_SStructUMatrixAssemble(matrix);
 
+   /* ParCSR matrix from the S- and U-matrices */
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      hypre_SStructMatrixAssembleParCSR(matrix);
+   }
+
    return hypre_error_flag;
 }
 
@@ -963,6 +1048,18 @@ HYPRE_SStructMatrixSetObjectType( HYPRE_SStructMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR( HYPRE_SStructMatrix  matrix,
+                                    HYPRE_Int            direct )
+{
+   hypre_SStructMatrixDirectParCSR(matrix) = direct;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
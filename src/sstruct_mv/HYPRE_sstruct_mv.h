@@ -303,6 +303,44 @@ HYPRE_SStructGridAddUnstructuredPart(HYPRE_SStructGrid grid,
 HYPRE_Int
 HYPRE_SStructGridAssemble(HYPRE_SStructGrid grid);
 
+/**
+ * Add a new box to part \e part of an assembled grid.  The change takes effect
+ * when \c HYPRE_SStructGridReassemble is called.
+ **/
+HYPRE_Int
+HYPRE_SStructGridAddExtents(HYPRE_SStructGrid  grid,
+                            HYPRE_Int          part,
+                            HYPRE_Int         *ilower,
+                            HYPRE_Int         *iupper);
+
+/**
+ * Remove a box from part \e part of an assembled grid.  The extents must be
+ * exactly those of a box previously set on this process.  The change takes
+ * effect when \c HYPRE_SStructGridReassemble is called.
+ **/
+HYPRE_Int
+HYPRE_SStructGridRemoveExtents(HYPRE_SStructGrid  grid,
+                               HYPRE_Int          part,
+                               HYPRE_Int         *ilower,
+                               HYPRE_Int         *iupper);
+
+/**
+ * Apply the boxes added and removed since the last assemble.  This is a
+ * collective call, and is intended for adaptive mesh refinement, where only a
+ * few boxes change between solves.
+ *
+ * When all variables are cell-centered and there are no neighbor or shared
+ * parts and no periodicity, the box managers are updated from the list of
+ * changes instead of being rebuilt, which avoids the assumed partition and
+ * the box gathers of \c HYPRE_SStructGridAssemble.  Otherwise, the grid is
+ * re-assembled from scratch.
+ *
+ * NOTE: Graphs, matrices, and vectors created on the grid before this call must
+ * be re-created.  The old objects may still be destroyed.
+ **/
+HYPRE_Int
+HYPRE_SStructGridReassemble(HYPRE_SStructGrid grid);
+
 /**
  * Set the periodicity on a particular part.
  *
@@ -696,6 +734,64 @@ HYPRE_SStructMatrixAddToBoxValues2(HYPRE_SStructMatrix  matrix,
                                    HYPRE_Int           *viupper,
                                    HYPRE_Complex       *values);
 
+/**
+ * Set matrix coefficients for several variables a box at a time.  This is
+ * equivalent to calling \ref HYPRE_SStructMatrixSetBoxValues2 for each
+ * variable \e vars[v], but all stencil entries coupling to the same variable
+ * are set in a single pass over the box.
+ *
+ * The entries for variable \e vars[v] are the \e nentries[v] values of
+ * \e entries that follow those of the previous variables.  The \e values array
+ * is logically box shaped with value-box extents \e vilower and \e viupper.
+ * With k the position of an entry in \e entries, its value at the point with
+ * (lexicographic) rank p in the value box is
+ *
+   \verbatim
+   values[p*point_stride + k*entry_stride]
+   \endverbatim
+ *
+ * For example, \e point_stride = (total number of entries) and
+ * \e entry_stride = 1 store all entries of a point contiguously, while
+ * \e point_stride = 1 and \e entry_stride = (value-box volume) store one
+ * array per entry.
+ *
+ * NOTE: The box extents apply to all variables, so \e vars should only contain
+ * variables of the same type.
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixSetBoxValuesStrided(HYPRE_SStructMatrix  matrix,
+                                       HYPRE_Int            part,
+                                       HYPRE_Int           *ilower,
+                                       HYPRE_Int           *iupper,
+                                       HYPRE_Int            nvars,
+                                       HYPRE_Int           *vars,
+                                       HYPRE_Int           *nentries,
+                                       HYPRE_Int           *entries,
+                                       HYPRE_Int           *vilower,
+                                       HYPRE_Int           *viupper,
+                                       HYPRE_Complex       *values,
+                                       HYPRE_Int            point_stride,
+                                       HYPRE_Int            entry_stride);
+
+/**
+ * Add to matrix coefficients for several variables a box at a time.  The data
+ * in \e values is ordered as in \ref HYPRE_SStructMatrixSetBoxValuesStrided.
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixAddToBoxValuesStrided(HYPRE_SStructMatrix  matrix,
+                                         HYPRE_Int            part,
+                                         HYPRE_Int           *ilower,
+                                         HYPRE_Int           *iupper,
+                                         HYPRE_Int            nvars,
+                                         HYPRE_Int           *vars,
+                                         HYPRE_Int           *nentries,
+                                         HYPRE_Int           *entries,
+                                         HYPRE_Int           *vilower,
+                                         HYPRE_Int           *viupper,
+                                         HYPRE_Complex       *values,
+                                         HYPRE_Int            point_stride,
+                                         HYPRE_Int            entry_stride);
+
 /**
  * Add finite element stiffness matrix coefficients a box at a time.  The data
  * in \e values is organized as an array of element matrices ordered as in \ref
@@ -798,6 +894,22 @@ HYPRE_Int
 HYPRE_SStructMatrixSetObjectType(HYPRE_SStructMatrix  matrix,
                                  HYPRE_Int            type);
 
+/**
+ * (Optional) With object type \c HYPRE_PARCSR, store the stencil entries in
+ * structured form and build the ParCSR matrix from them directly on Assemble,
+ * instead of passing every entry through the IJ interface.  Non-stencil
+ * entries and couplings between parts still go through the IJ interface.
+ * This must be called before \c HYPRE_SStructMatrixInitialize.
+ *
+ * As with \c HYPRE_SSTRUCT, values for rows on other processes can only be
+ * given in the ghost layer of the local boxes.  Symmetric storage is not used,
+ * and the option is ignored for rectangular matrices and for matrices in device
+ * memory.
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR(HYPRE_SStructMatrix  matrix,
+                                   HYPRE_Int            direct);
+
 /**
  * Get a reference to the constructed matrix object.
  *
@@ -83,6 +83,10 @@ typedef struct
    HYPRE_Int               ghlocal_size;     /* Number of vars including ghosts */
 
    HYPRE_Int               cell_sgrid_done;  /* =1 implies cell grid already assembled */
+
+   /* boxes added and removed since the last assemble (see Reassemble) */
+   hypre_BoxArray         *added_boxes;
+   hypre_BoxArray         *removed_boxes;
 } hypre_SStructPGrid;
 
 typedef struct
@@ -126,6 +130,37 @@ typedef struct
 
 } hypre_SStructBoxManNborInfo;
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructRegridExchange:
+ *
+ * Data passed to the fill-response routine of hypre_SStructGridReassemble.
+ * Boxes are exchanged as fixed-size HYPRE_BigInt objects with the layout
+ * given by the hypre_SSTRUCT_REGRID_OBJ_* indexes below, where the offsets
+ * are for variable 0 and size/ghsize give the per-variable block sizes of the
+ * owning process on that part.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SSTRUCT_REGRID_OBJ_PROC     0
+#define hypre_SSTRUCT_REGRID_OBJ_PART     1
+#define hypre_SSTRUCT_REGRID_OBJ_ID       2
+#define hypre_SSTRUCT_REGRID_OBJ_OFFSET   3
+#define hypre_SSTRUCT_REGRID_OBJ_GHOFFSET 4
+#define hypre_SSTRUCT_REGRID_OBJ_SIZE     5
+#define hypre_SSTRUCT_REGRID_OBJ_GHSIZE   6
+#define hypre_SSTRUCT_REGRID_OBJ_IMIN     7
+#define hypre_SSTRUCT_REGRID_OBJ_IMAX     (7 + HYPRE_MAXDIM)
+#define hypre_SSTRUCT_REGRID_OBJ_LEN      (7 + 2 * HYPRE_MAXDIM)
+
+typedef struct
+{
+   HYPRE_Int      nparts;
+   HYPRE_Int     *my_starts;  /* my objects for each part */
+   HYPRE_BigInt  *my_objs;
+   HYPRE_Int      recv_size;  /* number of objects received as contacts */
+   HYPRE_Int      recv_alloc;
+   HYPRE_BigInt  *recv_objs;
+} hypre_SStructRegridExchange;
+
 typedef struct
 {
    hypre_CommInfo  *comm_info;
@@ -256,6 +291,8 @@ typedef struct hypre_SStructGrid_struct
 #define hypre_SStructPGridGlobalSize(pgrid)       ((pgrid) -> global_size)
 #define hypre_SStructPGridPeriodic(pgrid)         ((pgrid) -> periodic)
 #define hypre_SStructPGridGhlocalSize(pgrid)      ((pgrid) -> ghlocal_size)
+#define hypre_SStructPGridAddedBoxes(pgrid)       ((pgrid) -> added_boxes)
+#define hypre_SStructPGridRemovedBoxes(pgrid)     ((pgrid) -> removed_boxes)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructBoxManInfo
@@ -613,6 +650,10 @@ typedef struct hypre_SStructMatrix_struct
    /* GEC0902   adding an object type to the matrix  */
    HYPRE_Int               object_type;
 
+   /* Build the ParCSR matrix from the S-matrix and U-matrix directly?  The
+    * ParCSR matrix is then owned by the SStructMatrix */
+   HYPRE_Int               direct_parcsr;
+
 } hypre_SStructMatrix;
 
 /*--------------------------------------------------------------------------
@@ -644,6 +685,7 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixGlobalSize(mat)           ((mat) -> global_size)
 #define hypre_SStructMatrixRefCount(mat)             ((mat) -> ref_count)
 #define hypre_SStructMatrixObjectType(mat)           ((mat) -> object_type)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPMatrix
@@ -826,6 +868,11 @@ HYPRE_Int HYPRE_SStructGridSetSharedPart ( HYPRE_SStructGrid grid, HYPRE_Int par
 HYPRE_Int HYPRE_SStructGridAddUnstructuredPart ( HYPRE_SStructGrid grid, HYPRE_Int ilower,
                                                  HYPRE_Int iupper );
 HYPRE_Int HYPRE_SStructGridAssemble ( HYPRE_SStructGrid grid );
+HYPRE_Int HYPRE_SStructGridAddExtents ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int *ilower,
+                                        HYPRE_Int *iupper );
+HYPRE_Int HYPRE_SStructGridRemoveExtents ( HYPRE_SStructGrid grid, HYPRE_Int part,
+                                           HYPRE_Int *ilower, HYPRE_Int *iupper );
+HYPRE_Int HYPRE_SStructGridReassemble ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetPeriodic ( HYPRE_SStructGrid grid, HYPRE_Int part,
                                          HYPRE_Int *periodic );
 HYPRE_Int HYPRE_SStructGridSetNumGhost ( HYPRE_SStructGrid grid, HYPRE_Int *num_ghost );
@@ -851,6 +898,14 @@ HYPRE_Int HYPRE_SStructMatrixSetBoxValues ( HYPRE_SStructMatrix matrix, HYPRE_In
 HYPRE_Int HYPRE_SStructMatrixAddToBoxValues ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                               HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries,
                                               HYPRE_Complex *values );
+HYPRE_Int HYPRE_SStructMatrixSetBoxValuesStrided ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
+                                                   HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int nvars, HYPRE_Int *vars, HYPRE_Int *nentries,
+                                                   HYPRE_Int *entries, HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values,
+                                                   HYPRE_Int point_stride, HYPRE_Int entry_stride );
+HYPRE_Int HYPRE_SStructMatrixAddToBoxValuesStrided ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
+                                                     HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int nvars, HYPRE_Int *vars, HYPRE_Int *nentries,
+                                                     HYPRE_Int *entries, HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values,
+                                                     HYPRE_Int point_stride, HYPRE_Int entry_stride );
 HYPRE_Int HYPRE_SStructMatrixGetBoxValues ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                             HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries,
                                             HYPRE_Complex *values );
@@ -859,6 +914,7 @@ HYPRE_Int HYPRE_SStructMatrixSetSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_In
                                             HYPRE_Int var, HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix, HYPRE_Int type );
+HYPRE_Int HYPRE_SStructMatrixSetDirectParCSR ( HYPRE_SStructMatrix matrix, HYPRE_Int direct );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix, void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename, HYPRE_SStructMatrix matrix,
                                      HYPRE_Int all );
@@ -953,6 +1009,10 @@ HYPRE_Int hypre_SStructGridRef ( hypre_SStructGrid *grid, hypre_SStructGrid **gr
 HYPRE_Int hypre_SStructGridAssembleBoxManagers ( hypre_SStructGrid *grid );
 HYPRE_Int hypre_SStructGridAssembleNborBoxManagers ( hypre_SStructGrid *grid );
 HYPRE_Int hypre_SStructGridCreateCommInfo ( hypre_SStructGrid *grid );
+HYPRE_Int hypre_FillResponseSStructGridReassemble ( void *p_recv_contact_buf,
+                                                    HYPRE_Int contact_size, HYPRE_Int contact_proc, void *ro, MPI_Comm comm,
+                                                    void **p_send_response_buf, HYPRE_Int *response_message_size );
+HYPRE_Int hypre_SStructGridReassemble ( hypre_SStructGrid *grid );
 HYPRE_Int hypre_SStructGridFindBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
                                              hypre_Index index, HYPRE_Int var, hypre_BoxManEntry **entry_ptr );
 HYPRE_Int hypre_SStructGridFindNborBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
@@ -1014,6 +1074,9 @@ HYPRE_Int hypre_SStructPMatrixSetValues ( hypre_SStructPMatrix *pmatrix, hypre_I
 HYPRE_Int hypre_SStructPMatrixSetBoxValues( hypre_SStructPMatrix *pmatrix, hypre_Box *set_box,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box, HYPRE_Complex *values,
                                             HYPRE_Int action );
+HYPRE_Int hypre_SStructPMatrixSetBoxValuesStrided( hypre_SStructPMatrix *pmatrix,
+                                                   hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
+                                                   HYPRE_Complex *values, HYPRE_Int point_stride, HYPRE_Int *value_offsets, HYPRE_Int action );
 HYPRE_Int hypre_SStructPMatrixAccumulate ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixAssemble ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPRE_Int var,
@@ -1029,6 +1092,7 @@ HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_I
                                             HYPRE_Complex *values, HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
+HYPRE_Int hypre_SStructMatrixSetDefaultSplits ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Int *nSentries_ptr,
                                             HYPRE_Int **Sentries_ptr, HYPRE_Int *nUentries_ptr, HYPRE_Int **Uentries_ptr );
@@ -1038,9 +1102,14 @@ HYPRE_Int hypre_SStructMatrixSetValues ( HYPRE_SStructMatrix matrix, HYPRE_Int p
 HYPRE_Int hypre_SStructMatrixSetBoxValues( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                            hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                            HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_SStructMatrixSetBoxValuesStrided( HYPRE_SStructMatrix matrix, HYPRE_Int part,
+                                                  hypre_Box *set_box, HYPRE_Int nvars, HYPRE_Int *vars, HYPRE_Int *nentries, HYPRE_Int *entries,
+                                                  hypre_Box *value_box, HYPRE_Complex *values, HYPRE_Int point_stride, HYPRE_Int entry_stride,
+                                                  HYPRE_Int action );
 HYPRE_Int hypre_SStructMatrixSetInterPartValues( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                                  hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                                  HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_SStructMatrixAssembleParCSR ( hypre_SStructMatrix *matrix );
 HYPRE_MemoryLocation hypre_SStructMatrixMemoryLocation(hypre_SStructMatrix *matrix);
 
 /* sstruct_matvec.c */
@@ -46,6 +46,11 @@ HYPRE_Int HYPRE_SStructGridSetSharedPart ( HYPRE_SStructGrid grid, HYPRE_Int par
 HYPRE_Int HYPRE_SStructGridAddUnstructuredPart ( HYPRE_SStructGrid grid, HYPRE_Int ilower,
                                                  HYPRE_Int iupper );
 HYPRE_Int HYPRE_SStructGridAssemble ( HYPRE_SStructGrid grid );
+HYPRE_Int HYPRE_SStructGridAddExtents ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int *ilower,
+                                        HYPRE_Int *iupper );
+HYPRE_Int HYPRE_SStructGridRemoveExtents ( HYPRE_SStructGrid grid, HYPRE_Int part,
+                                           HYPRE_Int *ilower, HYPRE_Int *iupper );
+HYPRE_Int HYPRE_SStructGridReassemble ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetPeriodic ( HYPRE_SStructGrid grid, HYPRE_Int part,
                                          HYPRE_Int *periodic );
 HYPRE_Int HYPRE_SStructGridSetNumGhost ( HYPRE_SStructGrid grid, HYPRE_Int *num_ghost );
@@ -71,6 +76,14 @@ HYPRE_Int HYPRE_SStructMatrixSetBoxValues ( HYPRE_SStructMatrix matrix, HYPRE_In
 HYPRE_Int HYPRE_SStructMatrixAddToBoxValues ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                               HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries,
                                               HYPRE_Complex *values );
+HYPRE_Int HYPRE_SStructMatrixSetBoxValuesStrided ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
+                                                   HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int nvars, HYPRE_Int *vars, HYPRE_Int *nentries,
+                                                   HYPRE_Int *entries, HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values,
+                                                   HYPRE_Int point_stride, HYPRE_Int entry_stride );
+HYPRE_Int HYPRE_SStructMatrixAddToBoxValuesStrided ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
+                                                     HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int nvars, HYPRE_Int *vars, HYPRE_Int *nentries,
+                                                     HYPRE_Int *entries, HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values,
+                                                     HYPRE_Int point_stride, HYPRE_Int entry_stride );
 HYPRE_Int HYPRE_SStructMatrixGetBoxValues ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                             HYPRE_Int *ilower, HYPRE_Int *iupper, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries,
                                             HYPRE_Complex *values );
@@ -79,6 +92,7 @@ HYPRE_Int HYPRE_SStructMatrixSetSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_In
                                             HYPRE_Int var, HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix, HYPRE_Int type );
+HYPRE_Int HYPRE_SStructMatrixSetDirectParCSR ( HYPRE_SStructMatrix matrix, HYPRE_Int direct );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix, void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename, HYPRE_SStructMatrix matrix,
                                      HYPRE_Int all );
@@ -173,6 +187,10 @@ HYPRE_Int hypre_SStructGridRef ( hypre_SStructGrid *grid, hypre_SStructGrid **gr
 HYPRE_Int hypre_SStructGridAssembleBoxManagers ( hypre_SStructGrid *grid );
 HYPRE_Int hypre_SStructGridAssembleNborBoxManagers ( hypre_SStructGrid *grid );
 HYPRE_Int hypre_SStructGridCreateCommInfo ( hypre_SStructGrid *grid );
+HYPRE_Int hypre_FillResponseSStructGridReassemble ( void *p_recv_contact_buf,
+                                                    HYPRE_Int contact_size, HYPRE_Int contact_proc, void *ro, MPI_Comm comm,
+                                                    void **p_send_response_buf, HYPRE_Int *response_message_size );
+HYPRE_Int hypre_SStructGridReassemble ( hypre_SStructGrid *grid );
 HYPRE_Int hypre_SStructGridFindBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
                                              hypre_Index index, HYPRE_Int var, hypre_BoxManEntry **entry_ptr );
 HYPRE_Int hypre_SStructGridFindNborBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
@@ -234,6 +252,9 @@ HYPRE_Int hypre_SStructPMatrixSetValues ( hypre_SStructPMatrix *pmatrix, hypre_I
 HYPRE_Int hypre_SStructPMatrixSetBoxValues( hypre_SStructPMatrix *pmatrix, hypre_Box *set_box,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box, HYPRE_Complex *values,
                                             HYPRE_Int action );
+HYPRE_Int hypre_SStructPMatrixSetBoxValuesStrided( hypre_SStructPMatrix *pmatrix,
+                                                   hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
+                                                   HYPRE_Complex *values, HYPRE_Int point_stride, HYPRE_Int *value_offsets, HYPRE_Int action );
 HYPRE_Int hypre_SStructPMatrixAccumulate ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixAssemble ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPRE_Int var,
@@ -249,6 +270,7 @@ HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_I
                                             HYPRE_Complex *values, HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
+HYPRE_Int hypre_SStructMatrixSetDefaultSplits ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Int *nSentries_ptr,
                                             HYPRE_Int **Sentries_ptr, HYPRE_Int *nUentries_ptr, HYPRE_Int **Uentries_ptr );
@@ -258,9 +280,14 @@ HYPRE_Int hypre_SStructMatrixSetValues ( HYPRE_SStructMatrix matrix, HYPRE_Int p
 HYPRE_Int hypre_SStructMatrixSetBoxValues( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                            hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                            HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_SStructMatrixSetBoxValuesStrided( HYPRE_SStructMatrix matrix, HYPRE_Int part,
+                                                  hypre_Box *set_box, HYPRE_Int nvars, HYPRE_Int *vars, HYPRE_Int *nentries, HYPRE_Int *entries,
+                                                  hypre_Box *value_box, HYPRE_Complex *values, HYPRE_Int point_stride, HYPRE_Int entry_stride,
+                                                  HYPRE_Int action );
 HYPRE_Int hypre_SStructMatrixSetInterPartValues( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                                  hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                                  HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_SStructMatrixAssembleParCSR ( hypre_SStructMatrix *matrix );
 HYPRE_MemoryLocation hypre_SStructMatrixMemoryLocation(hypre_SStructMatrix *matrix);
 
 /* sstruct_matvec.c */
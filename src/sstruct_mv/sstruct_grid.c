@@ -109,6 +109,9 @@ hypre_SStructPGridCreate( MPI_Comm             comm,
 
    hypre_SetIndex(hypre_SStructPGridPeriodic(pgrid), 0);
 
+   hypre_SStructPGridAddedBoxes(pgrid)   = hypre_BoxArrayCreate(0, ndim);
+   hypre_SStructPGridRemovedBoxes(pgrid) = hypre_BoxArrayCreate(0, ndim);
+
    *pgrid_ptr = pgrid;
 
    return hypre_error_flag;
@@ -136,6 +139,8 @@ hypre_SStructPGridDestroy( hypre_SStructPGrid *pgrid )
       }
       hypre_BoxArrayDestroy(hypre_SStructPGridPNeighbors(pgrid));
       hypre_TFree(hypre_SStructPGridPNborOffsets(pgrid), HYPRE_MEMORY_HOST);
+      hypre_BoxArrayDestroy(hypre_SStructPGridAddedBoxes(pgrid));
+      hypre_BoxArrayDestroy(hypre_SStructPGridRemovedBoxes(pgrid));
       hypre_TFree(pgrid, HYPRE_MEMORY_HOST);
    }
 
@@ -1441,6 +1446,1129 @@ hypre_SStructGridCreateCommInfo( hypre_SStructGrid  *grid )
    return hypre_error_flag;
 }
 
+/*==========================================================================
+ * SStructGrid re-assembly
+ *
+ * Boxes added with HYPRE_SStructGridAddExtents and removed with
+ * HYPRE_SStructGridRemoveExtents are applied to an assembled grid here.
+ *==========================================================================*/
+
+/*--------------------------------------------------------------------------
+ * Fill response for the box exchange in hypre_SStructGridReassemble.  The
+ * contact is the full box list of a process that has become a new neighbor on
+ * one or more parts.  It is saved, and the response is our own box list on the
+ * same parts.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FillResponseSStructGridReassemble( void       *p_recv_contact_buf,
+                                         HYPRE_Int   contact_size,
+                                         HYPRE_Int   contact_proc,
+                                         void       *ro,
+                                         MPI_Comm    comm,
+                                         void      **p_send_response_buf,
+                                         HYPRE_Int  *response_message_size )
+{
+   hypre_DataExchangeResponse  *response_obj = (hypre_DataExchangeResponse *) ro;
+   hypre_SStructRegridExchange *exchange     = (hypre_SStructRegridExchange *)
+                                               response_obj -> data1;
+   HYPRE_Int                    overhead     = response_obj -> send_response_overhead;
+   HYPRE_Int                    nparts       = exchange -> nparts;
+   HYPRE_Int                   *my_starts    = exchange -> my_starts;
+   HYPRE_BigInt                *my_objs      = exchange -> my_objs;
+   HYPRE_BigInt                *recv_objs    = (HYPRE_BigInt *) p_recv_contact_buf;
+   HYPRE_BigInt                *send_objs    = (HYPRE_BigInt *) *p_send_response_buf;
+   HYPRE_Int                    len          = hypre_SSTRUCT_REGRID_OBJ_LEN;
+   HYPRE_Int                   *requested;
+   HYPRE_Int                    part, i, num, size;
+
+   HYPRE_UNUSED_VAR(contact_proc);
+   HYPRE_UNUSED_VAR(comm);
+
+   /* save the contact */
+   if ((exchange -> recv_size + contact_size) > (exchange -> recv_alloc))
+   {
+      exchange -> recv_alloc = 2 * (exchange -> recv_size + contact_size);
+      exchange -> recv_objs  = hypre_TReAlloc(exchange -> recv_objs, HYPRE_BigInt,
+                                              len * (exchange -> recv_alloc),
+                                              HYPRE_MEMORY_HOST);
+   }
+   hypre_TMemcpy(exchange -> recv_objs + len * (exchange -> recv_size), recv_objs,
+                 HYPRE_BigInt, len * contact_size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   exchange -> recv_size += contact_size;
+
+   /* respond with my boxes on the parts in the contact */
+   requested = hypre_CTAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   for (i = 0; i < contact_size; i++)
+   {
+      requested[recv_objs[len * i + hypre_SSTRUCT_REGRID_OBJ_PART]] = 1;
+   }
+   size = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      if (requested[part])
+      {
+         size += my_starts[part + 1] - my_starts[part];
+      }
+   }
+
+   if (response_obj -> send_response_storage < size)
+   {
+      response_obj -> send_response_storage = size;
+      send_objs = hypre_TReAlloc(send_objs, HYPRE_BigInt, len * (size + overhead),
+                                 HYPRE_MEMORY_HOST);
+      *p_send_response_buf = send_objs;
+   }
+
+   size = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      if (requested[part])
+      {
+         num = my_starts[part + 1] - my_starts[part];
+         hypre_TMemcpy(send_objs + len * size, my_objs + len * my_starts[part],
+                       HYPRE_BigInt, len * num, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         size += num;
+      }
+   }
+   hypre_TFree(requested, HYPRE_MEMORY_HOST);
+
+   *response_message_size = size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Add an entry to a re-assembled box manager, and to the box manager of the
+ * cell struct grid when 'sgrid_manager' is given.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructGridReassembleAddEntry( hypre_BoxManager *manager,
+                                     hypre_BoxManager *sgrid_manager,
+                                     hypre_Index       imin,
+                                     hypre_Index       imax,
+                                     HYPRE_Int         proc,
+                                     HYPRE_Int         id,
+                                     HYPRE_BigInt      offset,
+                                     HYPRE_BigInt      ghoffset )
+{
+   hypre_SStructBoxManInfo  info;
+
+   hypre_SStructBoxManInfoType(&info)     = hypre_SSTRUCT_BOXMAN_INFO_DEFAULT;
+   hypre_SStructBoxManInfoOffset(&info)   = offset;
+   hypre_SStructBoxManInfoGhoffset(&info) = ghoffset;
+   hypre_BoxManAddEntry(manager, imin, imax, proc, id, &info);
+   if (sgrid_manager)
+   {
+      hypre_BoxManAddEntry(sgrid_manager, imin, imax, proc, id, NULL);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Re-assemble the grid from scratch with the boxes in 'new_boxes'.  This is
+ * used when the incremental update in hypre_SStructGridReassemble does not
+ * apply.  The 'new_boxes' arrays are taken over by the cell struct grids.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructGridReassembleFull( hypre_SStructGrid  *grid,
+                                 hypre_BoxArray    **new_boxes )
+{
+   MPI_Comm                comm          = hypre_SStructGridComm(grid);
+   HYPRE_Int               ndim          = hypre_SStructGridNDim(grid);
+   HYPRE_Int               nparts        = hypre_SStructGridNParts(grid);
+   HYPRE_Int             **nvneighbors   = hypre_SStructGridNVNeighbors(grid);
+   hypre_SStructNeighbor ***vneighbors    = hypre_SStructGridVNeighbors(grid);
+   hypre_BoxManager     ***managers      = hypre_SStructGridBoxManagers(grid);
+   hypre_BoxManager     ***nbor_managers = hypre_SStructGridNborBoxManagers(grid);
+   hypre_SStructCommInfo **vnbor_comm_info = hypre_SStructGridVNborCommInfo(grid);
+   HYPRE_Int               vnbor_ncomms  = hypre_SStructGridVNborNComms(grid);
+   hypre_SStructPGrid     *pgrid;
+   hypre_StructGrid      **sgrids;
+   hypre_BoxArray        **iboxarrays;
+   hypre_StructGrid       *sgrid;
+   HYPRE_Int               nvars, part, var, t, i;
+
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid      = hypre_SStructGridPGrid(grid, part);
+      nvars      = hypre_SStructPGridNVars(pgrid);
+      sgrids     = hypre_SStructPGridSGrids(pgrid);
+      iboxarrays = hypre_SStructPGridIBoxArrays(pgrid);
+
+      for (var = 0; var < nvars; var++)
+      {
+         hypre_TFree(vneighbors[part][var], HYPRE_MEMORY_HOST);
+         hypre_BoxManDestroy(managers[part][var]);
+         hypre_BoxManDestroy(nbor_managers[part][var]);
+      }
+      hypre_TFree(nvneighbors[part], HYPRE_MEMORY_HOST);
+      hypre_TFree(vneighbors[part], HYPRE_MEMORY_HOST);
+      hypre_TFree(managers[part], HYPRE_MEMORY_HOST);
+      hypre_TFree(nbor_managers[part], HYPRE_MEMORY_HOST);
+
+      /* start over with an unassembled cell grid */
+      HYPRE_StructGridCreate(comm, ndim, &sgrid);
+      hypre_StructGridSetNumGhost(sgrid, hypre_StructGridNumGhost(sgrids[0]));
+      hypre_StructGridSetBoxes(sgrid, new_boxes[part]);
+      for (t = 0; t < 8; t++)
+      {
+         HYPRE_StructGridDestroy(sgrids[t]);
+         hypre_BoxArrayDestroy(iboxarrays[t]);
+         sgrids[t]     = NULL;
+         iboxarrays[t] = NULL;
+      }
+      hypre_SStructPGridCellSGrid(pgrid)     = sgrid;
+      hypre_SStructPGridCellSGridDone(pgrid) = 0;
+
+      hypre_BoxArraySetSize(hypre_SStructPGridPNeighbors(pgrid), 0);
+      hypre_TFree(hypre_SStructPGridPNborOffsets(pgrid), HYPRE_MEMORY_HOST);
+      hypre_SStructPGridLocalSize(pgrid)   = 0;
+      hypre_SStructPGridGlobalSize(pgrid)  = 0;
+      hypre_SStructPGridGhlocalSize(pgrid) = 0;
+   }
+   for (i = 0; i < vnbor_ncomms; i++)
+   {
+      hypre_CommInfoDestroy(hypre_SStructCommInfoCommInfo(vnbor_comm_info[i]));
+      hypre_TFree(vnbor_comm_info[i], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(vnbor_comm_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(nvneighbors, HYPRE_MEMORY_HOST);
+   hypre_TFree(vneighbors, HYPRE_MEMORY_HOST);
+   hypre_TFree(managers, HYPRE_MEMORY_HOST);
+   hypre_TFree(nbor_managers, HYPRE_MEMORY_HOST);
+
+   hypre_SStructGridBoxManagers(grid)     = NULL;
+   hypre_SStructGridNborBoxManagers(grid) = NULL;
+   hypre_SStructGridLocalSize(grid)       = 0;
+   hypre_SStructGridGlobalSize(grid)      = 0;
+   hypre_SStructGridGhlocalSize(grid)     = 0;
+
+   HYPRE_SStructGridAssemble(grid);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Apply the boxes added and removed since the last assemble.
+ *
+ * When all variables are cell-centered and there are no neighbor parts and
+ * no periodicity, the box managers are updated in place of a full assemble:
+ *
+ * 1. Each process that changed broadcasts its removed box ids, added boxes and
+ *    new offsets (the change records).  Entries of unchanged processes only
+ *    have their offsets shifted, and entries of changed processes are
+ *    renumbered from their records.  The box manager already holds all of the
+ *    boxes of every process that it knows about, so this is exact.
+ *
+ * 2. A process that adds a box near a process it did not know about before
+ *    contacts it with its box list and gets that process's list back.
+ *
+ * No assumed partition is built and no box manager gather is done.  In all
+ * other cases, the grid is re-assembled from scratch.
+ *
+ * Graph, matrix and vector objects created on the grid before this call refer
+ * to the old boxes and must be re-created.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructGridReassemble( hypre_SStructGrid *grid )
+{
+   MPI_Comm                 comm      = hypre_SStructGridComm(grid);
+   HYPRE_Int                ndim      = hypre_SStructGridNDim(grid);
+   HYPRE_Int                nparts    = hypre_SStructGridNParts(grid);
+   HYPRE_Int               *nneighbors = hypre_SStructGridNNeighbors(grid);
+   hypre_BoxManager      ***managers  = hypre_SStructGridBoxManagers(grid);
+   hypre_BoxManager      ***nbor_managers;
+   hypre_SStructCommInfo  **vnbor_comm_info;
+   HYPRE_Int                len       = hypre_SSTRUCT_REGRID_OBJ_LEN;
+   HYPRE_Int                info_size = sizeof(hypre_SStructBoxManInfo);
+
+   hypre_SStructPGrid      *pgrid;
+   HYPRE_SStructVariable   *vartypes;
+   HYPRE_Int                nvars;
+   hypre_StructGrid        *sgrid, *new_sgrid;
+   hypre_BoxArray         **new_boxes;
+   hypre_BoxArray          *boxes, *added_boxes, *removed_boxes;
+   hypre_Box               *box, *ghbox, *grow_box, *int_box, *bbox;
+   hypre_BoxManager        *sgrid_manager, *new_manager;
+   hypre_BoxManager      ***new_managers;
+   hypre_BoxManEntry      **entries, *all_entries, *entry;
+   hypre_SStructBoxManInfo *info;
+   HYPRE_Int                nentries;
+   HYPRE_Int               *num_ghost;
+   hypre_IndexRef           max_distance;
+   hypre_Index              imin, imax;
+
+   HYPRE_Int                myid, nprocs, eligible, changed, found;
+   HYPRE_Int              **removed, *nremoved, *marker;
+   HYPRE_Int               *sizes, *ghsizes, *known;
+   HYPRE_BigInt            *offsets, *ghoffsets, *gdsizes;
+   HYPRE_BigInt             local_size, ghlocal_size, start, ghstart;
+   HYPRE_BigInt             sendbig[2], recvbig[2];
+   HYPRE_Int               *sendbuf, *recvbuf, nbuf;
+
+   /* change records */
+   HYPRE_BigInt            *rec, *all_recs, *r;
+   HYPRE_Int                rec_size, *rec_counts, *rec_displs;
+   HYPRE_Int                nchanged, *changed_procs, *changed_index, *rec_ptrs;
+   HYPRE_BigInt            *dstart, *dghstart, dtotal, dghtotal;
+
+   /* new neighbor exchange */
+   hypre_SStructRegridExchange  exchange;
+   hypre_DataExchangeResponse   response_obj;
+   HYPRE_Int                   *my_starts;
+   HYPRE_BigInt                *my_objs, *obj;
+   HYPRE_Int                  **rep_procs, *nrep_procs;
+   HYPRE_Int                   *contact_flags, ncontacts, *contact_procs;
+   HYPRE_Int                   *contact_starts, max_response_size;
+   HYPRE_BigInt                *contact_buf, *response_buf;
+   HYPRE_Int                   *response_starts;
+   HYPRE_Int                    nresponse;
+
+   HYPRE_Int                part, var, proc, id, b, c, d, i, j, k, e, f, n;
+   HYPRE_Int                nkept, nadded, nrem;
+   HYPRE_BigInt             running, ghrunning;
+
+   if (managers == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Grid must be assembled before re-assembling");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &nprocs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   box      = hypre_BoxCreate(ndim);
+   ghbox    = hypre_BoxCreate(ndim);
+   grow_box = hypre_BoxCreate(ndim);
+   int_box  = hypre_BoxCreate(ndim);
+
+   /*-------------------------------------------------------------
+    * Compute the new local box lists.  The removed boxes keep
+    * their ids in the records, the added boxes go at the end.
+    *-------------------------------------------------------------*/
+
+   new_boxes = hypre_TAlloc(hypre_BoxArray *, nparts, HYPRE_MEMORY_HOST);
+   removed   = hypre_TAlloc(HYPRE_Int *, nparts, HYPRE_MEMORY_HOST);
+   nremoved  = hypre_CTAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   eligible  = 1;
+   changed   = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid         = hypre_SStructGridPGrid(grid, part);
+      nvars         = hypre_SStructPGridNVars(pgrid);
+      vartypes      = hypre_SStructPGridVarTypes(pgrid);
+      sgrid         = hypre_SStructPGridCellSGrid(pgrid);
+      boxes         = hypre_StructGridBoxes(sgrid);
+      added_boxes   = hypre_SStructPGridAddedBoxes(pgrid);
+      removed_boxes = hypre_SStructPGridRemovedBoxes(pgrid);
+
+      for (var = 0; var < nvars; var++)
+      {
+         if (vartypes[var] != HYPRE_SSTRUCT_VARIABLE_CELL)
+         {
+            eligible = 0;
+         }
+      }
+      if (nneighbors[part] > 0 ||
+          !hypre_IndexEqual(hypre_SStructPGridPeriodic(pgrid), 0, ndim) ||
+          hypre_IndexEqual(hypre_StructGridMaxDistance(sgrid), 0, ndim))
+      {
+         eligible = 0;
+      }
+
+      marker = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+      hypre_ForBoxI(b, removed_boxes)
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(removed_boxes, b), box);
+         hypre_BoxManIntersect(hypre_StructGridBoxMan(sgrid),
+                               hypre_BoxIMin(box), hypre_BoxIMin(box), &entries, &nentries);
+         found = 0;
+         for (i = 0; i < nentries; i++)
+         {
+            if (hypre_BoxManEntryProc(entries[i]) == myid &&
+                hypre_IndexesEqual(hypre_BoxManEntryIMin(entries[i]), hypre_BoxIMin(box), ndim) &&
+                hypre_IndexesEqual(hypre_BoxManEntryIMax(entries[i]), hypre_BoxIMax(box), ndim))
+            {
+               id = hypre_BoxManEntryId(entries[i]);
+               if (!marker[id])
+               {
+                  marker[id] = 1;
+                  nremoved[part]++;
+                  found = 1;
+               }
+            }
+         }
+         hypre_TFree(entries, HYPRE_MEMORY_HOST);
+         if (!found)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Removed box is not a local box of the grid");
+         }
+      }
+
+      removed[part]   = hypre_TAlloc(HYPRE_Int, nremoved[part], HYPRE_MEMORY_HOST);
+      new_boxes[part] = hypre_BoxArrayCreate(0, ndim);
+      k = 0;
+      hypre_ForBoxI(b, boxes)
+      {
+         if (marker[b])
+         {
+            removed[part][k++] = b;
+         }
+         else
+         {
+            hypre_AppendBox(hypre_BoxArrayBox(boxes, b), new_boxes[part]);
+         }
+      }
+      hypre_AppendBoxArray(added_boxes, new_boxes[part]);
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+      if (nremoved[part] || hypre_BoxArraySize(added_boxes))
+      {
+         changed = 1;
+      }
+   }
+
+   /*-------------------------------------------------------------
+    * One reduction for the new bounding boxes, the incremental
+    * check, and the largest local box list (for the exchange)
+    *-------------------------------------------------------------*/
+
+   nbuf = 2 + 2 * ndim * nparts;
+   sendbuf = hypre_TAlloc(HYPRE_Int, nbuf, HYPRE_MEMORY_HOST);
+   recvbuf = hypre_TAlloc(HYPRE_Int, nbuf, HYPRE_MEMORY_HOST);
+   sendbuf[0] = eligible;
+   sendbuf[1] = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      j = 2 + 2 * ndim * part;
+      for (d = 0; d < ndim; d++)
+      {
+         sendbuf[j + d]        =  hypre_pow2(30);
+         sendbuf[j + ndim + d] =  hypre_pow2(30);
+      }
+      hypre_ForBoxI(b, new_boxes[part])
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(new_boxes[part], b), box);
+         for (d = 0; d < ndim; d++)
+         {
+            sendbuf[j + d]        = hypre_min(sendbuf[j + d], hypre_BoxIMinD(box, d));
+            sendbuf[j + ndim + d] = hypre_min(sendbuf[j + ndim + d], -hypre_BoxIMaxD(box, d));
+         }
+      }
+      sendbuf[1] -= hypre_BoxArraySize(new_boxes[part]);
+   }
+   hypre_MPI_Allreduce(sendbuf, recvbuf, nbuf, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   eligible          = recvbuf[0];
+   max_response_size = hypre_max(-recvbuf[1], 1);
+
+   if (!eligible)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid = hypre_SStructGridPGrid(grid, part);
+         hypre_BoxArraySetSize(hypre_SStructPGridAddedBoxes(pgrid), 0);
+         hypre_BoxArraySetSize(hypre_SStructPGridRemovedBoxes(pgrid), 0);
+         hypre_TFree(removed[part], HYPRE_MEMORY_HOST);
+      }
+      hypre_SStructGridReassembleFull(grid, new_boxes);
+
+      hypre_TFree(new_boxes, HYPRE_MEMORY_HOST);
+      hypre_TFree(removed, HYPRE_MEMORY_HOST);
+      hypre_TFree(nremoved, HYPRE_MEMORY_HOST);
+      hypre_TFree(sendbuf, HYPRE_MEMORY_HOST);
+      hypre_TFree(recvbuf, HYPRE_MEMORY_HOST);
+      hypre_BoxDestroy(box);
+      hypre_BoxDestroy(ghbox);
+      hypre_BoxDestroy(grow_box);
+      hypre_BoxDestroy(int_box);
+
+      return hypre_error_flag;
+   }
+
+   /*-------------------------------------------------------------
+    * New local sizes and offsets (the offsets run over parts,
+    * then variables, then boxes, as in AssembleBoxManagers)
+    *-------------------------------------------------------------*/
+
+   sizes     = hypre_CTAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   ghsizes   = hypre_CTAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   offsets   = hypre_TAlloc(HYPRE_BigInt, nparts, HYPRE_MEMORY_HOST);
+   ghoffsets = hypre_TAlloc(HYPRE_BigInt, nparts, HYPRE_MEMORY_HOST);
+   local_size   = 0;
+   ghlocal_size = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid     = hypre_SStructGridPGrid(grid, part);
+      num_ghost = hypre_StructGridNumGhost(hypre_SStructPGridCellSGrid(pgrid));
+      hypre_ForBoxI(b, new_boxes[part])
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(new_boxes[part], b), ghbox);
+         sizes[part] += hypre_BoxVolume(ghbox);
+         hypre_BoxGrowByArray(ghbox, num_ghost);
+         ghsizes[part] += hypre_BoxVolume(ghbox);
+      }
+      local_size   += (HYPRE_BigInt) hypre_SStructPGridNVars(pgrid) * sizes[part];
+      ghlocal_size += (HYPRE_BigInt) hypre_SStructPGridNVars(pgrid) * ghsizes[part];
+   }
+   sendbig[0] = local_size;
+   sendbig[1] = ghlocal_size;
+   hypre_MPI_Scan(sendbig, recvbig, 2, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   start   = recvbig[0] - local_size;
+   ghstart = recvbig[1] - ghlocal_size;
+   for (part = 0; part < nparts; part++)
+   {
+      nvars = hypre_SStructPGridNVars(hypre_SStructGridPGrid(grid, part));
+      offsets[part]   = start;
+      ghoffsets[part] = ghstart;
+      start   += (HYPRE_BigInt) nvars * sizes[part];
+      ghstart += (HYPRE_BigInt) nvars * ghsizes[part];
+   }
+   start   = recvbig[0] - local_size;
+   ghstart = recvbig[1] - ghlocal_size;
+
+   /*-------------------------------------------------------------
+    * Exchange the change records.  For each part a record holds
+    *
+    *   old size, size, old ghost size, ghost size, offset, ghost
+    *   offset, old number of boxes, number removed, number added,
+    *   removed ids, added box extents
+    *-------------------------------------------------------------*/
+
+   rec_size = 0;
+   if (changed)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         added_boxes = hypre_SStructPGridAddedBoxes(hypre_SStructGridPGrid(grid, part));
+         rec_size += 9 + nremoved[part] + 2 * ndim * hypre_BoxArraySize(added_boxes);
+      }
+   }
+   rec = hypre_TAlloc(HYPRE_BigInt, rec_size, HYPRE_MEMORY_HOST);
+   if (changed)
+   {
+      r = rec;
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid       = hypre_SStructGridPGrid(grid, part);
+         sgrid       = hypre_SStructPGridCellSGrid(pgrid);
+         added_boxes = hypre_SStructPGridAddedBoxes(pgrid);
+         r[0] = hypre_StructGridLocalSize(sgrid);
+         r[1] = sizes[part];
+         r[2] = hypre_StructGridGhlocalSize(sgrid);
+         r[3] = ghsizes[part];
+         r[4] = offsets[part];
+         r[5] = ghoffsets[part];
+         r[6] = hypre_StructGridNumBoxes(sgrid);
+         r[7] = nremoved[part];
+         r[8] = hypre_BoxArraySize(added_boxes);
+         r += 9;
+         for (i = 0; i < nremoved[part]; i++)
+         {
+            *r++ = removed[part][i];
+         }
+         hypre_ForBoxI(b, added_boxes)
+         {
+            for (d = 0; d < ndim; d++)
+            {
+               *r++ = hypre_BoxIMinD(hypre_BoxArrayBox(added_boxes, b), d);
+            }
+            for (d = 0; d < ndim; d++)
+            {
+               *r++ = hypre_BoxIMaxD(hypre_BoxArrayBox(added_boxes, b), d);
+            }
+         }
+      }
+   }
+
+   rec_counts = hypre_TAlloc(HYPRE_Int, nprocs, HYPRE_MEMORY_HOST);
+   rec_displs = hypre_TAlloc(HYPRE_Int, nprocs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&rec_size, 1, HYPRE_MPI_INT, rec_counts, 1, HYPRE_MPI_INT, comm);
+   rec_displs[0] = 0;
+   nchanged = 0;
+   for (proc = 0; proc < nprocs; proc++)
+   {
+      rec_displs[proc + 1] = rec_displs[proc] + rec_counts[proc];
+      nchanged += (rec_counts[proc] > 0);
+   }
+   all_recs = hypre_TAlloc(HYPRE_BigInt, rec_displs[nprocs], HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgatherv(rec, rec_size, HYPRE_MPI_BIG_INT,
+                        all_recs, rec_counts, rec_displs, HYPRE_MPI_BIG_INT, comm);
+
+   /* Index the records and accumulate the shifts of the offsets */
+   changed_procs = hypre_TAlloc(HYPRE_Int, nchanged, HYPRE_MEMORY_HOST);
+   changed_index = hypre_TAlloc(HYPRE_Int, nprocs, HYPRE_MEMORY_HOST);
+   rec_ptrs      = hypre_TAlloc(HYPRE_Int, nchanged * nparts, HYPRE_MEMORY_HOST);
+   dstart        = hypre_TAlloc(HYPRE_BigInt, nprocs, HYPRE_MEMORY_HOST);
+   dghstart      = hypre_TAlloc(HYPRE_BigInt, nprocs, HYPRE_MEMORY_HOST);
+   gdsizes       = hypre_CTAlloc(HYPRE_BigInt, nparts, HYPRE_MEMORY_HOST);
+   dtotal   = 0;
+   dghtotal = 0;
+   c = 0;
+   for (proc = 0; proc < nprocs; proc++)
+   {
+      dstart[proc]   = dtotal;
+      dghstart[proc] = dghtotal;
+      changed_index[proc] = -1;
+      if (rec_counts[proc] > 0)
+      {
+         changed_procs[c]    = proc;
+         changed_index[proc] = c;
+         k = rec_displs[proc];
+         for (part = 0; part < nparts; part++)
+         {
+            nvars = hypre_SStructPGridNVars(hypre_SStructGridPGrid(grid, part));
+            r = &all_recs[k];
+            rec_ptrs[c * nparts + part] = k;
+            dtotal   += nvars * (r[1] - r[0]);
+            dghtotal += nvars * (r[3] - r[2]);
+            gdsizes[part] += r[1] - r[0];
+            k += 9 + (HYPRE_Int) r[7] + 2 * ndim * (HYPRE_Int) r[8];
+         }
+         c++;
+      }
+   }
+
+   /*-------------------------------------------------------------
+    * Processes known to each box manager (entries are sorted by
+    * process and id after assembly)
+    *-------------------------------------------------------------*/
+
+   rep_procs  = hypre_TAlloc(HYPRE_Int *, nparts, HYPRE_MEMORY_HOST);
+   nrep_procs = hypre_CTAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   known      = hypre_TAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_BoxManGetAllGlobalKnown(managers[part][0], &known[part]);
+      hypre_BoxManGetAllEntries(managers[part][0], &nentries, &all_entries);
+      rep_procs[part] = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+      for (e = 0; e < nentries; e++)
+      {
+         proc = hypre_BoxManEntryProc(&all_entries[e]);
+         if (nrep_procs[part] == 0 || rep_procs[part][nrep_procs[part] - 1] != proc)
+         {
+            rep_procs[part][nrep_procs[part]++] = proc;
+         }
+      }
+   }
+
+   /*-------------------------------------------------------------
+    * My new boxes as exchange objects
+    *-------------------------------------------------------------*/
+
+   my_starts = hypre_TAlloc(HYPRE_Int, nparts + 1, HYPRE_MEMORY_HOST);
+   my_starts[0] = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      my_starts[part + 1] = my_starts[part] + hypre_BoxArraySize(new_boxes[part]);
+   }
+   my_objs = hypre_CTAlloc(HYPRE_BigInt, len * my_starts[nparts], HYPRE_MEMORY_HOST);
+   for (part = 0; part < nparts; part++)
+   {
+      num_ghost = hypre_StructGridNumGhost(
+                     hypre_SStructPGridCellSGrid(hypre_SStructGridPGrid(grid, part)));
+      running   = offsets[part];
+      ghrunning = ghoffsets[part];
+      hypre_ForBoxI(b, new_boxes[part])
+      {
+         obj = &my_objs[len * (my_starts[part] + b)];
+         hypre_CopyBox(hypre_BoxArrayBox(new_boxes[part], b), ghbox);
+         obj[hypre_SSTRUCT_REGRID_OBJ_PROC]     = myid;
+         obj[hypre_SSTRUCT_REGRID_OBJ_PART]     = part;
+         obj[hypre_SSTRUCT_REGRID_OBJ_ID]       = b;
+         obj[hypre_SSTRUCT_REGRID_OBJ_OFFSET]   = running;
+         obj[hypre_SSTRUCT_REGRID_OBJ_GHOFFSET] = ghrunning;
+         obj[hypre_SSTRUCT_REGRID_OBJ_SIZE]     = sizes[part];
+         obj[hypre_SSTRUCT_REGRID_OBJ_GHSIZE]   = ghsizes[part];
+         for (d = 0; d < ndim; d++)
+         {
+            obj[hypre_SSTRUCT_REGRID_OBJ_IMIN + d] = hypre_BoxIMinD(ghbox, d);
+            obj[hypre_SSTRUCT_REGRID_OBJ_IMAX + d] = hypre_BoxIMaxD(ghbox, d);
+         }
+         running += hypre_BoxVolume(ghbox);
+         hypre_BoxGrowByArray(ghbox, num_ghost);
+         ghrunning += hypre_BoxVolume(ghbox);
+      }
+   }
+
+   /*-------------------------------------------------------------
+    * Contact the processes whose added boxes are near my boxes
+    * and that the box manager did not know about
+    *-------------------------------------------------------------*/
+
+   contact_flags = hypre_CTAlloc(HYPRE_Int, nchanged * nparts, HYPRE_MEMORY_HOST);
+   for (part = 0; part < nparts; part++)
+   {
+      if (known[part] || hypre_BoxArraySize(new_boxes[part]) == 0)
+      {
+         continue;
+      }
+      max_distance = hypre_StructGridMaxDistance(
+                        hypre_SStructPGridCellSGrid(hypre_SStructGridPGrid(grid, part)));
+
+      /* bounding box of my grown boxes, for a quick test */
+      bbox = hypre_BoxCreate(ndim);
+      hypre_ForBoxI(b, new_boxes[part])
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(new_boxes[part], b), grow_box);
+         hypre_BoxGrowByIndex(grow_box, max_distance);
+         if (b == 0)
+         {
+            hypre_CopyBox(grow_box, bbox);
+         }
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(bbox, d) = hypre_min(hypre_BoxIMinD(bbox, d),
+                                                hypre_BoxIMinD(grow_box, d));
+            hypre_BoxIMaxD(bbox, d) = hypre_max(hypre_BoxIMaxD(bbox, d),
+                                                hypre_BoxIMaxD(grow_box, d));
+         }
+      }
+
+      for (c = 0; c < nchanged; c++)
+      {
+         proc = changed_procs[c];
+         if (proc == myid ||
+             hypre_BinarySearch(rep_procs[part], proc, nrep_procs[part]) > -1)
+         {
+            continue;
+         }
+         r = &all_recs[rec_ptrs[c * nparts + part]];
+         r += 9 + r[7];
+         nadded = (HYPRE_Int) all_recs[rec_ptrs[c * nparts + part] + 8];
+         for (i = 0; i < nadded && !contact_flags[c * nparts + part]; i++)
+         {
+            for (d = 0; d < ndim; d++)
+            {
+               imin[d] = (HYPRE_Int) r[2 * ndim * i + d];
+               imax[d] = (HYPRE_Int) r[2 * ndim * i + ndim + d];
+            }
+            hypre_BoxSetExtents(box, imin, imax);
+            hypre_IntersectBoxes(box, bbox, int_box);
+            if (hypre_BoxVolume(int_box) == 0)
+            {
+               continue;
+            }
+            hypre_ForBoxI(b, new_boxes[part])
+            {
+               hypre_CopyBox(hypre_BoxArrayBox(new_boxes[part], b), grow_box);
+               hypre_BoxGrowByIndex(grow_box, max_distance);
+               hypre_IntersectBoxes(box, grow_box, int_box);
+               if (hypre_BoxVolume(int_box) > 0)
+               {
+                  contact_flags[c * nparts + part] = 1;
+                  break;
+               }
+            }
+         }
+      }
+      hypre_BoxDestroy(bbox);
+   }
+
+   contact_procs  = hypre_TAlloc(HYPRE_Int, nchanged, HYPRE_MEMORY_HOST);
+   contact_starts = hypre_TAlloc(HYPRE_Int, nchanged + 1, HYPRE_MEMORY_HOST);
+   ncontacts = 0;
+   contact_starts[0] = 0;
+   for (c = 0; c < nchanged; c++)
+   {
+      n = 0;
+      for (part = 0; part < nparts; part++)
+      {
+         if (contact_flags[c * nparts + part])
+         {
+            n += my_starts[part + 1] - my_starts[part];
+         }
+      }
+      if (n > 0)
+      {
+         contact_procs[ncontacts] = changed_procs[c];
+         contact_starts[ncontacts + 1] = contact_starts[ncontacts] + n;
+         ncontacts++;
+      }
+   }
+   contact_buf = hypre_TAlloc(HYPRE_BigInt, len * contact_starts[ncontacts], HYPRE_MEMORY_HOST);
+   n = 0;
+   for (c = 0; c < nchanged; c++)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         if (contact_flags[c * nparts + part])
+         {
+            k = my_starts[part + 1] - my_starts[part];
+            hypre_TMemcpy(contact_buf + len * n, my_objs + len * my_starts[part],
+                          HYPRE_BigInt, len * k, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            n += k;
+         }
+      }
+   }
+
+   exchange.nparts     = nparts;
+   exchange.my_starts  = my_starts;
+   exchange.my_objs    = my_objs;
+   exchange.recv_size  = 0;
+   exchange.recv_alloc = 0;
+   exchange.recv_objs  = NULL;
+
+   response_buf    = NULL;
+   response_starts = NULL;
+   nresponse       = 0;
+   if (nprocs > 1)
+   {
+      response_obj.fill_response = hypre_FillResponseSStructGridReassemble;
+      response_obj.data1 = &exchange;
+      response_obj.data2 = NULL;
+
+      hypre_DataExchangeList(ncontacts, contact_procs,
+                             contact_buf, contact_starts, len * sizeof(HYPRE_BigInt),
+                             len * sizeof(HYPRE_BigInt), &response_obj,
+                             max_response_size, 5, comm,
+                             (void **) &response_buf, &response_starts);
+      nresponse = response_starts[ncontacts];
+   }
+
+   /*-------------------------------------------------------------
+    * Build the new box managers
+    *-------------------------------------------------------------*/
+
+   new_managers = hypre_TAlloc(hypre_BoxManager **, nparts, HYPRE_MEMORY_HOST);
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid        = hypre_SStructGridPGrid(grid, part);
+      nvars        = hypre_SStructPGridNVars(pgrid);
+      sgrid        = hypre_SStructPGridCellSGrid(pgrid);
+      num_ghost    = hypre_StructGridNumGhost(sgrid);
+      boxes        = new_boxes[part];
+
+      /* new bounding box */
+      bbox = hypre_BoxCreate(ndim);
+      j = 2 + 2 * ndim * part;
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_BoxIMinD(bbox, d) =  recvbuf[j + d];
+         hypre_BoxIMaxD(bbox, d) = -recvbuf[j + ndim + d];
+      }
+
+      new_managers[part] = hypre_TAlloc(hypre_BoxManager *, nvars, HYPRE_MEMORY_HOST);
+      for (var = 0; var < nvars; var++)
+      {
+         hypre_BoxManGetAllEntries(managers[part][var], &nentries, &all_entries);
+         n = nentries + hypre_BoxArraySize(boxes) + nresponse + exchange.recv_size;
+         hypre_BoxManCreate(n, info_size, ndim, bbox, comm, &new_manager);
+         hypre_BoxManSetNumGhost(new_manager, num_ghost);
+         hypre_BoxManSetAllGlobalKnown(new_manager, known[part]);
+         sgrid_manager = NULL;
+         if (var == 0)
+         {
+            hypre_BoxManCreate(n, 0, ndim, bbox, comm, &sgrid_manager);
+            hypre_BoxManSetAllGlobalKnown(sgrid_manager, known[part]);
+         }
+
+         /* my boxes */
+         running   = offsets[part] + (HYPRE_BigInt) var * sizes[part];
+         ghrunning = ghoffsets[part] + (HYPRE_BigInt) var * ghsizes[part];
+         hypre_ForBoxI(b, boxes)
+         {
+            hypre_CopyBox(hypre_BoxArrayBox(boxes, b), ghbox);
+            hypre_SStructGridReassembleAddEntry(new_manager, sgrid_manager,
+                                                hypre_BoxIMin(ghbox), hypre_BoxIMax(ghbox),
+                                                myid, b, running, ghrunning);
+            running += hypre_BoxVolume(ghbox);
+            hypre_BoxGrowByArray(ghbox, num_ghost);
+            ghrunning += hypre_BoxVolume(ghbox);
+         }
+
+         /* boxes of the processes the box manager already knows */
+         for (e = 0; e < nentries; e = f)
+         {
+            proc = hypre_BoxManEntryProc(&all_entries[e]);
+            for (f = e + 1; f < nentries; f++)
+            {
+               if (hypre_BoxManEntryProc(&all_entries[f]) != proc)
+               {
+                  break;
+               }
+            }
+            if (proc == myid)
+            {
+               continue;
+            }
+
+            c = changed_index[proc];
+            if (c < 0)
+            {
+               /* unchanged process: only the offsets move */
+               for (i = e; i < f; i++)
+               {
+                  entry = &all_entries[i];
+                  hypre_BoxManEntryGetInfo(entry, (void **) &info);
+                  hypre_SStructGridReassembleAddEntry(
+                     new_manager, sgrid_manager,
+                     hypre_BoxManEntryIMin(entry), hypre_BoxManEntryIMax(entry),
+                     proc, hypre_BoxManEntryId(entry),
+                     hypre_SStructBoxManInfoOffset(info) + dstart[proc],
+                     hypre_SStructBoxManInfoGhoffset(info) + dghstart[proc]);
+               }
+               continue;
+            }
+
+            /* changed process: drop the removed boxes, renumber the rest
+               and append the added boxes */
+            r    = &all_recs[rec_ptrs[c * nparts + part]];
+            nrem = (HYPRE_Int) r[7];
+            running   = r[4] + var * r[1];
+            ghrunning = r[5] + var * r[3];
+            k = 0;
+            for (i = e; i < f; i++)
+            {
+               entry = &all_entries[i];
+               id = hypre_BoxManEntryId(entry);
+               while (k < nrem && r[9 + k] < id)
+               {
+                  k++;
+               }
+               if (k < nrem && r[9 + k] == id)
+               {
+                  continue;
+               }
+               hypre_BoxSetExtents(ghbox, hypre_BoxManEntryIMin(entry),
+                                   hypre_BoxManEntryIMax(entry));
+               hypre_SStructGridReassembleAddEntry(new_manager, sgrid_manager,
+                                                   hypre_BoxIMin(ghbox), hypre_BoxIMax(ghbox),
+                                                   proc, id - k, running, ghrunning);
+               running += hypre_BoxVolume(ghbox);
+               hypre_BoxGrowByArray(ghbox, num_ghost);
+               ghrunning += hypre_BoxVolume(ghbox);
+            }
+            nkept  = (HYPRE_Int) (r[6] - r[7]);
+            nadded = (HYPRE_Int) r[8];
+            r += 9 + nrem;
+            for (i = 0; i < nadded; i++)
+            {
+               for (d = 0; d < ndim; d++)
+               {
+                  imin[d] = (HYPRE_Int) r[2 * ndim * i + d];
+                  imax[d] = (HYPRE_Int) r[2 * ndim * i + ndim + d];
+               }
+               hypre_BoxSetExtents(ghbox, imin, imax);
+               hypre_SStructGridReassembleAddEntry(new_manager, sgrid_manager,
+                                                   hypre_BoxIMin(ghbox), hypre_BoxIMax(ghbox),
+                                                   proc, nkept + i, running, ghrunning);
+               running += hypre_BoxVolume(ghbox);
+               hypre_BoxGrowByArray(ghbox, num_ghost);
+               ghrunning += hypre_BoxVolume(ghbox);
+            }
+         }
+
+         /* processes that are new to the box manager */
+         if (known[part])
+         {
+            /* everything is known: such a process had no boxes before */
+            for (c = 0; c < nchanged; c++)
+            {
+               proc = changed_procs[c];
+               if (proc == myid ||
+                   hypre_BinarySearch(rep_procs[part], proc, nrep_procs[part]) > -1)
+               {
+                  continue;
+               }
+               r = &all_recs[rec_ptrs[c * nparts + part]];
+               running   = r[4] + var * r[1];
+               ghrunning = r[5] + var * r[3];
+               nkept  = (HYPRE_Int) (r[6] - r[7]);
+               nadded = (HYPRE_Int) r[8];
+               r += 9 + r[7];
+               for (i = 0; i < nadded; i++)
+               {
+                  for (d = 0; d < ndim; d++)
+                  {
+                     imin[d] = (HYPRE_Int) r[2 * ndim * i + d];
+                     imax[d] = (HYPRE_Int) r[2 * ndim * i + ndim + d];
+                  }
+                  hypre_BoxSetExtents(ghbox, imin, imax);
+                  hypre_SStructGridReassembleAddEntry(new_manager, sgrid_manager,
+                                                      hypre_BoxIMin(ghbox), hypre_BoxIMax(ghbox),
+                                                      proc, nkept + i, running, ghrunning);
+                  running += hypre_BoxVolume(ghbox);
+                  hypre_BoxGrowByArray(ghbox, num_ghost);
+                  ghrunning += hypre_BoxVolume(ghbox);
+               }
+            }
+         }
+         else
+         {
+            /* full box lists from the exchange: all responses, and the
+               contacts from processes that we did not contact ourselves */
+            for (i = 0; i < nresponse + exchange.recv_size; i++)
+            {
+               if (i < nresponse)
+               {
+                  obj = &response_buf[len * i];
+               }
+               else
+               {
+                  obj = &exchange.recv_objs[len * (i - nresponse)];
+               }
+               proc = (HYPRE_Int) obj[hypre_SSTRUCT_REGRID_OBJ_PROC];
+               if (obj[hypre_SSTRUCT_REGRID_OBJ_PART] != part ||
+                   hypre_BinarySearch(rep_procs[part], proc, nrep_procs[part]) > -1)
+               {
+                  continue;
+               }
+               if (i >= nresponse)
+               {
+                  c = changed_index[proc];
+                  if (c > -1 && contact_flags[c * nparts + part])
+                  {
+                     continue;
+                  }
+               }
+               for (d = 0; d < ndim; d++)
+               {
+                  imin[d] = (HYPRE_Int) obj[hypre_SSTRUCT_REGRID_OBJ_IMIN + d];
+                  imax[d] = (HYPRE_Int) obj[hypre_SSTRUCT_REGRID_OBJ_IMAX + d];
+               }
+               hypre_SStructGridReassembleAddEntry(
+                  new_manager, sgrid_manager, imin, imax, proc,
+                  (HYPRE_Int) obj[hypre_SSTRUCT_REGRID_OBJ_ID],
+                  obj[hypre_SSTRUCT_REGRID_OBJ_OFFSET] +
+                  var * obj[hypre_SSTRUCT_REGRID_OBJ_SIZE],
+                  obj[hypre_SSTRUCT_REGRID_OBJ_GHOFFSET] +
+                  var * obj[hypre_SSTRUCT_REGRID_OBJ_GHSIZE]);
+            }
+         }
+
+         hypre_BoxManAssemble(new_manager);
+         new_managers[part][var] = new_manager;
+
+         /* the struct grid assembles its own box manager */
+         if (var == 0)
+         {
+            HYPRE_StructGridCreate(comm, ndim, &new_sgrid);
+            hypre_StructGridSetNumGhost(new_sgrid, num_ghost);
+            hypre_StructGridSetMaxDistance(new_sgrid, hypre_StructGridMaxDistance(sgrid));
+            hypre_StructGridSetBoxes(new_sgrid, boxes);
+            hypre_StructGridSetBoundingBox(new_sgrid, bbox);
+            hypre_StructGridSetBoxManager(new_sgrid, sgrid_manager);
+            hypre_StructGridAssemble(new_sgrid);
+            hypre_StructGridGlobalSize(new_sgrid) =
+               hypre_StructGridGlobalSize(sgrid) + gdsizes[part];
+         }
+      }
+      hypre_BoxDestroy(bbox);
+
+      /* swap in the new cell grid */
+      for (var = 0; var < nvars; var++)
+      {
+         hypre_BoxManDestroy(managers[part][var]);
+      }
+      hypre_TFree(managers[part], HYPRE_MEMORY_HOST);
+
+      HYPRE_StructGridDestroy(sgrid);
+      hypre_SStructPGridCellSGrid(pgrid) = new_sgrid;
+      hypre_BoxArrayDestroy(hypre_SStructPGridCellIBoxArray(pgrid));
+      hypre_SStructPGridCellIBoxArray(pgrid) =
+         hypre_BoxArrayDuplicate(hypre_StructGridBoxes(new_sgrid));
+
+      hypre_SStructPGridLocalSize(pgrid)   = nvars * sizes[part];
+      hypre_SStructPGridGlobalSize(pgrid)  = nvars * hypre_StructGridGlobalSize(new_sgrid);
+      hypre_SStructPGridGhlocalSize(pgrid) = nvars * ghsizes[part];
+
+      hypre_BoxArraySetSize(hypre_SStructPGridAddedBoxes(pgrid), 0);
+      hypre_BoxArraySetSize(hypre_SStructPGridRemovedBoxes(pgrid), 0);
+   }
+   hypre_TFree(managers, HYPRE_MEMORY_HOST);
+   hypre_SStructGridBoxManagers(grid) = new_managers;
+
+   /*-------------------------------------------------------------
+    * Sizes, then the neighbor box managers and the communication
+    * info, which are local to each process
+    *-------------------------------------------------------------*/
+
+   hypre_SStructGridLocalSize(grid)   = (HYPRE_Int) local_size;
+   hypre_SStructGridGhlocalSize(grid) = (HYPRE_Int) ghlocal_size;
+   hypre_SStructGridStartRank(grid)   = start;
+   hypre_SStructGridGhstartRank(grid) = ghstart;
+   hypre_SStructGridGlobalSize(grid)  = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_SStructGridGlobalSize(grid) +=
+         hypre_SStructPGridGlobalSize(hypre_SStructGridPGrid(grid, part));
+   }
+
+   nbor_managers = hypre_SStructGridNborBoxManagers(grid);
+   for (part = 0; part < nparts; part++)
+   {
+      nvars = hypre_SStructPGridNVars(hypre_SStructGridPGrid(grid, part));
+      for (var = 0; var < nvars; var++)
+      {
+         hypre_BoxManDestroy(nbor_managers[part][var]);
+      }
+      hypre_TFree(nbor_managers[part], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(nbor_managers, HYPRE_MEMORY_HOST);
+   hypre_SStructGridAssembleNborBoxManagers(grid);
+
+   vnbor_comm_info = hypre_SStructGridVNborCommInfo(grid);
+   for (i = 0; i < hypre_SStructGridVNborNComms(grid); i++)
+   {
+      hypre_CommInfoDestroy(hypre_SStructCommInfoCommInfo(vnbor_comm_info[i]));
+      hypre_TFree(vnbor_comm_info[i], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(vnbor_comm_info, HYPRE_MEMORY_HOST);
+   hypre_SStructGridCreateCommInfo(grid);
+
+   /*-------------------------------------------------------------
+    * Free memory
+    *-------------------------------------------------------------*/
+
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_TFree(removed[part], HYPRE_MEMORY_HOST);
+      hypre_TFree(rep_procs[part], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(new_boxes, HYPRE_MEMORY_HOST);
+   hypre_TFree(removed, HYPRE_MEMORY_HOST);
+   hypre_TFree(nremoved, HYPRE_MEMORY_HOST);
+   hypre_TFree(sendbuf, HYPRE_MEMORY_HOST);
+   hypre_TFree(recvbuf, HYPRE_MEMORY_HOST);
+   hypre_TFree(sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(ghsizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(ghoffsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(gdsizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(rec, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_recs, HYPRE_MEMORY_HOST);
+   hypre_TFree(rec_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(rec_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(changed_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(changed_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(rec_ptrs, HYPRE_MEMORY_HOST);
+   hypre_TFree(dstart, HYPRE_MEMORY_HOST);
+   hypre_TFree(dghstart, HYPRE_MEMORY_HOST);
+   hypre_TFree(rep_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(nrep_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(known, HYPRE_MEMORY_HOST);
+   hypre_TFree(my_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(my_objs, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_flags, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(exchange.recv_objs, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(box);
+   hypre_BoxDestroy(ghbox);
+   hypre_BoxDestroy(grow_box);
+   hypre_BoxDestroy(int_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * This routine returns a NULL 'entry_ptr' if an entry is not found
  *--------------------------------------------------------------------------*/
@@ -63,6 +63,10 @@ typedef struct
    HYPRE_Int               ghlocal_size;     /* Number of vars including ghosts */
 
    HYPRE_Int               cell_sgrid_done;  /* =1 implies cell grid already assembled */
+
+   /* boxes added and removed since the last assemble (see Reassemble) */
+   hypre_BoxArray         *added_boxes;
+   hypre_BoxArray         *removed_boxes;
 } hypre_SStructPGrid;
 
 typedef struct
@@ -106,6 +110,37 @@ typedef struct
 
 } hypre_SStructBoxManNborInfo;
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructRegridExchange:
+ *
+ * Data passed to the fill-response routine of hypre_SStructGridReassemble.
+ * Boxes are exchanged as fixed-size HYPRE_BigInt objects with the layout
+ * given by the hypre_SSTRUCT_REGRID_OBJ_* indexes below, where the offsets
+ * are for variable 0 and size/ghsize give the per-variable block sizes of the
+ * owning process on that part.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SSTRUCT_REGRID_OBJ_PROC     0
+#define hypre_SSTRUCT_REGRID_OBJ_PART     1
+#define hypre_SSTRUCT_REGRID_OBJ_ID       2
+#define hypre_SSTRUCT_REGRID_OBJ_OFFSET   3
+#define hypre_SSTRUCT_REGRID_OBJ_GHOFFSET 4
+#define hypre_SSTRUCT_REGRID_OBJ_SIZE     5
+#define hypre_SSTRUCT_REGRID_OBJ_GHSIZE   6
+#define hypre_SSTRUCT_REGRID_OBJ_IMIN     7
+#define hypre_SSTRUCT_REGRID_OBJ_IMAX     (7 + HYPRE_MAXDIM)
+#define hypre_SSTRUCT_REGRID_OBJ_LEN      (7 + 2 * HYPRE_MAXDIM)
+
+typedef struct
+{
+   HYPRE_Int      nparts;
+   HYPRE_Int     *my_starts;  /* my objects for each part */
+   HYPRE_BigInt  *my_objs;
+   HYPRE_Int      recv_size;  /* number of objects received as contacts */
+   HYPRE_Int      recv_alloc;
+   HYPRE_BigInt  *recv_objs;
+} hypre_SStructRegridExchange;
+
 typedef struct
 {
    hypre_CommInfo  *comm_info;
@@ -236,6 +271,8 @@ typedef struct hypre_SStructGrid_struct
 #define hypre_SStructPGridGlobalSize(pgrid)       ((pgrid) -> global_size)
 #define hypre_SStructPGridPeriodic(pgrid)         ((pgrid) -> periodic)
 #define hypre_SStructPGridGhlocalSize(pgrid)      ((pgrid) -> ghlocal_size)
+#define hypre_SStructPGridAddedBoxes(pgrid)       ((pgrid) -> added_boxes)
+#define hypre_SStructPGridRemovedBoxes(pgrid)     ((pgrid) -> removed_boxes)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructBoxManInfo
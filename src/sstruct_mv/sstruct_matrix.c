@@ -469,6 +469,126 @@ hypre_SStructPMatrixSetBoxValues( hypre_SStructPMatrix *pmatrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Same as hypre_SStructPMatrixSetBoxValues(), but the values are laid out as
+ * described in hypre_StructMatrixSetBoxValuesStrided().  All entries must
+ * couple to the same variable.
+ *
+ * (action > 0): add-to values
+ * (action = 0): set values
+ * (action < 0): get values
+ * (action =-2): get values and zero out
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixSetBoxValuesStrided( hypre_SStructPMatrix *pmatrix,
+                                         hypre_Box            *set_box,
+                                         HYPRE_Int             var,
+                                         HYPRE_Int             nentries,
+                                         HYPRE_Int            *entries,
+                                         hypre_Box            *value_box,
+                                         HYPRE_Complex        *values,
+                                         HYPRE_Int             point_stride,
+                                         HYPRE_Int            *value_offsets,
+                                         HYPRE_Int             action )
+{
+   HYPRE_Int             ndim    = hypre_SStructPMatrixNDim(pmatrix);
+   hypre_SStructStencil *stencil = hypre_SStructPMatrixStencil(pmatrix, var);
+   HYPRE_Int            *smap    = hypre_SStructPMatrixSMap(pmatrix, var);
+   HYPRE_Int            *vars    = hypre_SStructStencilVars(stencil);
+   hypre_StructMatrix   *smatrix;
+   hypre_BoxArray       *grid_boxes;
+   HYPRE_Int            *sentries;
+   HYPRE_Int             i, j;
+
+   smatrix = hypre_SStructPMatrixSMatrix(pmatrix, var, vars[entries[0]]);
+
+   sentries = hypre_SStructPMatrixSEntries(pmatrix);
+   for (i = 0; i < nentries; i++)
+   {
+      sentries[i] = smap[entries[i]];
+   }
+
+   /* set values inside the grid */
+   hypre_StructMatrixSetBoxValuesStrided(smatrix, set_box, value_box, nentries, sentries,
+                                         values, point_stride, value_offsets, action, -1, 0);
+
+   /* set (AddTo/Get) or clear (Set) values outside the grid in ghost zones */
+   if (action != 0)
+   {
+      /* AddTo/Get */
+      hypre_SStructPGrid  *pgrid = hypre_SStructPMatrixPGrid(pmatrix);
+      hypre_Index          varoffset;
+      hypre_BoxArray      *left_boxes, *done_boxes, *temp_boxes;
+      hypre_Box           *left_box, *done_box, *int_box;
+
+      hypre_SStructVariableGetOffset(hypre_SStructPGridVarType(pgrid, var),
+                                     hypre_SStructPGridNDim(pgrid), varoffset);
+      grid_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(smatrix));
+
+      left_boxes = hypre_BoxArrayCreate(1, ndim);
+      done_boxes = hypre_BoxArrayCreate(2, ndim);
+      temp_boxes = hypre_BoxArrayCreate(0, ndim);
+
+      /* done_box always points to the first box in done_boxes */
+      done_box = hypre_BoxArrayBox(done_boxes, 0);
+      /* int_box always points to the second box in done_boxes */
+      int_box = hypre_BoxArrayBox(done_boxes, 1);
+
+      hypre_CopyBox(set_box, hypre_BoxArrayBox(left_boxes, 0));
+      hypre_BoxArraySetSize(left_boxes, 1);
+      hypre_SubtractBoxArrays(left_boxes, grid_boxes, temp_boxes);
+
+      hypre_BoxArraySetSize(done_boxes, 0);
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         hypre_SubtractBoxArrays(left_boxes, done_boxes, temp_boxes);
+         hypre_BoxArraySetSize(done_boxes, 1);
+         hypre_CopyBox(hypre_BoxArrayBox(grid_boxes, i), done_box);
+         hypre_BoxGrowByIndex(done_box, varoffset);
+         hypre_ForBoxI(j, left_boxes)
+         {
+            left_box = hypre_BoxArrayBox(left_boxes, j);
+            hypre_IntersectBoxes(left_box, done_box, int_box);
+            hypre_StructMatrixSetBoxValuesStrided(smatrix, int_box, value_box,
+                                                  nentries, sentries, values,
+                                                  point_stride, value_offsets,
+                                                  action, i, 1);
+         }
+      }
+
+      hypre_BoxArrayDestroy(left_boxes);
+      hypre_BoxArrayDestroy(done_boxes);
+      hypre_BoxArrayDestroy(temp_boxes);
+   }
+   else
+   {
+      /* Set */
+      hypre_BoxArray  *diff_boxes;
+      hypre_Box       *grid_box, *diff_box;
+
+      grid_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(smatrix));
+      diff_boxes = hypre_BoxArrayCreate(0, ndim);
+
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         grid_box = hypre_BoxArrayBox(grid_boxes, i);
+         hypre_BoxArraySetSize(diff_boxes, 0);
+         hypre_SubtractBoxes(set_box, grid_box, diff_boxes);
+
+         hypre_ForBoxI(j, diff_boxes)
+         {
+            diff_box = hypre_BoxArrayBox(diff_boxes, j);
+            hypre_StructMatrixClearBoxValues(smatrix, diff_box, nentries, sentries,
+                                             i, 1);
+         }
+      }
+      hypre_BoxArrayDestroy(diff_boxes);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1320,6 +1440,73 @@ hypre_SStructMatrixRef( hypre_SStructMatrix  *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Compute the default S/U-matrix split.  Stencil couplings between variables
+ * of the same type go in the S-matrix, and all other couplings go in the
+ * U-matrix.  For rectangular matrices, all couplings go in the U-matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMatrixSetDefaultSplits( hypre_SStructMatrix *matrix )
+{
+   hypre_SStructGraph     *graph    = hypre_SStructMatrixGraph(matrix);
+   HYPRE_Int               nparts   = hypre_SStructMatrixNParts(matrix);
+   HYPRE_Int            ***splits   = hypre_SStructMatrixSplits(matrix);
+   hypre_SStructStencil ***stencils = hypre_SStructGraphStencils(graph);
+
+   hypre_SStructPGrid     *pgrid;
+   HYPRE_Int               nvars;
+   HYPRE_Int               stencil_size;
+   HYPRE_Int              *stencil_vars;
+   HYPRE_Int               pstencil_size;
+   HYPRE_SStructVariable   vitype, vjtype;
+   HYPRE_Int               part, vi, vj, i;
+   HYPRE_Int               rectangular;
+
+   /* is this a rectangular matrix? */
+   rectangular = 0;
+   if (hypre_SStructGraphGrid(graph) != hypre_SStructGraphDomainGrid(graph))
+   {
+      rectangular = 1;
+   }
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid = hypre_SStructGraphPGrid(graph, part);
+      nvars = hypre_SStructPGridNVars(pgrid);
+      for (vi = 0; vi < nvars; vi++)
+      {
+         stencil_size  = hypre_SStructStencilSize(stencils[part][vi]);
+         stencil_vars  = hypre_SStructStencilVars(stencils[part][vi]);
+         pstencil_size = 0;
+         for (i = 0; i < stencil_size; i++)
+         {
+            /* for rectangular matrices, put all coefficients in U-matrix */
+            if (rectangular)
+            {
+               splits[part][vi][i] = -1;
+            }
+            else
+            {
+               vj = stencil_vars[i];
+               vitype = hypre_SStructPGridVarType(pgrid, vi);
+               vjtype = hypre_SStructPGridVarType(pgrid, vj);
+               if (vjtype == vitype)
+               {
+                  splits[part][vi][i] = pstencil_size;
+                  pstencil_size++;
+               }
+               else
+               {
+                  splits[part][vi][i] = -1;
+               }
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1505,6 +1692,206 @@ hypre_SStructMatrixSetBoxValues( HYPRE_SStructMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Copy the values of the entries at value_offsets into a new array ordered as
+ * in hypre_SStructMatrixSetBoxValues().
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructMatrixPackBoxValues( HYPRE_Int              ndim,
+                                  hypre_Box             *value_box,
+                                  HYPRE_Complex         *values,
+                                  HYPRE_Int              point_stride,
+                                  HYPRE_Int              nentries,
+                                  HYPRE_Int             *value_offsets,
+                                  HYPRE_MemoryLocation   memory_location,
+                                  HYPRE_Complex        **packed_ptr )
+{
+   HYPRE_Complex  *packed;
+   HYPRE_Int      *offsets;
+   hypre_Index     loop_size, stride;
+
+   packed  = hypre_TAlloc(HYPRE_Complex, nentries * hypre_BoxVolume(value_box),
+                          memory_location);
+   offsets = hypre_TAlloc(HYPRE_Int, nentries, memory_location);
+   hypre_TMemcpy(offsets, value_offsets, HYPRE_Int, nentries,
+                 memory_location, HYPRE_MEMORY_HOST);
+
+   hypre_BoxGetSize(value_box, loop_size);
+   hypre_SetIndex(stride, 1);
+
+#undef DEVICE_VAR
+#define DEVICE_VAR is_device_ptr(packed,values,offsets)
+   hypre_BoxLoop1Begin(ndim, loop_size,
+                       value_box, hypre_BoxIMin(value_box), stride, vi);
+   {
+      HYPRE_Int  ei;
+      for (ei = 0; ei < nentries; ei++)
+      {
+         packed[vi * nentries + ei] = values[vi * point_stride + offsets[ei]];
+      }
+   }
+   hypre_BoxLoop1End(vi);
+#undef DEVICE_VAR
+#define DEVICE_VAR
+
+   hypre_TFree(offsets, memory_location);
+
+   *packed_ptr = packed;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set or add to the coefficients of several variables and stencil entries on
+ * a box at once.  The entries of variable vars[v] are the nentries[v] entries
+ * following those of the previous variables in the entries array.  With k the
+ * position of an entry in this array, its value at the point with rank p in
+ * value_box is
+ *
+ *    values[p*point_stride + k*entry_stride]
+ *
+ * Structured entries are written into the struct matrices with one BoxLoop
+ * pass per (var, to_var) pair.  Inter-part and unstructured entries are
+ * packed and passed on to the usual routines.
+ *
+ * (action > 0): add-to values
+ * (action = 0): set values
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMatrixSetBoxValuesStrided( HYPRE_SStructMatrix  matrix,
+                                        HYPRE_Int            part,
+                                        hypre_Box           *set_box,
+                                        HYPRE_Int            nvars,
+                                        HYPRE_Int           *vars,
+                                        HYPRE_Int           *nentries,
+                                        HYPRE_Int           *entries,
+                                        hypre_Box           *value_box,
+                                        HYPRE_Complex       *values,
+                                        HYPRE_Int            point_stride,
+                                        HYPRE_Int            entry_stride,
+                                        HYPRE_Int            action )
+{
+   HYPRE_Int                ndim        = hypre_SStructMatrixNDim(matrix);
+   hypre_SStructGraph      *graph       = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid       *grid        = hypre_SStructGraphGrid(graph);
+   HYPRE_Int              **nvneighbors = hypre_SStructGridNVNeighbors(grid);
+   hypre_SStructPMatrix    *pmatrix     = hypre_SStructMatrixPMatrix(matrix, part);
+   HYPRE_Int                pnvars      = hypre_SStructPMatrixNVars(pmatrix);
+   HYPRE_MemoryLocation     memory_location =
+      hypre_IJMatrixMemoryLocation(hypre_SStructMatrixIJMatrix(matrix));
+
+   hypre_SStructStencil    *stencil;
+   HYPRE_Int               *split, *svars;
+   HYPRE_Int                stencil_size;
+   HYPRE_Int               *Sentries, *Soffsets, *Ientries;
+   HYPRE_Int               *Uentries, *Uoffsets;
+   HYPRE_Int               *Tentries, *Toffsets;
+   HYPRE_Int                nSentries, nUentries, nTentries, max_nentries;
+   HYPRE_Complex           *packed;
+   HYPRE_Int                v, var, to_var, e, entry, k;
+
+   max_nentries = 0;
+   for (v = 0; v < nvars; v++)
+   {
+      max_nentries = hypre_max(max_nentries, nentries[v]);
+   }
+
+   Sentries = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+   Soffsets = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+   Ientries = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+   Uentries = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+   Uoffsets = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+   Tentries = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+   Toffsets = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+
+   k = 0;
+   for (v = 0; v < nvars; v++)
+   {
+      var          = vars[v];
+      split        = hypre_SStructMatrixSplit(matrix, part, var);
+      stencil      = hypre_SStructGraphStencil(graph, part, var);
+      stencil_size = hypre_SStructStencilSize(stencil);
+      svars        = hypre_SStructStencilVars(hypre_SStructPMatrixStencil(pmatrix, var));
+
+      /* split the entries, keeping track of their position in values */
+      nSentries = 0;
+      nUentries = 0;
+      for (e = 0; e < nentries[v]; e++, k++)
+      {
+         entry = entries[k];
+         if ((entry < stencil_size) && (split[entry] > -1))
+         {
+            Sentries[nSentries] = split[entry];
+            Ientries[nSentries] = entry;
+            Soffsets[nSentries] = k * entry_stride;
+            nSentries++;
+         }
+         else
+         {
+            Uentries[nUentries] = entry;
+            Uoffsets[nUentries] = k * entry_stride;
+            nUentries++;
+         }
+      }
+
+      /* S-matrix: one pass for each to_var */
+      for (to_var = 0; to_var < pnvars; to_var++)
+      {
+         nTentries = 0;
+         for (e = 0; e < nSentries; e++)
+         {
+            if (svars[Sentries[e]] == to_var)
+            {
+               Tentries[nTentries] = Sentries[e];
+               Toffsets[nTentries] = Soffsets[e];
+               nTentries++;
+            }
+         }
+         if (nTentries > 0)
+         {
+            hypre_SStructPMatrixSetBoxValuesStrided(pmatrix, set_box, var,
+                                                    nTentries, Tentries, value_box, values,
+                                                    point_stride, Toffsets, action);
+         }
+      }
+
+      /* put inter-part couplings in UMatrix and zero them out in PMatrix
+       * (possibly in ghost zones) */
+      if ((nSentries > 0) && (nvneighbors[part][var] > 0))
+      {
+         hypre_SStructMatrixPackBoxValues(ndim, value_box, values, point_stride,
+                                          nSentries, Soffsets, memory_location, &packed);
+         hypre_SStructMatrixSetInterPartValues(matrix, part, set_box, var,
+                                               nSentries, Ientries,
+                                               value_box, packed, action);
+         hypre_TFree(packed, memory_location);
+      }
+
+      /* U-matrix */
+      if (nUentries > 0)
+      {
+         hypre_SStructMatrixPackBoxValues(ndim, value_box, values, point_stride,
+                                          nUentries, Uoffsets, memory_location, &packed);
+         hypre_SStructUMatrixSetBoxValues(matrix, part, set_box, var,
+                                          nUentries, Uentries,
+                                          value_box, packed, action);
+         hypre_TFree(packed, memory_location);
+      }
+   }
+
+   hypre_TFree(Sentries, HYPRE_MEMORY_HOST);
+   hypre_TFree(Soffsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ientries, HYPRE_MEMORY_HOST);
+   hypre_TFree(Uentries, HYPRE_MEMORY_HOST);
+   hypre_TFree(Uoffsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(Tentries, HYPRE_MEMORY_HOST);
+   hypre_TFree(Toffsets, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Put inter-part couplings in UMatrix and zero them out in PMatrix (possibly in
  * ghost zones).  Assumes that all entries are stencil entries.
@@ -1695,6 +2082,480 @@ hypre_SStructMatrixSetInterPartValues( HYPRE_SStructMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Helper for hypre_SStructMatrixAssembleParCSR().  Count (cols == NULL) or
+ * fill the couplings of S-matrix stencil entry 'entry' for the rows in 'box',
+ * which lies in local box 'b' of variable 'var' and in box manager entry
+ * 'row_entry'.  Local box manager entries take precedence over neighbor box
+ * manager entries (periodic and inter-part boxes) for the columns, as in
+ * hypre_SStructUMatrixSetValues().  Set 'nbor_ptr' if any columns were found
+ * in the neighbor box manager.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructMatrixParCSRBoxEntry( hypre_SStructMatrix *matrix,
+                                   HYPRE_Int            part,
+                                   HYPRE_Int            var,
+                                   HYPRE_Int            b,
+                                   HYPRE_Int            entry,
+                                   hypre_Box           *box,
+                                   hypre_BoxManEntry   *row_entry,
+                                   HYPRE_BigInt         row_start,
+                                   HYPRE_Int           *row_ptr,
+                                   HYPRE_Int           *row_fill,
+                                   HYPRE_BigInt        *cols,
+                                   HYPRE_Complex       *vals,
+                                   HYPRE_Int           *nbor_ptr )
+{
+   HYPRE_Int             ndim     = hypre_SStructMatrixNDim(matrix);
+   hypre_SStructGraph   *graph    = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid    *dom_grid = hypre_SStructGraphDomainGrid(graph);
+   hypre_SStructStencil *stencil  = hypre_SStructGraphStencil(graph, part, var);
+   hypre_SStructPMatrix *pmatrix  = hypre_SStructMatrixPMatrix(matrix, part);
+   HYPRE_Int            *split    = hypre_SStructMatrixSplit(matrix, part, var);
+   HYPRE_Int             to_var   = hypre_SStructStencilVar(stencil, entry);
+   hypre_IndexRef        offset   = hypre_SStructStencilEntry(stencil, entry);
+   hypre_StructMatrix   *smatrix  = hypre_SStructPMatrixSMatrix(pmatrix, var, to_var);
+   HYPRE_Int             sentry   = hypre_SStructPMatrixSMap(pmatrix, var)[split[entry]];
+   hypre_Box            *data_box;
+   HYPRE_Complex        *sdata;
+
+   hypre_BoxManEntry   **col_entries;
+   HYPRE_Int             ncol_entries;
+   hypre_BoxArray       *covered, *segments, *tmp_boxes;
+   hypre_Box            *to_box, *map_box, *int_box;
+   hypre_Index           rs, cs, loop_size, stride;
+   hypre_IndexRef        start;
+   HYPRE_BigInt          row_base, col_base;
+   HYPRE_Int             row_offset;
+   HYPRE_Int             action, ci, i;
+
+   data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(smatrix), b);
+   sdata    = hypre_StructMatrixBoxData(smatrix, b, sentry);
+
+   to_box    = hypre_BoxCreate(ndim);
+   map_box   = hypre_BoxCreate(ndim);
+   int_box   = hypre_BoxCreate(ndim);
+   covered   = hypre_BoxArrayCreate(0, ndim);
+   segments  = hypre_BoxArrayCreate(0, ndim);
+   tmp_boxes = hypre_BoxArrayCreate(0, ndim);
+   hypre_SetIndex(stride, 1);
+
+   hypre_SStructBoxManEntryGetStrides(row_entry, rs, HYPRE_PARCSR);
+
+   hypre_CopyBox(box, to_box);
+   hypre_BoxShiftPos(to_box, offset);
+   for (action = 0; action < 2; action++)
+   {
+      hypre_SStructGridIntersect(dom_grid, part, to_var, to_box, action,
+                                 &col_entries, &ncol_entries);
+
+      for (ci = 0; ci < ncol_entries; ci++)
+      {
+         hypre_BoxManEntryGetExtents(col_entries[ci],
+                                     hypre_BoxIMin(map_box), hypre_BoxIMax(map_box));
+         hypre_IntersectBoxes(to_box, map_box, int_box);
+         if (hypre_BoxVolume(int_box) == 0)
+         {
+            continue;
+         }
+
+         /* remove the parts already covered by earlier entries */
+         hypre_BoxArraySetSize(segments, 0);
+         hypre_AppendBox(int_box, segments);
+         hypre_SubtractBoxArrays(segments, covered, tmp_boxes);
+         hypre_AppendBox(int_box, covered);
+         if (action > 0 && hypre_BoxArraySize(segments) > 0)
+         {
+            *nbor_ptr = 1;
+         }
+
+         hypre_SStructBoxManEntryGetStrides(col_entries[ci], cs, HYPRE_PARCSR);
+
+         hypre_ForBoxI(i, segments)
+         {
+            hypre_CopyBox(hypre_BoxArrayBox(segments, i), int_box);
+            hypre_SStructBoxManEntryGetGlobalRank(col_entries[ci], hypre_BoxIMin(int_box),
+                                                  &col_base, HYPRE_PARCSR);
+            hypre_BoxShiftNeg(int_box, offset);
+            hypre_SStructBoxManEntryGetGlobalRank(row_entry, hypre_BoxIMin(int_box),
+                                                  &row_base, HYPRE_PARCSR);
+            row_offset = (HYPRE_Int) (row_base - row_start);
+
+            start = hypre_BoxIMin(int_box);
+            hypre_BoxGetSize(int_box, loop_size);
+
+            /* each row appears once in the loop, so the rows can be updated in parallel */
+            zypre_BoxLoop1Begin(ndim, loop_size, data_box, start, stride, di);
+            {
+               hypre_Index  index;
+               HYPRE_BigInt col;
+               HYPRE_Int    lr, d;
+
+               zypre_BoxLoopGetIndex(index);
+               lr  = row_offset;
+               col = col_base;
+               for (d = 0; d < ndim; d++)
+               {
+                  lr  += index[d] * rs[d];
+                  col += index[d] * cs[d];
+               }
+               if (cols)
+               {
+                  cols[row_ptr[lr] + row_fill[lr]] = col;
+                  vals[row_ptr[lr] + row_fill[lr]] = sdata[di];
+               }
+               row_fill[lr]++;
+            }
+            zypre_BoxLoop1End(di);
+         }
+      }
+
+      hypre_TFree(col_entries, HYPRE_MEMORY_HOST);
+   }
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(map_box);
+   hypre_BoxDestroy(int_box);
+   hypre_BoxArrayDestroy(covered);
+   hypre_BoxArrayDestroy(segments);
+   hypre_BoxArrayDestroy(tmp_boxes);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Build the ParCSR matrix directly from the S-matrix and the assembled
+ * U-matrix, bypassing the IJ interface for the stencil entries.
+ *
+ * For each local box and S-matrix stencil entry, the boxes of the coupled
+ * variable are found once with the box manager, and the global row and column
+ * numbers are computed from the box manager strides in (threaded) box loops.
+ * The rows are counted in a first pass and filled in a second pass.  Entries
+ * of the U-matrix are then appended, and each row is sorted and compressed,
+ * summing couplings to the same column.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMatrixAssembleParCSR( hypre_SStructMatrix *matrix )
+{
+   MPI_Comm                comm     = hypre_SStructMatrixComm(matrix);
+   HYPRE_Int               ndim     = hypre_SStructMatrixNDim(matrix);
+   hypre_SStructGraph     *graph    = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid      *grid     = hypre_SStructGraphGrid(graph);
+   HYPRE_Int               nparts   = hypre_SStructMatrixNParts(matrix);
+   HYPRE_IJMatrix          ijmatrix = hypre_SStructMatrixIJMatrix(matrix);
+
+   hypre_ParCSRMatrix     *parcsr_U;
+   hypre_ParCSRMatrix     *parcsr_A;
+   hypre_CSRMatrix        *U_diag, *U_offd, *A_diag, *A_offd;
+   HYPRE_Int              *U_diag_i, *U_diag_j, *U_offd_i, *U_offd_j;
+   HYPRE_Complex          *U_diag_data, *U_offd_data;
+   HYPRE_BigInt           *U_col_map_offd;
+   HYPRE_BigInt           *row_starts, *col_starts;
+   HYPRE_BigInt            first_col, last_col;
+
+   hypre_SStructPGrid     *pgrid;
+   hypre_SStructStencil   *stencil;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *box, *map_box;
+   hypre_BoxManEntry     **row_entries;
+   HYPRE_Int               nrow_entries;
+   HYPRE_Int              *split;
+   HYPRE_Int               nvars, stencil_size;
+
+   HYPRE_Int               num_rows, nnz, diag_nnz, offd_nnz, num_cols_offd;
+   HYPRE_Int              *row_ptr, *row_fill;
+   HYPRE_BigInt           *cols;
+   HYPRE_Complex          *vals;
+   HYPRE_Int              *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex          *diag_data, *offd_data;
+   HYPRE_BigInt           *big_offd_j, *col_map_offd;
+
+   HYPRE_Int               nbor, pass, part, var, b, e, ri, i;
+
+   HYPRE_IJMatrixGetObject(ijmatrix, (void **) &parcsr_U);
+
+   /* Destroy the ParCSR matrix from a previous assemble */
+   if (hypre_SStructMatrixParCSRMatrix(matrix) != parcsr_U)
+   {
+      hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+   }
+
+   U_diag         = hypre_ParCSRMatrixDiag(parcsr_U);
+   U_offd         = hypre_ParCSRMatrixOffd(parcsr_U);
+   U_diag_i       = hypre_CSRMatrixI(U_diag);
+   U_diag_j       = hypre_CSRMatrixJ(U_diag);
+   U_diag_data    = hypre_CSRMatrixData(U_diag);
+   U_offd_i       = hypre_CSRMatrixI(U_offd);
+   U_offd_j       = hypre_CSRMatrixJ(U_offd);
+   U_offd_data    = hypre_CSRMatrixData(U_offd);
+   U_col_map_offd = hypre_ParCSRMatrixColMapOffd(parcsr_U);
+   row_starts     = hypre_ParCSRMatrixRowStarts(parcsr_U);
+   col_starts     = hypre_ParCSRMatrixColStarts(parcsr_U);
+   first_col      = col_starts[0];
+   last_col       = col_starts[1] - 1;
+   num_rows       = hypre_ParCSRMatrixNumRows(parcsr_U);
+
+   /*------------------------------------------------------
+    * Walk the S-matrix boxes twice: first count the row
+    * lengths, then fill the rows
+    *------------------------------------------------------*/
+
+   row_ptr  = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_fill = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   cols     = NULL;
+   vals     = NULL;
+   nnz      = 0;
+   nbor     = 0;
+   box      = hypre_BoxCreate(ndim);
+   map_box  = hypre_BoxCreate(ndim);
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid = hypre_SStructGraphPGrid(graph, part);
+         nvars = hypre_SStructPGridNVars(pgrid);
+         for (var = 0; var < nvars; var++)
+         {
+            stencil      = hypre_SStructGraphStencil(graph, part, var);
+            stencil_size = hypre_SStructStencilSize(stencil);
+            split        = hypre_SStructMatrixSplit(matrix, part, var);
+            boxes        = hypre_StructGridBoxes(hypre_SStructPGridSGrid(pgrid, var));
+
+            hypre_ForBoxI(b, boxes)
+            {
+               hypre_SStructGridIntersect(grid, part, var, hypre_BoxArrayBox(boxes, b), 0,
+                                          &row_entries, &nrow_entries);
+               for (ri = 0; ri < nrow_entries; ri++)
+               {
+                  hypre_BoxManEntryGetExtents(row_entries[ri], hypre_BoxIMin(map_box),
+                                              hypre_BoxIMax(map_box));
+                  hypre_IntersectBoxes(hypre_BoxArrayBox(boxes, b), map_box, box);
+                  if (hypre_BoxVolume(box) == 0)
+                  {
+                     continue;
+                  }
+                  for (e = 0; e < stencil_size; e++)
+                  {
+                     if (split[e] > -1)
+                     {
+                        hypre_SStructMatrixParCSRBoxEntry(matrix, part, var, b, e, box,
+                                                          row_entries[ri], row_starts[0],
+                                                          row_ptr, row_fill, cols, vals,
+                                                          &nbor);
+                     }
+                  }
+               }
+               hypre_TFree(row_entries, HYPRE_MEMORY_HOST);
+            }
+         }
+      }
+
+      if (pass == 0)
+      {
+         /* add the U-matrix row lengths and allocate */
+         for (i = 0; i < num_rows; i++)
+         {
+            row_ptr[i + 1] = row_ptr[i] + row_fill[i] +
+                             (U_diag_i[i + 1] - U_diag_i[i]) +
+                             (U_offd_i[i + 1] - U_offd_i[i]);
+            row_fill[i] = 0;
+         }
+         nnz  = row_ptr[num_rows];
+         cols = hypre_TAlloc(HYPRE_BigInt,  nnz, HYPRE_MEMORY_HOST);
+         vals = hypre_TAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_BoxDestroy(box);
+   hypre_BoxDestroy(map_box);
+
+   /*------------------------------------------------------
+    * Append the U-matrix entries, then sum duplicate columns
+    * in each row.  The rows are short, and keeping the entries
+    * in stencil order gives the same matrix as the IJ path.
+    *------------------------------------------------------*/
+
+   diag_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int     j, k, pos, cnt;
+
+      pos = row_ptr[i] + row_fill[i];
+      for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+      {
+         cols[pos] = first_col + (HYPRE_BigInt) U_diag_j[j];
+         vals[pos] = U_diag_data[j];
+         pos++;
+      }
+      for (j = U_offd_i[i]; j < U_offd_i[i + 1]; j++)
+      {
+         cols[pos] = U_col_map_offd[U_offd_j[j]];
+         vals[pos] = U_offd_data[j];
+         pos++;
+      }
+
+      /* compress in place; without neighbor couplings, the S-matrix columns
+       * in a row are distinct, so only the U-matrix columns need checking */
+      cnt = nbor ? row_ptr[i] : row_ptr[i] + row_fill[i];
+      for (j = cnt; j < row_ptr[i + 1]; j++)
+      {
+         for (k = row_ptr[i]; k < cnt; k++)
+         {
+            if (cols[k] == cols[j])
+            {
+               break;
+            }
+         }
+         if (k < cnt)
+         {
+            vals[k] += vals[j];
+         }
+         else
+         {
+            cols[cnt] = cols[j];
+            vals[cnt] = vals[j];
+            cnt++;
+         }
+      }
+      row_fill[i] = cnt - row_ptr[i];
+
+      for (j = row_ptr[i]; j < cnt; j++)
+      {
+         if (cols[j] >= first_col && cols[j] <= last_col)
+         {
+            diag_i[i + 1]++;
+         }
+         else
+         {
+            offd_i[i + 1]++;
+         }
+      }
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i + 1] += diag_i[i];
+      offd_i[i + 1] += offd_i[i];
+   }
+   diag_nnz = diag_i[num_rows];
+   offd_nnz = offd_i[num_rows];
+
+   /*------------------------------------------------------
+    * Fill the diag and offd parts (diagonal entry first)
+    *------------------------------------------------------*/
+
+   diag_j     = hypre_TAlloc(HYPRE_Int,     diag_nnz, HYPRE_MEMORY_HOST);
+   diag_data  = hypre_TAlloc(HYPRE_Complex, diag_nnz, HYPRE_MEMORY_HOST);
+   big_offd_j = hypre_TAlloc(HYPRE_BigInt,  offd_nnz, HYPRE_MEMORY_HOST);
+   offd_data  = hypre_TAlloc(HYPRE_Complex, offd_nnz, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_BigInt  diag_col = row_starts[0] + (HYPRE_BigInt) i;
+      HYPRE_Int     j, dpos, opos;
+
+      dpos = diag_i[i];
+      opos = offd_i[i];
+      for (j = row_ptr[i]; j < row_ptr[i] + row_fill[i]; j++)
+      {
+         if (cols[j] == diag_col)
+         {
+            diag_j[dpos]    = i;
+            diag_data[dpos] = vals[j];
+            dpos++;
+            break;
+         }
+      }
+      for (j = row_ptr[i]; j < row_ptr[i] + row_fill[i]; j++)
+      {
+         if (cols[j] >= first_col && cols[j] <= last_col)
+         {
+            if (cols[j] != diag_col)
+            {
+               diag_j[dpos]    = (HYPRE_Int) (cols[j] - first_col);
+               diag_data[dpos] = vals[j];
+               dpos++;
+            }
+         }
+         else
+         {
+            big_offd_j[opos] = cols[j];
+            offd_data[opos]  = vals[j];
+            opos++;
+         }
+      }
+   }
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_fill, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals, HYPRE_MEMORY_HOST);
+
+   /* Generate col_map_offd */
+   col_map_offd  = hypre_TAlloc(HYPRE_BigInt, offd_nnz, HYPRE_MEMORY_HOST);
+   offd_j        = hypre_TAlloc(HYPRE_Int, offd_nnz, HYPRE_MEMORY_HOST);
+   num_cols_offd = 0;
+   if (offd_nnz)
+   {
+      hypre_TMemcpy(col_map_offd, big_offd_j, HYPRE_BigInt, offd_nnz,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_BigQsort0(col_map_offd, 0, offd_nnz - 1);
+      for (i = 1; i < offd_nnz; i++)
+      {
+         if (col_map_offd[i] > col_map_offd[num_cols_offd])
+         {
+            col_map_offd[++num_cols_offd] = col_map_offd[i];
+         }
+      }
+      num_cols_offd++;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < offd_nnz; i++)
+   {
+      offd_j[i] = hypre_BigBinarySearch(col_map_offd, big_offd_j[i], num_cols_offd);
+   }
+   hypre_TFree(big_offd_j, HYPRE_MEMORY_HOST);
+
+   /*------------------------------------------------------
+    * Create the ParCSR matrix
+    *------------------------------------------------------*/
+
+   parcsr_A = hypre_ParCSRMatrixCreate(comm,
+                                       hypre_ParCSRMatrixGlobalNumRows(parcsr_U),
+                                       hypre_ParCSRMatrixGlobalNumCols(parcsr_U),
+                                       row_starts, col_starts, num_cols_offd,
+                                       diag_nnz, offd_nnz);
+   A_diag = hypre_ParCSRMatrixDiag(parcsr_A);
+   A_offd = hypre_ParCSRMatrixOffd(parcsr_A);
+
+   hypre_CSRMatrixI(A_diag)    = diag_i;
+   hypre_CSRMatrixJ(A_diag)    = diag_j;
+   hypre_CSRMatrixData(A_diag) = diag_data;
+   hypre_CSRMatrixMemoryLocation(A_diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(A_offd)    = offd_i;
+   hypre_CSRMatrixJ(A_offd)    = offd_j;
+   hypre_CSRMatrixData(A_offd) = offd_data;
+   hypre_CSRMatrixMemoryLocation(A_offd) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(parcsr_A) = col_map_offd;
+   hypre_ParCSRMatrixSetNumNonzeros(parcsr_A);
+   hypre_MatvecCommPkgCreate(parcsr_A);
+
+   hypre_SStructMatrixParCSRMatrix(matrix) = parcsr_A;
+
+   return hypre_error_flag;
+}
+
 HYPRE_MemoryLocation
 hypre_SStructMatrixMemoryLocation(hypre_SStructMatrix *matrix)
 {
@@ -79,6 +79,10 @@ typedef struct hypre_SStructMatrix_struct
    /* GEC0902   adding an object type to the matrix  */
    HYPRE_Int               object_type;
 
+   /* Build the ParCSR matrix from the S-matrix and U-matrix directly?  The
+    * ParCSR matrix is then owned by the SStructMatrix */
+   HYPRE_Int               direct_parcsr;
+
 } hypre_SStructMatrix;
 
 /*--------------------------------------------------------------------------
@@ -110,6 +114,7 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixGlobalSize(mat)           ((mat) -> global_size)
 #define hypre_SStructMatrixRefCount(mat)             ((mat) -> ref_count)
 #define hypre_SStructMatrixObjectType(mat)           ((mat) -> object_type)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPMatrix
@@ -26,6 +26,8 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_GMRESFunctionsSetFusedOps(gmres_functions, hypre_StructKrylovMassAxpy,
+                                   hypre_StructKrylovAxpyNorm);
 
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -257,6 +257,9 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Line Jacobi, with lines along the coarsening direction of each level
+ *          (weighted by the Jacobi weight; falls back to weighted Jacobi for
+ *          constant-coefficient matrices)
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -414,6 +417,20 @@ HYPRE_Int HYPRE_StructSMGSetMemoryUse(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructSMGGetMemoryUse(HYPRE_StructSolver solver,
                                       HYPRE_Int *memory_use);
 
+/**
+ * (Optional) Use a batched tridiagonal solver for the line solves in the
+ * relaxation.  Lines are solved several at a time with the Thomas algorithm
+ * instead of by multilevel cyclic reduction, which is considerably faster
+ * when no line crosses a box boundary (other cases fall back to cyclic
+ * reduction).  Results agree with the default up to rounding.  The default
+ * is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructSMGSetLineBatching(HYPRE_StructSolver solver,
+                                         HYPRE_Int          line_batching);
+
+HYPRE_Int HYPRE_StructSMGGetLineBatching(HYPRE_StructSolver solver,
+                                         HYPRE_Int *line_batching);
+
 /**
  * (Optional) Set the convergence tolerance.
  **/
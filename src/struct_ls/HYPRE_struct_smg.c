@@ -74,6 +74,23 @@ HYPRE_StructSMGGetMemoryUse( HYPRE_StructSolver solver,
    return ( hypre_SMGGetMemoryUse( (void *) solver, memory_use ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSMGSetLineBatching( HYPRE_StructSolver solver,
+                                HYPRE_Int          line_batching )
+{
+   return ( hypre_SMGSetLineBatching( (void *) solver, line_batching ) );
+}
+
+HYPRE_Int
+HYPRE_StructSMGGetLineBatching( HYPRE_StructSolver solver,
+                                HYPRE_Int        * line_batching )
+{
+   return ( hypre_SMGGetLineBatching( (void *) solver, line_batching ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
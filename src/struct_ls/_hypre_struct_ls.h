@@ -44,6 +44,7 @@ HYPRE_Int hypre_CyclicReductionSetup ( void *cyc_red_vdata, hypre_StructMatrix *
 HYPRE_Int hypre_CyclicReduction ( void *cyc_red_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                                   hypre_StructVector *x );
 HYPRE_Int hypre_CyclicReductionSetCDir ( void *cyc_red_vdata, HYPRE_Int cdir );
+HYPRE_Int hypre_CyclicReductionSetBatching ( void *cyc_red_vdata, HYPRE_Int batching );
 HYPRE_Int hypre_CyclicReductionSetBase ( void *cyc_red_vdata, hypre_Index base_index,
                                          hypre_Index base_stride );
 HYPRE_Int hypre_CyclicReductionDestroy ( void *cyc_red_vdata );
@@ -122,6 +123,12 @@ HYPRE_Int hypre_StructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_StructKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_StructKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
+                                           void *result );
+HYPRE_Int hypre_StructKrylovMassAxpy ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                      HYPRE_Int unroll );
+HYPRE_Real hypre_StructKrylovAxpyNorm ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_StructKrylovXpay ( HYPRE_Complex beta, void *x, void *y );
 HYPRE_Int hypre_StructKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_StructKrylovIdentity ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_StructKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
@@ -205,6 +212,9 @@ HYPRE_Int hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0 ( HYPRE_Int ci, HYPRE_Int fi
 HYPRE_Int hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC1 ( HYPRE_Int ci, HYPRE_Int fi,
                                                       hypre_StructMatrix *A, hypre_StructMatrix *P, hypre_StructMatrix *R, HYPRE_Int cdir,
                                                       hypre_Index cindex, hypre_Index cstride, hypre_StructMatrix *RAP );
+HYPRE_Int hypre_PFMG3BuildRAPHost ( hypre_StructMatrix *A, hypre_StructMatrix *P,
+                                    hypre_StructMatrix *R, HYPRE_Int cdir, hypre_Index cindex, hypre_Index cstride,
+                                    hypre_StructMatrix *RAP );
 
 /* pfmg.c */
 void *hypre_PFMGCreate ( MPI_Comm comm );
@@ -256,6 +266,12 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetLineDir ( void *pfmg_relax_vdata, HYPRE_Int line_dir );
+HYPRE_Int hypre_PFMGLineRelaxSetup ( void *pfmg_relax_vdata, hypre_StructMatrix *A,
+                                     hypre_StructVector *x );
+HYPRE_Int hypre_PFMGLineRelax ( void *pfmg_relax_vdata, hypre_StructMatrix *A,
+                                hypre_StructVector *b, hypre_StructVector *x );
+HYPRE_Int hypre_PFMGLineRelaxDestroy ( void *pfmg_relax_vdata );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -469,6 +485,8 @@ void *hypre_SMGCreate ( MPI_Comm comm );
 HYPRE_Int hypre_SMGDestroy ( void *smg_vdata );
 HYPRE_Int hypre_SMGSetMemoryUse ( void *smg_vdata, HYPRE_Int memory_use );
 HYPRE_Int hypre_SMGGetMemoryUse ( void *smg_vdata, HYPRE_Int *memory_use );
+HYPRE_Int hypre_SMGSetLineBatching ( void *smg_vdata, HYPRE_Int line_batching );
+HYPRE_Int hypre_SMGGetLineBatching ( void *smg_vdata, HYPRE_Int *line_batching );
 HYPRE_Int hypre_SMGSetTol ( void *smg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_SMGGetTol ( void *smg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_SMGSetMaxIter ( void *smg_vdata, HYPRE_Int max_iter );
@@ -512,6 +530,7 @@ HYPRE_Int hypre_SMGRelaxSetupASol ( void *relax_vdata, hypre_StructMatrix *A, hy
                                     hypre_StructVector *x );
 HYPRE_Int hypre_SMGRelaxSetTempVec ( void *relax_vdata, hypre_StructVector *temp_vec );
 HYPRE_Int hypre_SMGRelaxSetMemoryUse ( void *relax_vdata, HYPRE_Int memory_use );
+HYPRE_Int hypre_SMGRelaxSetLineBatching ( void *relax_vdata, HYPRE_Int line_batching );
 HYPRE_Int hypre_SMGRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_SMGRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_SMGRelaxSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
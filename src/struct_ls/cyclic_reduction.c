@@ -15,6 +15,9 @@
 
 #define DEBUG 0
 
+/* number of lines solved together by the batched line solver */
+#define HYPRE_CYCRED_BATCH_SIZE 16
+
 /*--------------------------------------------------------------------------
  * Macros
  *--------------------------------------------------------------------------*/
@@ -75,6 +78,15 @@ typedef struct
    hypre_ComputePkg    **down_compute_pkg_l;
    hypre_ComputePkg    **up_compute_pkg_l;
 
+   /* batched line solver (used when every line lies within a single box) */
+   HYPRE_Int             batching;       /* try the batched line solver in setup */
+   HYPRE_Int             batched;
+   HYPRE_Int            *batch_offsets;  /* start of each box in the arrays below */
+   HYPRE_Real           *batch_lower;    /* sub-diagonal coefficients */
+   HYPRE_Real           *batch_upper;    /* eliminated super-diagonal coefficients */
+   HYPRE_Real           *batch_dinv;     /* inverse pivots */
+   HYPRE_Real           *batch_work;
+
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
@@ -96,6 +108,7 @@ hypre_CyclicReductionCreate( MPI_Comm  comm )
    (cyc_red_data -> cdir) = 0;
    (cyc_red_data -> time_index)  = hypre_InitializeTiming("CyclicReduction");
    (cyc_red_data -> max_levels)  = -1;
+   (cyc_red_data -> batching)    = 0;
 
    /* set defaults */
    hypre_SetIndex3((cyc_red_data -> base_index), 0, 0, 0);
@@ -460,6 +473,390 @@ hypre_CycRedSetupCoarseOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CycRedBatchedLineInfo
+ *
+ * Returns the line length, the number of lines, and the memory strides (in
+ * units of base_stride) along the line and across the lines of a data box.
+ * The lines of a box are numbered with the first non-line direction varying
+ * fastest.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedBatchedLineInfo( HYPRE_Int       ndim,
+                             HYPRE_Int       cdir,
+                             hypre_Index     loop_size,
+                             hypre_IndexRef  base_stride,
+                             hypre_Box      *dbox,
+                             HYPRE_Int      *n_ptr,
+                             HYPRE_Int      *m_ptr,
+                             HYPRE_Int      *osize,
+                             HYPRE_Int      *ostride,
+                             HYPRE_Int      *lstride_ptr )
+{
+   hypre_Index  unit;
+   HYPRE_Int    d, k, m;
+
+   m = 1;
+   k = 0;
+   osize[0] = osize[1] = 1;
+   ostride[0] = ostride[1] = 0;
+   for (d = 0; d < ndim; d++)
+   {
+      hypre_SetIndex(unit, 0);
+      hypre_IndexD(unit, d) = hypre_IndexD(base_stride, d);
+      if (d == cdir)
+      {
+         *lstride_ptr = hypre_BoxOffsetDistance(dbox, unit);
+      }
+      else
+      {
+         osize[k]   = hypre_IndexD(loop_size, d);
+         ostride[k] = hypre_BoxOffsetDistance(dbox, unit);
+         m *= osize[k];
+         k++;
+      }
+   }
+
+   *n_ptr = hypre_IndexD(loop_size, cdir);
+   *m_ptr = m;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSetupBatched
+ *
+ * Sets up a batched tridiagonal solver that is used in place of the
+ * multilevel cyclic reduction algorithm when no line crosses a box boundary
+ * (this includes periodic images).  Each box is then solved with the Thomas
+ * algorithm applied to HYPRE_CYCRED_BATCH_SIZE lines at a time.  The
+ * coefficients of a batch are stored line-fastest (structure-of-arrays over
+ * lines), so that the inner loop of both sweeps runs across independent lines
+ * and vectorizes.  No communication is needed in the solve.
+ *
+ * Sets 'batched' to zero if batching was not requested or if the path does
+ * not apply, i.e., if the lines are strided, if the matrix is not
+ * host-resident with variable coefficients, if a line crosses a box boundary
+ * on any process, or if a zero pivot is encountered (for example, for
+ * singular problems).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedSetupBatched( hypre_CyclicReductionData *cyc_red_data,
+                          hypre_StructMatrix        *A )
+{
+   MPI_Comm              comm        = (cyc_red_data -> comm);
+   HYPRE_Int             cdir        = (cyc_red_data -> cdir);
+   hypre_IndexRef        base_index  = (cyc_red_data -> base_index);
+   hypre_IndexRef        base_stride = (cyc_red_data -> base_stride);
+   hypre_StructGrid     *grid        = hypre_StructMatrixGrid(A);
+   HYPRE_Int             ndim        = hypre_StructGridNDim(grid);
+   HYPRE_Int             bsize       = HYPRE_CYCRED_BATCH_SIZE;
+
+   hypre_StructStencil  *stencil;
+   hypre_Index          *stencil_shape;
+   hypre_CommInfo       *comm_info;
+   hypre_BoxArrayArray  *recv_boxes;
+   hypre_BoxArray       *base_points;
+   hypre_Box            *box;
+   hypre_Box            *A_dbox;
+   hypre_Index           index;
+   hypre_Index           loop_size;
+
+   HYPRE_Real           *Ap, *Awp, *Aep;
+   HYPRE_Real           *lower, *upper, *dinv;
+   HYPRE_Int            *batch_offsets;
+   HYPRE_Int             osize[2], ostride[2], lstride = 0;
+   HYPRE_Int             n, m, nb, size;
+   HYPRE_Int             i, j, fi, b, lane, line, Ai;
+   HYPRE_Int             local_ok, ok;
+
+   (cyc_red_data -> batched) = 0;
+   if (!(cyc_red_data -> batching))
+   {
+      return hypre_error_flag;
+   }
+
+   local_ok = 1;
+   if ( (hypre_IndexD(base_stride, cdir) != 1) ||
+        (hypre_StructMatrixConstantCoefficient(A) != 0) ||
+        (hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST) )
+   {
+      local_ok = 0;
+   }
+
+   /* Check that no line needs data from another box */
+   if (local_ok)
+   {
+      stencil_shape = hypre_CTAlloc(hypre_Index, 2, HYPRE_MEMORY_HOST);
+      hypre_IndexD(stencil_shape[0], cdir) = -1;
+      hypre_IndexD(stencil_shape[1], cdir) =  1;
+      stencil = hypre_StructStencilCreate(ndim, 2, stencil_shape);
+      hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
+      hypre_StructStencilDestroy(stencil);
+
+      recv_boxes = hypre_CommInfoRecvBoxes(comm_info);
+      hypre_ForBoxArrayI(i, recv_boxes)
+      {
+         hypre_ForBoxI(j, hypre_BoxArrayArrayBoxArray(recv_boxes, i))
+         {
+            if (hypre_BoxVolume(hypre_BoxArrayBox(
+                                   hypre_BoxArrayArrayBoxArray(recv_boxes, i), j)))
+            {
+               local_ok = 0;
+            }
+         }
+      }
+      hypre_CommInfoDestroy(comm_info);
+   }
+
+   hypre_MPI_Allreduce(&local_ok, &ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!ok)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Compute the storage layout */
+   base_points = hypre_BoxArrayDuplicate(hypre_StructGridBoxes(grid));
+   hypre_ProjectBoxArray(base_points, base_index, base_stride);
+
+   batch_offsets = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(base_points) + 1,
+                                 HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(fi, base_points)
+   {
+      box    = hypre_BoxArrayBox(base_points, fi);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      hypre_BoxGetStrideSize(box, base_stride, loop_size);
+      hypre_CycRedBatchedLineInfo(ndim, cdir, loop_size, base_stride, A_dbox,
+                                  &n, &m, osize, ostride, &lstride);
+      nb = (m + bsize - 1) / bsize;
+      batch_offsets[fi + 1] = batch_offsets[fi] + nb * n * bsize;
+   }
+   size = batch_offsets[hypre_BoxArraySize(base_points)];
+
+   lower = hypre_TAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+   upper = hypre_TAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+   dinv  = hypre_TAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+
+   /* Factor the lines (padding lanes get the identity equation) */
+   hypre_ForBoxI(fi, base_points)
+   {
+      box    = hypre_BoxArrayBox(base_points, fi);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      hypre_BoxGetStrideSize(box, base_stride, loop_size);
+      hypre_CycRedBatchedLineInfo(ndim, cdir, loop_size, base_stride, A_dbox,
+                                  &n, &m, osize, ostride, &lstride);
+      nb = (m + bsize - 1) / bsize;
+
+      hypre_SetIndex(index, 0);
+      Ap = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_IndexD(index, cdir) = -1;
+      Awp = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_IndexD(index, cdir) = 1;
+      Aep = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+      for (b = 0; b < nb; b++)
+      {
+         HYPRE_Real *lo = lower + batch_offsets[fi] + b * n * bsize;
+         HYPRE_Real *up = upper + batch_offsets[fi] + b * n * bsize;
+         HYPRE_Real *di = dinv  + batch_offsets[fi] + b * n * bsize;
+
+         for (lane = 0; lane < bsize; lane++)
+         {
+            line = b * bsize + lane;
+            if (line >= m)
+            {
+               for (i = 0; i < n; i++)
+               {
+                  lo[i * bsize + lane] = 0.0;
+                  up[i * bsize + lane] = 0.0;
+                  di[i * bsize + lane] = 1.0;
+               }
+               continue;
+            }
+
+            Ai = hypre_BoxIndexRank(A_dbox, hypre_BoxIMin(box)) +
+                 (line % osize[0]) * ostride[0] + (line / osize[0]) * ostride[1];
+            for (i = 0; i < n; i++, Ai += lstride)
+            {
+               HYPRE_Real a = (i > 0)     ? Awp[Ai] : 0.0;
+               HYPRE_Real c = (i < n - 1) ? Aep[Ai] : 0.0;
+               HYPRE_Real pivot = Ap[Ai];
+
+               if (i > 0)
+               {
+                  pivot -= a * up[(i - 1) * bsize + lane];
+               }
+               if (pivot == 0.0)
+               {
+                  local_ok = 0;
+                  pivot = 1.0;
+               }
+               lo[i * bsize + lane] = a;
+               di[i * bsize + lane] = 1.0 / pivot;
+               up[i * bsize + lane] = c / pivot;
+            }
+         }
+      }
+   }
+
+   hypre_MPI_Allreduce(&local_ok, &ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!ok)
+   {
+      hypre_BoxArrayDestroy(base_points);
+      hypre_TFree(batch_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(lower, HYPRE_MEMORY_HOST);
+      hypre_TFree(upper, HYPRE_MEMORY_HOST);
+      hypre_TFree(dinv, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   (cyc_red_data -> batched)       = 1;
+   (cyc_red_data -> base_points)   = base_points;
+   (cyc_red_data -> batch_offsets) = batch_offsets;
+   (cyc_red_data -> batch_lower)   = lower;
+   (cyc_red_data -> batch_upper)   = upper;
+   (cyc_red_data -> batch_dinv)    = dinv;
+   (cyc_red_data -> batch_work)    = hypre_TAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSolveBatched
+ *
+ * Solves with the line factorization computed in hypre_CycRedSetupBatched.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedSolveBatched( hypre_CyclicReductionData *cyc_red_data,
+                          hypre_StructVector        *b,
+                          hypre_StructVector        *x )
+{
+   HYPRE_Int             cdir          = (cyc_red_data -> cdir);
+   hypre_IndexRef        base_stride   = (cyc_red_data -> base_stride);
+   hypre_BoxArray       *base_points   = (cyc_red_data -> base_points);
+   HYPRE_Int            *batch_offsets = (cyc_red_data -> batch_offsets);
+   HYPRE_Int             ndim          = hypre_StructVectorNDim(x);
+   HYPRE_Int             bsize         = HYPRE_CYCRED_BATCH_SIZE;
+
+   hypre_Box            *box;
+   hypre_Box            *x_dbox;
+   hypre_Box            *b_dbox;
+   hypre_Index           loop_size;
+
+   HYPRE_Real           *xp, *bp;
+   HYPRE_Int             xosize[2], xostride[2], xlstride, xstart;
+   HYPRE_Int             bosize[2], bostride[2], blstride, bstart;
+   HYPRE_Int             n, m, nb, fi, bi;
+
+   hypre_ForBoxI(fi, base_points)
+   {
+      box    = hypre_BoxArrayBox(base_points, fi);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), fi);
+      xp     = hypre_StructVectorBoxData(x, fi);
+      bp     = hypre_StructVectorBoxData(b, fi);
+
+      hypre_BoxGetStrideSize(box, base_stride, loop_size);
+      hypre_CycRedBatchedLineInfo(ndim, cdir, loop_size, base_stride, x_dbox,
+                                  &n, &m, xosize, xostride, &xlstride);
+      hypre_CycRedBatchedLineInfo(ndim, cdir, loop_size, base_stride, b_dbox,
+                                  &n, &m, bosize, bostride, &blstride);
+      if (n == 0 || m == 0)
+      {
+         continue;
+      }
+      xstart = hypre_BoxIndexRank(x_dbox, hypre_BoxIMin(box));
+      bstart = hypre_BoxIndexRank(b_dbox, hypre_BoxIMin(box));
+      nb = (m + bsize - 1) / bsize;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(bi) HYPRE_SMP_SCHEDULE
+#endif
+      for (bi = 0; bi < nb; bi++)
+      {
+         HYPRE_Int   offset = batch_offsets[fi] + bi * n * bsize;
+         HYPRE_Real *lo = (cyc_red_data -> batch_lower) + offset;
+         HYPRE_Real *up = (cyc_red_data -> batch_upper) + offset;
+         HYPRE_Real *di = (cyc_red_data -> batch_dinv)  + offset;
+         HYPRE_Real *d  = (cyc_red_data -> batch_work)  + offset;
+         HYPRE_Int   lane, line, i, xi, bj;
+
+         /* gather the right-hand side */
+         for (lane = 0; lane < bsize; lane++)
+         {
+            line = bi * bsize + lane;
+            if (line < m)
+            {
+               bj = bstart + (line % bosize[0]) * bostride[0] +
+                    (line / bosize[0]) * bostride[1];
+               for (i = 0; i < n; i++, bj += blstride)
+               {
+                  d[i * bsize + lane] = bp[bj];
+               }
+            }
+            else
+            {
+               for (i = 0; i < n; i++)
+               {
+                  d[i * bsize + lane] = 0.0;
+               }
+            }
+         }
+
+         /* forward elimination */
+         for (lane = 0; lane < bsize; lane++)
+         {
+            d[lane] *= di[lane];
+         }
+         for (i = 1; i < n; i++)
+         {
+            HYPRE_Real *dc = d  + i * bsize;
+            HYPRE_Real *dp = dc - bsize;
+            HYPRE_Real *lc = lo + i * bsize;
+            HYPRE_Real *ic = di + i * bsize;
+
+            for (lane = 0; lane < bsize; lane++)
+            {
+               dc[lane] = (dc[lane] - lc[lane] * dp[lane]) * ic[lane];
+            }
+         }
+
+         /* back substitution */
+         for (i = n - 2; i >= 0; i--)
+         {
+            HYPRE_Real *dc = d  + i * bsize;
+            HYPRE_Real *dn = dc + bsize;
+            HYPRE_Real *uc = up + i * bsize;
+
+            for (lane = 0; lane < bsize; lane++)
+            {
+               dc[lane] -= uc[lane] * dn[lane];
+            }
+         }
+
+         /* scatter the solution */
+         for (lane = 0; lane < bsize; lane++)
+         {
+            line = bi * bsize + lane;
+            if (line < m)
+            {
+               xi = xstart + (line % xosize[0]) * xostride[0] +
+                    (line / xosize[0]) * xostride[1];
+               for (i = 0; i < n; i++, xi += xlstride)
+               {
+                  xp[xi] = d[i * bsize + lane];
+               }
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionSetup
  *--------------------------------------------------------------------------*/
@@ -506,11 +903,48 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    HYPRE_MemoryLocation    memory_location = hypre_StructMatrixMemoryLocation(A);
 
+   grid = hypre_StructMatrixGrid(A);
+
    /*-----------------------------------------------------
-    * Set up coarse grids
+    * Use the batched line solver if possible.  Only the
+    * finest level is kept in this case.
     *-----------------------------------------------------*/
 
-   grid = hypre_StructMatrixGrid(A);
+   hypre_CycRedSetupBatched(cyc_red_data, A);
+   if (cyc_red_data -> batched)
+   {
+      num_levels = 1;
+      grid_l = hypre_TAlloc(hypre_StructGrid *, num_levels, HYPRE_MEMORY_HOST);
+      fine_points_l = hypre_TAlloc(hypre_BoxArray *, num_levels, HYPRE_MEMORY_HOST);
+      A_l = hypre_TAlloc(hypre_StructMatrix *, num_levels, HYPRE_MEMORY_HOST);
+      x_l = hypre_TAlloc(hypre_StructVector *, num_levels, HYPRE_MEMORY_HOST);
+      hypre_StructGridRef(grid, &grid_l[0]);
+      fine_points_l[0] = hypre_BoxArrayDuplicate(cyc_red_data -> base_points);
+      A_l[0] = hypre_StructMatrixRef(A);
+      x_l[0] = hypre_StructVectorRef(x);
+
+      (cyc_red_data -> ndim)               = hypre_StructGridNDim(grid);
+      (cyc_red_data -> num_levels)         = num_levels;
+      (cyc_red_data -> grid_l)             = grid_l;
+      (cyc_red_data -> fine_points_l)      = fine_points_l;
+      (cyc_red_data -> A_l)                = A_l;
+      (cyc_red_data -> x_l)                = x_l;
+      (cyc_red_data -> down_compute_pkg_l) = NULL;
+      (cyc_red_data -> up_compute_pkg_l)   = NULL;
+      (cyc_red_data -> memory_location)    = memory_location;
+
+      flop_divisor = (hypre_IndexX(base_stride) *
+                      hypre_IndexY(base_stride) *
+                      hypre_IndexZ(base_stride)  );
+      (cyc_red_data -> solve_flops) =
+         5 * hypre_StructVectorGlobalSize(x) / (HYPRE_BigInt)flop_divisor;
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------
+    * Set up coarse grids
+    *-----------------------------------------------------*/
 
    /* Compute a preliminary num_levels value based on the grid */
    cbox = hypre_BoxDuplicate(hypre_StructGridBoundingBox(grid));
@@ -814,6 +1248,15 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
 
    hypre_BeginTiming(cyc_red_data -> time_index);
 
+   if (cyc_red_data -> batched)
+   {
+      hypre_CycRedSolveBatched(cyc_red_data, b, x);
+
+      hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+      hypre_EndTiming(cyc_red_data -> time_index);
+
+      return hypre_error_flag;
+   }
 
    /*--------------------------------------------------
     * Initialize some things
@@ -1202,6 +1645,24 @@ hypre_CyclicReductionSetCDir( void        *cyc_red_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CyclicReductionSetBatching
+ *
+ * If 'batching' is nonzero, setup uses the batched line solver whenever it
+ * applies (see hypre_CycRedSetupBatched).  The default is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CyclicReductionSetBatching( void        *cyc_red_vdata,
+                                  HYPRE_Int    batching )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *)cyc_red_vdata;
+
+   (cyc_red_data -> batching) = batching;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionDestroy
  *--------------------------------------------------------------------------*/
@@ -1238,6 +1699,11 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
       hypre_TFree(cyc_red_data -> x_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> down_compute_pkg_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> up_compute_pkg_l, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> batch_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> batch_lower, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> batch_upper, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> batch_dinv, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> batch_work, HYPRE_MEMORY_HOST);
 
       hypre_FinalizeTiming(cyc_red_data -> time_index);
       hypre_TFree(cyc_red_data, HYPRE_MEMORY_HOST);
@@ -468,6 +468,8 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(pcg_functions, hypre_StructKrylovMassInnerProd,
+                                 hypre_StructKrylovAxpyNorm, hypre_StructKrylovXpay);
    krylov_solver = hypre_PCGCreate( pcg_functions );
 
    hypre_PCGSetTol(krylov_solver, tol);
@@ -507,6 +509,8 @@ hypre_HybridSolveUseGMRES( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_GMRESFunctionsSetFusedOps(gmres_functions, hypre_StructKrylovMassAxpy,
+                                   hypre_StructKrylovAxpyNorm);
    krylov_solver = hypre_GMRESCreate( gmres_functions );
 
    hypre_GMRESSetTol(krylov_solver, tol);
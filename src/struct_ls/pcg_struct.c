@@ -182,6 +182,63 @@ hypre_StructKrylovAxpy( HYPRE_Complex alpha,
                               (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMassInnerProd( void      *x,
+                                 void     **y,
+                                 HYPRE_Int  k,
+                                 HYPRE_Int  unroll,
+                                 void      *result )
+{
+   HYPRE_UNUSED_VAR(unroll);
+
+   return ( hypre_StructMassInnerProd( (hypre_StructVector *) x,
+                                       (hypre_StructVector **) y, k,
+                                       (HYPRE_Real *) result ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovMassAxpy( HYPRE_Complex  *alpha,
+                            void          **x,
+                            void           *y,
+                            HYPRE_Int       k,
+                            HYPRE_Int       unroll )
+{
+   HYPRE_UNUSED_VAR(unroll);
+
+   return ( hypre_StructMassAxpy( alpha, (hypre_StructVector **) x,
+                                  (hypre_StructVector *) y, k ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructKrylovAxpyNorm( HYPRE_Complex alpha,
+                            void   *x,
+                            void   *y )
+{
+   return ( hypre_StructAxpyNorm( alpha, (hypre_StructVector *) x,
+                                  (hypre_StructVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovXpay( HYPRE_Complex beta,
+                        void   *x,
+                        void   *y )
+{
+   return ( hypre_StructXpay( beta, (hypre_StructVector *) x,
+                              (hypre_StructVector *) y ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -5661,3 +5661,438 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC1(
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMG3BuildRAPHost
+ *
+ * Host routine that computes both the lower and upper triangular parts of
+ * a variable coefficient RAP in a single pass (it replaces the calls to
+ * hypre_PFMG3BuildRAPSym and hypre_PFMG3BuildRAPNoSym).
+ *
+ * Instead of one hand-expanded BoxLoop per fine stencil size, the Galerkin
+ * product is written as a short list of terms built from the stencil of A.
+ * With f = F(c) the fine point under the coarse point c, a fine stencil entry
+ * a and s = -1, 0, 1 in direction cdir, each term has the form
+ *
+ *    RAP(c; e) += R(c, f+s) * A(f+s; a) * P(f+s+a, c+e)
+ *
+ * where e is a with its cdir component replaced by the coarse offset dz.
+ * Since the c-to-c interpolation is the identity, R and P are one for s = 0
+ * and t = s + a_cdir - 2*dz = 0 respectively.
+ *
+ * The coarse boxes are split into small tiles (a few x-lines each), and the
+ * tiles of all boxes are distributed over the threads at once.  All stored
+ * coefficients of RAP on a tile are computed while the tile is in cache, up to
+ * four terms at a time, and the innermost loops run over the unit-stride
+ * direction so they vectorize.  Fine stencils contained in the 27-point
+ * stencil are supported.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_PFMG_RAP_TILE_SIZE  1024
+#define hypre_PFMG_RAP_GROUP_SIZE 4
+
+typedef struct
+{
+   HYPRE_Complex *A_data;
+   HYPRE_Complex *R_data;     /* NULL for a unit weight */
+   HYPRE_Complex *P_data;     /* NULL for a unit weight */
+   HYPRE_Int      A_offset;
+   HYPRE_Int      R_offset;
+   HYPRE_Int      P_offset;
+
+} hypre_PFMGRAPTermData;
+
+/* rap = value for the first group of an entry, rap += value otherwise */
+#define hypre_PFMGRAPGroupLoop(value)           \
+   if (first)                                   \
+   {                                            \
+      for (i = 0; i < nx; i++)                  \
+      {                                         \
+         rp[i] = value;                         \
+      }                                         \
+   }                                            \
+   else                                         \
+   {                                            \
+      for (i = 0; i < nx; i++)                  \
+      {                                         \
+         rp[i] += value;                        \
+      }                                         \
+   }
+
+#define hypre_PFMGRAPTermValue(q) (wr[q][i] * wa[q][i * sx] * wp[q][i])
+
+HYPRE_Int
+hypre_PFMG3BuildRAPHost( hypre_StructMatrix *A,
+                         hypre_StructMatrix *P,
+                         hypre_StructMatrix *R,
+                         HYPRE_Int           cdir,
+                         hypre_Index         cindex,
+                         hypre_Index         cstride,
+                         hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil    *A_stencil   = hypre_StructMatrixStencil(A);
+   hypre_Index            *A_shape     = hypre_StructStencilShape(A_stencil);
+   HYPRE_Int               A_size      = hypre_StructStencilSize(A_stencil);
+   hypre_StructStencil    *RAP_stencil = hypre_StructMatrixStencil(RAP);
+   HYPRE_Int               RAP_size    = hypre_StructStencilSize(RAP_stencil);
+   HYPRE_Int              *RAP_symm    = hypre_StructMatrixSymmElements(RAP);
+
+   hypre_StructGrid       *fgrid       = hypre_StructMatrixGrid(A);
+   HYPRE_Int              *fgrid_ids   = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid       *cgrid       = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray         *cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int              *cgrid_ids   = hypre_StructGridIDs(cgrid);
+   HYPRE_Int               num_boxes   = hypre_BoxArraySize(cgrid_boxes);
+
+   /* Terms (A entry, s, t, coarse offset), grouped by RAP stencil entry */
+   HYPRE_Int              *term_A, *term_s, *term_t;
+   hypre_Index            *term_shape;
+   HYPRE_Int               num_terms;
+
+   /* Groups of at most hypre_PFMG_RAP_GROUP_SIZE terms of the same entry */
+   HYPRE_Int              *group_entry, *group_start, *group_first;
+   HYPRE_Int               num_groups;
+
+   hypre_PFMGRAPTermData  *term_data;
+   HYPRE_Complex         **group_data;
+   HYPRE_Complex          *ones;
+   HYPRE_Int              *fis, *rows_per_tile, *tile_starts;
+   HYPRE_Int               num_tiles, max_nx;
+
+   hypre_Box              *cgrid_box;
+   hypre_Box              *A_dbox, *P_dbox, *R_dbox;
+   hypre_Index             index, loop_size;
+   HYPRE_Int               P_pa, P_pb, R_ra, R_rb;
+   HYPRE_Int               zOffsetA, zOffsetP, zOffsetR;
+   HYPRE_Int               ci, fi, a, e, g, m, s, dz, t, entry_size;
+
+   /*-----------------------------------------------------------------------
+    * Build the list of terms from the fine grid stencil.  For symmetric
+    * storage, only the stored entries of RAP are built.  Stored entries
+    * without any terms (e.g., the corners for a 7-point A) get one group
+    * with no terms, which sets them to zero.
+    *-----------------------------------------------------------------------*/
+
+   term_A      = hypre_TAlloc(HYPRE_Int, 6 * A_size, HYPRE_MEMORY_HOST);
+   term_s      = hypre_TAlloc(HYPRE_Int, 6 * A_size, HYPRE_MEMORY_HOST);
+   term_t      = hypre_TAlloc(HYPRE_Int, 6 * A_size, HYPRE_MEMORY_HOST);
+   term_shape  = hypre_TAlloc(hypre_Index, 6 * A_size, HYPRE_MEMORY_HOST);
+   group_entry = hypre_TAlloc(HYPRE_Int, 6 * A_size + RAP_size + 1, HYPRE_MEMORY_HOST);
+   group_start = hypre_TAlloc(HYPRE_Int, 6 * A_size + RAP_size + 1, HYPRE_MEMORY_HOST);
+   group_first = hypre_TAlloc(HYPRE_Int, 6 * A_size + RAP_size + 1, HYPRE_MEMORY_HOST);
+
+   num_terms  = 0;
+   num_groups = 0;
+   for (e = 0; e < RAP_size; e++)
+   {
+      if (RAP_symm[e] >= 0)
+      {
+         continue;
+      }
+
+      entry_size = 0;
+      for (a = 0; a < A_size; a++)
+      {
+         for (s = -1; s < 2; s++)
+         {
+            for (dz = -1; dz < 2; dz++)
+            {
+               t = s + hypre_IndexD(A_shape[a], cdir) - 2 * dz;
+               if (t < -1 || t > 1)
+               {
+                  continue;
+               }
+
+               hypre_CopyIndex(A_shape[a], index);
+               hypre_IndexD(index, cdir) = dz;
+               if (hypre_StructStencilElementRank(RAP_stencil, index) != e)
+               {
+                  continue;
+               }
+
+               if ((entry_size % hypre_PFMG_RAP_GROUP_SIZE) == 0)
+               {
+                  group_entry[num_groups] = e;
+                  group_start[num_groups] = num_terms;
+                  group_first[num_groups] = (entry_size == 0);
+                  num_groups++;
+               }
+
+               term_A[num_terms] = a;
+               term_s[num_terms] = s;
+               term_t[num_terms] = t;
+               hypre_CopyIndex(index, term_shape[num_terms]);
+               num_terms++;
+               entry_size++;
+            }
+         }
+      }
+
+      if (entry_size == 0)
+      {
+         group_entry[num_groups] = e;
+         group_start[num_groups] = num_terms;
+         group_first[num_groups] = 1;
+         num_groups++;
+      }
+   }
+   group_start[num_groups] = num_terms;
+
+   /* Stencil ranks of the interpolation and restriction weights */
+   hypre_SetIndex3(index, 0, 0, 0);
+   hypre_IndexD(index, cdir) = -1;
+   P_pa = hypre_StructStencilElementRank(hypre_StructMatrixStencil(P), index);
+   R_ra = hypre_StructStencilElementRank(hypre_StructMatrixStencil(R), index);
+   hypre_IndexD(index, cdir) = 1;
+   P_pb = hypre_StructStencilElementRank(hypre_StructMatrixStencil(P), index);
+   R_rb = hypre_StructStencilElementRank(hypre_StructMatrixStencil(R), index);
+
+   /*-----------------------------------------------------------------------
+    * Set up per-box term data and the tile partitioning over all boxes
+    *-----------------------------------------------------------------------*/
+
+   fis           = hypre_TAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   rows_per_tile = hypre_TAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   tile_starts   = hypre_TAlloc(HYPRE_Int, num_boxes + 1, HYPRE_MEMORY_HOST);
+   term_data     = hypre_TAlloc(hypre_PFMGRAPTermData, num_boxes * num_terms, HYPRE_MEMORY_HOST);
+   group_data    = hypre_TAlloc(HYPRE_Complex *, num_boxes * num_groups, HYPRE_MEMORY_HOST);
+
+   fi = 0;
+   max_nx = 0;
+   tile_starts[0] = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      fis[ci] = fi;
+
+      /* Tiles are blocks of rows_per_tile x-lines in one plane of the box */
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+      hypre_BoxGetSize(cgrid_box, loop_size);
+      max_nx = hypre_max(max_nx, loop_size[0]);
+      rows_per_tile[ci] = hypre_max(1, hypre_PFMG_RAP_TILE_SIZE / hypre_max(1, loop_size[0]));
+      tile_starts[ci + 1] = tile_starts[ci];
+      if (hypre_BoxVolume(cgrid_box) > 0)
+      {
+         tile_starts[ci + 1] += loop_size[2] *
+                                ((loop_size[1] + rows_per_tile[ci] - 1) / rows_per_tile[ci]);
+      }
+
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      P_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(P), fi);
+      R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+
+      hypre_SetIndex3(index, 0, 0, 0);
+      hypre_IndexD(index, cdir) = 1;
+      zOffsetA = hypre_BoxOffsetDistance(A_dbox, index);
+      zOffsetP = hypre_BoxOffsetDistance(P_dbox, index);
+      zOffsetR = hypre_BoxOffsetDistance(R_dbox, index);
+
+      for (g = 0; g < num_groups; g++)
+      {
+         group_data[ci * num_groups + g] = hypre_StructMatrixBoxData(RAP, ci, group_entry[g]);
+      }
+
+      for (m = 0; m < num_terms; m++)
+      {
+         hypre_PFMGRAPTermData *td = &term_data[ci * num_terms + m];
+
+         s = term_s[m];
+         t = term_t[m];
+
+         td -> A_data   = hypre_StructMatrixBoxData(A, fi, term_A[m]);
+         td -> A_offset = s * zOffsetA;
+
+         /* R(c, f+1) is stored at c, R(c, f-1) at the point below c */
+         td -> R_data   = NULL;
+         td -> R_offset = 0;
+         if (s == 1)
+         {
+            td -> R_data = hypre_StructMatrixBoxData(R, fi, R_ra);
+         }
+         else if (s == -1)
+         {
+            td -> R_data   = hypre_StructMatrixBoxData(R, fi, R_rb);
+            td -> R_offset = -zOffsetR;
+         }
+
+         /* Same for P, relative to the coarse point c+e */
+         td -> P_data   = NULL;
+         td -> P_offset = hypre_BoxOffsetDistance(P_dbox, term_shape[m]);
+         if (t == 1)
+         {
+            td -> P_data = hypre_StructMatrixBoxData(P, fi, P_pa);
+         }
+         else if (t == -1)
+         {
+            td -> P_data    = hypre_StructMatrixBoxData(P, fi, P_pb);
+            td -> P_offset -= zOffsetP;
+         }
+      }
+   }
+   num_tiles = tile_starts[num_boxes];
+
+   /* Unit weights, so that all terms of a group have the same form */
+   ones = hypre_TAlloc(HYPRE_Complex, max_nx, HYPRE_MEMORY_HOST);
+   for (m = 0; m < max_nx; m++)
+   {
+      ones[m] = 1.0;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Compute RAP one tile at a time
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ci, fi, g, m) HYPRE_SMP_SCHEDULE
+#endif
+   for (HYPRE_Int tile = 0; tile < num_tiles; tile++)
+   {
+      hypre_Box             *c_box, *A_box, *P_box, *R_box, *RAP_box;
+      hypre_Index            lsize, cidx, fidx;
+      HYPRE_Int              lo, hi, mid, j, k, i, q, jj, nx, nrows, nblocks;
+      HYPRE_Int              sx, sA, sAc, sR[hypre_PFMG_RAP_GROUP_SIZE], sP[hypre_PFMG_RAP_GROUP_SIZE];
+      HYPRE_Int              iA0, iP0, iR0, iAc0, first, nterms;
+      hypre_PFMGRAPTermData *td;
+      HYPRE_Complex         *rp;
+      HYPRE_Complex         *ta[hypre_PFMG_RAP_GROUP_SIZE];
+      HYPRE_Complex         *tr[hypre_PFMG_RAP_GROUP_SIZE];
+      HYPRE_Complex         *tp[hypre_PFMG_RAP_GROUP_SIZE];
+      HYPRE_Complex         *wa[hypre_PFMG_RAP_GROUP_SIZE];
+      HYPRE_Complex         *wr[hypre_PFMG_RAP_GROUP_SIZE];
+      HYPRE_Complex         *wp[hypre_PFMG_RAP_GROUP_SIZE];
+
+      /* Find the box that owns this tile */
+      lo = 0;
+      hi = num_boxes - 1;
+      while (lo < hi)
+      {
+         mid = (lo + hi + 1) / 2;
+         if (tile_starts[mid] <= tile)
+         {
+            lo = mid;
+         }
+         else
+         {
+            hi = mid - 1;
+         }
+      }
+      ci = lo;
+      fi = fis[ci];
+
+      c_box   = hypre_BoxArrayBox(cgrid_boxes, ci);
+      A_box   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      P_box   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(P), fi);
+      R_box   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+      RAP_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+
+      hypre_BoxGetSize(c_box, lsize);
+      nx      = lsize[0];
+      nblocks = (lsize[1] + rows_per_tile[ci] - 1) / rows_per_tile[ci];
+      j       = ((tile - tile_starts[ci]) % nblocks) * rows_per_tile[ci];
+      k       = (tile - tile_starts[ci]) / nblocks;
+      nrows   = hypre_min(rows_per_tile[ci], lsize[1] - j);
+
+      hypre_CopyIndex(hypre_BoxIMin(c_box), cidx);
+      hypre_IndexD(cidx, 1) += j;
+      hypre_IndexD(cidx, 2) += k;
+      hypre_StructMapCoarseToFine(cidx, cindex, cstride, fidx);
+
+      iA0  = hypre_BoxIndexRank(A_box, fidx);
+      iP0  = hypre_BoxIndexRank(P_box, cidx);
+      iR0  = hypre_BoxIndexRank(R_box, cidx);
+      iAc0 = hypre_BoxIndexRank(RAP_box, cidx);
+
+      /* Strides along x and between consecutive rows of the tile */
+      sx  = hypre_IndexD(cstride, 0);
+      sA  = hypre_BoxSizeD(A_box, 0) * hypre_IndexD(cstride, 1);
+      sAc = hypre_BoxSizeD(RAP_box, 0);
+
+      for (g = 0; g < num_groups; g++)
+      {
+         first  = group_first[g];
+         nterms = group_start[g + 1] - group_start[g];
+         for (q = 0; q < nterms; q++)
+         {
+            td = &term_data[ci * num_terms + group_start[g] + q];
+
+            ta[q] = (td -> A_data) + iA0 + (td -> A_offset);
+            tr[q] = ones;
+            sR[q] = 0;
+            if (td -> R_data)
+            {
+               tr[q] = (td -> R_data) + iR0 + (td -> R_offset);
+               sR[q] = hypre_BoxSizeD(R_box, 0);
+            }
+            tp[q] = ones;
+            sP[q] = 0;
+            if (td -> P_data)
+            {
+               tp[q] = (td -> P_data) + iP0 + (td -> P_offset);
+               sP[q] = hypre_BoxSizeD(P_box, 0);
+            }
+         }
+
+         for (jj = 0; jj < nrows; jj++)
+         {
+            rp = group_data[ci * num_groups + g] + iAc0 + jj * sAc;
+            for (q = 0; q < nterms; q++)
+            {
+               wa[q] = ta[q] + jj * sA;
+               wr[q] = tr[q] + jj * sR[q];
+               wp[q] = tp[q] + jj * sP[q];
+            }
+
+            switch (nterms)
+            {
+               case 0:
+                  hypre_PFMGRAPGroupLoop(0.0);
+                  break;
+
+               case 1:
+                  hypre_PFMGRAPGroupLoop(hypre_PFMGRAPTermValue(0));
+                  break;
+
+               case 2:
+                  hypre_PFMGRAPGroupLoop(hypre_PFMGRAPTermValue(0) +
+                                         hypre_PFMGRAPTermValue(1));
+                  break;
+
+               case 3:
+                  hypre_PFMGRAPGroupLoop(hypre_PFMGRAPTermValue(0) +
+                                         hypre_PFMGRAPTermValue(1) +
+                                         hypre_PFMGRAPTermValue(2));
+                  break;
+
+               default:
+                  hypre_PFMGRAPGroupLoop(hypre_PFMGRAPTermValue(0) +
+                                         hypre_PFMGRAPTermValue(1) +
+                                         hypre_PFMGRAPTermValue(2) +
+                                         hypre_PFMGRAPTermValue(3));
+                  break;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(term_A, HYPRE_MEMORY_HOST);
+   hypre_TFree(term_s, HYPRE_MEMORY_HOST);
+   hypre_TFree(term_t, HYPRE_MEMORY_HOST);
+   hypre_TFree(term_shape, HYPRE_MEMORY_HOST);
+   hypre_TFree(group_entry, HYPRE_MEMORY_HOST);
+   hypre_TFree(group_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(group_first, HYPRE_MEMORY_HOST);
+   hypre_TFree(fis, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows_per_tile, HYPRE_MEMORY_HOST);
+   hypre_TFree(tile_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(term_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(group_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(ones, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+#undef hypre_PFMGRAPGroupLoop
+#undef hypre_PFMGRAPTermValue
@@ -17,6 +17,16 @@ typedef struct
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
+   /* line relaxation (relax_type 4) */
+   MPI_Comm                comm;
+   HYPRE_Int               line_dir;
+   hypre_StructMatrix     *A_line;
+   void                   *line_solve_data;
+   void                   *line_matvec_data;
+   hypre_StructVector     *t;
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+
 } hypre_PFMGRelaxData;
 
 /*--------------------------------------------------------------------------
@@ -32,6 +42,9 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> comm) = comm;
+   (pfmg_relax_data -> line_dir) = 0;
+   (pfmg_relax_data -> max_iter) = 1000;
 
    return (void *) pfmg_relax_data;
 }
@@ -48,6 +61,8 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_PFMGLineRelaxDestroy(pfmg_relax_data);
+      hypre_StructVectorDestroy(pfmg_relax_data -> t);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -85,6 +100,9 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
 
+         break;
+      case 4:
+         hypre_PFMGLineRelax(pfmg_relax_data, A, b, x);
          break;
    }
 
@@ -104,6 +122,13 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight);
 
+   /* line relaxation needs variable coefficients; use weighted Jacobi instead */
+   if (relax_type == 4 && hypre_StructMatrixConstantCoefficient(A))
+   {
+      relax_type = 1;
+      (pfmg_relax_data -> relax_type) = relax_type;
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -114,6 +139,9 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_PFMGLineRelaxSetup(pfmg_relax_data, A, x);
+         break;
    }
 
    if (relax_type == 1)
@@ -154,6 +182,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
 
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
+      case 4: /* Line Jacobi */
          break;
    }
 
@@ -254,6 +283,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   (pfmg_relax_data -> max_iter) = max_iter;
 
    return hypre_error_flag;
 }
@@ -269,6 +299,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   (pfmg_relax_data -> zero_guess) = zero_guess;
 
    return hypre_error_flag;
 }
@@ -284,6 +315,160 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
 
    hypre_PointRelaxSetTempVec((pfmg_relax_data -> relax_data), t);
 
+   hypre_StructVectorDestroy(pfmg_relax_data -> t);
+   (pfmg_relax_data -> t) = hypre_StructVectorRef(t);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set the direction of the lines used by line relaxation (relax_type 4).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDir( void      *pfmg_relax_vdata,
+                           HYPRE_Int  line_dir         )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> line_dir) = line_dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Line Jacobi relaxation:
+ *
+ *   x <- x + w * T^{-1} (b - A x)
+ *
+ * where T is the tridiagonal part of A along line_dir.  The line solves are
+ * done with cyclic reduction, which uses its batched line solver whenever the
+ * lines do not cross box boundaries.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelaxSetup( void               *pfmg_relax_vdata,
+                          hypre_StructMatrix *A,
+                          hypre_StructVector *x                )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+   HYPRE_Int            line_dir        = (pfmg_relax_data -> line_dir);
+   hypre_StructStencil *stencil         = hypre_StructMatrixStencil(A);
+   hypre_Index         *stencil_shape   = hypre_StructStencilShape(stencil);
+   HYPRE_Int            stencil_size    = hypre_StructStencilSize(stencil);
+   HYPRE_Int            ndim            = hypre_StructStencilNDim(stencil);
+
+   HYPRE_Int           *stencil_indices;
+   HYPRE_Int            num_stencil_indices;
+   HYPRE_Int            i, d, on_line;
+
+   hypre_PFMGLineRelaxDestroy(pfmg_relax_data);
+
+   stencil_indices = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   num_stencil_indices = 0;
+   for (i = 0; i < stencil_size; i++)
+   {
+      on_line = (hypre_abs(hypre_IndexD(stencil_shape[i], line_dir)) <= 1);
+      for (d = 0; d < ndim; d++)
+      {
+         if ((d != line_dir) && (hypre_IndexD(stencil_shape[i], d) != 0))
+         {
+            on_line = 0;
+         }
+      }
+      if (on_line)
+      {
+         stencil_indices[num_stencil_indices] = i;
+         num_stencil_indices++;
+      }
+   }
+
+   (pfmg_relax_data -> A_line) =
+      hypre_StructMatrixCreateMask(A, num_stencil_indices, stencil_indices);
+   hypre_TFree(stencil_indices, HYPRE_MEMORY_HOST);
+
+   (pfmg_relax_data -> line_solve_data) =
+      hypre_CyclicReductionCreate(pfmg_relax_data -> comm);
+   hypre_CyclicReductionSetCDir((pfmg_relax_data -> line_solve_data), line_dir);
+   hypre_CyclicReductionSetBatching((pfmg_relax_data -> line_solve_data), 1);
+   hypre_CyclicReductionSetup((pfmg_relax_data -> line_solve_data),
+                              (pfmg_relax_data -> A_line),
+                              (pfmg_relax_data -> t), (pfmg_relax_data -> t));
+
+   (pfmg_relax_data -> line_matvec_data) = hypre_StructMatvecCreate();
+   hypre_StructMatvecSetup((pfmg_relax_data -> line_matvec_data), A, x);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelax( void               *pfmg_relax_vdata,
+                     hypre_StructMatrix *A,
+                     hypre_StructVector *b,
+                     hypre_StructVector *x                )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+   hypre_StructVector  *t               = (pfmg_relax_data -> t);
+   HYPRE_Real           weight          = (pfmg_relax_data -> jacobi_weight);
+   HYPRE_Int            max_iter        = (pfmg_relax_data -> max_iter);
+   HYPRE_Int            iter;
+
+   if (weight == 0.0)
+   {
+      weight = 1.0;
+   }
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      /* t = T^{-1} (b - A x) */
+      hypre_StructCopy(b, t);
+      if (iter > 0 || !(pfmg_relax_data -> zero_guess))
+      {
+         hypre_StructMatvecCompute((pfmg_relax_data -> line_matvec_data),
+                                   -1.0, A, x, 1.0, t);
+      }
+      hypre_CyclicReduction((pfmg_relax_data -> line_solve_data),
+                            (pfmg_relax_data -> A_line), t, t);
+
+      /* x = x + w t */
+      if (iter == 0 && (pfmg_relax_data -> zero_guess))
+      {
+         hypre_StructCopy(t, x);
+         hypre_StructScale(weight, x);
+      }
+      else
+      {
+         hypre_StructAxpy(weight, t, x);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelaxDestroy( void *pfmg_relax_vdata )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   if (pfmg_relax_data -> line_solve_data)
+   {
+      hypre_CyclicReductionDestroy(pfmg_relax_data -> line_solve_data);
+      (pfmg_relax_data -> line_solve_data) = NULL;
+   }
+   if (pfmg_relax_data -> line_matvec_data)
+   {
+      hypre_StructMatvecDestroy(pfmg_relax_data -> line_matvec_data);
+      (pfmg_relax_data -> line_matvec_data) = NULL;
+   }
+   hypre_StructMatrixDestroy(pfmg_relax_data -> A_line);
+   (pfmg_relax_data -> A_line) = NULL;
+
    return hypre_error_flag;
 }
 
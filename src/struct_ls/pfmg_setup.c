@@ -660,6 +660,10 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   if (num_levels > 1)
+   {
+      hypre_PFMGRelaxSetLineDir(relax_data_l[0], cdir_l[0]);
+   }
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
@@ -680,6 +684,10 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            if (l < num_levels - 1)
+            {
+               hypre_PFMGRelaxSetLineDir(relax_data_l[l], cdir_l[l]);
+            }
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
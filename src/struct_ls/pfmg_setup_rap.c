@@ -162,6 +162,21 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
 
          case 3:
 
+#ifdef HYPRE_USING_OPENMP
+            /*--------------------------------------------------------------------
+             *    With several host threads, variable coefficient operators are
+             *    computed by a single tiled pass over all boxes
+             *--------------------------------------------------------------------*/
+            if (hypre_NumThreads() > 1 &&
+                hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) == HYPRE_EXEC_HOST &&
+                hypre_StructMatrixConstantCoefficient(A) == 0 &&
+                hypre_StructMatrixConstantCoefficient(Ac_tmp) == 0)
+            {
+               hypre_PFMG3BuildRAPHost(A, P, R, cdir, cindex, cstride, Ac_tmp);
+               break;
+            }
+#endif
+
             /*--------------------------------------------------------------------
              *    Set lower triangular (+ diagonal) coefficients
              *--------------------------------------------------------------------*/
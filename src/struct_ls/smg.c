@@ -24,6 +24,7 @@ hypre_SMGCreate( MPI_Comm  comm )
 
    /* set defaults */
    (smg_data -> memory_use) = 0;
+   (smg_data -> line_batching) = 0;
    (smg_data -> tol)        = 1.0e-06;
    (smg_data -> max_iter)   = 200;
    (smg_data -> rel_change) = 0;
@@ -157,6 +158,31 @@ hypre_SMGGetMemoryUse( void *smg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGSetLineBatching( void *smg_vdata,
+                          HYPRE_Int   line_batching )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   (smg_data -> line_batching) = line_batching;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SMGGetLineBatching( void *smg_vdata,
+                          HYPRE_Int * line_batching )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   *line_batching = (smg_data -> line_batching);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -23,6 +23,7 @@ typedef struct
    MPI_Comm              comm;
 
    HYPRE_Int             memory_use;
+   HYPRE_Int             line_batching;  /* use the batched line solver */
    HYPRE_Real            tol;
    HYPRE_Int             max_iter;
    HYPRE_Int             rel_change;
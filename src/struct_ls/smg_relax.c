@@ -19,6 +19,7 @@ typedef struct
    MPI_Comm                comm;
 
    HYPRE_Int               memory_use;
+   HYPRE_Int               line_batching;
    HYPRE_Real              tol;
    HYPRE_Int               max_iter;
    HYPRE_Int               zero_guess;
@@ -77,6 +78,7 @@ hypre_SMGRelaxCreate( MPI_Comm  comm )
    (relax_data -> time_index)     = hypre_InitializeTiming("SMGRelax");
    /* set defaults */
    (relax_data -> memory_use)         = 0;
+   (relax_data -> line_batching)      = 0;
    (relax_data -> tol)                = 1.0e-06;
    (relax_data -> max_iter)           = 1000;
    (relax_data -> zero_guess)         = 0;
@@ -593,6 +595,7 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
          hypre_SMGSetNumPostRelax( solve_data[i], num_post_relax);
          hypre_SMGSetBase(solve_data[i], base_index, base_stride);
          hypre_SMGSetMemoryUse(solve_data[i], (relax_data -> memory_use));
+         hypre_SMGSetLineBatching(solve_data[i], (relax_data -> line_batching));
          hypre_SMGSetTol(solve_data[i], 0.0);
          hypre_SMGSetMaxIter(solve_data[i], 1);
          hypre_StructSMGSetMaxLevel(solve_data[i], (relax_data -> max_level));
@@ -602,6 +605,7 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
       {
          solve_data[i] = hypre_CyclicReductionCreate(relax_data -> comm);
          hypre_CyclicReductionSetBase(solve_data[i], base_index, base_stride);
+         hypre_CyclicReductionSetBatching(solve_data[i], (relax_data -> line_batching));
          //hypre_CyclicReductionSetMaxLevel(solve_data[i], -1);//(relax_data -> max_level)+10);
          hypre_CyclicReductionSetup(solve_data[i], A_sol, temp_vec, x);
       }
@@ -648,6 +652,20 @@ hypre_SMGRelaxSetMemoryUse( void *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGRelaxSetLineBatching( void *relax_vdata,
+                               HYPRE_Int   line_batching  )
+{
+   hypre_SMGRelaxData *relax_data = (hypre_SMGRelaxData  *)relax_vdata;
+
+   (relax_data -> line_batching) = line_batching;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -465,6 +465,7 @@ hypre_SMGSetup( void               *smg_vdata,
       relax_data_l[l] = hypre_SMGRelaxCreate(comm);
       hypre_SMGRelaxSetBase(relax_data_l[l], bindex, bstride);
       hypre_SMGRelaxSetMemoryUse(relax_data_l[l], (smg_data -> memory_use));
+      hypre_SMGRelaxSetLineBatching(relax_data_l[l], (smg_data -> line_batching));
       hypre_SMGRelaxSetTol(relax_data_l[l], 0.0);
       hypre_SMGRelaxSetNumSpaces(relax_data_l[l], 2);
       hypre_SMGRelaxSetSpace(relax_data_l[l], 0,
@@ -301,6 +301,102 @@ HYPRE_StructMatrixAddToBoxValues2( HYPRE_StructMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixSetBoxValuesStrided( HYPRE_StructMatrix  matrix,
+                                       HYPRE_Int          *ilower,
+                                       HYPRE_Int          *iupper,
+                                       HYPRE_Int           num_stencil_indices,
+                                       HYPRE_Int          *stencil_indices,
+                                       HYPRE_Int          *vilower,
+                                       HYPRE_Int          *viupper,
+                                       HYPRE_Complex      *values,
+                                       HYPRE_Int           point_stride,
+                                       HYPRE_Int           entry_stride )
+{
+   hypre_Box  *set_box, *value_box;
+   HYPRE_Int  *value_offsets;
+   HYPRE_Int   d, s;
+
+   /* This creates boxes with zeroed-out extents */
+   set_box = hypre_BoxCreate(hypre_StructMatrixNDim(matrix));
+   value_box = hypre_BoxCreate(hypre_StructMatrixNDim(matrix));
+
+   for (d = 0; d < hypre_StructMatrixNDim(matrix); d++)
+   {
+      hypre_BoxIMinD(set_box, d) = ilower[d];
+      hypre_BoxIMaxD(set_box, d) = iupper[d];
+      hypre_BoxIMinD(value_box, d) = vilower[d];
+      hypre_BoxIMaxD(value_box, d) = viupper[d];
+   }
+
+   value_offsets = hypre_TAlloc(HYPRE_Int, num_stencil_indices, HYPRE_MEMORY_HOST);
+   for (s = 0; s < num_stencil_indices; s++)
+   {
+      value_offsets[s] = s * entry_stride;
+   }
+
+   hypre_StructMatrixSetBoxValuesStrided(matrix, set_box, value_box,
+                                         num_stencil_indices, stencil_indices,
+                                         values, point_stride, value_offsets, 0, -1, 0);
+
+   hypre_TFree(value_offsets, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(set_box);
+   hypre_BoxDestroy(value_box);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixAddToBoxValuesStrided( HYPRE_StructMatrix  matrix,
+                                         HYPRE_Int          *ilower,
+                                         HYPRE_Int          *iupper,
+                                         HYPRE_Int           num_stencil_indices,
+                                         HYPRE_Int          *stencil_indices,
+                                         HYPRE_Int          *vilower,
+                                         HYPRE_Int          *viupper,
+                                         HYPRE_Complex      *values,
+                                         HYPRE_Int           point_stride,
+                                         HYPRE_Int           entry_stride )
+{
+   hypre_Box  *set_box, *value_box;
+   HYPRE_Int  *value_offsets;
+   HYPRE_Int   d, s;
+
+   /* This creates boxes with zeroed-out extents */
+   set_box = hypre_BoxCreate(hypre_StructMatrixNDim(matrix));
+   value_box = hypre_BoxCreate(hypre_StructMatrixNDim(matrix));
+
+   for (d = 0; d < hypre_StructMatrixNDim(matrix); d++)
+   {
+      hypre_BoxIMinD(set_box, d) = ilower[d];
+      hypre_BoxIMaxD(set_box, d) = iupper[d];
+      hypre_BoxIMinD(value_box, d) = vilower[d];
+      hypre_BoxIMaxD(value_box, d) = viupper[d];
+   }
+
+   value_offsets = hypre_TAlloc(HYPRE_Int, num_stencil_indices, HYPRE_MEMORY_HOST);
+   for (s = 0; s < num_stencil_indices; s++)
+   {
+      value_offsets[s] = s * entry_stride;
+   }
+
+   hypre_StructMatrixSetBoxValuesStrided(matrix, set_box, value_box,
+                                         num_stencil_indices, stencil_indices,
+                                         values, point_stride, value_offsets, 1, -1, 0);
+
+   hypre_TFree(value_offsets, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(set_box);
+   hypre_BoxDestroy(value_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
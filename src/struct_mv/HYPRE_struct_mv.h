@@ -278,6 +278,48 @@ HYPRE_Int HYPRE_StructMatrixAddToBoxValues2(HYPRE_StructMatrix  matrix,
                                             HYPRE_Int          *viupper,
                                             HYPRE_Complex      *values);
 
+/**
+ * Set matrix coefficients a box at a time, with a user-specified layout of the
+ * \e values array.  As in \ref HYPRE_StructMatrixSetBoxValues2, \e values is
+ * logically box shaped with value-box extents \e vilower and \e viupper.  The
+ * value for entry \e entries[e] at the point with (lexicographic) rank p in
+ * the value box is
+ *
+   \verbatim
+   values[p*point_stride + e*entry_stride]
+   \endverbatim
+ *
+ * Setting \e point_stride = \e nentries and \e entry_stride = 1 gives the
+ * layout of \ref HYPRE_StructMatrixSetBoxValues2, while \e point_stride = 1
+ * and \e entry_stride = (value-box volume) stores one array per entry.  All
+ * entries are set in a single pass over the box.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetBoxValuesStrided(HYPRE_StructMatrix  matrix,
+                                                HYPRE_Int          *ilower,
+                                                HYPRE_Int          *iupper,
+                                                HYPRE_Int           nentries,
+                                                HYPRE_Int          *entries,
+                                                HYPRE_Int          *vilower,
+                                                HYPRE_Int          *viupper,
+                                                HYPRE_Complex      *values,
+                                                HYPRE_Int           point_stride,
+                                                HYPRE_Int           entry_stride);
+
+/**
+ * Add to matrix coefficients a box at a time.  The data in \e values is
+ * ordered as in \ref HYPRE_StructMatrixSetBoxValuesStrided.
+ **/
+HYPRE_Int HYPRE_StructMatrixAddToBoxValuesStrided(HYPRE_StructMatrix  matrix,
+                                                  HYPRE_Int          *ilower,
+                                                  HYPRE_Int          *iupper,
+                                                  HYPRE_Int           nentries,
+                                                  HYPRE_Int          *entries,
+                                                  HYPRE_Int          *vilower,
+                                                  HYPRE_Int          *viupper,
+                                                  HYPRE_Complex      *values,
+                                                  HYPRE_Int           point_stride,
+                                                  HYPRE_Int           entry_stride);
+
 /**
  * Finalize the construction of the matrix before using.
  **/
@@ -597,6 +597,18 @@ typedef struct
    /* Ghost stuff  */
    HYPRE_Int           num_ghost[2 * HYPRE_MAXDIM];
 
+   /* Optional spatial index: a uniform hash grid over the extents of the
+      entries, used for point lookups in hypre_BoxManIntersect */
+   HYPRE_Int           spatial_index; /* Boolean: build the hash grid in the
+                                         assemble (default is on) */
+   hypre_Index         sindex_origin; /* Lower corner of the hash grid */
+   hypre_Index         sindex_cell_size; /* Cell size in each direction */
+   hypre_Index         sindex_num_cells; /* Number of cells in each direction */
+   HYPRE_Int          *sindex_offsets; /* Offsets of each cell into
+                                          sindex_entries */
+   hypre_BoxManEntry **sindex_entries; /* Entries overlapping each cell, in the
+                                          same order as the index_table lists */
+
 } hypre_BoxManager;
 
 /*--------------------------------------------------------------------------
@@ -641,6 +653,13 @@ typedef struct
 
 #define hypre_BoxManNumGhost(manager)           ((manager) -> num_ghost)
 
+#define hypre_BoxManSpatialIndex(manager)       ((manager) -> spatial_index)
+#define hypre_BoxManSIndexOrigin(manager)       ((manager) -> sindex_origin)
+#define hypre_BoxManSIndexCellSize(manager)     ((manager) -> sindex_cell_size)
+#define hypre_BoxManSIndexNumCells(manager)     ((manager) -> sindex_num_cells)
+#define hypre_BoxManSIndexOffsets(manager)      ((manager) -> sindex_offsets)
+#define hypre_BoxManSIndexEntries(manager)      ((manager) -> sindex_entries)
+
 #define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
 #define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
 #define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
@@ -868,6 +887,11 @@ typedef struct hypre_CommType_struct
    HYPRE_Int            *rem_boxnums; /* entry remote box numbers */
    hypre_Box            *rem_boxes;   /* entry remote boxes */
 
+   /* message sent from/received into the data without a buffer copy:
+    * 0 = buffered, 1 = contiguous, 2 = described by 'datatype' */
+   HYPRE_Int             direct;
+   hypre_MPI_Datatype    datatype;
+
 } hypre_CommType;
 
 /*--------------------------------------------------------------------------
@@ -921,6 +945,22 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+   /* direct messages (0 = none, 1 = sends and recvs, 2 = recvs only);
+    * with direct sends, the send data must not change until finalize */
+   HYPRE_Int            direct;            /* use direct messages? */
+   HYPRE_Int            num_direct;        /* number of direct send/recv types */
+   HYPRE_Int            direct_setup;      /* direct types determined? */
+
+   /* persistent requests and buffers, reused after the first comm.
+    * The requests use the buffers; direct messages are posted separately. */
+   HYPRE_Int            persistent;        /* use persistent communication? */
+   HYPRE_Int            persistent_active; /* requests in use by a handle? */
+   HYPRE_Int            persistent_tag;    /* tag the requests were created with */
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -946,6 +986,13 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* requests and buffers are owned by comm_pkg */
+   HYPRE_Int          persistent;
+
+   /* direct messages used?  (see comm_pkg; direct recvs also require
+    * action = 0) */
+   HYPRE_Int          direct;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -998,6 +1045,9 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
 
+#define hypre_CommTypeDirect(type)        (type -> direct)
+#define hypre_CommTypeDatatype(type)      (type -> datatype)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
  *--------------------------------------------------------------------------*/
@@ -1039,6 +1089,18 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgDirect(comm_pkg)                     (comm_pkg -> direct)
+#define hypre_CommPkgNumDirect(comm_pkg)                  (comm_pkg -> num_direct)
+#define hypre_CommPkgDirectSetup(comm_pkg)                (comm_pkg -> direct_setup)
+
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)      (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)      (comm_pkg -> persistent_recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1054,6 +1116,8 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
+#define hypre_CommHandleDirect(comm_handle)               (comm_handle -> direct)
 
 #endif
 /******************************************************************************
@@ -1428,6 +1492,7 @@ HYPRE_Int hypre_BoxManSetAssumedPartition ( hypre_BoxManager *manager,
                                             hypre_StructAssumedPart *assumed_partition );
 HYPRE_Int hypre_BoxManSetBoundingBox ( hypre_BoxManager *manager, hypre_Box *bounding_box );
 HYPRE_Int hypre_BoxManSetNumGhost ( hypre_BoxManager *manager, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_BoxManSetSpatialIndex ( hypre_BoxManager *manager, HYPRE_Int spatial_index );
 HYPRE_Int hypre_BoxManDeleteMultipleEntriesAndInfo ( hypre_BoxManager *manager, HYPRE_Int *indices,
                                                      HYPRE_Int num );
 HYPRE_Int hypre_BoxManCreate ( HYPRE_Int max_nentries, HYPRE_Int info_size, HYPRE_Int dim,
@@ -1449,6 +1514,10 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManBuildSpatialIndex ( hypre_BoxManager *manager );
+HYPRE_Int hypre_BoxManDestroySpatialIndex ( hypre_BoxManager *manager );
+HYPRE_Int hypre_BoxManIntersectPoint ( hypre_BoxManager *manager, hypre_Index index,
+                                       hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -1527,6 +1596,14 @@ HYPRE_Int HYPRE_StructMatrixAddToValues ( HYPRE_StructMatrix matrix, HYPRE_Int *
 HYPRE_Int HYPRE_StructMatrixAddToBoxValues ( HYPRE_StructMatrix matrix, HYPRE_Int *ilower,
                                              HYPRE_Int *iupper, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
                                              HYPRE_Complex *values );
+HYPRE_Int HYPRE_StructMatrixSetBoxValuesStrided ( HYPRE_StructMatrix matrix, HYPRE_Int *ilower,
+                                                  HYPRE_Int *iupper, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
+                                                  HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values, HYPRE_Int point_stride,
+                                                  HYPRE_Int entry_stride );
+HYPRE_Int HYPRE_StructMatrixAddToBoxValuesStrided ( HYPRE_StructMatrix matrix, HYPRE_Int *ilower,
+                                                    HYPRE_Int *iupper, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
+                                                    HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values, HYPRE_Int point_stride,
+                                                    HYPRE_Int entry_stride );
 HYPRE_Int HYPRE_StructMatrixAddToConstantValues ( HYPRE_StructMatrix matrix,
                                                   HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructMatrixAssemble ( HYPRE_StructMatrix matrix );
@@ -1590,6 +1667,11 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 
 /* struct_axpy.c */
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructMassAxpy ( HYPRE_Complex *alpha, hypre_StructVector **x,
+                                 hypre_StructVector *y, HYPRE_Int k );
+HYPRE_Real hypre_StructAxpyNorm ( HYPRE_Complex alpha, hypre_StructVector *x,
+                                  hypre_StructVector *y );
+HYPRE_Int hypre_StructXpay ( HYPRE_Complex beta, hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_communication.c */
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
@@ -1601,6 +1683,15 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommTypeSetupDirect ( hypre_CommType *comm_type, HYPRE_Int ndim,
+                                      HYPRE_Int num_values );
+HYPRE_Int hypre_CommEntryTypeMarkData ( hypre_CommEntryType *comm_entry, HYPRE_Int ndim,
+                                        HYPRE_Int num_values, char *marks, HYPRE_Int check );
+HYPRE_Int hypre_CommPkgSetupDirect ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommTypeGetMessage ( hypre_CommType *comm_type, HYPRE_Complex *buffer,
+                                     HYPRE_Complex *data, HYPRE_Int direct, void **message_ptr, HYPRE_Int *count_ptr,
+                                     hypre_MPI_Datatype *datatype_ptr );
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -1638,7 +1729,10 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructMassInnerProd ( hypre_StructVector *x, hypre_StructVector **y, HYPRE_Int k,
+                                      HYPRE_Real *result );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -1671,6 +1765,10 @@ HYPRE_Int hypre_StructMatrixSetValues ( hypre_StructMatrix *matrix, hypre_Index
 HYPRE_Int hypre_StructMatrixSetBoxValues ( hypre_StructMatrix *matrix, hypre_Box *set_box,
                                            hypre_Box *value_box, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
                                            HYPRE_Complex *values, HYPRE_Int action, HYPRE_Int boxnum, HYPRE_Int outside );
+HYPRE_Int hypre_StructMatrixSetBoxValuesStrided ( hypre_StructMatrix *matrix, hypre_Box *set_box,
+                                                  hypre_Box *value_box, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
+                                                  HYPRE_Complex *values, HYPRE_Int point_stride, HYPRE_Int *value_offsets, HYPRE_Int action,
+                                                  HYPRE_Int boxnum, HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixSetConstantValues ( hypre_StructMatrix *matrix,
                                                 HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Complex *values,
                                                 HYPRE_Int action );
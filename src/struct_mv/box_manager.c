@@ -345,6 +345,33 @@ hypre_BoxManSetNumGhost( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Turn the spatial index (a uniform hash grid used for point lookups) on or
+ * off. When the manager is already assembled, the index is built or freed
+ * right away; otherwise, it is built at the end of the assemble.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManSetSpatialIndex( hypre_BoxManager *manager,
+                             HYPRE_Int         spatial_index )
+{
+   hypre_BoxManSpatialIndex(manager) = spatial_index;
+
+   if (hypre_BoxManIsAssembled(manager))
+   {
+      if (spatial_index)
+      {
+         hypre_BoxManBuildSpatialIndex(manager);
+      }
+      else
+      {
+         hypre_BoxManDestroySpatialIndex(manager);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Delete multiple entries (and their corresponding info object) from the
  * manager.  The indices correspond to the ordering of the entries.  Assumes
@@ -489,6 +516,10 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
 
    hypre_BoxManNextId(manager) = 0;
 
+   hypre_BoxManSpatialIndex(manager)  = 1;
+   hypre_BoxManSIndexOffsets(manager) = NULL;
+   hypre_BoxManSIndexEntries(manager) = NULL;
+
    /* ghost points: we choose a default that will give zero everywhere..*/
    for (i = 0; i < 2 * HYPRE_MAXDIM; i++)
    {
@@ -576,6 +607,7 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
       hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_BoxManDestroySpatialIndex(manager);
 
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -2422,6 +2454,12 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    hypre_BoxManNEntries(manager) = nentries;
    hypre_BoxManEntries(manager) = entries;
 
+   /* the spatial index uses the same entry ordering as the index table */
+   if (hypre_BoxManSpatialIndex(manager))
+   {
+      hypre_BoxManBuildSpatialIndex(manager);
+   }
+
    hypre_BoxManIsGatherCalled(manager) = 0;
    hypre_BoxArrayDestroy(gather_regions);
    hypre_BoxManGatherRegions(manager) =  hypre_BoxArrayCreate(0, ndim);
@@ -2488,6 +2526,12 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       return hypre_error_flag;
    }
 
+   /* Point lookups go through the spatial index, if available */
+   if (hypre_BoxManSIndexOffsets(manager) && hypre_IndexesEqual(ilower, iupper, ndim))
+   {
+      return hypre_BoxManIntersectPoint(manager, ilower, entries_ptr, nentries_ptr);
+   }
+
    /* Loop through each dimension */
    for (d = 0; d < ndim; d++)
    {
@@ -2609,6 +2653,273 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Build the spatial index: a uniform hash grid over the extents of the
+ * entries. The cell size in each direction is the average box extent,
+ * enlarged if needed to keep the number of cells proportional to the number
+ * of entries, so that each cell overlaps O(1) boxes in the expected case.
+ *
+ * The entries of each cell are listed in the same order as in the linked
+ * lists of the index table (on-processor entries first), so that point
+ * lookups return the same entries in the same order with or without it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManBuildSpatialIndex( hypre_BoxManager *manager )
+{
+   HYPRE_Int           ndim      = hypre_BoxManNDim(manager);
+   HYPRE_Int           nentries  = hypre_BoxManNEntries(manager);
+   hypre_BoxManEntry  *entries   = hypre_BoxManEntries(manager);
+   HYPRE_Int          *origin    = hypre_BoxManSIndexOrigin(manager);
+   HYPRE_Int          *cell_size = hypre_BoxManSIndexCellSize(manager);
+   HYPRE_Int          *num_cells = hypre_BoxManSIndexNumCells(manager);
+
+   HYPRE_Int          *offsets, *fill;
+   hypre_BoxManEntry **sentries;
+   hypre_BoxManEntry  *entry;
+
+   HYPRE_BigInt        extent_sum[HYPRE_MAXDIM];
+   HYPRE_BigInt        total_cells, max_cells;
+   HYPRE_Int           upper[HYPRE_MAXDIM];
+   hypre_Index         cmin, cmax, stride, loop_size;
+   hypre_Box          *cell_box, *grid_box;
+
+   HYPRE_Int           start_loop[3], end_loop[3];
+   HYPRE_Int           loop, loop_num, mystart, myfinish;
+   HYPRE_Int           pass, e, d, dmax, ncells;
+
+   hypre_BoxManDestroySpatialIndex(manager);
+
+   if (nentries == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Bounding extents and average box size */
+   for (d = 0; d < ndim; d++)
+   {
+      origin[d]     = hypre_IndexD(hypre_BoxManEntryIMin(&entries[0]), d);
+      upper[d]      = hypre_IndexD(hypre_BoxManEntryIMax(&entries[0]), d);
+      extent_sum[d] = 0;
+   }
+   for (e = 0; e < nentries; e++)
+   {
+      entry = &entries[e];
+      for (d = 0; d < ndim; d++)
+      {
+         origin[d] = hypre_min(origin[d], hypre_IndexD(hypre_BoxManEntryIMin(entry), d));
+         upper[d]  = hypre_max(upper[d],  hypre_IndexD(hypre_BoxManEntryIMax(entry), d));
+         extent_sum[d] += (HYPRE_BigInt) (hypre_IndexD(hypre_BoxManEntryIMax(entry), d) -
+                                          hypre_IndexD(hypre_BoxManEntryIMin(entry), d) + 1);
+      }
+   }
+
+   max_cells = 4 * (HYPRE_BigInt) nentries + 64;
+   for (d = 0; d < ndim; d++)
+   {
+      cell_size[d] = (HYPRE_Int) hypre_max(1, extent_sum[d] / nentries);
+   }
+   while (1)
+   {
+      total_cells = 1;
+      dmax = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         num_cells[d] = (upper[d] - origin[d]) / cell_size[d] + 1;
+         total_cells *= (HYPRE_BigInt) num_cells[d];
+         if (num_cells[d] > num_cells[dmax])
+         {
+            dmax = d;
+         }
+      }
+      if (total_cells <= max_cells)
+      {
+         break;
+      }
+      cell_size[dmax] *= 2;
+   }
+   ncells = (HYPRE_Int) total_cells;
+
+   /* Same ordering as the index table: off-processor entries, then
+      on-processor entries, each list being built by prepending */
+   mystart = hypre_BoxManFirstLocal(manager);
+   if (mystart >= 0)
+   {
+      myfinish = hypre_BoxManProcsSortOffsets(manager)[hypre_BoxManLocalProcOffset(manager) + 1];
+      loop_num = 3;
+      start_loop[0] = 0;
+      end_loop[0]   = mystart;
+      start_loop[1] = myfinish;
+      end_loop[1]   = nentries;
+      start_loop[2] = mystart;
+      end_loop[2]   = myfinish;
+   }
+   else
+   {
+      loop_num = 1;
+      start_loop[0] = 0;
+      end_loop[0]   = nentries;
+   }
+
+   offsets  = hypre_CTAlloc(HYPRE_Int, ncells + 1, HYPRE_MEMORY_HOST);
+   fill     = NULL;
+   sentries = NULL;
+
+   cell_box = hypre_BoxCreate(ndim);
+   grid_box = hypre_BoxCreate(ndim);
+   hypre_SetIndex(stride, 1);
+   hypre_BoxSetExtents(grid_box, stride, num_cells);
+   hypre_BoxShiftNeg(grid_box, stride); /* Want box to start at 0*/
+
+   /* First pass counts the entries of each cell, second pass fills them in
+      from the back of each cell */
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (loop = 0; loop < loop_num; loop++)
+      {
+         for (e = start_loop[loop]; e < end_loop[loop]; e++)
+         {
+            entry = &entries[e];
+            for (d = 0; d < ndim; d++)
+            {
+               cmin[d] = (hypre_IndexD(hypre_BoxManEntryIMin(entry), d) - origin[d]) / cell_size[d];
+               cmax[d] = (hypre_IndexD(hypre_BoxManEntryIMax(entry), d) - origin[d]) / cell_size[d];
+            }
+            hypre_BoxSetExtents(cell_box, cmin, cmax);
+            hypre_BoxGetSize(cell_box, loop_size);
+            hypre_SerialBoxLoop1Begin(ndim, loop_size, grid_box, cmin, stride, ii);
+            {
+               if (pass)
+               {
+                  sentries[--fill[ii]] = entry;
+               }
+               else
+               {
+                  offsets[ii + 1]++;
+               }
+            }
+            hypre_SerialBoxLoop1End(ii);
+         }
+      }
+
+      if (pass == 0)
+      {
+         for (e = 0; e < ncells; e++)
+         {
+            offsets[e + 1] += offsets[e];
+         }
+         sentries = hypre_TAlloc(hypre_BoxManEntry *, offsets[ncells], HYPRE_MEMORY_HOST);
+         fill     = hypre_TAlloc(HYPRE_Int, ncells, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(fill, offsets + 1, HYPRE_Int, ncells, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_BoxDestroy(cell_box);
+   hypre_BoxDestroy(grid_box);
+   hypre_TFree(fill, HYPRE_MEMORY_HOST);
+
+   hypre_BoxManSIndexOffsets(manager) = offsets;
+   hypre_BoxManSIndexEntries(manager) = sentries;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Free the spatial index (if any)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManDestroySpatialIndex( hypre_BoxManager *manager )
+{
+   hypre_TFree(hypre_BoxManSIndexOffsets(manager), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_BoxManSIndexEntries(manager), HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Return the entries that contain a given index, using the spatial index.
+ * This gives the same result as hypre_BoxManIntersect with ilower = iupper,
+ * in expected constant time.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManIntersectPoint( hypre_BoxManager    *manager,
+                            hypre_Index          index,
+                            hypre_BoxManEntry ***entries_ptr,
+                            HYPRE_Int           *nentries_ptr )
+{
+   HYPRE_Int           ndim      = hypre_BoxManNDim(manager);
+   HYPRE_Int          *origin    = hypre_BoxManSIndexOrigin(manager);
+   HYPRE_Int          *cell_size = hypre_BoxManSIndexCellSize(manager);
+   HYPRE_Int          *num_cells = hypre_BoxManSIndexNumCells(manager);
+   HYPRE_Int          *offsets   = hypre_BoxManSIndexOffsets(manager);
+   hypre_BoxManEntry **sentries  = hypre_BoxManSIndexEntries(manager);
+   hypre_BoxManEntry **entries;
+   hypre_BoxManEntry  *entry;
+   HYPRE_Int           cell, c, d, i, k, nentries;
+
+   *entries_ptr  = NULL;
+   *nentries_ptr = 0;
+
+   /* Locate the cell (first dimension varies fastest, as in the box loops) */
+   cell = 0;
+   for (d = ndim - 1; d >= 0; d--)
+   {
+      k = hypre_IndexD(index, d) - origin[d];
+      if (k < 0 || (k / cell_size[d]) >= num_cells[d])
+      {
+         return hypre_error_flag;
+      }
+      cell = cell * num_cells[d] + k / cell_size[d];
+   }
+
+   /* Count the entries that actually contain the index */
+   nentries = 0;
+   for (i = offsets[cell]; i < offsets[cell + 1]; i++)
+   {
+      entry = sentries[i];
+      for (d = 0; d < ndim; d++)
+      {
+         c = hypre_IndexD(index, d);
+         if (c < hypre_IndexD(hypre_BoxManEntryIMin(entry), d) ||
+             c > hypre_IndexD(hypre_BoxManEntryIMax(entry), d))
+         {
+            break;
+         }
+      }
+      nentries += (d == ndim);
+   }
+
+   if (nentries)
+   {
+      entries  = hypre_TAlloc(hypre_BoxManEntry *, nentries, HYPRE_MEMORY_HOST);
+      nentries = 0;
+      for (i = offsets[cell]; i < offsets[cell + 1]; i++)
+      {
+         entry = sentries[i];
+         for (d = 0; d < ndim; d++)
+         {
+            c = hypre_IndexD(index, d);
+            if (c < hypre_IndexD(hypre_BoxManEntryIMin(entry), d) ||
+                c > hypre_IndexD(hypre_BoxManEntryIMax(entry), d))
+            {
+               break;
+            }
+         }
+         if (d == ndim)
+         {
+            entries[nentries++] = entry;
+         }
+      }
+
+      *entries_ptr  = entries;
+      *nentries_ptr = nentries;
+   }
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  * contact message is null.  need to return the (proc) id of each box in our
  * assumed partition.
@@ -124,6 +124,18 @@ typedef struct
    /* Ghost stuff  */
    HYPRE_Int           num_ghost[2 * HYPRE_MAXDIM];
 
+   /* Optional spatial index: a uniform hash grid over the extents of the
+      entries, used for point lookups in hypre_BoxManIntersect */
+   HYPRE_Int           spatial_index; /* Boolean: build the hash grid in the
+                                         assemble (default is on) */
+   hypre_Index         sindex_origin; /* Lower corner of the hash grid */
+   hypre_Index         sindex_cell_size; /* Cell size in each direction */
+   hypre_Index         sindex_num_cells; /* Number of cells in each direction */
+   HYPRE_Int          *sindex_offsets; /* Offsets of each cell into
+                                          sindex_entries */
+   hypre_BoxManEntry **sindex_entries; /* Entries overlapping each cell, in the
+                                          same order as the index_table lists */
+
 } hypre_BoxManager;
 
 /*--------------------------------------------------------------------------
@@ -168,6 +180,13 @@ typedef struct
 
 #define hypre_BoxManNumGhost(manager)           ((manager) -> num_ghost)
 
+#define hypre_BoxManSpatialIndex(manager)       ((manager) -> spatial_index)
+#define hypre_BoxManSIndexOrigin(manager)       ((manager) -> sindex_origin)
+#define hypre_BoxManSIndexCellSize(manager)     ((manager) -> sindex_cell_size)
+#define hypre_BoxManSIndexNumCells(manager)     ((manager) -> sindex_num_cells)
+#define hypre_BoxManSIndexOffsets(manager)      ((manager) -> sindex_offsets)
+#define hypre_BoxManSIndexEntries(manager)      ((manager) -> sindex_entries)
+
 #define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
 #define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
 #define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
@@ -93,9 +93,10 @@ hypre_ComputeInfoDestroy( hypre_ComputeInfo  *compute_info )
 
 /*--------------------------------------------------------------------------
  * Return descriptions of communications and computations patterns for
- * a given grid-stencil computation.  If HYPRE\_OVERLAP\_COMM\_COMP is
- * defined, then the patterns are computed to allow for overlapping
- * communications and computations.  The default is no overlap.
+ * a given grid-stencil computation.  If overlapping is turned on with
+ * HYPRE\_SetStructOverlapCommComp (or HYPRE\_OVERLAP\_COMM\_COMP is defined),
+ * then the patterns are computed to allow for overlapping communications and
+ * computations.  The default is no overlap.
  *
  * Note: This routine assumes that the grid boxes do not overlap.
  *--------------------------------------------------------------------------*/
@@ -117,13 +118,11 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    HYPRE_Int                i;
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
    hypre_Box               *rembox;
    hypre_Index             *stencil_shape;
    hypre_Index              lborder, rborder;
    HYPRE_Int                cbox_array_size;
    HYPRE_Int                s, d;
-#endif
 
    /*------------------------------------------------------
     * Extract needed grid info
@@ -137,122 +136,121 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
-
-   /*------------------------------------------------------
-    * Compute border info
-    *------------------------------------------------------*/
-
-   hypre_SetIndex(lborder, 0);
-   hypre_SetIndex(rborder, 0);
-   stencil_shape = hypre_StructStencilShape(stencil);
-   for (s = 0; s < hypre_StructStencilSize(stencil); s++)
+   if (hypre_HandleStructOverlapCommComp(hypre_handle()))
    {
-      for (d = 0; d < ndim; d++)
+      /*------------------------------------------------------
+       * Compute border info
+       *------------------------------------------------------*/
+
+      hypre_SetIndex(lborder, 0);
+      hypre_SetIndex(rborder, 0);
+      stencil_shape = hypre_StructStencilShape(stencil);
+      for (s = 0; s < hypre_StructStencilSize(stencil); s++)
       {
-         i = hypre_IndexD(stencil_shape[s], d);
-         if (i < 0)
+         for (d = 0; d < ndim; d++)
          {
-            lborder[d] = hypre_max(lborder[d], -i);
-         }
-         else if (i > 0)
-         {
-            rborder[d] = hypre_max(rborder[d], i);
+            i = hypre_IndexD(stencil_shape[s], d);
+            if (i < 0)
+            {
+               lborder[d] = hypre_max(lborder[d], -i);
+            }
+            else if (i > 0)
+            {
+               rborder[d] = hypre_max(rborder[d], i);
+            }
          }
       }
-   }
-
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
-      cbox_array_size = 0;
-      for (d = 0; d < ndim; d++)
+      rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
+      hypre_ForBoxI(i, boxes)
       {
-         if ( (hypre_BoxVolume(rembox)) && lborder[d] )
-         {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMaxD(cbox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
-            hypre_BoxIMinD(rembox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d];
-            cbox_array_size++;
-         }
-         if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+         cbox_array_size = 0;
+         for (d = 0; d < ndim; d++)
          {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMinD(cbox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
-            hypre_BoxIMaxD(rembox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d];
-            cbox_array_size++;
+            if ( (hypre_BoxVolume(rembox)) && lborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMaxD(cbox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
+               hypre_BoxIMinD(rembox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d];
+               cbox_array_size++;
+            }
+            if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMinD(cbox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
+               hypre_BoxIMaxD(rembox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d];
+               cbox_array_size++;
+            }
          }
+         hypre_BoxArraySetSize(cbox_array, cbox_array_size);
       }
-      hypre_BoxArraySetSize(cbox_array, cbox_array_size);
-   }
-   hypre_BoxDestroy(rembox);
-
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
+      hypre_BoxDestroy(rembox);
 
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-      for (d = 0; d < ndim; d++)
+      hypre_ForBoxI(i, boxes)
       {
-         if ( lborder[d] )
-         {
-            hypre_BoxIMinD(cbox, d) += lborder[d];
-         }
-         if ( rborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+
+         for (d = 0; d < ndim; d++)
          {
-            hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            if ( lborder[d] )
+            {
+               hypre_BoxIMinD(cbox, d) += lborder[d];
+            }
+            if ( rborder[d] )
+            {
+               hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            }
          }
       }
    }
+   else
+   {
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-#else
-
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
-
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      hypre_ForBoxI(i, boxes)
+      {
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      }
    }
 
-#endif
-
    /*------------------------------------------------------
     * Return
     *------------------------------------------------------*/
@@ -277,15 +275,29 @@ hypre_ComputePkgCreate( hypre_ComputeInfo     *compute_info,
                         hypre_StructGrid      *grid,
                         hypre_ComputePkg     **compute_pkg_ptr )
 {
-   hypre_ComputePkg  *compute_pkg;
-   hypre_CommPkg     *comm_pkg;
+   hypre_ComputePkg    *compute_pkg;
+   hypre_CommPkg       *comm_pkg;
+   hypre_BoxArrayArray *indt_boxes = hypre_ComputeInfoIndtBoxes(compute_info);
+   HYPRE_Int            overlap, i;
 
    compute_pkg = hypre_CTAlloc(hypre_ComputePkg,  1, HYPRE_MEMORY_HOST);
 
+   /* computations on independent boxes overlap with the exchange */
+   overlap = 0;
+   hypre_ForBoxArrayI(i, indt_boxes)
+   {
+      overlap = overlap || hypre_BoxArraySize(hypre_BoxArrayArrayBoxArray(indt_boxes, i));
+   }
+
    hypre_CommPkgCreate(hypre_ComputeInfoCommInfo(compute_info),
                        data_space, data_space, num_values, NULL, 0,
                        hypre_StructGridComm(grid), &comm_pkg);
    hypre_CommInfoDestroy(hypre_ComputeInfoCommInfo(compute_info));
+   /* the same exchange is repeated for every matvec or relaxation sweep */
+   hypre_CommPkgPersistent(comm_pkg) = 1;
+   /* with overlap, the independent computations may update the sent data
+    * before the exchange is finalized, but they never touch the ghost zones */
+   hypre_CommPkgDirect(comm_pkg) = overlap ? 2 : 1;
    hypre_ComputePkgCommPkg(compute_pkg) = comm_pkg;
 
    hypre_ComputePkgIndtBoxes(compute_pkg) =
@@ -115,6 +115,7 @@ HYPRE_Int hypre_BoxManSetAssumedPartition ( hypre_BoxManager *manager,
                                             hypre_StructAssumedPart *assumed_partition );
 HYPRE_Int hypre_BoxManSetBoundingBox ( hypre_BoxManager *manager, hypre_Box *bounding_box );
 HYPRE_Int hypre_BoxManSetNumGhost ( hypre_BoxManager *manager, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_BoxManSetSpatialIndex ( hypre_BoxManager *manager, HYPRE_Int spatial_index );
 HYPRE_Int hypre_BoxManDeleteMultipleEntriesAndInfo ( hypre_BoxManager *manager, HYPRE_Int *indices,
                                                      HYPRE_Int num );
 HYPRE_Int hypre_BoxManCreate ( HYPRE_Int max_nentries, HYPRE_Int info_size, HYPRE_Int dim,
@@ -136,6 +137,10 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManBuildSpatialIndex ( hypre_BoxManager *manager );
+HYPRE_Int hypre_BoxManDestroySpatialIndex ( hypre_BoxManager *manager );
+HYPRE_Int hypre_BoxManIntersectPoint ( hypre_BoxManager *manager, hypre_Index index,
+                                       hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -214,6 +219,14 @@ HYPRE_Int HYPRE_StructMatrixAddToValues ( HYPRE_StructMatrix matrix, HYPRE_Int *
 HYPRE_Int HYPRE_StructMatrixAddToBoxValues ( HYPRE_StructMatrix matrix, HYPRE_Int *ilower,
                                              HYPRE_Int *iupper, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
                                              HYPRE_Complex *values );
+HYPRE_Int HYPRE_StructMatrixSetBoxValuesStrided ( HYPRE_StructMatrix matrix, HYPRE_Int *ilower,
+                                                  HYPRE_Int *iupper, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
+                                                  HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values, HYPRE_Int point_stride,
+                                                  HYPRE_Int entry_stride );
+HYPRE_Int HYPRE_StructMatrixAddToBoxValuesStrided ( HYPRE_StructMatrix matrix, HYPRE_Int *ilower,
+                                                    HYPRE_Int *iupper, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
+                                                    HYPRE_Int *vilower, HYPRE_Int *viupper, HYPRE_Complex *values, HYPRE_Int point_stride,
+                                                    HYPRE_Int entry_stride );
 HYPRE_Int HYPRE_StructMatrixAddToConstantValues ( HYPRE_StructMatrix matrix,
                                                   HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructMatrixAssemble ( HYPRE_StructMatrix matrix );
@@ -277,6 +290,11 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 
 /* struct_axpy.c */
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructMassAxpy ( HYPRE_Complex *alpha, hypre_StructVector **x,
+                                 hypre_StructVector *y, HYPRE_Int k );
+HYPRE_Real hypre_StructAxpyNorm ( HYPRE_Complex alpha, hypre_StructVector *x,
+                                  hypre_StructVector *y );
+HYPRE_Int hypre_StructXpay ( HYPRE_Complex beta, hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_communication.c */
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
@@ -288,6 +306,15 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommTypeSetupDirect ( hypre_CommType *comm_type, HYPRE_Int ndim,
+                                      HYPRE_Int num_values );
+HYPRE_Int hypre_CommEntryTypeMarkData ( hypre_CommEntryType *comm_entry, HYPRE_Int ndim,
+                                        HYPRE_Int num_values, char *marks, HYPRE_Int check );
+HYPRE_Int hypre_CommPkgSetupDirect ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommTypeGetMessage ( hypre_CommType *comm_type, HYPRE_Complex *buffer,
+                                     HYPRE_Complex *data, HYPRE_Int direct, void **message_ptr, HYPRE_Int *count_ptr,
+                                     hypre_MPI_Datatype *datatype_ptr );
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -325,7 +352,10 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructMassInnerProd ( hypre_StructVector *x, hypre_StructVector **y, HYPRE_Int k,
+                                      HYPRE_Real *result );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -358,6 +388,10 @@ HYPRE_Int hypre_StructMatrixSetValues ( hypre_StructMatrix *matrix, hypre_Index
 HYPRE_Int hypre_StructMatrixSetBoxValues ( hypre_StructMatrix *matrix, hypre_Box *set_box,
                                            hypre_Box *value_box, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
                                            HYPRE_Complex *values, HYPRE_Int action, HYPRE_Int boxnum, HYPRE_Int outside );
+HYPRE_Int hypre_StructMatrixSetBoxValuesStrided ( hypre_StructMatrix *matrix, hypre_Box *set_box,
+                                                  hypre_Box *value_box, HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices,
+                                                  HYPRE_Complex *values, HYPRE_Int point_stride, HYPRE_Int *value_offsets, HYPRE_Int action,
+                                                  HYPRE_Int boxnum, HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixSetConstantValues ( hypre_StructMatrix *matrix,
                                                 HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Complex *values,
                                                 HYPRE_Int action );
@@ -81,3 +81,244 @@ hypre_StructAxpy( HYPRE_Complex       alpha,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMassAxpy
+ *
+ * Computes y = y + sum_j alpha[j] * x[j] for j = 0, ..., k-1.  The x vectors
+ * are applied two at a time so that y is swept once per pair.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMassAxpy( HYPRE_Complex       *alpha,
+                      hypre_StructVector **x,
+                      hypre_StructVector  *y,
+                      HYPRE_Int            k )
+{
+   hypre_Box        *x0_data_box;
+   hypre_Box        *x1_data_box;
+   hypre_Box        *y_data_box;
+
+   HYPRE_Complex    *x0p;
+   HYPRE_Complex    *x1p;
+   HYPRE_Complex    *yp;
+
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       unit_stride;
+
+   HYPRE_Int         ndim = hypre_StructVectorNDim(y);
+   HYPRE_Int         i, j;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+      for (j = 0; j + 1 < k; j += 2)
+      {
+         HYPRE_Complex alpha0 = alpha[j];
+         HYPRE_Complex alpha1 = alpha[j + 1];
+
+         x0_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x[j]), i);
+         x1_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x[j + 1]), i);
+         x0p = hypre_StructVectorBoxData(x[j], i);
+         x1p = hypre_StructVectorBoxData(x[j + 1], i);
+
+#define DEVICE_VAR is_device_ptr(yp,x0p,x1p)
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             x0_data_box, start, unit_stride, x0i,
+                             x1_data_box, start, unit_stride, x1i,
+                             y_data_box, start, unit_stride, yi);
+         {
+            yp[yi] += alpha0 * x0p[x0i] + alpha1 * x1p[x1i];
+         }
+         hypre_BoxLoop3End(x0i, x1i, yi);
+#undef DEVICE_VAR
+      }
+
+      if (j < k)
+      {
+         HYPRE_Complex alpha0 = alpha[j];
+
+         x0_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x[j]), i);
+         x0p = hypre_StructVectorBoxData(x[j], i);
+
+#define DEVICE_VAR is_device_ptr(yp,x0p)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             x0_data_box, start, unit_stride, x0i,
+                             y_data_box, start, unit_stride, yi);
+         {
+            yp[yi] += alpha0 * x0p[x0i];
+         }
+         hypre_BoxLoop2End(x0i, yi);
+#undef DEVICE_VAR
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpyNorm
+ *
+ * Computes y = y + alpha * x and returns <y, y> for the updated y, so that
+ * the update and the norm share one pass over the data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructAxpyNorm( HYPRE_Complex       alpha,
+                      hypre_StructVector *x,
+                      hypre_StructVector *y )
+{
+   HYPRE_Real       final_norm_result;
+   HYPRE_Real       process_result;
+
+   hypre_Box       *x_data_box;
+   hypre_Box       *y_data_box;
+
+   HYPRE_Complex   *xp;
+   HYPRE_Complex   *yp;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        i;
+
+   HYPRE_Real       local_result = 0.0;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+      HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+      HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                   x_data_box, start, unit_stride, xi,
+                                   y_data_box, start, unit_stride, yi,
+                                   box_sum)
+      {
+         HYPRE_Complex yval = yp[yi] + alpha * xp[xi];
+
+         yp[yi] = yval;
+         box_sum += (HYPRE_Real) (yval * hypre_conj(yval));
+      }
+      hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+#undef DEVICE_VAR
+
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+
+      local_result += (HYPRE_Real) box_sum;
+   }
+
+   process_result = local_result;
+
+   hypre_MPI_Allreduce(&process_result, &final_norm_result, 1,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
+
+   hypre_IncFLOPCount(4 * hypre_StructVectorGlobalSize(x));
+
+   return final_norm_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructXpay
+ *
+ * Computes y = x + beta * y in a single pass (instead of a scale followed by
+ * an axpy).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructXpay( HYPRE_Complex       beta,
+                  hypre_StructVector *x,
+                  hypre_StructVector *y )
+{
+   hypre_Box        *x_data_box;
+   hypre_Box        *y_data_box;
+
+   HYPRE_Complex    *xp;
+   HYPRE_Complex    *yp;
+
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       unit_stride;
+
+   HYPRE_Int         i;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                          x_data_box, start, unit_stride, xi,
+                          y_data_box, start, unit_stride, yi);
+      {
+         yp[yi] = xp[xi] + beta * yp[yi];
+      }
+      hypre_BoxLoop2End(xi, yi);
+#undef DEVICE_VAR
+   }
+
+   return hypre_error_flag;
+}
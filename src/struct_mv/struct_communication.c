@@ -805,6 +805,458 @@ hypre_StructCommunicationReleaseBuffer(HYPRE_Complex       *buffer,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Determine which send and recv types can be communicated directly from/to
+ * the data, without packing a buffer.  This is the case for messages with a
+ * single entry that is either contiguous in memory (e.g., a face spanning the
+ * data box) or made of contiguous rows with positive strides (e.g., the
+ * k-faces of a box), in which case an MPI datatype describes the message.
+ *
+ * This is done after the first communication, since the recv entries are
+ * only known then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommTypeSetupDirect( hypre_CommType *comm_type,
+                           HYPRE_Int       ndim,
+                           HYPRE_Int       num_values )
+{
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   HYPRE_Int           *order;
+   HYPRE_Int            length[HYPRE_MAXDIM + 1];
+   HYPRE_Int            stride[HYPRE_MAXDIM + 1];
+   HYPRE_Int            d, ll, size, contiguous;
+   hypre_MPI_Datatype   datatype, newtype;
+
+   hypre_CommTypeDirect(comm_type) = 0;
+   if (hypre_CommTypeNumEntries(comm_type) != 1)
+   {
+      return hypre_error_flag;
+   }
+
+   comm_entry   = hypre_CommTypeEntry(comm_type, 0);
+   length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+   stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+   order        = hypre_CommEntryTypeOrder(comm_entry);
+
+   /* the values must be in their natural order */
+   for (ll = 0; ll < num_values; ll++)
+   {
+      if (order[ll] != ll)
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   /* the values are treated as one more dimension */
+   for (d = 0; d < ndim; d++)
+   {
+      length[d] = length_array[d];
+      stride[d] = stride_array[d];
+   }
+   length[ndim] = num_values;
+   stride[ndim] = stride_array[ndim];
+
+   /* the innermost dimension must be unit stride and the others positive */
+   if (length[0] > 1 && stride[0] != 1)
+   {
+      return hypre_error_flag;
+   }
+   size = length[0];
+   contiguous = 1;
+   for (d = 1; d <= ndim; d++)
+   {
+      if (length[d] > 1)
+      {
+         if (stride[d] <= 0)
+         {
+            return hypre_error_flag;
+         }
+         if (stride[d] != size)
+         {
+            contiguous = 0;
+         }
+         size *= length[d];
+      }
+   }
+
+   if (contiguous)
+   {
+      hypre_CommTypeDirect(comm_type) = 1;
+   }
+   else
+   {
+      hypre_MPI_Type_contiguous(length[0], HYPRE_MPI_COMPLEX, &datatype);
+      for (d = 1; d <= ndim; d++)
+      {
+         if (length[d] > 1)
+         {
+            hypre_MPI_Type_hvector(length[d], 1,
+                                   (hypre_MPI_Aint) stride[d] * sizeof(HYPRE_Complex),
+                                   datatype, &newtype);
+            hypre_MPI_Type_free(&datatype);
+            datatype = newtype;
+         }
+      }
+      hypre_MPI_Type_commit(&datatype);
+
+      hypre_CommTypeDirect(comm_type)   = 2;
+      hypre_CommTypeDatatype(comm_type) = datatype;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Visit the data locations of a comm entry.  Depending on 'mode':
+ *   mode = 0    - count a write to each location in 'marks' (up to 2)
+ *   mode = 1    - flag a read of each location in 'marks'
+ *   mode = 2    - return whether no location is written
+ *   mode = 3    - return whether every location is written once and not read
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CommMarkWrites  3
+#define hypre_CommMarkRead    4
+
+HYPRE_Int
+hypre_CommEntryTypeMarkData( hypre_CommEntryType *comm_entry,
+                             HYPRE_Int            ndim,
+                             HYPRE_Int            num_values,
+                             char                *marks,
+                             HYPRE_Int            mode )
+{
+   HYPRE_Int  *length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+   HYPRE_Int  *stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+   HYPRE_Int   length[HYPRE_MAXDIM + 1];
+   HYPRE_Int   index[HYPRE_MAXDIM + 1];
+   HYPRE_Int   d, k, writes;
+
+   for (d = 0; d < ndim; d++)
+   {
+      length[d] = length_array[d];
+      index[d]  = 0;
+   }
+   length[ndim] = num_values;
+   index[ndim]  = 0;
+
+   while (index[ndim] < length[ndim])
+   {
+      k = hypre_CommEntryTypeOffset(comm_entry);
+      for (d = 0; d <= ndim; d++)
+      {
+         k += index[d] * stride_array[d];
+      }
+
+      writes = marks[k] & hypre_CommMarkWrites;
+      switch (mode)
+      {
+         case 0:
+            marks[k] = (marks[k] & hypre_CommMarkRead) | hypre_min(writes + 1, 2);
+            break;
+
+         case 1:
+            marks[k] |= hypre_CommMarkRead;
+            break;
+
+         case 2:
+            if (writes)
+            {
+               return 0;
+            }
+            break;
+
+         case 3:
+            if (writes > 1 || (marks[k] & hypre_CommMarkRead))
+            {
+               return 0;
+            }
+            break;
+      }
+
+      for (d = 0; d < ndim; d++)
+      {
+         if (++index[d] < length[d])
+         {
+            break;
+         }
+         index[d] = 0;
+      }
+      if (d == ndim)
+      {
+         index[ndim]++;
+      }
+   }
+
+   return 1;
+}
+
+#undef hypre_CommMarkWrites
+#undef hypre_CommMarkRead
+
+/*--------------------------------------------------------------------------
+ * Determine the direct send and recv types of a communication package.
+ *
+ * The data locations of different messages may overlap, e.g., on periodic
+ * grids that are small relative to the stencil, or when send_data and
+ * recv_data are the same.  Since MPI may access the data of a direct message
+ * at any time before the exchange is finalized, a send is only made direct if
+ * none of its locations is written during the exchange, and a recv only if
+ * its locations are written once and not read.  This assumes that send_data
+ * and recv_data are the same, which is the conservative choice.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgSetupDirect( hypre_CommPkg *comm_pkg )
+{
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int            num_types  = num_sends + num_recvs + 2;
+   hypre_CommType     **types;
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   char                *marks;
+   HYPRE_Int            i, j, d, hi, size, is_send, num_direct;
+
+   /* types are ordered as sends, copy-from, recvs, copy-to */
+   types = hypre_TAlloc(hypre_CommType *, num_types, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      types[i] = hypre_CommPkgSendType(comm_pkg, i);
+   }
+   types[num_sends] = hypre_CommPkgCopyFromType(comm_pkg);
+   for (i = 0; i < num_recvs; i++)
+   {
+      types[num_sends + 1 + i] = hypre_CommPkgRecvType(comm_pkg, i);
+   }
+   types[num_types - 1] = hypre_CommPkgCopyToType(comm_pkg);
+
+   /* mark the data locations read and written during an exchange */
+   size = 0;
+   for (i = 0; i < num_types; i++)
+   {
+      comm_type = types[i];
+      for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+      {
+         comm_entry   = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         hi = hypre_CommEntryTypeOffset(comm_entry) + (num_values - 1) * stride_array[ndim];
+         for (d = 0; d < ndim; d++)
+         {
+            hi += hypre_max(0, (length_array[d] - 1) * stride_array[d]);
+         }
+         size = hypre_max(size, hi + 1);
+      }
+   }
+   marks = hypre_CTAlloc(char, size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_types; i++)
+   {
+      comm_type = types[i];
+      is_send   = (i <= num_sends);
+      for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+      {
+         hypre_CommEntryTypeMarkData(hypre_CommTypeEntry(comm_type, j),
+                                     ndim, num_values, marks, is_send);
+      }
+   }
+
+   /* set up the send and recv types with a simple layout and no overlap */
+   num_direct = 0;
+   for (i = 0; i < num_types; i++)
+   {
+      is_send = (i < num_sends);
+      if (i == num_sends || i == num_types - 1 ||
+          (is_send && hypre_CommPkgDirect(comm_pkg) == 2))
+      {
+         continue;
+      }
+      comm_type = types[i];
+
+      hypre_CommTypeSetupDirect(comm_type, ndim, num_values);
+      if (hypre_CommTypeDirect(comm_type) &&
+          !hypre_CommEntryTypeMarkData(hypre_CommTypeEntry(comm_type, 0),
+                                       ndim, num_values, marks, is_send ? 2 : 3))
+      {
+         if (hypre_CommTypeDirect(comm_type) == 2)
+         {
+            hypre_MPI_Type_free(&hypre_CommTypeDatatype(comm_type));
+         }
+         hypre_CommTypeDirect(comm_type) = 0;
+      }
+      num_direct += (hypre_CommTypeDirect(comm_type) > 0);
+   }
+   hypre_TFree(marks, HYPRE_MEMORY_HOST);
+   hypre_TFree(types, HYPRE_MEMORY_HOST);
+
+   hypre_CommPkgNumDirect(comm_pkg)   = num_direct;
+   hypre_CommPkgDirectSetup(comm_pkg) = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Return the MPI message arguments for a send or recv type.  If 'direct' is
+ * set and the type allows it, the message points into 'data', otherwise to
+ * the packed 'buffer'.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommTypeGetMessage( hypre_CommType      *comm_type,
+                          HYPRE_Complex       *buffer,
+                          HYPRE_Complex       *data,
+                          HYPRE_Int            direct,
+                          void               **message_ptr,
+                          HYPRE_Int           *count_ptr,
+                          hypre_MPI_Datatype  *datatype_ptr )
+{
+   HYPRE_Complex *dptr;
+
+   if (direct && hypre_CommTypeDirect(comm_type))
+   {
+      dptr = data + hypre_CommEntryTypeOffset(hypre_CommTypeEntry(comm_type, 0));
+      *message_ptr = (void *) dptr;
+      if (hypre_CommTypeDirect(comm_type) == 2)
+      {
+         *count_ptr    = 1;
+         *datatype_ptr = hypre_CommTypeDatatype(comm_type);
+
+         return hypre_error_flag;
+      }
+   }
+   else
+   {
+      *message_ptr = (void *) buffer;
+   }
+   *count_ptr    = hypre_CommTypeBufsize(comm_type) * sizeof(HYPRE_Complex);
+   *datatype_ptr = hypre_MPI_BYTE;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up the persistent requests and buffers of a communication package.
+ *
+ * The buffer sizes are fixed after the first communication, so the buffers
+ * are allocated once.  The requests are bound to these buffers and are only
+ * recreated when the tag changes.  Receives come first in the request array,
+ * followed by sends.  Messages that may be direct get a null request instead,
+ * and are posted for every exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgSetupPersistent( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_CommPkgComm(comm_pkg);
+   HYPRE_Int            direct    = hypre_CommPkgDirect(comm_pkg);
+
+   hypre_MPI_Request   *requests  = hypre_CommPkgPersistentRequests(comm_pkg);
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, j;
+
+   if (direct && !hypre_CommPkgDirectSetup(comm_pkg))
+   {
+      hypre_CommPkgSetupDirect(comm_pkg);
+   }
+
+   if (requests != NULL)
+   {
+      if (hypre_CommPkgPersistentTag(comm_pkg) == tag)
+      {
+         return hypre_error_flag;
+      }
+
+      for (j = 0; j < num_recvs + num_sends; j++)
+      {
+         if (requests[j] != hypre_MPI_REQUEST_NULL)
+         {
+            hypre_MPI_Request_free(&requests[j]);
+         }
+      }
+   }
+   else
+   {
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_recvs + num_sends, HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentRequests(comm_pkg) = requests;
+      hypre_CommPkgPersistentStatus(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Status, num_recvs + num_sends, HYPRE_MEMORY_HOST);
+
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                         HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+            send_buffers[i] = send_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgPersistentSendBuffers(comm_pkg) = send_buffers;
+
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         recv_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                         HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+            recv_buffers[i] = recv_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgPersistentRecvBuffers(comm_pkg) = recv_buffers;
+   }
+
+   send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+   recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      if (direct && hypre_CommTypeDirect(comm_type))
+      {
+         requests[j++] = hypre_MPI_REQUEST_NULL;
+      }
+      else
+      {
+         hypre_MPI_Recv_init(recv_buffers[i],
+                             hypre_CommTypeBufsize(comm_type) * sizeof(HYPRE_Complex),
+                             hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                             tag, comm, &requests[j++]);
+      }
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      if (direct && hypre_CommTypeDirect(comm_type))
+      {
+         requests[j++] = hypre_MPI_REQUEST_NULL;
+      }
+      else
+      {
+         hypre_MPI_Send_init(send_buffers[i],
+                             hypre_CommTypeBufsize(comm_type) * sizeof(HYPRE_Complex),
+                             hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                             tag, comm, &requests[j++]);
+      }
+   }
+   hypre_CommPkgPersistentTag(comm_pkg) = tag;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -814,6 +1266,16 @@ hypre_StructCommunicationReleaseBuffer(HYPRE_Complex       *buffer,
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
  *   action = 1    - add the data to existing values in memory
+ *
+ * If persistent communication is turned on for comm_pkg, then after the first
+ * communication the requests and buffers stored in comm_pkg are reused, and
+ * the receives are started before the send buffers are packed.
+ *
+ * If direct messages are turned on for comm_pkg, then after the first
+ * communication the messages with a simple memory layout are received into
+ * recv_data when action = 0, and sent from send_data unless only direct recvs
+ * are turned on, without packing.  With direct sends, send_data must not be
+ * modified until the communication is finalized.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -854,47 +1316,103 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
+   HYPRE_Int            persistent, direct, direct_recvs;
+   void                *message;
+   HYPRE_Int            count;
+   hypre_MPI_Datatype   datatype;
 
    HYPRE_MemoryLocation memory_location     = hypre_HandleMemoryLocation(hypre_handle());
    HYPRE_MemoryLocation memory_location_mpi = memory_location;
 
-   /*--------------------------------------------------------------------
-    * allocate requests and status
-    *--------------------------------------------------------------------*/
-
    num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
-   status = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
 
-   /*--------------------------------------------------------------------
-    * allocate buffers
-    *--------------------------------------------------------------------*/
+   direct = 0;
+   if (!hypre_CommPkgFirstComm(comm_pkg) &&
+       hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+   {
+      direct = hypre_CommPkgDirect(comm_pkg);
+   }
+   if (direct && !hypre_CommPkgDirectSetup(comm_pkg))
+   {
+      hypre_CommPkgSetupDirect(comm_pkg);
+   }
+   direct_recvs = direct && (action == 0);
 
-   /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
+   /* only one handle at a time can use the persistent requests */
+   persistent = hypre_CommPkgPersistent(comm_pkg) &&
+                !hypre_CommPkgFirstComm(comm_pkg) &&
+                !hypre_CommPkgPersistentActive(comm_pkg) &&
+                hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST;
+
+   if (persistent)
    {
-      size = hypre_CommPkgSendBufsize(comm_pkg);
-      send_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
-      for (i = 1; i < num_sends; i++)
+      /*--------------------------------------------------------------------
+       * reuse requests and buffers, and start receives early
+       *--------------------------------------------------------------------*/
+
+      hypre_CommPkgSetupPersistent(comm_pkg, tag);
+      hypre_CommPkgPersistentActive(comm_pkg) = 1;
+
+      requests     = hypre_CommPkgPersistentRequests(comm_pkg);
+      status       = hypre_CommPkgPersistentStatus(comm_pkg);
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+
+      for (i = 0; i < num_recvs; i++)
       {
-         comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
-         size = hypre_CommTypeBufsize(comm_type);
-         send_buffers[i] = send_buffers[i - 1] + size;
+         if (requests[i] != hypre_MPI_REQUEST_NULL)
+         {
+            hypre_MPI_Startall(1, &requests[i]);
+         }
+         else
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+            hypre_CommTypeGetMessage(comm_type, recv_buffers[i], recv_data, direct_recvs,
+                                     &message, &count, &datatype);
+            hypre_MPI_Irecv(message, count, datatype, hypre_CommTypeProc(comm_type),
+                            tag, comm, &requests[i]);
+         }
       }
    }
-
-   /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
+   else
    {
-      size = hypre_CommPkgRecvBufsize(comm_pkg);
-      recv_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
-      for (i = 1; i < num_recvs; i++)
+      /*--------------------------------------------------------------------
+       * allocate requests and status
+       *--------------------------------------------------------------------*/
+
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      status = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+
+      /*--------------------------------------------------------------------
+       * allocate buffers
+       *--------------------------------------------------------------------*/
+
+      /* allocate send buffers */
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         size = hypre_CommPkgSendBufsize(comm_pkg);
+         send_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+            size = hypre_CommTypeBufsize(comm_type);
+            send_buffers[i] = send_buffers[i - 1] + size;
+         }
+      }
+
+      /* allocate recv buffers */
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
       {
-         comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
-         size = hypre_CommTypeBufsize(comm_type);
-         recv_buffers[i] = recv_buffers[i - 1] + size;
+         size = hypre_CommPkgRecvBufsize(comm_pkg);
+         recv_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+            size = hypre_CommTypeBufsize(comm_type);
+            recv_buffers[i] = recv_buffers[i - 1] + size;
+         }
       }
    }
 
@@ -907,6 +1425,12 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
       comm_type = hypre_CommPkgSendType(comm_pkg, i);
       num_entries = hypre_CommTypeNumEntries(comm_type);
 
+      /* direct messages are sent from send_data */
+      if (direct && hypre_CommTypeDirect(comm_type))
+      {
+         continue;
+      }
+
       dptr = (HYPRE_Complex *) send_buffers[i];
       if ( hypre_CommPkgFirstComm(comm_pkg) )
       {
@@ -1032,34 +1556,57 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
-   j = 0;
-   for (i = 0; i < num_recvs; i++)
+   if (persistent)
    {
-      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers_mpi[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      /* receives were started above */
+      for (i = 0; i < num_sends; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         j = num_recvs + i;
+         if (requests[j] != hypre_MPI_REQUEST_NULL)
+         {
+            hypre_MPI_Startall(1, &requests[j]);
+         }
+         else
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i);
+            hypre_CommTypeGetMessage(comm_type, send_buffers_mpi[i], send_data, direct,
+                                     &message, &count, &datatype);
+            hypre_MPI_Isend(message, count, datatype, hypre_CommTypeProc(comm_type),
+                            tag, comm, &requests[j]);
+         }
       }
    }
-
-   for (i = 0; i < num_sends; i++)
+   else
    {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers_mpi[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      j = 0;
+      for (i = 0; i < num_recvs; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_CommTypeGetMessage(comm_type, recv_buffers_mpi[i], recv_data,
+                                  direct_recvs, &message, &count, &datatype);
+         hypre_MPI_Irecv(message, count, datatype, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         }
+      }
+
+      for (i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         hypre_CommTypeGetMessage(comm_type, send_buffers_mpi[i], send_data,
+                                  direct, &message, &count, &datatype);
+         hypre_MPI_Isend(message, count, datatype, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         }
       }
    }
 
@@ -1107,6 +1654,8 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
    hypre_CommHandleAction(comm_handle)         = action;
    hypre_CommHandleSendBuffersMPI(comm_handle) = send_buffers_mpi;
    hypre_CommHandleRecvBuffersMPI(comm_handle) = recv_buffers_mpi;
+   hypre_CommHandlePersistent(comm_handle)     = persistent;
+   hypre_CommHandleDirect(comm_handle)         = direct;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1247,6 +1796,13 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
       comm_type = hypre_CommPkgRecvType(comm_pkg, i);
       num_entries = hypre_CommTypeNumEntries(comm_type);
 
+      /* direct messages were received into recv_data */
+      if (hypre_CommHandleDirect(comm_handle) && (action == 0) &&
+          hypre_CommTypeDirect(comm_type))
+      {
+         continue;
+      }
+
       dptr = (HYPRE_Complex *) recv_buffers[i];
 
       if ( hypre_CommPkgFirstComm(comm_pkg) )
@@ -1303,6 +1859,15 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * Free up communication handle
     *--------------------------------------------------------------------*/
 
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      /* requests and buffers are kept in comm_pkg for the next exchange */
+      hypre_CommPkgPersistentActive(comm_pkg) = 0;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
    if (num_sends > 0)
@@ -1430,6 +1995,24 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+      /* free the datatypes of direct messages */
+      for (i = 0; i < hypre_CommPkgNumSends(comm_pkg); i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         if (hypre_CommTypeDirect(comm_type) == 2)
+         {
+            hypre_MPI_Type_free(&hypre_CommTypeDatatype(comm_type));
+         }
+      }
+      for (i = 0; i < hypre_CommPkgNumRecvs(comm_pkg); i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         if (hypre_CommTypeDirect(comm_type) == 2)
+         {
+            hypre_MPI_Type_free(&hypre_CommTypeDatatype(comm_type));
+         }
+      }
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
@@ -1459,6 +2042,29 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      if (hypre_CommPkgPersistentRequests(comm_pkg))
+      {
+         for (i = 0; i < hypre_CommPkgNumRecvs(comm_pkg) + hypre_CommPkgNumSends(comm_pkg); i++)
+         {
+            if (hypre_CommPkgPersistentRequests(comm_pkg)[i] != hypre_MPI_REQUEST_NULL)
+            {
+               hypre_MPI_Request_free(&hypre_CommPkgPersistentRequests(comm_pkg)[i]);
+            }
+         }
+         hypre_TFree(hypre_CommPkgPersistentRequests(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+         if (hypre_CommPkgNumSends(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      }
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -70,6 +70,11 @@ typedef struct hypre_CommType_struct
    HYPRE_Int            *rem_boxnums; /* entry remote box numbers */
    hypre_Box            *rem_boxes;   /* entry remote boxes */
 
+   /* message sent from/received into the data without a buffer copy:
+    * 0 = buffered, 1 = contiguous, 2 = described by 'datatype' */
+   HYPRE_Int             direct;
+   hypre_MPI_Datatype    datatype;
+
 } hypre_CommType;
 
 /*--------------------------------------------------------------------------
@@ -123,6 +128,22 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+   /* direct messages (0 = none, 1 = sends and recvs, 2 = recvs only);
+    * with direct sends, the send data must not change until finalize */
+   HYPRE_Int            direct;            /* use direct messages? */
+   HYPRE_Int            num_direct;        /* number of direct send/recv types */
+   HYPRE_Int            direct_setup;      /* direct types determined? */
+
+   /* persistent requests and buffers, reused after the first comm.
+    * The requests use the buffers; direct messages are posted separately. */
+   HYPRE_Int            persistent;        /* use persistent communication? */
+   HYPRE_Int            persistent_active; /* requests in use by a handle? */
+   HYPRE_Int            persistent_tag;    /* tag the requests were created with */
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -148,6 +169,13 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* requests and buffers are owned by comm_pkg */
+   HYPRE_Int          persistent;
+
+   /* direct messages used?  (see comm_pkg; direct recvs also require
+    * action = 0) */
+   HYPRE_Int          direct;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -200,6 +228,9 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
 
+#define hypre_CommTypeDirect(type)        (type -> direct)
+#define hypre_CommTypeDatatype(type)      (type -> datatype)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
  *--------------------------------------------------------------------------*/
@@ -241,6 +272,18 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgDirect(comm_pkg)                     (comm_pkg -> direct)
+#define hypre_CommPkgNumDirect(comm_pkg)                  (comm_pkg -> num_direct)
+#define hypre_CommPkgDirectSetup(comm_pkg)                (comm_pkg -> direct_setup)
+
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)      (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)      (comm_pkg -> persistent_recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -256,5 +299,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
+#define hypre_CommHandleDirect(comm_handle)               (comm_handle -> direct)
 
 #endif
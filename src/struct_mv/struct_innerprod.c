@@ -15,16 +15,15 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Returns the process-local contribution to <x, y>.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -96,7 +95,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return (HYPRE_Real) local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -105,3 +118,133 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMassInnerProd
+ *
+ * Computes result[j] = <x, y[j]> for j = 0, ..., k-1 with a single global
+ * reduction.  On the host, the y vectors are swept two at a time so that x is
+ * read once per pair instead of once per vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMassInnerProd( hypre_StructVector  *x,
+                           hypre_StructVector **y,
+                           HYPRE_Int            k,
+                           HYPRE_Real          *result )
+{
+   HYPRE_Real      *local_result;
+   HYPRE_Int        j;
+
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP) && \
+    !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_RAJA)
+   hypre_Box       *x_data_box;
+   hypre_Box       *y0_data_box;
+   hypre_Box       *y1_data_box;
+
+   HYPRE_Complex   *xp;
+   HYPRE_Complex   *y0p;
+   HYPRE_Complex   *y1p;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        i;
+#endif
+
+   if (k < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP) || \
+    defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_RAJA)
+   for (j = 0; j < k; j++)
+   {
+      local_result[j] = hypre_StructInnerProdLocal(x, y[j]);
+   }
+#else
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      xp = hypre_StructVectorBoxData(x, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+      for (j = 0; j + 1 < k; j += 2)
+      {
+         HYPRE_Real sum0 = 0.0, sum1 = 0.0;
+
+         y0_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y[j]), i);
+         y1_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y[j + 1]), i);
+         y0p = hypre_StructVectorBoxData(y[j], i);
+         y1p = hypre_StructVectorBoxData(y[j + 1], i);
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+#define HYPRE_BOX_REDUCTION reduction(+:sum0,sum1)
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             x_data_box, start, unit_stride, xi,
+                             y0_data_box, start, unit_stride, y0i,
+                             y1_data_box, start, unit_stride, y1i);
+         {
+            HYPRE_Complex xval = xp[xi];
+
+            sum0 += xval * hypre_conj(y0p[y0i]);
+            sum1 += xval * hypre_conj(y1p[y1i]);
+         }
+         hypre_BoxLoop3End(xi, y0i, y1i);
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+
+         local_result[j]     += sum0;
+         local_result[j + 1] += sum1;
+      }
+
+      if (j < k)
+      {
+         HYPRE_Real sum0 = 0.0;
+
+         y0_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y[j]), i);
+         y0p = hypre_StructVectorBoxData(y[j], i);
+
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION reduction(+:sum0)
+         hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                      x_data_box, start, unit_stride, xi,
+                                      y0_data_box, start, unit_stride, y0i,
+                                      sum0)
+         {
+            sum0 += xp[xi] * hypre_conj(y0p[y0i]);
+         }
+         hypre_BoxLoop2ReductionEnd(xi, y0i, sum0);
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+
+         local_result[j] += sum0;
+      }
+   }
+#endif
+
+   hypre_MPI_Allreduce(local_result, result, k, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_StructVectorComm(x));
+
+   hypre_IncFLOPCount(2 * k * hypre_StructVectorGlobalSize(x));
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
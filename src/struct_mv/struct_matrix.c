@@ -896,6 +896,218 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Same as hypre_StructMatrixSetBoxValues(), but with a user-specified layout
+ * of the values array and with all stencil entries handled in a single
+ * BoxLoop pass.  The value for stencil entry s at the point with rank p in
+ * value_box is
+ *
+ *    values[p*point_stride + value_offsets[s]]
+ *
+ * For example, point_stride = num_stencil_indices and value_offsets[s] = s
+ * give the layout of hypre_StructMatrixSetBoxValues() (array of structures),
+ * while point_stride = 1 and value_offsets[s] = s*volume(value_box) give a
+ * structure of arrays layout.
+ *
+ * Only variable-coefficient entries can be set with this routine.
+ *
+ * (action > 0): add-to values
+ * (action = 0): set values
+ * (action < 0): get values
+ * (action =-2): get values and zero out
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetBoxValuesStrided( hypre_StructMatrix *matrix,
+                                       hypre_Box          *set_box,
+                                       hypre_Box          *value_box,
+                                       HYPRE_Int           num_stencil_indices,
+                                       HYPRE_Int          *stencil_indices,
+                                       HYPRE_Complex      *values,
+                                       HYPRE_Int           point_stride,
+                                       HYPRE_Int          *value_offsets,
+                                       HYPRE_Int           action,
+                                       HYPRE_Int           boxnum,
+                                       HYPRE_Int           outside )
+{
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(matrix);
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(matrix);
+   HYPRE_Complex        *data = hypre_StructMatrixData(matrix);
+   HYPRE_Int           **data_indices = hypre_StructMatrixDataIndices(matrix);
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int             constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
+
+   hypre_BoxArray       *grid_boxes;
+   hypre_Box            *grid_box;
+   hypre_Box            *int_box;
+   hypre_BoxArray       *data_space;
+   hypre_Box            *data_box;
+   hypre_IndexRef        data_start;
+   hypre_Index           data_stride;
+   hypre_Index           loop_size;
+   hypre_Index           center_index;
+   hypre_StructStencil  *stencil;
+   HYPRE_Int             center_rank = -1;
+
+   HYPRE_Int            *stored, nstored;
+   HYPRE_Int            *offsets, *h_offsets;
+   HYPRE_Int             i, s, istart, istop;
+
+   /*-----------------------------------------------------------------------
+    * Determine the stored variable-coefficient entries
+    *-----------------------------------------------------------------------*/
+
+   if (constant_coefficient == 2)
+   {
+      hypre_SetIndex(center_index, 0);
+      stencil = hypre_StructMatrixStencil(matrix);
+      center_rank = hypre_StructStencilElementRank(stencil, center_index);
+   }
+
+   stored = hypre_TAlloc(HYPRE_Int, num_stencil_indices, HYPRE_MEMORY_HOST);
+   nstored = 0;
+   for (s = 0; s < num_stencil_indices; s++)
+   {
+      /* only set stored stencil values */
+      if (symm_elements[stencil_indices[s]] < 0)
+      {
+         if ( (constant_coefficient == 1) ||
+              (constant_coefficient == 2 && stencil_indices[s] != center_rank) )
+         {
+            /* should have called SetConstantValues */
+            hypre_error(HYPRE_ERROR_GENERIC);
+         }
+         else
+         {
+            stored[nstored++] = s;
+         }
+      }
+   }
+
+   if (nstored == 0)
+   {
+      hypre_TFree(stored, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /* h_offsets holds the data offsets followed by the value offsets */
+   h_offsets = hypre_TAlloc(HYPRE_Int, 2 * nstored, HYPRE_MEMORY_HOST);
+   offsets   = hypre_TAlloc(HYPRE_Int, 2 * nstored, memory_location);
+   for (s = 0; s < nstored; s++)
+   {
+      h_offsets[nstored + s] = value_offsets[stored[s]];
+   }
+
+   /*-----------------------------------------------------------------------
+    * Set the matrix coefficients
+    *-----------------------------------------------------------------------*/
+
+   if (outside > 0)
+   {
+      grid_boxes = hypre_StructMatrixDataSpace(matrix);
+   }
+   else
+   {
+      grid_boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   }
+   data_space = hypre_StructMatrixDataSpace(matrix);
+
+   if (boxnum < 0)
+   {
+      istart = 0;
+      istop  = hypre_BoxArraySize(grid_boxes);
+   }
+   else
+   {
+      istart = boxnum;
+      istop  = istart + 1;
+   }
+
+   hypre_SetIndex(data_stride, 1);
+   int_box = hypre_BoxCreate(ndim);
+
+   for (i = istart; i < istop; i++)
+   {
+      grid_box = hypre_BoxArrayBox(grid_boxes, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+
+      hypre_IntersectBoxes(set_box, grid_box, int_box);
+
+      /* if there was an intersection */
+      if (hypre_BoxVolume(int_box))
+      {
+         for (s = 0; s < nstored; s++)
+         {
+            h_offsets[s] = data_indices[i][stencil_indices[stored[s]]];
+         }
+         hypre_TMemcpy(offsets, h_offsets, HYPRE_Int, 2 * nstored,
+                       memory_location, HYPRE_MEMORY_HOST);
+
+         data_start = hypre_BoxIMin(int_box);
+         hypre_BoxGetSize(int_box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(data,values,offsets)
+         if (action > 0)
+         {
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                data_box, data_start, data_stride, datai,
+                                value_box, data_start, data_stride, vali);
+            {
+               HYPRE_Int  ss;
+               for (ss = 0; ss < nstored; ss++)
+               {
+                  data[offsets[ss] + datai] +=
+                     values[vali * point_stride + offsets[nstored + ss]];
+               }
+            }
+            hypre_BoxLoop2End(datai, vali);
+         }
+         else if (action > -1)
+         {
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                data_box, data_start, data_stride, datai,
+                                value_box, data_start, data_stride, vali);
+            {
+               HYPRE_Int  ss;
+               for (ss = 0; ss < nstored; ss++)
+               {
+                  data[offsets[ss] + datai] =
+                     values[vali * point_stride + offsets[nstored + ss]];
+               }
+            }
+            hypre_BoxLoop2End(datai, vali);
+         }
+         else
+         {
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                data_box, data_start, data_stride, datai,
+                                value_box, data_start, data_stride, vali);
+            {
+               HYPRE_Int  ss;
+               for (ss = 0; ss < nstored; ss++)
+               {
+                  values[vali * point_stride + offsets[nstored + ss]] =
+                     data[offsets[ss] + datai];
+                  if (action == -2)
+                  {
+                     data[offsets[ss] + datai] = 0;
+                  }
+               }
+            }
+            hypre_BoxLoop2End(datai, vali);
+         }
+#undef DEVICE_VAR
+      }
+   }
+
+   hypre_BoxDestroy(int_box);
+   hypre_TFree(stored, HYPRE_MEMORY_HOST);
+   hypre_TFree(h_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(offsets, memory_location);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * (action > 0): add-to values
  * (action = 0): set values
@@ -298,6 +298,7 @@ main( hypre_int argc,
    HYPRE_Int  cheby_eig_est = 10;
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
+   HYPRE_Int  cheby_eig_reuse = 0;
    HYPRE_Real cheby_fraction = .3;
 
 #if defined(HYPRE_USING_GPU)
@@ -369,6 +370,7 @@ main( hypre_int argc,
 
    HYPRE_Int    print_system = 0;
    HYPRE_Int    print_system_binary = 0;
+   HYPRE_Int    print_parcsr_binary = 0;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
    HYPRE_Int    benchmark = 0;
@@ -440,12 +442,16 @@ main( hypre_int argc,
    HYPRE_Int mgr_num_gsmooth_sweeps = 1;
    HYPRE_Int mgr_restrict_type = 0;
    HYPRE_Int mgr_num_restrict_sweeps = 0;
+   HYPRE_Int mgr_setup_reuse = 0;
+   HYPRE_Real mgr_setup_perturb = 0.0;
    /* end mgr options */
 
    /* hypre_ILU options */
    HYPRE_Int ilu_type = 0;
    HYPRE_Int ilu_lfil = 0;
    HYPRE_Int ilu_reordering = 1;
+   HYPRE_Int ilu_num_local_parts = 0;
+   HYPRE_Int ilu_block_size = 1;
    HYPRE_Int ilu_tri_solve = 1;
    HYPRE_Int ilu_ljac_iters = 5;
    HYPRE_Int ilu_ujac_iters = 5;
@@ -470,6 +476,7 @@ main( hypre_int argc,
    HYPRE_Real fsai_threshold = 1.0e-02;
    HYPRE_Int  fsai_eig_max_iters = 5;
    HYPRE_Real fsai_kap_tolerance = 1.0e-03;
+   HYPRE_Int  fsai_pattern_reuse = 0;
    /* end hypre FSAI options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -714,6 +721,12 @@ main( hypre_int argc,
          build_matrix_type      = -1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromMMfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -3;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-auxfromfile") == 0 )
       {
          arg_index++;
@@ -732,6 +745,12 @@ main( hypre_int argc,
          build_matrix_type      = 1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromparbinfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 9;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-laplacian") == 0 )
       {
          arg_index++;
@@ -1387,6 +1406,18 @@ main( hypre_int argc,
          arg_index++;
          mgr_num_restrict_sweeps = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mgr_setup_reuse") == 0 )
+      {
+         /* reuse of setup data across setup calls */
+         arg_index++;
+         mgr_setup_reuse = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mgr_setup_perturb") == 0 )
+      {
+         /* change the matrix values before the second setup call */
+         arg_index++;
+         mgr_setup_perturb = (HYPRE_Real) atof(argv[arg_index++]);
+      }
       /* end mgr options */
       /* begin ilu options*/
       else if ( strcmp(argv[arg_index], "-ilu_type") == 0 )
@@ -1413,6 +1444,18 @@ main( hypre_int argc,
          arg_index++;
          ilu_reordering = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_nparts") == 0 )
+      {
+         /* number of local subdomains for the dissection reordering */
+         arg_index++;
+         ilu_num_local_parts = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_block_size") == 0 )
+      {
+         /* number of unknowns per node for block ILU(k) */
+         arg_index++;
+         ilu_block_size = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-ilu_trisolve") == 0 )
       {
          /* Triangular solver type */
@@ -1532,6 +1575,11 @@ main( hypre_int argc,
          arg_index++;
          fsai_kap_tolerance = (HYPRE_Real)atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fs_pattern_reuse") == 0 )
+      {
+         arg_index++;
+         fsai_pattern_reuse = atoi(argv[arg_index++]);
+      }
       /* end FSAI options */
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-mm_vendor") == 0 )
@@ -2110,6 +2158,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_scale = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_eig_reuse") == 0 )
+      {
+         arg_index++;
+         cheby_eig_reuse = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cheby_fraction") == 0 )
       {
          arg_index++;
@@ -2197,6 +2250,11 @@ main( hypre_int argc,
          arg_index++;
          print_system_binary = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printparbin") == 0 )
+      {
+         arg_index++;
+         print_parcsr_binary = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -2328,10 +2386,14 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -frombinfile <filename>    : ");
          hypre_printf("matrix read from multiple binary files (IJ format)\n");
+         hypre_printf("  -fromMMfile <filename>     : ");
+         hypre_printf("matrix read from a single file (Matrix Market format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
+         hypre_printf("  -fromparbinfile <filename> : ");
+         hypre_printf("matrix read from a single binary file (ParCSR format)\n");
          hypre_printf("\n");
          hypre_printf("  -laplacian             : build 5pt 2D laplacian problem (default) \n");
          hypre_printf("  -sysL <num functions>  : build SYSTEMS laplacian 7pt operator\n");
@@ -2487,6 +2549,8 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_variant <val> : Chebyshev variant (0-3, 2/3 = fourth-kind, default is 0)\n");
+         hypre_printf("  -cheby_eig_reuse <val> : reuse CG eigenvalue estimates across setups (default is 0)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -2559,6 +2623,7 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printparbin           : print out the matrix in ParCSR binary format\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2651,6 +2716,12 @@ main( hypre_int argc,
          hypre_printf("                                     for F-relaxation \n");
          hypre_printf("  -mgr_frelax_method   1           : Use a 'multi-level smoother' strategy \n");
          hypre_printf("                                     for F-relaxation \n");
+         hypre_printf("  -mgr_setup_reuse   <val>         : reuse setup data in later setup calls \n");
+         hypre_printf("                                     0: none, 1: CF splitting, \n");
+         hypre_printf("                                     2: also lag P and R, \n");
+         hypre_printf("                                     3: also lag the F-relaxation solver \n");
+         hypre_printf("  -mgr_setup_perturb <val>         : scale column j of A by 1 + val*(j%%7)/7 \n");
+         hypre_printf("                                     before the -second_time setup (solver 70)\n");
          /* end MGR options */
          /* hypre ILU options */
          hypre_printf("  -ilu_type   <val>                : set ILU factorization type = val\n");
@@ -2671,7 +2742,11 @@ main( hypre_int argc,
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
          hypre_printf("  -ilu_reordering <val>            : 0: no reordering. 1: Reverse Cuthill-McKee.\n");
-         hypre_printf("  -ilu_tri_solve <0/1>             : 0: iterative solve. 1: direct solve.\n");
+         hypre_printf("                                     2: RCM + dissection (threaded BJ factorization).\n");
+         hypre_printf("  -ilu_nparts <val>                : number of local subdomains for -ilu_reordering 2.\n");
+         hypre_printf("  -ilu_block_size <val>            : unknowns per node for block ILU(k) = val\n");
+         hypre_printf("  -ilu_trisolve <0/1/2>            : 0: iterative solve. 1: direct solve.\n");
+         hypre_printf("                                     2: direct solve with level scheduling.\n");
          hypre_printf("  -ilu_ljac_iters <val>            : set number of lower Jacobi iterations for the triangular L solves when using iterative solve approach.\n");
          hypre_printf("  -ilu_ujac_iters <val>            : set number of upper Jacobi iterations for the triangular U solves when using iterative solve approach.\n");
          hypre_printf("  -ilu_iter_setup_type <val>       : set iterative ILU setup algorithm.\n");
@@ -2690,6 +2765,7 @@ main( hypre_int argc,
          hypre_printf("  -fs_threshold <val>              : Filtering threshold (static)\n");
          hypre_printf("  -fs_eig_max_iters <val>          : Max. it. for eig calculation.\n");
          hypre_printf("  -fs_kap_tol <val>                : Kap. theshold (adaptive)\n");
+         hypre_printf("  -fs_pattern_reuse <val>          : Reuse pattern of G across setups\n");
          /* end FSAI options */
          /* hypre AMG-DD options */
          hypre_printf("  -amgdd_start_level   <val>       : set AMG-DD start level = val\n");
@@ -2825,6 +2901,16 @@ main( hypre_int argc,
          hypre_MPI_Abort(comm, 1);
       }
    }
+   else if ( build_matrix_type == -3 )
+   {
+      ierr = HYPRE_IJMatrixReadMM( argv[build_matrix_arg_index], comm,
+                                   HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix in MM format!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
    else if ( build_matrix_type == 0 )
    {
       BuildParFromFile(argc, argv, build_matrix_arg_index, &parcsr_A);
@@ -2872,6 +2958,15 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 9 )
+   {
+      ierr = HYPRE_ParCSRMatrixReadBinary(comm, argv[build_matrix_arg_index], &parcsr_A);
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
    else
    {
       hypre_printf("You have asked for an unsupported problem with\n");
@@ -4080,6 +4175,11 @@ main( hypre_int argc,
       }
    }
 
+   if (print_parcsr_binary)
+   {
+      HYPRE_ParCSRMatrixPrintBinary(parcsr_A, "ParCSR.out.A.bin");
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -4526,6 +4626,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyEigReuse(amg_solver, cheby_eig_reuse);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4575,6 +4676,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetFSAIThreshold(amg_solver, fsai_threshold);
       HYPRE_BoomerAMGSetFSAIEigMaxIters(amg_solver, fsai_eig_max_iters);
       HYPRE_BoomerAMGSetFSAIKapTolerance(amg_solver, fsai_kap_tolerance);
+      HYPRE_BoomerAMGSetFSAIPatternReuse(amg_solver, fsai_pattern_reuse);
       HYPRE_BoomerAMGSetFilterFunctions(amg_solver, filter_functions);
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
@@ -4850,6 +4952,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyEigReuse(amg_solver, cheby_eig_reuse);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4898,6 +5001,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetFSAIThreshold(amg_solver, fsai_threshold);
       HYPRE_BoomerAMGSetFSAIEigMaxIters(amg_solver, fsai_eig_max_iters);
       HYPRE_BoomerAMGSetFSAIKapTolerance(amg_solver, fsai_kap_tolerance);
+      HYPRE_BoomerAMGSetFSAIPatternReuse(amg_solver, fsai_pattern_reuse);
       HYPRE_BoomerAMGSetFilterFunctions(amg_solver, filter_functions);
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
@@ -5071,6 +5175,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -5131,6 +5236,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
          if (num_functions > 1)
          {
@@ -5274,6 +5380,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -5317,6 +5424,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
          HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
@@ -5377,6 +5485,7 @@ main( hypre_int argc,
          HYPRE_FSAISetNumLevels(pcg_precond, fsai_num_levels);
          HYPRE_FSAISetThreshold(pcg_precond, fsai_threshold);
          HYPRE_FSAISetKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_FSAISetPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_FSAISetMaxIterations(pcg_precond, 1);
          HYPRE_FSAISetTolerance(pcg_precond, 0.0);
          HYPRE_FSAISetZeroGuess(pcg_precond, 1);
@@ -6802,6 +6911,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(amg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(amg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(amg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(amg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(amg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(amg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(amg_precond, outer_wt);
@@ -6861,6 +6971,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIThreshold(amg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIEigMaxIters(amg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIKapTolerance(amg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(amg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetCycleNumSweeps(amg_precond, ns_coarse, 3);
          if (ns_down > -1)
          {
@@ -7016,6 +7127,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7061,6 +7173,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
          HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
@@ -7153,6 +7266,8 @@ main( hypre_int argc,
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
          HYPRE_ILUSetLocalReordering(pcg_precond, ilu_reordering);
+         HYPRE_ILUSetNumLocalParts(pcg_precond, ilu_num_local_parts);
+         HYPRE_ILUSetBlockSize(pcg_precond, ilu_block_size);
          HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
          HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_ljac_iters);
          HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_ujac_iters);
@@ -7397,6 +7512,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7456,6 +7572,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
          if (num_functions > 1)
          {
@@ -7623,6 +7740,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7682,6 +7800,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
          if (num_functions > 1)
          {
@@ -7759,6 +7878,7 @@ main( hypre_int argc,
          /* set interpolation type */
          HYPRE_MGRSetInterpType(pcg_precond, mgr_interp_type);
          HYPRE_MGRSetNumInterpSweeps(pcg_precond, mgr_num_interp_sweeps);
+         HYPRE_MGRSetSetupReuse(pcg_precond, mgr_setup_reuse);
          /* set print level */
          HYPRE_MGRSetPrintLevel(pcg_precond, ioutdat);
          /* set max iterations */
@@ -7852,6 +7972,8 @@ main( hypre_int argc,
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
          HYPRE_ILUSetLocalReordering(pcg_precond, ilu_reordering);
+         HYPRE_ILUSetNumLocalParts(pcg_precond, ilu_num_local_parts);
+         HYPRE_ILUSetBlockSize(pcg_precond, ilu_block_size);
          HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
          HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_ljac_iters);
          HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_ujac_iters);
@@ -8058,6 +8180,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -8118,6 +8241,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
          if (num_functions > 1)
          {
@@ -8263,6 +8387,7 @@ main( hypre_int argc,
          HYPRE_MGRSetNumRestrictSweeps(pcg_precond, mgr_num_restrict_sweeps);
          HYPRE_MGRSetInterpType(pcg_precond, mgr_interp_type);
          HYPRE_MGRSetNumInterpSweeps(pcg_precond, mgr_num_interp_sweeps);
+         HYPRE_MGRSetSetupReuse(pcg_precond, mgr_setup_reuse);
          /* set print level */
          HYPRE_MGRSetPrintLevel(pcg_precond, ioutdat);
          /* set max iterations */
@@ -8485,6 +8610,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -8545,6 +8671,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetFSAIThreshold(pcg_precond, fsai_threshold);
          HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIPatternReuse(pcg_precond, fsai_pattern_reuse);
          HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
          if (num_functions > 1)
          {
@@ -8664,6 +8791,7 @@ main( hypre_int argc,
          HYPRE_MGRSetNumRestrictSweeps(pcg_precond, mgr_num_restrict_sweeps);
          HYPRE_MGRSetInterpType(pcg_precond, mgr_interp_type);
          HYPRE_MGRSetNumInterpSweeps(pcg_precond, mgr_num_interp_sweeps);
+         HYPRE_MGRSetSetupReuse(pcg_precond, mgr_setup_reuse);
          /* set print level */
          HYPRE_MGRSetPrintLevel(pcg_precond, ioutdat);
          /* set max iterations */
@@ -8856,6 +8984,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigReuse(pcg_precond, cheby_eig_reuse);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -9053,6 +9182,7 @@ main( hypre_int argc,
       HYPRE_MGRSetNumRestrictSweeps(mgr_solver, mgr_num_restrict_sweeps);
       HYPRE_MGRSetInterpType(mgr_solver, mgr_interp_type);
       HYPRE_MGRSetNumInterpSweeps(mgr_solver, mgr_num_interp_sweeps);
+      HYPRE_MGRSetSetupReuse(mgr_solver, mgr_setup_reuse);
       /* set print level */
       HYPRE_MGRSetPrintLevel(mgr_solver, ioutdat);
       /* set max iterations */
@@ -9142,6 +9272,43 @@ main( hypre_int argc,
 #endif
          hypre_ParVectorCopy(x0_save, x);
 
+         /* change the matrix values, but not the sparsity pattern */
+         if (mgr_setup_perturb != 0.0)
+         {
+            HYPRE_IJVector   ij_rd;
+            HYPRE_ParVector  par_rd;
+            HYPRE_Complex   *h_data, *d_data;
+
+            h_data = hypre_TAlloc(HYPRE_Complex, local_num_rows, HYPRE_MEMORY_HOST);
+            d_data = hypre_TAlloc(HYPRE_Complex, local_num_rows, memory_location);
+            for (i = 0; i < local_num_rows; i++)
+            {
+               h_data[i] = 1.0 + mgr_setup_perturb *
+                           (HYPRE_Real) ((first_local_row + i) % 7) / 7.0;
+            }
+            hypre_TMemcpy(d_data, h_data, HYPRE_Complex, local_num_rows,
+                          memory_location, HYPRE_MEMORY_HOST);
+
+            HYPRE_IJVectorCreate(comm, first_local_row, last_local_row, &ij_rd);
+            HYPRE_IJVectorSetObjectType(ij_rd, HYPRE_PARCSR);
+            HYPRE_IJVectorInitialize(ij_rd);
+            HYPRE_IJVectorSetValues(ij_rd, local_num_rows, NULL, d_data);
+            HYPRE_IJVectorAssemble(ij_rd);
+            HYPRE_IJVectorGetObject(ij_rd, &object);
+            par_rd = (HYPRE_ParVector) object;
+
+            /* Compute A = A * diag(rd) */
+            hypre_ParCSRMatrixDiagScale(parcsr_A, NULL, par_rd);
+            if (parcsr_M != parcsr_A)
+            {
+               hypre_ParCSRMatrixDiagScale(parcsr_M, NULL, par_rd);
+            }
+
+            hypre_TFree(h_data, HYPRE_MEMORY_HOST);
+            hypre_TFree(d_data, memory_location);
+            HYPRE_IJVectorDestroy(ij_rd);
+         }
+
          HYPRE_MGRSetup(mgr_solver, parcsr_M, b, x);
          HYPRE_MGRSolve(mgr_solver, parcsr_A, b, x);
       }
@@ -9206,6 +9373,10 @@ main( hypre_int argc,
       HYPRE_ILUSetLevelOfFill(ilu_solver, ilu_lfil);
       /* set local reordering type */
       HYPRE_ILUSetLocalReordering(ilu_solver, ilu_reordering);
+      HYPRE_ILUSetNumLocalParts(ilu_solver, ilu_num_local_parts);
+      HYPRE_ILUSetBlockSize(ilu_solver, ilu_block_size);
+      /* set triangular solve type */
+      HYPRE_ILUSetTriSolve(ilu_solver, ilu_tri_solve);
       /* set print level */
       HYPRE_ILUSetPrintLevel(ilu_solver, 2);
       /* set max iterations */
@@ -9304,7 +9475,7 @@ final:
 
    HYPRE_ParVectorDestroy(x0_save);
 
-   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2)
+   if (test_ij || build_matrix_type < 0)
    {
       if (ij_A)
       {
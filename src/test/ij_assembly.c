@@ -36,6 +36,9 @@ HYPRE_Int getParCSRMatrixData(HYPRE_ParCSRMatrix  A, HYPRE_Int base, HYPRE_Int *
 
 HYPRE_Real checkMatrix(HYPRE_ParCSRMatrix parcsr_ref, HYPRE_IJMatrix ij_A);
 
+/* host assembly algorithm passed to HYPRE_IJMatrixSetAssemblyMode */
+static HYPRE_Int assembly_mode = 0;
+
 HYPRE_Int test_Set(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HYPRE_Int option,
                    HYPRE_BigInt ilower,
                    HYPRE_BigInt iupper, HYPRE_BigInt jlower, HYPRE_BigInt jupper, HYPRE_Int nrows,
@@ -72,6 +75,17 @@ HYPRE_Int test_SetAddSet(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HY
                          HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks, HYPRE_Int *h_nnzrow, HYPRE_Int *nnzrow,
                          HYPRE_BigInt *rows, HYPRE_BigInt *cols, HYPRE_Real *coefs, HYPRE_IJMatrix *ij_AT_ptr);
 
+HYPRE_Int test_AddConcurrent(MPI_Comm comm, HYPRE_MemoryLocation memory_location,
+                             HYPRE_BigInt ilower, HYPRE_BigInt iupper, HYPRE_BigInt jlower,
+                             HYPRE_BigInt jupper, HYPRE_Int nrows, HYPRE_BigInt num_nonzeros,
+                             HYPRE_Int *h_nnzrow, HYPRE_BigInt *rows, HYPRE_BigInt *cols,
+                             HYPRE_Real *coefs, HYPRE_IJMatrix *ij_A_ptr);
+
+HYPRE_Int test_AddTransposeRepeat(MPI_Comm comm, HYPRE_MemoryLocation memory_location,
+                                  HYPRE_BigInt ilower, HYPRE_BigInt iupper, HYPRE_BigInt jlower,
+                                  HYPRE_BigInt jupper, HYPRE_Int nrows, HYPRE_BigInt num_nonzeros,
+                                  HYPRE_Int nchunks, HYPRE_Int *h_nnzrow, HYPRE_BigInt *rows,
+                                  HYPRE_BigInt *cols, HYPRE_Real *coefs, HYPRE_IJMatrix *ij_AT_ptr);
 
 hypre_int
 main( hypre_int  argc,
@@ -109,6 +123,7 @@ main( hypre_int  argc,
    HYPRE_Int                 option, base;
    HYPRE_Int                 stencil;
    HYPRE_Int                 print_matrix;
+   HYPRE_Int                 neighbor_coll;
 
    /* Initialize MPI */
    hypre_MPI_Init(&argc, &argv);
@@ -156,6 +171,7 @@ main( hypre_int  argc,
    nchunks             = 3;
    base                = 0;
    print_matrix        = 0;
+   neighbor_coll       = 0;
    stencil             = 7;
 
    /*-----------------------------------------------------------
@@ -221,6 +237,16 @@ main( hypre_int  argc,
          arg_index++;
          base = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-assembly_mode") == 0 )
+      {
+         arg_index++;
+         assembly_mode = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_coll") == 0 )
+      {
+         arg_index++;
+         neighbor_coll = 1;
+      }
       else if ( strcmp(argv[arg_index], "-print") == 0 )
       {
          arg_index++;
@@ -265,9 +291,17 @@ main( hypre_int  argc,
          hypre_printf("             4 = SetSet\n");
          hypre_printf("             8 = AddSet\n");
          hypre_printf("            16 = SetAddSet\n");
+         hypre_printf("            64 = AddConcurrent, assembled twice (assembly modes 1 and 2 on host only)\n");
+         hypre_printf("           128 = AddTransposeRepeat\n");
          hypre_printf("      -option <val>          : interface option of Set/AddToValues\n");
          hypre_printf("             1 = CSR-like (default)\n");
          hypre_printf("             2 = COO-like\n");
+         hypre_printf("      -assembly_mode <val>   : host assembly algorithm\n");
+         hypre_printf("             0 = row arrays (default)\n");
+         hypre_printf("             1 = COO stash and sort\n");
+         hypre_printf("             2 = COO stash and sort, reusing the assembly pattern\n");
+         hypre_printf("      -neighbor_coll         : exchange off-processor values with\n");
+         hypre_printf("                               MPI neighborhood collectives\n");
          hypre_printf("      -print                 : print matrices\n");
          hypre_printf("\n");
       }
@@ -303,13 +337,20 @@ main( hypre_int  argc,
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
 #endif
 
+   HYPRE_SetUseNeighborCollectives(neighbor_coll);
+
 #if defined(HYPRE_USING_OPENMP)
-   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST && assembly_mode == 0)
    {
-      mode = mode & ~2; /* skip AddTranspose with OMP */
+      mode = mode & ~(2 | 128); /* skip AddTranspose with OMP */
    }
 #endif
 
+   if (hypre_GetExecPolicy1(memory_location) != HYPRE_EXEC_HOST || assembly_mode == 0)
+   {
+      mode = mode & ~64; /* concurrent AddToValues needs the stash assembly */
+   }
+
    /*-----------------------------------------------------------
     * Build matrix entries
     *-----------------------------------------------------------*/
@@ -450,6 +491,37 @@ main( hypre_int  argc,
       HYPRE_IJMatrixDestroy(ij_A);
    }
 
+   /* Test concurrent Add */
+   if (mode & 64)
+   {
+      test_AddConcurrent(comm, memory_location, ilower, iupper, jlower, jupper, nrows, num_nonzeros,
+                         h_nnzrow, rows, cols, coefs, &ij_A);
+
+      ierr += checkMatrix(parcsr_ref, ij_A) > tol;
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_A, "ij_AddConcurrent");
+      }
+      HYPRE_IJMatrixDestroy(ij_A);
+   }
+
+   /* Test repeated AddTranspose */
+   if (mode & 128)
+   {
+      test_AddTransposeRepeat(comm, memory_location, ilower, iupper, jlower, jupper, nrows,
+                              num_nonzeros, nchunks, h_nnzrow, rows_coo, cols, coefs, &ij_AT);
+
+      hypre_ParCSRMatrixTranspose(parcsr_ref, &parcsr_trans, 1);
+
+      ierr += checkMatrix(parcsr_trans, ij_AT) > tol;
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_AT, "ij_AddTransRepeat");
+      }
+      HYPRE_IJMatrixDestroy(ij_AT);
+      HYPRE_ParCSRMatrixDestroy(parcsr_trans);
+   }
+
    /* Print the error code */
    hypre_ParPrintf(comm, "Test error code = %d\n", ierr);
 
@@ -756,6 +828,7 @@ test_Set(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -850,6 +923,7 @@ test_AddTranspose(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, jlower, jupper, ilower, iupper, &ij_AT);
    HYPRE_IJMatrixSetObjectType(ij_AT, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_AT, assembly_mode);
    HYPRE_IJMatrixInitialize_v2(ij_AT, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_AT, 1);
 
@@ -925,6 +999,7 @@ test_SetSet(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1053,6 +1128,7 @@ test_AddSet(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1177,6 +1253,7 @@ test_SetAdd(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1285,6 +1362,7 @@ test_SetAddSet(MPI_Comm             comm,
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
    HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
    HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
    HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
 
@@ -1383,3 +1461,163 @@ test_SetAddSet(MPI_Comm             comm,
 
    return hypre_error_flag;
 }
+
+/* add the values of each row in two halves, from concurrent threads */
+HYPRE_Int
+test_AddConcurrent(MPI_Comm             comm,
+                   HYPRE_MemoryLocation memory_location,
+                   HYPRE_BigInt         ilower,
+                   HYPRE_BigInt         iupper,
+                   HYPRE_BigInt         jlower,
+                   HYPRE_BigInt         jupper,
+                   HYPRE_Int            nrows,
+                   HYPRE_BigInt         num_nonzeros,
+                   HYPRE_Int           *h_nnzrow,
+                   HYPRE_BigInt        *rows,
+                   HYPRE_BigInt        *cols,
+                   HYPRE_Real          *coefs,
+                   HYPRE_IJMatrix      *ij_A_ptr)
+{
+   HYPRE_IJMatrix  ij_A;
+   HYPRE_Int       i, step;
+   HYPRE_Int       time_index;
+   HYPRE_Int      *h_rowptr;
+   HYPRE_Real     *half_coefs;
+
+   h_rowptr = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+   for (i = 1; i < nrows + 1; i++)
+   {
+      h_rowptr[i] = h_rowptr[i - 1] + h_nnzrow[i - 1];
+   }
+   hypre_assert(h_rowptr[nrows] == num_nonzeros);
+
+   half_coefs = hypre_TAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      half_coefs[i] = 0.5 * coefs[i];
+   }
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
+   HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
+
+   time_index = hypre_InitializeTiming("Test AddConcurrent");
+   hypre_BeginTiming(time_index);
+
+   /* The second step re-assembles the matrix. The assembly frees the stashes,
+      so they are recreated by the threads of the parallel region. */
+   for (step = 0; step < 2; step++)
+   {
+      if (step > 0)
+      {
+         HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+      }
+
+      /* with a static schedule, the two halves of a row come from different threads */
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) schedule(static)
+#endif
+      for (i = 0; i < 2 * nrows; i++)
+      {
+         HYPRE_Int row = i % nrows;
+
+         HYPRE_IJMatrixAddToValues(ij_A, 1, &h_nnzrow[row], &rows[row],
+                                   &cols[h_rowptr[row]], &half_coefs[h_rowptr[row]]);
+      }
+
+      // Assemble matrix
+      HYPRE_IJMatrixAssemble(ij_A);
+   }
+
+   // Finalize timer
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test AddConcurrent", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(h_rowptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(half_coefs, HYPRE_MEMORY_HOST);
+
+   // Set pointer to matrix
+   *ij_A_ptr = ij_A;
+
+   return hypre_error_flag;
+}
+
+/* Assembles the transpose several times with the same sequence of off-processor
+   additions, as in a time stepping loop. Assembly mode 2 reuses the pattern. */
+HYPRE_Int
+test_AddTransposeRepeat(MPI_Comm             comm,
+                        HYPRE_MemoryLocation memory_location,
+                        HYPRE_BigInt         ilower,
+                        HYPRE_BigInt         iupper,
+                        HYPRE_BigInt         jlower,
+                        HYPRE_BigInt         jupper,
+                        HYPRE_Int            nrows,
+                        HYPRE_BigInt         num_nonzeros,
+                        HYPRE_Int            nchunks,
+                        HYPRE_Int           *h_nnzrow,
+                        HYPRE_BigInt        *rows,
+                        HYPRE_BigInt        *cols,
+                        HYPRE_Real          *coefs,
+                        HYPRE_IJMatrix      *ij_AT_ptr)
+{
+   HYPRE_IJMatrix  ij_AT;
+   HYPRE_Int       i, step, chunk, chunk_size;
+   HYPRE_Int       time_index;
+   HYPRE_Int      *h_rowptr = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 1; i < nrows + 1; i++)
+   {
+      h_rowptr[i] = h_rowptr[i - 1] + h_nnzrow[i - 1];
+   }
+   hypre_assert(h_rowptr[nrows] == num_nonzeros);
+
+   HYPRE_IJMatrixCreate(comm, jlower, jupper, ilower, iupper, &ij_AT);
+   HYPRE_IJMatrixSetObjectType(ij_AT, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetAssemblyMode(ij_AT, assembly_mode);
+   HYPRE_IJMatrixInitialize_v2(ij_AT, memory_location);
+
+   time_index = hypre_InitializeTiming("Test AddTransposeRepeat");
+   hypre_BeginTiming(time_index);
+
+   for (step = 0; step < 3; step++)
+   {
+      if (step > 0)
+      {
+         HYPRE_IJMatrixSetConstantValues(ij_AT, 0.0);
+      }
+
+      chunk_size = nrows / nchunks;
+      for (chunk = 0; chunk < nrows; chunk += chunk_size)
+      {
+         chunk_size = hypre_min(chunk_size, nrows - chunk);
+
+         HYPRE_IJMatrixAddToValues(ij_AT, h_rowptr[chunk + chunk_size] - h_rowptr[chunk],
+                                   NULL, &cols[h_rowptr[chunk]],
+                                   &rows[h_rowptr[chunk]], &coefs[h_rowptr[chunk]]);
+      }
+
+      HYPRE_IJMatrixAssemble(ij_AT);
+   }
+
+#if defined(HYPRE_USING_GPU)
+   hypre_SyncCudaDevice(hypre_handle());
+#endif
+
+   // Finalize timer
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test AddTransposeRepeat", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(h_rowptr, HYPRE_MEMORY_HOST);
+
+   // Set pointer to output
+   *ij_AT_ptr = ij_AT;
+
+   return hypre_error_flag;
+}
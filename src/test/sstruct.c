@@ -2245,6 +2245,8 @@ PrintUsage( char *progname,
       hypre_printf("                        248- Struct BiCGSTAB with diagonal scaling\n");
       hypre_printf("                        249- Struct BiCGSTAB\n");
       hypre_printf("  -print             : print out the system\n");
+      hypre_printf("  -direct_parcsr     : build ParCSR matrix directly from SStruct storage\n");
+      hypre_printf("  -strided           : set stencil values of all variables at once\n");
       hypre_printf("  -rhsfromcosine     : solution is cosine function (default)\n");
       hypre_printf("  -rhsone            : rhs is vector with unit components\n");
       hypre_printf("  -tol <val>         : convergence tolerance (default 1e-6)\n");
@@ -2339,6 +2341,8 @@ main( hypre_int argc,
    Index                *block = NULL;
    HYPRE_Int             solver_id, object_type;
    HYPRE_Int             print_system;
+   HYPRE_Int             direct_parcsr;
+   HYPRE_Int             set_strided;
    HYPRE_Int             cosine;
    HYPRE_Real            scale;
    HYPRE_Int             read_fromfile_flag = 0;
@@ -2511,6 +2515,8 @@ main( hypre_int argc,
    jump  = 0;
    gradient_matrix = 0;
    object_type = HYPRE_SSTRUCT;
+   direct_parcsr = 0;
+   set_strided = 0;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
    cf_tol = 0.90;
@@ -2715,6 +2721,16 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-direct_parcsr") == 0 )
+      {
+         arg_index++;
+         direct_parcsr = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-strided") == 0 )
+      {
+         arg_index++;
+         set_strided = 1;
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromcosine") == 0 )
       {
          arg_index++;
@@ -3217,10 +3233,102 @@ main( hypre_int argc,
       {
          HYPRE_SStructMatrixSetObjectType(A, object_type);
       }
+      if ( object_type == HYPRE_PARCSR && direct_parcsr )
+      {
+         HYPRE_SStructMatrixSetDirectParCSR(A, 1);
+      }
 
       HYPRE_SStructMatrixInitialize(A);
 
-      if (data.nstencils > 0)
+      if (data.nstencils > 0 && set_strided)
+      {
+         /* StencilSetEntry: set stencil values of all variables of the same
+          * type with one call per box, one array per entry */
+         HYPRE_Int   *svars, *snentries, *sentries;
+         HYPRE_Int    snvars, snent, boxsize, ii;
+         HYPRE_Real  *svalues, *d_svalues;
+
+         for (part = 0; part < data.nparts; part++)
+         {
+            pdata = data.pdata[part];
+
+            snent = 0;
+            for (var = 0; var < pdata.nvars; var++)
+            {
+               snent += data.stencil_sizes[pdata.stencil_num[var]];
+            }
+            svars     = hypre_TAlloc(HYPRE_Int, pdata.nvars, HYPRE_MEMORY_HOST);
+            snentries = hypre_TAlloc(HYPRE_Int, pdata.nvars, HYPRE_MEMORY_HOST);
+            sentries  = hypre_TAlloc(HYPRE_Int, snent, HYPRE_MEMORY_HOST);
+            svalues   = hypre_TAlloc(HYPRE_Real, snent * pdata.max_boxsize,
+                                     HYPRE_MEMORY_HOST);
+            d_svalues = hypre_TAlloc(HYPRE_Real, snent * pdata.max_boxsize,
+                                     memory_location);
+
+            for (box = 0; box < pdata.nboxes; box++)
+            {
+               for (var = 0; var < pdata.nvars; var++)
+               {
+                  /* skip variables whose type has already been set */
+                  for (j = 0; j < var; j++)
+                  {
+                     if (pdata.vartypes[j] == pdata.vartypes[var])
+                     {
+                        break;
+                     }
+                  }
+                  if (j < var)
+                  {
+                     continue;
+                  }
+
+                  GetVariableBox(pdata.ilowers[box], pdata.iuppers[box],
+                                 pdata.vartypes[var], ilower, iupper);
+                  boxsize = 1;
+                  for (j = 0; j < 3; j++)
+                  {
+                     boxsize *= (iupper[j] - ilower[j] + 1);
+                  }
+
+                  snvars = 0;
+                  k = 0;
+                  for (j = var; j < pdata.nvars; j++)
+                  {
+                     if (pdata.vartypes[j] == pdata.vartypes[var])
+                     {
+                        s = pdata.stencil_num[j];
+                        svars[snvars] = j;
+                        snentries[snvars] = data.stencil_sizes[s];
+                        snvars++;
+                        for (i = 0; i < data.stencil_sizes[s]; i++, k++)
+                        {
+                           sentries[k] = i;
+                           for (ii = 0; ii < boxsize; ii++)
+                           {
+                              svalues[k * boxsize + ii] = data.stencil_values[s][i];
+                           }
+                        }
+                     }
+                  }
+
+                  hypre_TMemcpy(d_svalues, svalues, HYPRE_Real, k * boxsize,
+                                memory_location, HYPRE_MEMORY_HOST);
+
+                  HYPRE_SStructMatrixSetBoxValuesStrided(A, part, ilower, iupper,
+                                                         snvars, svars, snentries, sentries,
+                                                         ilower, iupper, d_svalues,
+                                                         1, boxsize);
+               }
+            }
+
+            hypre_TFree(svars, HYPRE_MEMORY_HOST);
+            hypre_TFree(snentries, HYPRE_MEMORY_HOST);
+            hypre_TFree(sentries, HYPRE_MEMORY_HOST);
+            hypre_TFree(svalues, HYPRE_MEMORY_HOST);
+            hypre_TFree(d_svalues, memory_location);
+         }
+      }
+      else if (data.nstencils > 0)
       {
          /* StencilSetEntry: set stencil values */
          for (part = 0; part < data.nparts; part++)
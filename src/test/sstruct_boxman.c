@@ -0,0 +1,538 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * Test driver for the box manager lookups used by the SStruct interface.
+ *
+ * It builds a one-part, cell-centered SStructGrid made of many small boxes
+ * (with holes) on each process and times hypre_SStructGridFindBoxManEntry
+ * with and without the box manager spatial index, checking that both give
+ * the same entries.
+ *
+ * With -regrid, boxes are then added and removed on the even processes and
+ * the grid is re-assembled.  The result is checked against a grid assembled
+ * from scratch with the same boxes.
+ *--------------------------------------------------------------------------*/
+
+#include "HYPRE.h"
+#include "HYPRE_utilities.h"
+#include "HYPRE_sstruct_mv.h"
+#include "_hypre_sstruct_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * Assemble a 7-point Laplacian on the grid and return its Frobenius norm
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+LaplacianNorm( HYPRE_SStructGrid  grid,
+               HYPRE_Int          nboxes,
+               HYPRE_Int         *box_lo,
+               HYPRE_Int          bsize )
+{
+   MPI_Comm              comm = hypre_SStructGridComm(grid);
+   HYPRE_SStructStencil  stencil;
+   HYPRE_SStructGraph    graph;
+   HYPRE_SStructMatrix   A;
+   HYPRE_ParCSRMatrix    parA;
+   HYPRE_Int             offsets[7][3] = {{0, 0, 0}, {-1, 0, 0}, {1, 0, 0}, {0, -1, 0},
+                                          {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+   HYPRE_Int             entries[7] = {0, 1, 2, 3, 4, 5, 6};
+   HYPRE_Int             ilower[3], iupper[3];
+   HYPRE_Real           *values;
+   HYPRE_Real            norm;
+   HYPRE_Int             volume = bsize * bsize * bsize;
+   HYPRE_Int             b, d, i;
+
+   HYPRE_SStructStencilCreate(3, 7, &stencil);
+   for (i = 0; i < 7; i++)
+   {
+      HYPRE_SStructStencilSetEntry(stencil, i, offsets[i], 0);
+   }
+   HYPRE_SStructGraphCreate(comm, grid, &graph);
+   HYPRE_SStructGraphSetObjectType(graph, HYPRE_PARCSR);
+   HYPRE_SStructGraphSetStencil(graph, 0, 0, stencil);
+   HYPRE_SStructGraphAssemble(graph);
+
+   HYPRE_SStructMatrixCreate(comm, graph, &A);
+   HYPRE_SStructMatrixSetObjectType(A, HYPRE_PARCSR);
+   HYPRE_SStructMatrixInitialize(A);
+   values = hypre_TAlloc(HYPRE_Real, 7 * volume, HYPRE_MEMORY_HOST);
+   for (i = 0; i < volume; i++)
+   {
+      values[7 * i] = 6.0;
+      for (d = 1; d < 7; d++)
+      {
+         values[7 * i + d] = -1.0;
+      }
+   }
+   for (b = 0; b < nboxes; b++)
+   {
+      for (d = 0; d < 3; d++)
+      {
+         ilower[d] = box_lo[3 * b + d];
+         iupper[d] = ilower[d] + bsize - 1;
+      }
+      HYPRE_SStructMatrixSetBoxValues(A, 0, ilower, iupper, 0, 7, entries, values);
+   }
+   HYPRE_SStructMatrixAssemble(A);
+   HYPRE_SStructMatrixGetObject(A, (void **) &parA);
+   norm = hypre_ParCSRMatrixFnorm((hypre_ParCSRMatrix *) parA);
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   HYPRE_SStructMatrixDestroy(A);
+   HYPRE_SStructGraphDestroy(graph);
+   HYPRE_SStructStencilDestroy(stencil);
+
+   return norm;
+}
+
+hypre_int
+main( hypre_int  argc,
+      char      *argv[] )
+{
+   MPI_Comm                comm = hypre_MPI_COMM_WORLD;
+   HYPRE_Int               num_procs, myid;
+   HYPRE_Int               arg_index, print_usage;
+   HYPRE_Int               time_index;
+   HYPRE_Int               ierr = 0, global_ierr;
+
+   /* Driver input parameters */
+   HYPRE_Int               nx, ny, nz, bsize, nlookups, sweeps, regrid;
+
+   HYPRE_SStructGrid       grid, new_grid;
+   HYPRE_SStructGraph      old_graph;
+   HYPRE_SStructStencil    old_stencil;
+   HYPRE_SStructVariable   vartypes[1] = {HYPRE_SSTRUCT_VARIABLE_CELL};
+   hypre_BoxManager       *boxman;
+   hypre_BoxManEntry      *entry, **ref_entries, **entries;
+   HYPRE_Int               nboxes, nlocal, global_nlocal;
+   HYPRE_Int               ilower[3], iupper[3];
+   HYPRE_Int               lo[3], hi[3];
+   hypre_Index             index;
+   HYPRE_Int              *points;
+   HYPRE_Int              *box_lo, *new_box_lo, nnew, nkept;
+   hypre_BoxManEntry      *new_entry;
+   HYPRE_BigInt            rank, new_rank;
+   HYPRE_Real              norm, new_norm;
+   HYPRE_Int               i, j, k, d, n, s, b, offset;
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Initialize Hypre: must be the first Hypre function to call */
+   HYPRE_Initialize();
+
+   /*-----------------------------------------------------------
+    * Set default parameters
+    *-----------------------------------------------------------*/
+   nx       = 16;
+   ny       = 16;
+   nz       = 16;
+   bsize    = 4;
+   nlookups = 100000;
+   sweeps   = 1;
+   regrid   = 0;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+   print_usage = 0;
+   arg_index = 1;
+   while ( (arg_index < argc) && (!print_usage) )
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-b") == 0 )
+      {
+         arg_index++;
+         bsize = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-lookups") == 0 )
+      {
+         arg_index++;
+         nlookups = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sweeps") == 0 )
+      {
+         arg_index++;
+         sweeps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-regrid") == 0 )
+      {
+         arg_index++;
+         regrid = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+         break;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Print usage info
+    *-----------------------------------------------------------*/
+   if ( print_usage )
+   {
+      if ( myid == 0 )
+      {
+         hypre_printf("\n");
+         hypre_printf("Usage: %s [<options>]\n", argv[0]);
+         hypre_printf("\n");
+         hypre_printf("  -n <nx> <ny> <nz>  : boxes per process in each direction\n");
+         hypre_printf("  -b <bsize>         : box size in each direction\n");
+         hypre_printf("  -lookups <n>       : number of random lookups\n");
+         hypre_printf("  -sweeps <n>        : number of repetitions of the lookups\n");
+         hypre_printf("  -regrid            : add and remove boxes and re-assemble\n");
+         hypre_printf("\n");
+      }
+
+      HYPRE_Finalize();
+      hypre_MPI_Finalize();
+
+      return (0);
+   }
+
+   if (myid == 0)
+   {
+      hypre_printf("  (nx, ny, nz)  = (%d, %d, %d) boxes per process\n", nx, ny, nz);
+      hypre_printf("  box size      = %d\n", bsize);
+      hypre_printf("  lookups       = %d x %d\n\n", nlookups, sweeps);
+   }
+
+   /*-----------------------------------------------------------
+    * Build the grid: processes are stacked in the x direction and
+    * some of the boxes are left out to create holes
+    *-----------------------------------------------------------*/
+   time_index = hypre_InitializeTiming("SStructGrid setup");
+   hypre_BeginTiming(time_index);
+
+   HYPRE_SStructGridCreate(comm, 3, 1, &grid);
+   offset = myid * nx * bsize;
+   nlocal = 0;
+   box_lo = hypre_TAlloc(HYPRE_Int, 3 * nx * ny * nz, HYPRE_MEMORY_HOST);
+   for (k = 0; k < nz; k++)
+   {
+      for (j = 0; j < ny; j++)
+      {
+         for (i = 0; i < nx; i++)
+         {
+            if ((i + j + k + myid) % 7 == 3)
+            {
+               continue;
+            }
+            ilower[0] = offset + i * bsize;
+            ilower[1] = j * bsize;
+            ilower[2] = k * bsize;
+            for (d = 0; d < 3; d++)
+            {
+               iupper[d] = ilower[d] + bsize - 1;
+            }
+            HYPRE_SStructGridSetExtents(grid, 0, ilower, iupper);
+            for (d = 0; d < 3; d++)
+            {
+               box_lo[3 * nlocal + d] = ilower[d];
+            }
+            nlocal++;
+         }
+      }
+   }
+   HYPRE_SStructGridSetVariables(grid, 0, 1, vartypes);
+   HYPRE_SStructGridAssemble(grid);
+
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Setup times", comm);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   boxman = hypre_SStructGridBoxManager(grid, 0, 0);
+   hypre_BoxManGetAllEntries(boxman, &nboxes, &entry);
+   hypre_MPI_Allreduce(&nlocal, &global_nlocal, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+   if (myid == 0)
+   {
+      hypre_printf("  %d boxes in the grid, %d box manager entries on proc 0\n\n",
+                   global_nlocal, nboxes);
+   }
+
+   /*-----------------------------------------------------------
+    * Random lookups in (and slightly around) the local region
+    *-----------------------------------------------------------*/
+   lo[0] = offset - bsize;
+   hi[0] = offset + (nx + 1) * bsize;
+   lo[1] = -1;
+   hi[1] = ny * bsize + 1;
+   lo[2] = -1;
+   hi[2] = nz * bsize + 1;
+
+   hypre_SeedRand(myid + 1);
+   points = hypre_TAlloc(HYPRE_Int, 3 * nlookups, HYPRE_MEMORY_HOST);
+   for (n = 0; n < nlookups; n++)
+   {
+      for (d = 0; d < 3; d++)
+      {
+         points[3 * n + d] = lo[d] + hypre_RandI() % (hi[d] - lo[d]);
+      }
+   }
+   ref_entries = hypre_TAlloc(hypre_BoxManEntry *, nlookups, HYPRE_MEMORY_HOST);
+   entries     = hypre_TAlloc(hypre_BoxManEntry *, nlookups, HYPRE_MEMORY_HOST);
+
+   /* Reference: index table search */
+   hypre_BoxManSetSpatialIndex(boxman, 0);
+
+   time_index = hypre_InitializeTiming("FindBoxManEntry (index table)");
+   hypre_BeginTiming(time_index);
+   for (s = 0; s < sweeps; s++)
+   {
+      for (n = 0; n < nlookups; n++)
+      {
+         hypre_SetIndex3(index, points[3 * n], points[3 * n + 1], points[3 * n + 2]);
+         hypre_SStructGridFindBoxManEntry(grid, 0, index, 0, &ref_entries[n]);
+      }
+   }
+   hypre_EndTiming(time_index);
+
+   /* Spatial index */
+   hypre_BoxManSetSpatialIndex(boxman, 1);
+
+   time_index = hypre_InitializeTiming("FindBoxManEntry (spatial index)");
+   hypre_BeginTiming(time_index);
+   for (s = 0; s < sweeps; s++)
+   {
+      for (n = 0; n < nlookups; n++)
+      {
+         hypre_SetIndex3(index, points[3 * n], points[3 * n + 1], points[3 * n + 2]);
+         hypre_SStructGridFindBoxManEntry(grid, 0, index, 0, &entries[n]);
+      }
+   }
+   hypre_EndTiming(time_index);
+
+   hypre_PrintTiming("Lookup times", comm);
+   hypre_FinalizeTiming(time_index - 1);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   /*-----------------------------------------------------------
+    * Check the results: same entries, and containment of the
+    * local points
+    *-----------------------------------------------------------*/
+   for (n = 0; n < nlookups; n++)
+   {
+      if (entries[n] != ref_entries[n])
+      {
+         ierr++;
+      }
+      else if (entries[n])
+      {
+         for (d = 0; d < 3; d++)
+         {
+            if (points[3 * n + d] < hypre_IndexD(hypre_BoxManEntryIMin(entries[n]), d) ||
+                points[3 * n + d] > hypre_IndexD(hypre_BoxManEntryIMax(entries[n]), d))
+            {
+               ierr++;
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Re-assemble after adding and removing boxes on the even
+    * processes: some boxes are removed, the holes in the bottom
+    * half are filled, and one box is added next to the top of
+    * another process's region
+    *-----------------------------------------------------------*/
+   if (regrid)
+   {
+      /* a graph created before re-assembly can still be destroyed after */
+      for (d = 0; d < 3; d++)
+      {
+         lo[d] = 0;
+      }
+      HYPRE_SStructStencilCreate(3, 1, &old_stencil);
+      HYPRE_SStructStencilSetEntry(old_stencil, 0, lo, 0);
+      HYPRE_SStructGraphCreate(comm, grid, &old_graph);
+      HYPRE_SStructGraphSetStencil(old_graph, 0, 0, old_stencil);
+      HYPRE_SStructGraphAssemble(old_graph);
+
+      new_box_lo = hypre_TAlloc(HYPRE_Int, 3 * (nx * ny * nz + 1), HYPRE_MEMORY_HOST);
+      nnew = 0;
+      for (b = 0; b < nlocal; b++)
+      {
+         i = (box_lo[3 * b] - offset) / bsize;
+         j = box_lo[3 * b + 1] / bsize;
+         k = box_lo[3 * b + 2] / bsize;
+         for (d = 0; d < 3; d++)
+         {
+            ilower[d] = box_lo[3 * b + d];
+            iupper[d] = ilower[d] + bsize - 1;
+         }
+         if ((myid % 2 == 0) && ((i + j + k + myid) % 7 == 5))
+         {
+            HYPRE_SStructGridRemoveExtents(grid, 0, ilower, iupper);
+         }
+         else
+         {
+            for (d = 0; d < 3; d++)
+            {
+               new_box_lo[3 * nnew + d] = ilower[d];
+            }
+            nnew++;
+         }
+      }
+      nkept = nnew;
+      if (myid % 2 == 0)
+      {
+         for (k = 0; k < nz / 2; k++)
+         {
+            for (j = 0; j < ny; j++)
+            {
+               for (i = 0; i < nx; i++)
+               {
+                  if ((i + j + k + myid) % 7 == 3)
+                  {
+                     new_box_lo[3 * nnew]     = offset + i * bsize;
+                     new_box_lo[3 * nnew + 1] = j * bsize;
+                     new_box_lo[3 * nnew + 2] = k * bsize;
+                     nnew++;
+                  }
+               }
+            }
+         }
+         new_box_lo[3 * nnew]     = ((myid + 2) % num_procs) * nx * bsize;
+         new_box_lo[3 * nnew + 1] = ny * bsize;
+         new_box_lo[3 * nnew + 2] = (myid % nz) * bsize;
+         nnew++;
+
+         for (b = nkept; b < nnew; b++)
+         {
+            for (d = 0; d < 3; d++)
+            {
+               ilower[d] = new_box_lo[3 * b + d];
+               iupper[d] = ilower[d] + bsize - 1;
+            }
+            HYPRE_SStructGridAddExtents(grid, 0, ilower, iupper);
+         }
+      }
+
+      time_index = hypre_InitializeTiming("SStructGrid re-assemble");
+      hypre_BeginTiming(time_index);
+      HYPRE_SStructGridReassemble(grid);
+      hypre_EndTiming(time_index);
+
+      HYPRE_SStructGraphDestroy(old_graph);
+      HYPRE_SStructStencilDestroy(old_stencil);
+
+      time_index = hypre_InitializeTiming("SStructGrid assemble from scratch");
+      hypre_BeginTiming(time_index);
+      HYPRE_SStructGridCreate(comm, 3, 1, &new_grid);
+      for (b = 0; b < nnew; b++)
+      {
+         for (d = 0; d < 3; d++)
+         {
+            ilower[d] = new_box_lo[3 * b + d];
+            iupper[d] = ilower[d] + bsize - 1;
+         }
+         HYPRE_SStructGridSetExtents(new_grid, 0, ilower, iupper);
+      }
+      HYPRE_SStructGridSetVariables(new_grid, 0, 1, vartypes);
+      HYPRE_SStructGridAssemble(new_grid);
+      hypre_EndTiming(time_index);
+
+      hypre_PrintTiming("Regrid times", comm);
+      hypre_FinalizeTiming(time_index - 1);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      if (hypre_SStructGridLocalSize(grid)   != hypre_SStructGridLocalSize(new_grid)   ||
+          hypre_SStructGridGlobalSize(grid)  != hypre_SStructGridGlobalSize(new_grid)  ||
+          hypre_SStructGridStartRank(grid)   != hypre_SStructGridStartRank(new_grid)   ||
+          hypre_SStructGridGhstartRank(grid) != hypre_SStructGridGhstartRank(new_grid))
+      {
+         ierr++;
+      }
+
+      /* lookups within the maximum distance of the local boxes */
+      for (n = 0; n < nlookups && nnew > 0; n++)
+      {
+         b = hypre_RandI() % nnew;
+         for (d = 0; d < 3; d++)
+         {
+            hypre_IndexD(index, d) = new_box_lo[3 * b + d] - 8 + hypre_RandI() % (bsize + 16);
+         }
+         hypre_SStructGridFindBoxManEntry(grid, 0, index, 0, &entry);
+         hypre_SStructGridFindBoxManEntry(new_grid, 0, index, 0, &new_entry);
+         if ((entry == NULL) != (new_entry == NULL))
+         {
+            ierr++;
+         }
+         else if (entry)
+         {
+            if (hypre_BoxManEntryProc(entry) != hypre_BoxManEntryProc(new_entry) ||
+                hypre_BoxManEntryId(entry) != hypre_BoxManEntryId(new_entry))
+            {
+               ierr++;
+            }
+            hypre_SStructBoxManEntryGetGlobalRank(entry, index, &rank, HYPRE_PARCSR);
+            hypre_SStructBoxManEntryGetGlobalRank(new_entry, index, &new_rank, HYPRE_PARCSR);
+            if (rank != new_rank)
+            {
+               ierr++;
+            }
+            hypre_SStructBoxManEntryGetGlobalGhrank(entry, index, &rank);
+            hypre_SStructBoxManEntryGetGlobalGhrank(new_entry, index, &new_rank);
+            if (rank != new_rank)
+            {
+               ierr++;
+            }
+         }
+      }
+
+      /* a matrix on the re-assembled grid */
+      norm     = LaplacianNorm(grid, nnew, new_box_lo, bsize);
+      new_norm = LaplacianNorm(new_grid, nnew, new_box_lo, bsize);
+      if (hypre_abs(norm - new_norm) > 1.0e-12 * new_norm)
+      {
+         ierr++;
+      }
+
+      hypre_TFree(new_box_lo, HYPRE_MEMORY_HOST);
+      HYPRE_SStructGridDestroy(new_grid);
+   }
+
+   hypre_MPI_Allreduce(&ierr, &global_ierr, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+
+   /* Print the error code */
+   hypre_ParPrintf(comm, "Test error code = %d\n", global_ierr);
+
+   /*-----------------------------------------------------------
+    * Free memory
+    *-----------------------------------------------------------*/
+   hypre_TFree(points, HYPRE_MEMORY_HOST);
+   hypre_TFree(box_lo, HYPRE_MEMORY_HOST);
+   hypre_TFree(ref_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+   HYPRE_SStructGridDestroy(grid);
+
+   /* Finalize Hypre */
+   HYPRE_Finalize();
+
+   /* Finalize MPI */
+   hypre_MPI_Finalize();
+
+   return (0);
+}
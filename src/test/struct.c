@@ -107,7 +107,10 @@ main( hypre_int argc,
    HYPRE_Real          jacobi_weight;
    HYPRE_Int           usr_jacobi_weight;
    HYPRE_Int           jump;
+   HYPRE_Int           smg_batch;
    HYPRE_Int           rep, reps;
+   HYPRE_Int           setup_reps;
+   HYPRE_Int           num_threads;
 
    HYPRE_Int         **iupper;
    HYPRE_Int         **ilower;
@@ -189,6 +192,7 @@ main( hypre_int argc,
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_DEVICE;
 #endif
    HYPRE_Int gpu_aware_mpi = 0;
+   HYPRE_Int overlap_comm_comp = 0;
 
    //HYPRE_Int device_level = -2;
 
@@ -249,7 +253,10 @@ main( hypre_int argc,
    jacobi_weight = 1.0;
    usr_jacobi_weight = 0;
    jump  = 0;
+   smg_batch = 0;
    reps = 1;
+   setup_reps = 0;
+   num_threads = 0;
 
    nx = 10;
    ny = 10;
@@ -391,6 +398,16 @@ main( hypre_int argc,
          arg_index++;
          reps = atoi(argv[arg_index++]);
       }
+      else if (strcmp(argv[arg_index], "-setup_reps") == 0 )
+      {
+         arg_index++;
+         setup_reps = atoi(argv[arg_index++]);
+      }
+      else if (strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-solver") == 0 )
       {
          arg_index++;
@@ -443,6 +460,11 @@ main( hypre_int argc,
          arg_index++;
          jump = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-smgbatch") == 0 )
+      {
+         arg_index++;
+         smg_batch = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-solver_type") == 0 )
       {
          arg_index++;
@@ -572,6 +594,11 @@ main( hypre_int argc,
          arg_index++;
          gpu_aware_mpi = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-overlap") == 0 )
+      {
+         arg_index++;
+         overlap_comm_comp = atoi(argv[arg_index++]);
+      }
       /* end lobpcg */
       else
       {
@@ -592,6 +619,8 @@ main( hypre_int argc,
 
    HYPRE_SetGpuAwareMPI(gpu_aware_mpi);
 
+   HYPRE_SetStructOverlapCommComp(overlap_comm_comp);
+
    /* begin lobpcg */
 
    if ( solver_id == 0 && lobpcgFlag )
@@ -624,6 +653,8 @@ main( hypre_int argc,
       hypre_printf("  -rhsfromfile <name> : prefix name for rhsfiles\n");
       hypre_printf("  -x0fromfile <name>  : prefix name for firstguessfiles\n");
       hypre_printf("  -repeats <reps>     : number of times to repeat the run, default 1.  For solver 0,1,3\n");
+      hypre_printf("  -setup_reps <n>     : benchmark n additional PFMG setups, default 0.  For solver 1\n");
+      hypre_printf("  -nthreads <n>       : number of OpenMP threads (overrides OMP_NUM_THREADS)\n");
       hypre_printf("  -solver <ID>        : solver ID\n");
       hypre_printf("                        0  - SMG (default)\n");
       hypre_printf("                        1  - PFMG\n");
@@ -670,10 +701,13 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Line Jacobi (PFMG only)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
+      hypre_printf("  -smgbatch <b>       : batched line solves in SMG (0 or 1)\n");
+      hypre_printf("  -overlap <o>        : overlap ghost exchanges with computation (0 or 1)\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
@@ -729,6 +763,11 @@ main( hypre_int argc,
       exit(1);
    }
 
+   if (num_threads > 0)
+   {
+      hypre_SetNumThreads(num_threads);
+   }
+
    /*-----------------------------------------------------------
     * Check a few things
     *-----------------------------------------------------------*/
@@ -1434,6 +1473,7 @@ main( hypre_int argc,
 
          HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_StructSMGSetMemoryUse(solver, 0);
+         HYPRE_StructSMGSetLineBatching(solver, smg_batch);
          HYPRE_StructSMGSetMaxIter(solver, 50);
          HYPRE_StructSMGSetTol(solver, tol);
          HYPRE_StructSMGSetRelChange(solver, 0);
@@ -1536,6 +1576,34 @@ main( hypre_int argc,
             hypre_FinalizeTiming(time_index);
          }
 
+         /* Benchmark the setup alone, as when re-setting up every nonlinear iteration */
+         if ( setup_reps > 0 && reps == 1 )
+         {
+            HYPRE_StructSolver  bench_solver;
+
+            time_index = hypre_InitializeTiming("PFMG Setup Benchmark");
+            hypre_BeginTiming(time_index);
+
+            for (i = 0; i < setup_reps; i++)
+            {
+               HYPRE_StructPFMGCreate(hypre_MPI_COMM_WORLD, &bench_solver);
+               HYPRE_StructPFMGSetRAPType(bench_solver, rap);
+               HYPRE_StructPFMGSetRelaxType(bench_solver, relax);
+               HYPRE_StructPFMGSetSkipRelax(bench_solver, skip);
+               HYPRE_StructPFMGSetup(bench_solver, A, b, x);
+               HYPRE_StructPFMGDestroy(bench_solver);
+            }
+
+            hypre_EndTiming(time_index);
+            if (myid == 0)
+            {
+               hypre_printf("PFMG setup benchmark: %d setups\n", setup_reps);
+            }
+            hypre_PrintTiming("Setup benchmark times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+         }
+
          time_index = hypre_InitializeTiming("PFMG Solve");
          hypre_BeginTiming(time_index);
 
@@ -1663,6 +1731,7 @@ main( hypre_int argc,
             /* use symmetric SMG as preconditioner */
             HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
             HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetLineBatching(precond, smg_batch);
             HYPRE_StructSMGSetMaxIter(precond, 1);
             HYPRE_StructSMGSetTol(precond, 0.0);
             HYPRE_StructSMGSetZeroGuess(precond);
@@ -1833,6 +1902,7 @@ main( hypre_int argc,
                /* use symmetric SMG as preconditioner */
                HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
                HYPRE_StructSMGSetMemoryUse(precond, 0);
+               HYPRE_StructSMGSetLineBatching(precond, smg_batch);
                HYPRE_StructSMGSetMaxIter(precond, 1);
                HYPRE_StructSMGSetTol(precond, 0.0);
                HYPRE_StructSMGSetZeroGuess(precond);
@@ -2084,6 +2154,7 @@ main( hypre_int argc,
                /* use symmetric SMG as preconditioner */
                HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
                HYPRE_StructSMGSetMemoryUse(precond, 0);
+               HYPRE_StructSMGSetLineBatching(precond, smg_batch);
                HYPRE_StructSMGSetMaxIter(precond, 1);
                HYPRE_StructSMGSetTol(precond, 0.0);
                HYPRE_StructSMGSetZeroGuess(precond);
@@ -2347,6 +2418,7 @@ main( hypre_int argc,
             /* use symmetric SMG as preconditioner */
             HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
             HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetLineBatching(precond, smg_batch);
             HYPRE_StructSMGSetMaxIter(precond, 1);
             HYPRE_StructSMGSetTol(precond, 0.0);
             HYPRE_StructSMGSetZeroGuess(precond);
@@ -2471,6 +2543,7 @@ main( hypre_int argc,
             /* use symmetric SMG as preconditioner */
             HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
             HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetLineBatching(precond, smg_batch);
             HYPRE_StructSMGSetMaxIter(precond, 1);
             HYPRE_StructSMGSetTol(precond, 0.0);
             HYPRE_StructSMGSetZeroGuess(precond);
@@ -2622,6 +2695,7 @@ main( hypre_int argc,
             /* use symmetric SMG as preconditioner */
             HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
             HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetLineBatching(precond, smg_batch);
             HYPRE_StructSMGSetMaxIter(precond, 1);
             HYPRE_StructSMGSetTol(precond, 0.0);
             HYPRE_StructSMGSetZeroGuess(precond);
@@ -2773,6 +2847,7 @@ main( hypre_int argc,
             /* use symmetric SMG as preconditioner */
             HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
             HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetLineBatching(precond, smg_batch);
             HYPRE_StructSMGSetMaxIter(precond, 1);
             HYPRE_StructSMGSetTol(precond, 0.0);
             HYPRE_StructSMGSetZeroGuess(precond);
@@ -2871,6 +2946,7 @@ main( hypre_int argc,
             /* use symmetric SMG as preconditioner */
             HYPRE_StructSMGCreate(hypre_MPI_COMM_WORLD, &precond);
             HYPRE_StructSMGSetMemoryUse(precond, 0);
+            HYPRE_StructSMGSetLineBatching(precond, smg_batch);
             HYPRE_StructSMGSetMaxIter(precond, 1);
             HYPRE_StructSMGSetTol(precond, 0.0);
             HYPRE_StructSMGSetZeroGuess(precond);
@@ -72,3 +72,23 @@ HYPRE_SetGpuAwareMPI( HYPRE_Int use_gpu_aware_mpi )
 {
    return hypre_SetGpuAwareMPI(use_gpu_aware_mpi);
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetUseNeighborCollectives
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetUseNeighborCollectives( HYPRE_Int use_neighbor_coll )
+{
+   return hypre_SetUseNeighborCollectives(use_neighbor_coll);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructOverlapCommComp
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetStructOverlapCommComp( HYPRE_Int overlap_comm_comp )
+{
+   return hypre_SetStructOverlapCommComp(overlap_comm_comp);
+}
@@ -486,6 +486,45 @@ HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
  **/
 HYPRE_Int HYPRE_SetGpuAwareMPI( HYPRE_Int use_gpu_aware_mpi );
 
+/**
+ * Configures the communication used to send off-processor IJ matrix and
+ * vector values to their owners during assembly.
+ *
+ * The following options are available for \e use_neighbor_coll:
+ *
+ *    - 0 : (default) Use hypre's point-to-point exchange with termination detection.
+ *    - 1 : Build a distributed graph communicator from the destination
+ *          processors and use MPI-3 neighborhood collectives for the
+ *          message sizes and the data.
+ *
+ * @param use_neighbor_coll Specifies whether to use neighborhood collectives or not.
+ *
+ * @note This option has no effect when the MPI library does not support MPI-3.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetUseNeighborCollectives( HYPRE_Int use_neighbor_coll );
+
+/**
+ * Configures the ghost exchanges of struct matrix-vector products and
+ * relaxation sweeps.
+ *
+ * The following options are available for \e overlap_comm_comp:
+ *
+ *    - 0 : (default) Finish the exchange, then compute on all points.
+ *    - 1 : Compute on the points whose stencil does not reach the ghost
+ *          layer while the exchange is in progress, then finish the exchange
+ *          and compute on the remaining points near the box boundaries.
+ *
+ * @param overlap_comm_comp Specifies whether to overlap communication and
+ *                          computation or not.
+ *
+ * @note The option applies to the struct objects set up after the call.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetStructOverlapCommComp( HYPRE_Int overlap_comm_comp );
+
 /*--------------------------------------------------------------------------
  * Base objects
  *--------------------------------------------------------------------------*/
@@ -54,6 +54,12 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
 
+   /* use MPI-3 neighborhood collectives for irregular data exchanges */
+   HYPRE_Int              use_neighbor_coll;
+
+   /* overlap struct communication with computations on independent boxes */
+   HYPRE_Int              struct_overlap_comm_comp;
+
    /* the device buffers needed to do MPI communication for struct comm */
    HYPRE_Complex         *struct_comm_recv_buffer;
    HYPRE_Complex         *struct_comm_send_buffer;
@@ -100,6 +106,8 @@ typedef struct
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
+#define hypre_HandleUseNeighborColl(hypre_handle)                ((hypre_handle) -> use_neighbor_coll)
+#define hypre_HandleStructOverlapCommComp(hypre_handle)          ((hypre_handle) -> struct_overlap_comm_comp)
 
 #define hypre_HandleStructCommRecvBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_recv_buffer)
 #define hypre_HandleStructCommSendBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_send_buffer)
@@ -836,6 +844,11 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Dist_graph_create           hypre_MPI_Dist_graph_create
+#define MPI_Dist_graph_neighbors_count  hypre_MPI_Dist_graph_neighbors_count
+#define MPI_Dist_graph_neighbors        hypre_MPI_Dist_graph_neighbors
+#define MPI_Neighbor_alltoall           hypre_MPI_Neighbor_alltoall
+#define MPI_Neighbor_alltoallv          hypre_MPI_Neighbor_alltoallv
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -892,6 +905,9 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+/* neighborhood collectives are trivial without MPI */
+#define  hypre_MPI_HAVE_NEIGHBOR_COLL 1
+
 #else
 
 /******************************************************************************
@@ -944,6 +960,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+/* neighborhood collectives on distributed graph communicators need MPI-3 */
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#define  hypre_MPI_HAVE_NEIGHBOR_COLL 1
+#endif
+
 #endif
 
 /******************************************************************************
@@ -1052,6 +1073,24 @@ HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, H
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
+#if defined(hypre_MPI_HAVE_NEIGHBOR_COLL)
+HYPRE_Int hypre_MPI_Dist_graph_create( hypre_MPI_Comm comm_old, HYPRE_Int n, HYPRE_Int *sources,
+                                       HYPRE_Int *degrees, HYPRE_Int *destinations,
+                                       HYPRE_Int reorder, hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Dist_graph_neighbors_count( hypre_MPI_Comm comm, HYPRE_Int *indegree,
+                                                HYPRE_Int *outdegree );
+HYPRE_Int hypre_MPI_Dist_graph_neighbors( hypre_MPI_Comm comm, HYPRE_Int maxindegree,
+                                          HYPRE_Int *sources, HYPRE_Int maxoutdegree,
+                                          HYPRE_Int *destinations );
+HYPRE_Int hypre_MPI_Neighbor_alltoall( void *sendbuf, HYPRE_Int sendcount,
+                                       hypre_MPI_Datatype sendtype, void *recvbuf,
+                                       HYPRE_Int recvcount, hypre_MPI_Datatype recvtype,
+                                       hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Neighbor_alltoallv( void *sendbuf, HYPRE_Int *sendcounts, HYPRE_Int *sdispls,
+                                        hypre_MPI_Datatype sendtype, void *recvbuf,
+                                        HYPRE_Int *recvcounts, HYPRE_Int *rdispls,
+                                        hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+#endif
 
 #ifdef __cplusplus
 }
@@ -1815,12 +1854,30 @@ typedef struct
 
 } hypre_DataExchangeResponse;
 
+/* Distributed graph communicator built by hypre_DataExchangeNeighborList(),
+   kept by the caller so that repeated exchanges with the same contact
+   processors do not rebuild it */
+
+typedef struct
+{
+   MPI_Comm      comm;
+   HYPRE_Int     num_contacts;
+   HYPRE_Int    *contact_procs;
+
+} hypre_DataExchangeGraph;
+
 HYPRE_Int hypre_CreateBinaryTree(HYPRE_Int, HYPRE_Int, hypre_BinaryTree**);
 HYPRE_Int hypre_DestroyBinaryTree(hypre_BinaryTree*);
 HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list,
                                  void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size,
                                  HYPRE_Int response_obj_size, hypre_DataExchangeResponse *response_obj, HYPRE_Int max_response_size,
                                  HYPRE_Int rnum, MPI_Comm comm, void **p_response_recv_buf, HYPRE_Int **p_response_recv_buf_starts);
+HYPRE_Int hypre_DataExchangeNeighborList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list,
+                                         void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size,
+                                         MPI_Comm comm, hypre_DataExchangeGraph **graph_ptr,
+                                         HYPRE_Int *p_num_recvs, HYPRE_Int **p_recv_procs,
+                                         HYPRE_Int **p_recv_starts, void **p_recv_buf);
+HYPRE_Int hypre_DataExchangeGraphDestroy(hypre_DataExchangeGraph *graph);
 
 #endif /* end of header */
 /******************************************************************************
@@ -2436,6 +2493,8 @@ HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
 HYPRE_Int hypre_SetGpuAwareMPI( HYPRE_Int use_gpu_aware_mpi );
 HYPRE_Int hypre_GetGpuAwareMPI(void);
+HYPRE_Int hypre_SetUseNeighborCollectives( HYPRE_Int use_neighbor_coll );
+HYPRE_Int hypre_SetStructOverlapCommComp( HYPRE_Int overlap_comm_comp );
 
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
@@ -596,3 +596,183 @@ hypre_DataExchangeList(HYPRE_Int num_contacts,
 
    return hypre_error_flag;
 }
+
+/*---------------------------------------------------
+ * hypre_DataExchangeNeighborList()
+ *
+ * Same contact pattern as hypre_DataExchangeList() with an empty
+ * (confirmation) response, but done with MPI-3 neighborhood
+ * collectives: a distributed graph communicator is built from the
+ * known destinations, the message sizes are exchanged with a
+ * neighbor all-to-all and the payload with a neighbor all-to-allv.
+ * The receiving processors, the starts of their messages (in objects
+ * of size contact_obj_size) and the received data are returned.
+ *
+ * If graph_ptr is not NULL, the graph communicator is kept in *graph_ptr
+ * and reused by later calls as long as no process changes its contact
+ * list. It is freed with hypre_DataExchangeGraphDestroy().
+ *----------------------------------------------------*/
+
+HYPRE_Int
+hypre_DataExchangeNeighborList(HYPRE_Int   num_contacts,
+                               HYPRE_Int  *contact_proc_list,
+                               void       *contact_send_buf,
+                               HYPRE_Int  *contact_send_buf_starts,
+                               HYPRE_Int   contact_obj_size,
+                               MPI_Comm    comm,
+                               hypre_DataExchangeGraph **graph_ptr,
+                               HYPRE_Int  *p_num_recvs,
+                               HYPRE_Int **p_recv_procs,
+                               HYPRE_Int **p_recv_starts,
+                               void      **p_recv_buf)
+{
+#if defined(hypre_MPI_HAVE_NEIGHBOR_COLL)
+   hypre_DataExchangeGraph *graph = (graph_ptr) ? *graph_ptr : NULL;
+   hypre_MPI_Comm      graph_comm;
+   hypre_MPI_Datatype  obj_type;
+   HYPRE_Int           myid, indegree, outdegree, my_reuse, reuse;
+   HYPRE_Int          *send_sizes, *send_displs, *recv_sizes;
+   HYPRE_Int          *recv_procs, *recv_starts, *dests;
+   HYPRE_Int          *sorted_procs, *sorted_index;
+   HYPRE_Int           i, j;
+   void               *recv_buf;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* the cached graph can only be reused if every process has the same contacts */
+   if (graph_ptr)
+   {
+      my_reuse = (graph && graph -> num_contacts == num_contacts);
+      for (i = 0; my_reuse && i < num_contacts; i++)
+      {
+         my_reuse = (graph -> contact_procs[i] == contact_proc_list[i]);
+      }
+      hypre_MPI_Allreduce(&my_reuse, &reuse, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+      if (!reuse)
+      {
+         hypre_DataExchangeGraphDestroy(graph);
+         graph = NULL;
+      }
+   }
+
+   if (graph)
+   {
+      graph_comm = graph -> comm;
+   }
+   else
+   {
+      /* each process only knows its own destinations */
+      hypre_MPI_Dist_graph_create(comm, 1, &myid, &num_contacts, contact_proc_list, 0,
+                                  &graph_comm);
+   }
+   hypre_MPI_Dist_graph_neighbors_count(graph_comm, &indegree, &outdegree);
+
+   recv_procs = hypre_TAlloc(HYPRE_Int, indegree + 1, HYPRE_MEMORY_HOST);
+   dests      = hypre_TAlloc(HYPRE_Int, outdegree + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Dist_graph_neighbors(graph_comm, indegree, recv_procs, outdegree, dests);
+
+   /* the graph may reorder the destinations, so map them back to the contacts */
+   sorted_procs = hypre_TAlloc(HYPRE_Int, num_contacts + 1, HYPRE_MEMORY_HOST);
+   sorted_index = hypre_TAlloc(HYPRE_Int, num_contacts + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_contacts; i++)
+   {
+      sorted_procs[i] = contact_proc_list[i];
+      sorted_index[i] = i;
+   }
+   hypre_qsort2i(sorted_procs, sorted_index, 0, num_contacts - 1);
+
+   send_sizes  = hypre_TAlloc(HYPRE_Int, outdegree + 1, HYPRE_MEMORY_HOST);
+   send_displs = hypre_TAlloc(HYPRE_Int, outdegree + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < outdegree; i++)
+   {
+      j = sorted_index[hypre_BinarySearch(sorted_procs, dests[i], num_contacts)];
+      send_sizes[i]  = contact_send_buf_starts[j + 1] - contact_send_buf_starts[j];
+      send_displs[i] = contact_send_buf_starts[j];
+   }
+   hypre_TFree(sorted_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(dests, HYPRE_MEMORY_HOST);
+
+   recv_sizes = hypre_TAlloc(HYPRE_Int, indegree + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Neighbor_alltoall(send_sizes, 1, HYPRE_MPI_INT,
+                               recv_sizes, 1, HYPRE_MPI_INT, graph_comm);
+
+   recv_starts = hypre_TAlloc(HYPRE_Int, indegree + 1, HYPRE_MEMORY_HOST);
+   recv_starts[0] = 0;
+   for (i = 0; i < indegree; i++)
+   {
+      recv_starts[i + 1] = recv_starts[i] + recv_sizes[i];
+   }
+   recv_buf = hypre_TAlloc(char, (size_t) contact_obj_size * (recv_starts[indegree] + 1),
+                           HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Type_contiguous(contact_obj_size, hypre_MPI_BYTE, &obj_type);
+   hypre_MPI_Type_commit(&obj_type);
+   hypre_MPI_Neighbor_alltoallv(contact_send_buf, send_sizes, send_displs, obj_type,
+                                recv_buf, recv_sizes, recv_starts, obj_type, graph_comm);
+   hypre_MPI_Type_free(&obj_type);
+
+   if (graph_ptr)
+   {
+      if (!graph)
+      {
+         graph = hypre_TAlloc(hypre_DataExchangeGraph, 1, HYPRE_MEMORY_HOST);
+         graph -> comm          = graph_comm;
+         graph -> num_contacts  = num_contacts;
+         graph -> contact_procs = hypre_TAlloc(HYPRE_Int, num_contacts + 1, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(graph -> contact_procs, contact_proc_list, HYPRE_Int, num_contacts,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+      *graph_ptr = graph;
+   }
+   else if (graph_comm != comm)
+   {
+      hypre_MPI_Comm_free(&graph_comm);
+   }
+
+   hypre_TFree(send_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_sizes, HYPRE_MEMORY_HOST);
+
+   *p_num_recvs   = indegree;
+   *p_recv_procs  = recv_procs;
+   *p_recv_starts = recv_starts;
+   *p_recv_buf    = recv_buf;
+#else
+   HYPRE_UNUSED_VAR(num_contacts);
+   HYPRE_UNUSED_VAR(contact_proc_list);
+   HYPRE_UNUSED_VAR(contact_send_buf);
+   HYPRE_UNUSED_VAR(contact_send_buf_starts);
+   HYPRE_UNUSED_VAR(contact_obj_size);
+   HYPRE_UNUSED_VAR(comm);
+   HYPRE_UNUSED_VAR(graph_ptr);
+
+   *p_num_recvs   = 0;
+   *p_recv_procs  = NULL;
+   *p_recv_starts = NULL;
+   *p_recv_buf    = NULL;
+
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Neighborhood collectives require MPI-3!\n");
+#endif
+
+   return hypre_error_flag;
+}
+
+/*---------------------------------------------------
+ * hypre_DataExchangeGraphDestroy()
+ *----------------------------------------------------*/
+
+HYPRE_Int
+hypre_DataExchangeGraphDestroy(hypre_DataExchangeGraph *graph)
+{
+   if (graph)
+   {
+#if defined(hypre_MPI_HAVE_NEIGHBOR_COLL) && !defined(HYPRE_SEQUENTIAL)
+      hypre_MPI_Comm_free(&(graph -> comm));
+#endif
+      hypre_TFree(graph -> contact_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(graph, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
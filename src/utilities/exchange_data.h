@@ -41,11 +41,29 @@ typedef struct
 
 } hypre_DataExchangeResponse;
 
+/* Distributed graph communicator built by hypre_DataExchangeNeighborList(),
+   kept by the caller so that repeated exchanges with the same contact
+   processors do not rebuild it */
+
+typedef struct
+{
+   MPI_Comm      comm;
+   HYPRE_Int     num_contacts;
+   HYPRE_Int    *contact_procs;
+
+} hypre_DataExchangeGraph;
+
 HYPRE_Int hypre_CreateBinaryTree(HYPRE_Int, HYPRE_Int, hypre_BinaryTree**);
 HYPRE_Int hypre_DestroyBinaryTree(hypre_BinaryTree*);
 HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list,
                                  void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size,
                                  HYPRE_Int response_obj_size, hypre_DataExchangeResponse *response_obj, HYPRE_Int max_response_size,
                                  HYPRE_Int rnum, MPI_Comm comm, void **p_response_recv_buf, HYPRE_Int **p_response_recv_buf_starts);
+HYPRE_Int hypre_DataExchangeNeighborList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list,
+                                         void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size,
+                                         MPI_Comm comm, hypre_DataExchangeGraph **graph_ptr,
+                                         HYPRE_Int *p_num_recvs, HYPRE_Int **p_recv_procs,
+                                         HYPRE_Int **p_recv_starts, void **p_recv_buf);
+HYPRE_Int hypre_DataExchangeGraphDestroy(hypre_DataExchangeGraph *graph);
 
 #endif /* end of header */
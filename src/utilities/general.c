@@ -36,6 +36,12 @@ hypre_HandleCreate(void)
 
    hypre_HandleLogLevel(hypre_handle_) = 0;
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
+   hypre_HandleUseNeighborColl(hypre_handle_) = 0;
+#ifdef HYPRE_OVERLAP_COMM_COMP
+   hypre_HandleStructOverlapCommComp(hypre_handle_) = 1;
+#else
+   hypre_HandleStructOverlapCommComp(hypre_handle_) = 0;
+#endif
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
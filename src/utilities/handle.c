@@ -254,6 +254,38 @@ hypre_SetGpuAwareMPI( HYPRE_Int use_gpu_aware_mpi )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SetUseNeighborCollectives
+ *
+ * Only takes effect when the MPI library provides neighborhood collectives.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetUseNeighborCollectives( HYPRE_Int use_neighbor_coll )
+{
+#if defined(hypre_MPI_HAVE_NEIGHBOR_COLL)
+   hypre_HandleUseNeighborColl(hypre_handle()) = use_neighbor_coll;
+#else
+   HYPRE_UNUSED_VAR(use_neighbor_coll);
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetStructOverlapCommComp
+ *
+ * Only affects the struct computation packages created afterwards.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetStructOverlapCommComp( HYPRE_Int overlap_comm_comp )
+{
+   hypre_HandleStructOverlapCommComp(hypre_handle()) = overlap_comm_comp;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GetGpuAwareMPI
  *--------------------------------------------------------------------------*/
@@ -38,6 +38,12 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
 
+   /* use MPI-3 neighborhood collectives for irregular data exchanges */
+   HYPRE_Int              use_neighbor_coll;
+
+   /* overlap struct communication with computations on independent boxes */
+   HYPRE_Int              struct_overlap_comm_comp;
+
    /* the device buffers needed to do MPI communication for struct comm */
    HYPRE_Complex         *struct_comm_recv_buffer;
    HYPRE_Complex         *struct_comm_send_buffer;
@@ -84,6 +90,8 @@ typedef struct
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
+#define hypre_HandleUseNeighborColl(hypre_handle)                ((hypre_handle) -> use_neighbor_coll)
+#define hypre_HandleStructOverlapCommComp(hypre_handle)          ((hypre_handle) -> struct_overlap_comm_comp)
 
 #define hypre_HandleStructCommRecvBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_recv_buffer)
 #define hypre_HandleStructCommSendBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_send_buffer)
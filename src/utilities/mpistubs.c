@@ -753,6 +753,65 @@ HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info )
 }
 #endif
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create( hypre_MPI_Comm  comm_old,
+                             HYPRE_Int       n,
+                             HYPRE_Int      *sources,
+                             HYPRE_Int      *degrees,
+                             HYPRE_Int      *destinations,
+                             HYPRE_Int       reorder,
+                             hypre_MPI_Comm *comm_dist_graph )
+{
+   *comm_dist_graph = comm_old;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Dist_graph_neighbors_count( hypre_MPI_Comm  comm,
+                                      HYPRE_Int      *indegree,
+                                      HYPRE_Int      *outdegree )
+{
+   *indegree  = 0;
+   *outdegree = 0;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Dist_graph_neighbors( hypre_MPI_Comm  comm,
+                                HYPRE_Int       maxindegree,
+                                HYPRE_Int      *sources,
+                                HYPRE_Int       maxoutdegree,
+                                HYPRE_Int      *destinations )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoall( void               *sendbuf,
+                             HYPRE_Int           sendcount,
+                             hypre_MPI_Datatype  sendtype,
+                             void               *recvbuf,
+                             HYPRE_Int           recvcount,
+                             hypre_MPI_Datatype  recvtype,
+                             hypre_MPI_Comm      comm )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoallv( void               *sendbuf,
+                              HYPRE_Int          *sendcounts,
+                              HYPRE_Int          *sdispls,
+                              hypre_MPI_Datatype  sendtype,
+                              void               *recvbuf,
+                              HYPRE_Int          *recvcounts,
+                              HYPRE_Int          *rdispls,
+                              hypre_MPI_Datatype  recvtype,
+                              hypre_MPI_Comm      comm )
+{
+   return (0);
+}
+
 /******************************************************************************
  * MPI stubs to do casting of HYPRE_Int and hypre_int correctly
  *****************************************************************************/
@@ -1420,4 +1479,155 @@ hypre_MPI_Info_free( hypre_MPI_Info *info )
 }
 #endif
 
+#if defined(hypre_MPI_HAVE_NEIGHBOR_COLL)
+HYPRE_Int
+hypre_MPI_Dist_graph_create( hypre_MPI_Comm  comm_old,
+                             HYPRE_Int       n,
+                             HYPRE_Int      *sources,
+                             HYPRE_Int      *degrees,
+                             HYPRE_Int      *destinations,
+                             HYPRE_Int       reorder,
+                             hypre_MPI_Comm *comm_dist_graph )
+{
+   hypre_int *mpi_sources, *mpi_degrees, *mpi_destinations, *mpi_weights;
+   HYPRE_Int  i, num_edges = 0;
+   HYPRE_Int  ierr;
+
+   mpi_sources = hypre_TAlloc(hypre_int, n + 1, HYPRE_MEMORY_HOST);
+   mpi_degrees = hypre_TAlloc(hypre_int, n + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+      mpi_degrees[i] = (hypre_int) degrees[i];
+      num_edges += degrees[i];
+   }
+   /* Unit weights instead of MPI_UNWEIGHTED, which some MPI implementations
+      define as a sentinel pointer that compilers flag as an invalid buffer */
+   mpi_destinations = hypre_TAlloc(hypre_int, num_edges + 1, HYPRE_MEMORY_HOST);
+   mpi_weights = hypre_TAlloc(hypre_int, num_edges + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_edges; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+      mpi_weights[i] = 1;
+   }
+
+   ierr = (HYPRE_Int) MPI_Dist_graph_create(comm_old, (hypre_int)n, mpi_sources, mpi_degrees,
+                                            mpi_destinations, mpi_weights, MPI_INFO_NULL,
+                                            (hypre_int)reorder, comm_dist_graph);
+
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_degrees, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Dist_graph_neighbors_count( hypre_MPI_Comm  comm,
+                                      HYPRE_Int      *indegree,
+                                      HYPRE_Int      *outdegree )
+{
+   hypre_int mpi_indegree, mpi_outdegree, mpi_weighted;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Dist_graph_neighbors_count(comm, &mpi_indegree, &mpi_outdegree,
+                                                     &mpi_weighted);
+   *indegree  = (HYPRE_Int) mpi_indegree;
+   *outdegree = (HYPRE_Int) mpi_outdegree;
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Dist_graph_neighbors( hypre_MPI_Comm  comm,
+                                HYPRE_Int       maxindegree,
+                                HYPRE_Int      *sources,
+                                HYPRE_Int       maxoutdegree,
+                                HYPRE_Int      *destinations )
+{
+   hypre_int *mpi_sources, *mpi_destinations;
+   hypre_int *mpi_sourceweights, *mpi_destweights;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   mpi_sources = hypre_TAlloc(hypre_int, maxindegree + 1, HYPRE_MEMORY_HOST);
+   mpi_destinations = hypre_TAlloc(hypre_int, maxoutdegree + 1, HYPRE_MEMORY_HOST);
+   mpi_sourceweights = hypre_TAlloc(hypre_int, maxindegree + 1, HYPRE_MEMORY_HOST);
+   mpi_destweights = hypre_TAlloc(hypre_int, maxoutdegree + 1, HYPRE_MEMORY_HOST);
+   ierr = (HYPRE_Int) MPI_Dist_graph_neighbors(comm, (hypre_int)maxindegree, mpi_sources,
+                                               mpi_sourceweights, (hypre_int)maxoutdegree,
+                                               mpi_destinations, mpi_destweights);
+   for (i = 0; i < maxindegree; i++)
+   {
+      sources[i] = (HYPRE_Int) mpi_sources[i];
+   }
+   for (i = 0; i < maxoutdegree; i++)
+   {
+      destinations[i] = (HYPRE_Int) mpi_destinations[i];
+   }
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_sourceweights, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destweights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoall( void               *sendbuf,
+                             HYPRE_Int           sendcount,
+                             hypre_MPI_Datatype  sendtype,
+                             void               *recvbuf,
+                             HYPRE_Int           recvcount,
+                             hypre_MPI_Datatype  recvtype,
+                             hypre_MPI_Comm      comm )
+{
+   return (HYPRE_Int) MPI_Neighbor_alltoall(sendbuf, (hypre_int)sendcount, sendtype,
+                                            recvbuf, (hypre_int)recvcount, recvtype, comm);
+}
+
+HYPRE_Int
+hypre_MPI_Neighbor_alltoallv( void               *sendbuf,
+                              HYPRE_Int          *sendcounts,
+                              HYPRE_Int          *sdispls,
+                              hypre_MPI_Datatype  sendtype,
+                              void               *recvbuf,
+                              HYPRE_Int          *recvcounts,
+                              HYPRE_Int          *rdispls,
+                              hypre_MPI_Datatype  recvtype,
+                              hypre_MPI_Comm      comm )
+{
+   hypre_int *mpi_sendcounts, *mpi_sdispls, *mpi_recvcounts, *mpi_rdispls;
+   hypre_int  indegree, outdegree, weighted;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree, &weighted);
+   mpi_sendcounts = hypre_TAlloc(hypre_int, outdegree + 1, HYPRE_MEMORY_HOST);
+   mpi_sdispls = hypre_TAlloc(hypre_int, outdegree + 1, HYPRE_MEMORY_HOST);
+   mpi_recvcounts = hypre_TAlloc(hypre_int, indegree + 1, HYPRE_MEMORY_HOST);
+   mpi_rdispls = hypre_TAlloc(hypre_int, indegree + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_sendcounts[i] = (hypre_int) sendcounts[i];
+      mpi_sdispls[i] = (hypre_int) sdispls[i];
+   }
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_recvcounts[i] = (hypre_int) recvcounts[i];
+      mpi_rdispls[i] = (hypre_int) rdispls[i];
+   }
+   ierr = (HYPRE_Int) MPI_Neighbor_alltoallv(sendbuf, mpi_sendcounts, mpi_sdispls, sendtype,
+                                             recvbuf, mpi_recvcounts, mpi_rdispls, recvtype,
+                                             comm);
+   hypre_TFree(mpi_sendcounts, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_sdispls, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_recvcounts, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_rdispls, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+#endif
+
 #endif
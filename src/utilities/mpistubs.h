@@ -133,6 +133,11 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Dist_graph_create           hypre_MPI_Dist_graph_create
+#define MPI_Dist_graph_neighbors_count  hypre_MPI_Dist_graph_neighbors_count
+#define MPI_Dist_graph_neighbors        hypre_MPI_Dist_graph_neighbors
+#define MPI_Neighbor_alltoall           hypre_MPI_Neighbor_alltoall
+#define MPI_Neighbor_alltoallv          hypre_MPI_Neighbor_alltoallv
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -189,6 +194,9 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+/* neighborhood collectives are trivial without MPI */
+#define  hypre_MPI_HAVE_NEIGHBOR_COLL 1
+
 #else
 
 /******************************************************************************
@@ -241,6 +249,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+/* neighborhood collectives on distributed graph communicators need MPI-3 */
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#define  hypre_MPI_HAVE_NEIGHBOR_COLL 1
+#endif
+
 #endif
 
 /******************************************************************************
@@ -349,6 +362,24 @@ HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, H
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
+#if defined(hypre_MPI_HAVE_NEIGHBOR_COLL)
+HYPRE_Int hypre_MPI_Dist_graph_create( hypre_MPI_Comm comm_old, HYPRE_Int n, HYPRE_Int *sources,
+                                       HYPRE_Int *degrees, HYPRE_Int *destinations,
+                                       HYPRE_Int reorder, hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Dist_graph_neighbors_count( hypre_MPI_Comm comm, HYPRE_Int *indegree,
+                                                HYPRE_Int *outdegree );
+HYPRE_Int hypre_MPI_Dist_graph_neighbors( hypre_MPI_Comm comm, HYPRE_Int maxindegree,
+                                          HYPRE_Int *sources, HYPRE_Int maxoutdegree,
+                                          HYPRE_Int *destinations );
+HYPRE_Int hypre_MPI_Neighbor_alltoall( void *sendbuf, HYPRE_Int sendcount,
+                                       hypre_MPI_Datatype sendtype, void *recvbuf,
+                                       HYPRE_Int recvcount, hypre_MPI_Datatype recvtype,
+                                       hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Neighbor_alltoallv( void *sendbuf, HYPRE_Int *sendcounts, HYPRE_Int *sdispls,
+                                        hypre_MPI_Datatype sendtype, void *recvbuf,
+                                        HYPRE_Int *recvcounts, HYPRE_Int *rdispls,
+                                        hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm );
+#endif
 
 #ifdef __cplusplus
 }
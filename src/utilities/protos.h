@@ -397,6 +397,8 @@ HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
 HYPRE_Int hypre_SetGpuAwareMPI( HYPRE_Int use_gpu_aware_mpi );
 HYPRE_Int hypre_GetGpuAwareMPI(void);
+HYPRE_Int hypre_SetUseNeighborCollectives( HYPRE_Int use_neighbor_coll );
+HYPRE_Int hypre_SetStructOverlapCommComp( HYPRE_Int overlap_comm_comp );
 
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );